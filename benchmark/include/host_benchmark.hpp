@@ -0,0 +1,152 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "perf_regression.hpp"
+
+namespace ck {
+namespace host_bench {
+
+struct HostBenchmark
+{
+    // e.g. "check_err<half_t>"
+    std::string name;
+    // problem description, e.g. "M=256 N=256 K=256"
+    std::string params;
+    // runs the benchmarked code once
+    std::function<void()> run;
+    // bytes read and written by one run, 0 if not meaningful
+    std::size_t num_bytes = 0;
+};
+
+/**
+ * @brief      Times host-side code of the library.
+ *
+ *             Each benchmark is run once to warm up, then timed num_repeat times. A repeat calls
+ *             the benchmark as many times as needed to run for at least MinRepeatTimeMs, so that
+ *             short benchmarks are not dominated by timer resolution. The time of every repeat is
+ *             written as a PerfRecord with op "host_bench", so that results files can be compared
+ *             with "ckProfiler compare".
+ */
+class HostBenchmarkSuite
+{
+    public:
+    static constexpr double MinRepeatTimeMs = 20;
+
+    void Add(const std::string& name,
+             const std::string& params,
+             std::function<void()> run,
+             std::size_t num_bytes = 0)
+    {
+        benchmarks_.push_back({name, params, std::move(run), num_bytes});
+    }
+
+    const std::vector<HostBenchmark>& GetBenchmarks() const { return benchmarks_; }
+
+    // runs the benchmarks whose name contains filter and returns the number that ran
+    std::size_t Run(const std::string& filter, int num_repeat, std::ostream* p_results) const
+    {
+        std::size_t num_run = 0;
+
+        std::cout << std::setw(52) << std::left << "benchmark" << std::setw(36) << "params"
+                  << std::right << std::setw(14) << "mean (ms)" << std::setw(14) << "min (ms)"
+                  << std::setw(12) << "GB/s" << std::endl;
+
+        for(const auto& benchmark : benchmarks_)
+        {
+            if(benchmark.name.find(filter) == std::string::npos)
+            {
+                continue;
+            }
+
+            benchmark.run();
+
+            const std::size_t num_call = GetNumCallPerRepeat(benchmark);
+
+            std::vector<double> times_ms;
+
+            for(int r = 0; r < num_repeat; ++r)
+            {
+                const double time_ms = TimeMs(benchmark, num_call) / num_call;
+
+                times_ms.push_back(time_ms);
+
+                if(p_results != nullptr)
+                {
+                    utils::WritePerfRecord(
+                        *p_results, {"host_bench", benchmark.params, benchmark.name, time_ms});
+                }
+            }
+
+            const auto stats        = utils::GetPerfStats(times_ms);
+            const double min_ms     = *std::min_element(times_ms.begin(), times_ms.end());
+            const double gb_per_sec = benchmark.num_bytes / 1.E6 / stats.mean;
+
+            std::cout << std::setw(52) << std::left << benchmark.name << std::setw(36)
+                      << benchmark.params << std::right << std::fixed << std::setprecision(4)
+                      << std::setw(14) << stats.mean << std::setw(14) << min_ms
+                      << std::setprecision(2) << std::setw(12) << gb_per_sec << std::defaultfloat
+                      << std::endl;
+
+            ++num_run;
+        }
+
+        return num_run;
+    }
+
+    private:
+    static double TimeMs(const HostBenchmark& benchmark, std::size_t num_call)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        for(std::size_t i = 0; i < num_call; ++i)
+        {
+            benchmark.run();
+        }
+
+        const auto end = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    static std::size_t GetNumCallPerRepeat(const HostBenchmark& benchmark)
+    {
+        std::size_t num_call = 1;
+
+        while(num_call < (std::size_t(1) << 20))
+        {
+            const double time_ms = TimeMs(benchmark, num_call);
+
+            if(time_ms >= MinRepeatTimeMs)
+            {
+                break;
+            }
+
+            // aim slightly above the minimum, at most 10x more calls per step
+            const double scale = std::min(10.0, 1.2 * MinRepeatTimeMs / (time_ms + 1e-6));
+
+            num_call = std::max(num_call + 1, static_cast<std::size_t>(num_call * scale));
+        }
+
+        return num_call;
+    }
+
+    std::vector<HostBenchmark> benchmarks_;
+};
+
+// keeps a computed value from being optimized away
+template <typename T>
+void do_not_optimize(const T& value)
+{
+    asm volatile("" : : "r"(&value) : "memory");
+}
+
+} // namespace host_bench
+} // namespace ck
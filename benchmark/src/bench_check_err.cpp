@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "host_benchmark.hpp"
+#include "check_err.hpp"
+#include "data_type.hpp"
+#include "fill.hpp"
+
+using ck::host_bench::HostBenchmarkSuite;
+
+namespace {
+
+constexpr std::size_t size = 1 << 22;
+
+template <typename T>
+std::shared_ptr<std::vector<T>> make_data()
+{
+    auto data = std::make_shared<std::vector<T>>(size);
+
+    ck::utils::FillUniformDistributionIntegerValue<T>{-5.f, 5.f}(data->begin(), data->end());
+
+    return data;
+}
+
+// compares equal vectors, so that every element is checked
+template <typename T>
+void add_check_err_benchmark(HostBenchmarkSuite& suite, const std::string& type_name)
+{
+    auto out = make_data<T>();
+    auto ref = std::make_shared<std::vector<T>>(*out);
+
+    suite.Add("check_err<" + type_name + ">",
+              "size=" + std::to_string(size),
+              [out, ref] { ck::host_bench::do_not_optimize(ck::utils::check_err(*out, *ref)); },
+              2 * size * sizeof(T));
+}
+
+template <typename Y, typename X>
+void add_type_convert_benchmark(HostBenchmarkSuite& suite,
+                                const std::string& y_name,
+                                const std::string& x_name)
+{
+    auto x = make_data<X>();
+    auto y = std::make_shared<std::vector<Y>>(size);
+
+    suite.Add("type_convert<" + y_name + ", " + x_name + ">",
+              "size=" + std::to_string(size),
+              [x, y] {
+                  std::transform(x->begin(), x->end(), y->begin(), [](X v) {
+                      return ck::type_convert<Y>(v);
+                  });
+              },
+              size * (sizeof(X) + sizeof(Y)));
+}
+
+} // namespace
+
+void add_check_err_benchmarks(HostBenchmarkSuite& suite)
+{
+    using ck::bhalf_t;
+    using ck::half_t;
+
+    add_check_err_benchmark<double>(suite, "double");
+    add_check_err_benchmark<float>(suite, "float");
+    add_check_err_benchmark<half_t>(suite, "half_t");
+    add_check_err_benchmark<bhalf_t>(suite, "bhalf_t");
+    add_check_err_benchmark<int32_t>(suite, "int32_t");
+    add_check_err_benchmark<int8_t>(suite, "int8_t");
+
+    add_type_convert_benchmark<half_t, float>(suite, "half_t", "float");
+    add_type_convert_benchmark<float, half_t>(suite, "float", "half_t");
+    add_type_convert_benchmark<bhalf_t, float>(suite, "bhalf_t", "float");
+    add_type_convert_benchmark<float, bhalf_t>(suite, "float", "bhalf_t");
+    add_type_convert_benchmark<int8_t, float>(suite, "int8_t", "float");
+    add_type_convert_benchmark<float, int8_t>(suite, "float", "int8_t");
+}
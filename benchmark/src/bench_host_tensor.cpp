@@ -0,0 +1,163 @@
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "host_benchmark.hpp"
+#include "data_type.hpp"
+#include "fill.hpp"
+#include "host_tensor.hpp"
+#include "host_tensor_generator.hpp"
+#include "host_type_convert.hpp"
+
+using ck::host_bench::HostBenchmarkSuite;
+
+namespace {
+
+std::string lengths_string(const std::vector<std::size_t>& lengths)
+{
+    std::string s;
+
+    for(std::size_t i = 0; i < lengths.size(); ++i)
+    {
+        s += (i == 0 ? "" : "x") + std::to_string(lengths[i]);
+    }
+
+    return s;
+}
+
+std::vector<std::size_t> get_num_threads()
+{
+    const std::size_t num_thread = std::thread::hardware_concurrency();
+
+    if(num_thread > 1)
+    {
+        return {1, num_thread};
+    }
+
+    return {1};
+}
+
+// dispatch overhead dominates small tensors, the work per element large ones
+void add_parallel_tensor_functor_benchmarks(HostBenchmarkSuite& suite)
+{
+    for(std::size_t n : {32, 256, 2048})
+    {
+        for(std::size_t num_thread : get_num_threads())
+        {
+            auto t = std::make_shared<Tensor<float>>(std::vector<std::size_t>{n, n});
+
+            suite.Add("ParallelTensorFunctor",
+                      "lengths=" + lengths_string({n, n}) +
+                          " threads=" + std::to_string(num_thread),
+                      [t, n, num_thread] {
+                          make_ParallelTensorFunctor(
+                              [&](auto i, auto j) { (*t)(i, j) = static_cast<float>(i + j); },
+                              n,
+                              n)(num_thread);
+                      },
+                      n * n * sizeof(float));
+        }
+    }
+}
+
+template <typename T, typename Generator>
+void add_generate_benchmark(HostBenchmarkSuite& suite,
+                            const std::string& name,
+                            const std::vector<std::size_t>& lengths,
+                            Generator g)
+{
+    for(std::size_t num_thread : get_num_threads())
+    {
+        auto t = std::make_shared<Tensor<T>>(lengths);
+
+        suite.Add("GenerateTensorValue<" + name + ">",
+                  "lengths=" + lengths_string(lengths) + " threads=" + std::to_string(num_thread),
+                  [t, g, num_thread] { t->GenerateTensorValue(g, num_thread); },
+                  t->mData.size() * sizeof(T));
+    }
+}
+
+template <typename T, typename Fill>
+void add_fill_benchmark(HostBenchmarkSuite& suite,
+                        const std::string& name,
+                        std::size_t size,
+                        Fill fill)
+{
+    auto data = std::make_shared<std::vector<T>>(size);
+
+    suite.Add(name,
+              "size=" + std::to_string(size),
+              [data, fill] { fill(data->begin(), data->end()); },
+              size * sizeof(T));
+}
+
+template <typename Y, typename X>
+void add_bulk_type_convert_benchmark(HostBenchmarkSuite& suite,
+                                     const std::string& name,
+                                     std::size_t size)
+{
+    for(std::size_t num_thread : get_num_threads())
+    {
+        auto src = std::make_shared<std::vector<X>>(size);
+        auto dst = std::make_shared<std::vector<Y>>(size);
+
+        for(std::size_t i = 0; i < size; ++i)
+        {
+            (*src)[i] = ck::type_convert<X>(static_cast<float>(i % 1000) / 50.f - 10.f);
+        }
+
+        suite.Add("bulk_type_convert<" + name + ">",
+                  "size=" + std::to_string(size) + " threads=" + std::to_string(num_thread),
+                  [src, dst, size, num_thread] {
+                      bulk_type_convert(src->data(), dst->data(), size, num_thread);
+                  },
+                  size * (sizeof(X) + sizeof(Y)));
+    }
+}
+
+} // namespace
+
+void add_host_tensor_benchmarks(HostBenchmarkSuite& suite)
+{
+    using ck::half_t;
+
+    add_parallel_tensor_functor_benchmarks(suite);
+
+    const std::vector<std::size_t> lengths_2d{1024, 1024};
+    const std::vector<std::size_t> lengths_4d{16, 64, 32, 32};
+
+    add_generate_benchmark<float>(
+        suite, "GeneratorTensor_1", lengths_2d, GeneratorTensor_1<float>{1});
+    add_generate_benchmark<float>(
+        suite, "GeneratorTensor_2", lengths_2d, GeneratorTensor_2<float>{-5, 5});
+    add_generate_benchmark<half_t>(
+        suite, "GeneratorTensor_3", lengths_2d, GeneratorTensor_3<half_t>{-0.5, 0.5});
+    add_generate_benchmark<half_t>(
+        suite, "GeneratorTensor_3", lengths_4d, GeneratorTensor_3<half_t>{-0.5, 0.5});
+
+    const std::size_t size = 1 << 22;
+
+    add_fill_benchmark<float>(suite,
+                              "FillUniformDistribution<float>",
+                              size,
+                              ck::utils::FillUniformDistribution<float>{-1.f, 1.f});
+    add_fill_benchmark<half_t>(suite,
+                               "FillUniformDistribution<half_t>",
+                               size,
+                               ck::utils::FillUniformDistribution<half_t>{-1.f, 1.f});
+    add_fill_benchmark<int8_t>(suite,
+                               "FillUniformDistributionIntegerValue<int8_t>",
+                               size,
+                               ck::utils::FillUniformDistributionIntegerValue<int8_t>{-5.f, 5.f});
+    add_fill_benchmark<float>(
+        suite, "FillMonotonicSeq<float>", size, ck::utils::FillMonotonicSeq<float>{0.f, 0.1f});
+    add_fill_benchmark<half_t>(
+        suite, "FillConstant<half_t>", size, ck::utils::FillConstant<half_t>{half_t{1}});
+
+    add_bulk_type_convert_benchmark<ck::f8_t, float>(suite, "f8_t, float", size);
+    add_bulk_type_convert_benchmark<ck::bf8_t, float>(suite, "bf8_t, float", size);
+    add_bulk_type_convert_benchmark<float, ck::f8_t>(suite, "float, f8_t", size);
+    add_bulk_type_convert_benchmark<ck::f8_t, half_t>(suite, "f8_t, half_t", size);
+}
@@ -0,0 +1,100 @@
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "host_benchmark.hpp"
+#include "config.hpp"
+#include "magic_division.hpp"
+
+using ck::host_bench::HostBenchmarkSuite;
+
+namespace {
+
+constexpr std::size_t num_dividend = 1 << 16;
+
+// random dividends, of the bits of a 64-bit generator shifted right by shift
+template <typename DividendType>
+std::shared_ptr<std::vector<DividendType>> make_dividends(int shift)
+{
+    auto dividends = std::make_shared<std::vector<DividendType>>(num_dividend);
+
+    std::mt19937_64 gen(11939);
+
+    for(auto& dividend : *dividends)
+    {
+        dividend = static_cast<DividendType>(gen() >> shift);
+    }
+
+    return dividends;
+}
+
+// divides a buffer of random dividends by a divisor only known at run time, with magic number
+// division and with plain division
+template <typename MagicDivisionType, typename DividendType, typename DivisorType>
+void add_magic_division_benchmark(HostBenchmarkSuite& suite,
+                                  const std::string& name,
+                                  const std::string& type_name,
+                                  const std::shared_ptr<std::vector<DividendType>>& dividends,
+                                  DivisorType divisor)
+{
+    const auto magic_numbers    = MagicDivisionType::CalculateMagicNumbers(divisor);
+    const auto magic_multiplier = magic_numbers[ck::Number<0>{}];
+    const auto magic_shift      = magic_numbers[ck::Number<1>{}];
+
+    const std::string params = type_name + " divisor=" + std::to_string(divisor);
+
+    suite.Add(
+        name + "::naive",
+        params,
+        [dividends, divisor] {
+            uint64_t checksum = 0;
+
+            for(const auto dividend : *dividends)
+            {
+                checksum += static_cast<uint64_t>(dividend / static_cast<DividendType>(divisor));
+            }
+
+            ck::host_bench::do_not_optimize(checksum);
+        },
+        num_dividend * sizeof(DividendType));
+
+    suite.Add(
+        name + "::DoMagicDivision",
+        params,
+        [dividends, magic_multiplier, magic_shift] {
+            uint64_t checksum = 0;
+
+            for(const auto dividend : *dividends)
+            {
+                checksum += static_cast<uint64_t>(
+                    MagicDivisionType::DoMagicDivision(dividend, magic_multiplier, magic_shift));
+            }
+
+            ck::host_bench::do_not_optimize(checksum);
+        },
+        num_dividend * sizeof(DividendType));
+}
+
+} // namespace
+
+void add_magic_division_benchmarks(HostBenchmarkSuite& suite)
+{
+    const auto dividends_i32_non_negative = make_dividends<int32_t>(33);
+    const auto dividends_u32              = make_dividends<uint32_t>(0);
+    const auto dividends_i32              = make_dividends<int32_t>(0);
+    const auto dividends_i64              = make_dividends<int64_t>(0);
+
+    for(uint32_t divisor : {3U, 56U, 3136U, 1000003U})
+    {
+        add_magic_division_benchmark<ck::MagicDivision>(
+            suite, "MagicDivision", "int32_t (31-bit)", dividends_i32_non_negative, divisor);
+        add_magic_division_benchmark<ck::MagicDivision32BitFullRange>(
+            suite, "MagicDivision32BitFullRange", "uint32_t", dividends_u32, divisor);
+        add_magic_division_benchmark<ck::MagicDivision32BitFullRange>(
+            suite, "MagicDivision32BitFullRange", "int32_t", dividends_i32, divisor);
+        add_magic_division_benchmark<ck::MagicDivision64Bit>(
+            suite, "MagicDivision64Bit", "int64_t", dividends_i64, uint64_t{divisor});
+    }
+}
@@ -0,0 +1,351 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "host_benchmark.hpp"
+#include "data_type.hpp"
+#include "element_wise_operation.hpp"
+#include "host_reduction.hpp"
+#include "host_tensor.hpp"
+#include "host_tensor_generator.hpp"
+#include "reduction_enums.hpp"
+#include "reduction_operator_mapping.hpp"
+#include "reference_batched_gemm.hpp"
+#include "reference_conv_backward_weight.hpp"
+#include "reference_conv_bwd_data.hpp"
+#include "reference_conv_fwd.hpp"
+#include "reference_gemm.hpp"
+#include "reference_layernorm.hpp"
+#include "reference_softmax.hpp"
+
+using ck::host_bench::HostBenchmarkSuite;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+namespace {
+
+template <typename T>
+std::shared_ptr<Tensor<T>> make_tensor(const std::vector<std::size_t>& lengths)
+{
+    auto t = std::make_shared<Tensor<T>>(lengths);
+
+    t->GenerateTensorValue(GeneratorTensor_2<T>{-5, 5});
+
+    return t;
+}
+
+template <typename T>
+std::size_t num_bytes(const Tensor<T>& t)
+{
+    return t.mData.size() * sizeof(T);
+}
+
+template <typename T, typename AccT>
+void add_gemm_benchmark(HostBenchmarkSuite& suite,
+                        const std::string& type_name,
+                        std::size_t M,
+                        std::size_t N,
+                        std::size_t K)
+{
+    using ReferenceGemm = ck::tensor_operation::host::
+        ReferenceGemm<T, T, T, AccT, PassThrough, PassThrough, PassThrough>;
+
+    auto a = make_tensor<T>({M, K});
+    auto b = make_tensor<T>({K, N});
+    auto c = make_tensor<T>({M, N});
+
+    suite.Add("ReferenceGemm<" + type_name + ">",
+              "M=" + std::to_string(M) + " N=" + std::to_string(N) + " K=" + std::to_string(K),
+              [a, b, c] {
+                  auto argument = ReferenceGemm::MakeArgument(
+                      *a, *b, *c, PassThrough{}, PassThrough{}, PassThrough{});
+
+                  ReferenceGemm::MakeInvoker().Run(argument);
+              },
+              num_bytes(*a) + num_bytes(*b) + num_bytes(*c));
+}
+
+void add_batched_gemm_benchmark(HostBenchmarkSuite& suite,
+                                std::size_t G,
+                                std::size_t M,
+                                std::size_t N,
+                                std::size_t K)
+{
+    using ReferenceBatchedGemm = ck::tensor_operation::host::
+        ReferenceBatchedGemm<float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    auto a = make_tensor<float>({G, M, K});
+    auto b = make_tensor<float>({G, K, N});
+    auto c = make_tensor<float>({G, M, N});
+
+    suite.Add("ReferenceBatchedGemm<float>",
+              "G=" + std::to_string(G) + " M=" + std::to_string(M) + " N=" + std::to_string(N) +
+                  " K=" + std::to_string(K),
+              [a, b, c] {
+                  auto argument = ReferenceBatchedGemm::MakeArgument(
+                      *a, *b, *c, PassThrough{}, PassThrough{}, PassThrough{});
+
+                  ReferenceBatchedGemm::MakeInvoker().Run(argument);
+              },
+              num_bytes(*a) + num_bytes(*b) + num_bytes(*c));
+}
+
+// 2D convolution with YX x YX filter, stride 1 and padding (YX - 1) / 2, so that Ho = Hi and
+// Wo = Wi for odd YX
+struct ConvShape
+{
+    std::size_t N;
+    std::size_t C;
+    std::size_t K;
+    std::size_t HW;
+    std::size_t YX = 3;
+
+    ck::index_t GetPad() const { return static_cast<ck::index_t>((YX - 1) / 2); }
+
+    std::string GetParams() const
+    {
+        return "N=" + std::to_string(N) + " C=" + std::to_string(C) + " K=" + std::to_string(K) +
+               " HW=" + std::to_string(HW) + " Y=X=" + std::to_string(YX);
+    }
+};
+
+template <typename ReferenceConv>
+void add_conv_benchmark(HostBenchmarkSuite& suite, const std::string& name, const ConvShape& s)
+{
+    auto in  = make_tensor<float>({s.N, s.C, s.HW, s.HW});
+    auto wei = make_tensor<float>({s.K, s.C, s.YX, s.YX});
+    auto out = make_tensor<float>({s.N, s.K, s.HW, s.HW});
+
+    const ck::index_t pad = s.GetPad();
+
+    suite.Add(name,
+              s.GetParams(),
+              [in, wei, out, pad] {
+                  auto argument = ReferenceConv::MakeArgument(*in,
+                                                              *wei,
+                                                              *out,
+                                                              {1, 1},
+                                                              {1, 1},
+                                                              {pad, pad},
+                                                              {pad, pad},
+                                                              PassThrough{},
+                                                              PassThrough{},
+                                                              PassThrough{});
+
+                  ReferenceConv::MakeInvoker().Run(argument);
+              },
+              num_bytes(*in) + num_bytes(*wei) + num_bytes(*out));
+}
+
+// ReferenceConvFwd with a given algorithm, to compare them on the same shape
+void add_conv_fwd_algorithm_benchmark(HostBenchmarkSuite& suite,
+                                      ck::tensor_operation::host::ConvFwdAlgorithm algorithm,
+                                      const ConvShape& s)
+{
+    using ReferenceConvFwd = ck::tensor_operation::host::
+        ReferenceConvFwd<float, float, float, PassThrough, PassThrough, PassThrough, 2>;
+
+    auto in  = make_tensor<float>({s.N, s.C, s.HW, s.HW});
+    auto wei = make_tensor<float>({s.K, s.C, s.YX, s.YX});
+    auto out = make_tensor<float>({s.N, s.K, s.HW, s.HW});
+
+    const ck::index_t pad = s.GetPad();
+
+    suite.Add("ReferenceConvFwd<float, 2D, " +
+                  ck::tensor_operation::host::GetConvFwdAlgorithmString(algorithm) + ">",
+              s.GetParams(),
+              [in, wei, out, pad, algorithm] {
+                  auto argument = ReferenceConvFwd::MakeArgument(*in,
+                                                                 *wei,
+                                                                 *out,
+                                                                 {1, 1},
+                                                                 {1, 1},
+                                                                 {pad, pad},
+                                                                 {pad, pad},
+                                                                 PassThrough{},
+                                                                 PassThrough{},
+                                                                 PassThrough{},
+                                                                 algorithm);
+
+                  ReferenceConvFwd::MakeInvoker().Run(argument);
+              },
+              num_bytes(*in) + num_bytes(*wei) + num_bytes(*out));
+}
+
+void add_softmax_benchmark(HostBenchmarkSuite& suite, std::size_t M, std::size_t N)
+{
+    using ReferenceSoftmax = ck::tensor_operation::host::ReferenceSoftmax<float, float, float>;
+
+    auto in  = make_tensor<float>({M, N});
+    auto out = make_tensor<float>({M, N});
+
+    suite.Add("ReferenceSoftmax<float>",
+              "M=" + std::to_string(M) + " N=" + std::to_string(N) + " reduce=1",
+              [in, out] {
+                  auto argument = ReferenceSoftmax::MakeArgument(*in, *out, 1.f, 0.f, 2, {1});
+
+                  ReferenceSoftmax::MakeInvoker().Run(argument);
+              },
+              num_bytes(*in) + num_bytes(*out));
+}
+
+// layernorm of x + residual over the last dimension, with gamma and beta
+void add_layernorm_benchmark(HostBenchmarkSuite& suite, std::size_t M, std::size_t N)
+{
+    using ReferenceLayernorm =
+        ck::tensor_operation::host::ReferenceLayernorm<float, float, float, float, float>;
+
+    auto x        = make_tensor<float>({M, N});
+    auto residual = make_tensor<float>({M, N});
+    auto gamma    = make_tensor<float>({N});
+    auto beta     = make_tensor<float>({N});
+    auto y        = make_tensor<float>({M, N});
+
+    suite.Add("ReferenceLayernorm<float>",
+              "M=" + std::to_string(M) + " N=" + std::to_string(N) + " residual",
+              [x, residual, gamma, beta, y] {
+                  auto argument = ReferenceLayernorm::MakeArgument(
+                      *x, *residual, gamma.get(), beta.get(), *y, nullptr, {1}, 1e-5f);
+
+                  ReferenceLayernorm::MakeInvoker().Run(argument);
+              },
+              num_bytes(*x) + num_bytes(*residual) + num_bytes(*y));
+}
+
+// reduces a 3D tensor over its last NumReduceDim dimensions
+template <ck::ReduceTensorOp ReduceOpId, int NumReduceDim, bool OutputIndex>
+void add_reduction_benchmark(HostBenchmarkSuite& suite,
+                             const std::string& name,
+                             const std::vector<std::size_t>& lengths)
+{
+    using ck::reduce_binary_operator;
+    using ck::reduce_unary_operator;
+
+    constexpr int Rank = 3;
+
+    using InElementwiseOperation =
+        typename reduce_unary_operator<ReduceOpId, true, true>::InElementwiseOperation;
+    using AccElementwiseOperation =
+        typename reduce_unary_operator<ReduceOpId, true, true>::AccElementwiseOperation;
+
+    using ReduceOperation = typename reduce_binary_operator<ReduceOpId>::opType;
+
+    using HostReduction = ReductionHost<float,
+                                        float,
+                                        float,
+                                        ReduceOperation,
+                                        InElementwiseOperation,
+                                        AccElementwiseOperation,
+                                        Rank,
+                                        NumReduceDim,
+                                        false,
+                                        OutputIndex>;
+
+    std::vector<int> invariant_dims;
+    std::vector<int> reduce_dims;
+    std::vector<std::size_t> out_lengths;
+    int32_t reduce_length = 1;
+
+    for(int i = 0; i < Rank; ++i)
+    {
+        if(i < Rank - NumReduceDim)
+        {
+            invariant_dims.push_back(i);
+            out_lengths.push_back(lengths[i]);
+        }
+        else
+        {
+            reduce_dims.push_back(i);
+            reduce_length *= static_cast<int32_t>(lengths[i]);
+        }
+    }
+
+    auto in      = make_tensor<float>(lengths);
+    auto out     = make_tensor<float>(out_lengths);
+    auto indices = std::make_shared<Tensor<int32_t>>(out_lengths);
+
+    auto reduction =
+        std::make_shared<HostReduction>(in->mDesc, out->mDesc, invariant_dims, reduce_dims);
+
+    const auto elementwise_ops =
+        reduce_unary_operator<ReduceOpId, true, true>::GetElementwiseOperator(reduce_length);
+
+    std::string params;
+
+    for(std::size_t i = 0; i < lengths.size(); ++i)
+    {
+        params += (i == 0 ? "lengths=" : "x") + std::to_string(lengths[i]);
+    }
+
+    params += " reduce=" + std::to_string(NumReduceDim);
+
+    suite.Add(name,
+              params,
+              [in, out, indices, reduction, elementwise_ops] {
+                  reduction->Run(1.f,
+                                 in->mData.data(),
+                                 0.f,
+                                 out->mData.data(),
+                                 indices->mData.data(),
+                                 std::get<0>(elementwise_ops),
+                                 std::get<1>(elementwise_ops));
+              },
+              num_bytes(*in) + num_bytes(*out));
+}
+
+} // namespace
+
+void add_reference_benchmarks(HostBenchmarkSuite& suite)
+{
+    using namespace ck::tensor_operation::host;
+
+    add_reduction_benchmark<ck::ReduceTensorOp::ADD, 1, false>(
+        suite, "ReductionHost<ADD>", {64, 256, 256});
+    add_reduction_benchmark<ck::ReduceTensorOp::ADD, 2, false>(
+        suite, "ReductionHost<ADD>", {64, 256, 256});
+    add_reduction_benchmark<ck::ReduceTensorOp::AVG, 1, false>(
+        suite, "ReductionHost<AVG>", {64, 256, 256});
+    add_reduction_benchmark<ck::ReduceTensorOp::MAX, 1, true>(
+        suite, "ReductionHost<MAX, index>", {64, 256, 256});
+
+    add_gemm_benchmark<float, float>(suite, "float", 256, 256, 256);
+    add_gemm_benchmark<float, float>(suite, "float", 1024, 64, 512);
+    add_gemm_benchmark<ck::half_t, float>(suite, "half_t", 256, 256, 256);
+
+    add_batched_gemm_benchmark(suite, 8, 128, 128, 128);
+
+    const ConvShape conv_shape{4, 64, 64, 28};
+
+    add_conv_benchmark<
+        ReferenceConvFwd<float, float, float, PassThrough, PassThrough, PassThrough, 2>>(
+        suite, "ReferenceConvFwd<float, 2D>", conv_shape);
+    add_conv_benchmark<
+        ReferenceConvBwdData<float, float, float, float, PassThrough, PassThrough, PassThrough, 2>>(
+        suite, "ReferenceConvBwdData<float, 2D>", conv_shape);
+    add_conv_benchmark<
+        ReferenceConvBwdWeight<float, float, float, PassThrough, PassThrough, PassThrough, 2>>(
+        suite, "ReferenceConvBwdWeight<float, 2D>", conv_shape);
+
+    // the fast algorithms of ReferenceConvFwd against Direct, for the shapes they are selected for
+    for(const ConvShape& shape : {ConvShape{4, 64, 64, 56, 3},
+                                  ConvShape{4, 32, 32, 56, 5},
+                                  ConvShape{2, 16, 16, 64, 11}})
+    {
+        for(auto algorithm : {ConvFwdAlgorithm::Direct,
+                              ConvFwdAlgorithm::Winograd,
+                              ConvFwdAlgorithm::Fft,
+                              ConvFwdAlgorithm::Auto})
+        {
+            if(algorithm != ConvFwdAlgorithm::Winograd || shape.YX <= 5)
+            {
+                add_conv_fwd_algorithm_benchmark(suite, algorithm, shape);
+            }
+        }
+    }
+
+    add_softmax_benchmark(suite, 256, 1024);
+    add_softmax_benchmark(suite, 4096, 64);
+
+    add_layernorm_benchmark(suite, 256, 4096);
+    add_layernorm_benchmark(suite, 8192, 64);
+}
@@ -0,0 +1,305 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "host_benchmark.hpp"
+#include "common_header.hpp"
+#include "tensor_descriptor.hpp"
+#include "tensor_descriptor_helper.hpp"
+
+using ck::index_t;
+using ck::Number;
+using ck::host_bench::HostBenchmarkSuite;
+
+namespace {
+
+struct MergeV1CarryCheck
+{
+    static constexpr const char* Name = "Merge_v1_carry_check";
+
+    template <typename LowLengths>
+    static constexpr auto Make(const LowLengths& low_lengths)
+    {
+        return ck::make_merge_transform_v1_carry_check(low_lengths);
+    }
+};
+
+struct MergeV2MagicDivision
+{
+    static constexpr const char* Name = "Merge_v2_magic_division";
+
+    template <typename LowLengths>
+    static constexpr auto Make(const LowLengths& low_lengths)
+    {
+        return ck::Merge_v2_magic_division<LowLengths>{low_lengths};
+    }
+};
+
+struct MergeV2r2MagicDivision
+{
+    static constexpr const char* Name = "Merge_v2r2_magic_division";
+
+    template <typename LowLengths>
+    static constexpr auto Make(const LowLengths& low_lengths)
+    {
+        return ck::Merge_v2r2_magic_division<LowLengths>{low_lengths};
+    }
+};
+
+struct MergeV3DivisionMod
+{
+    static constexpr const char* Name = "Merge_v3_division_mod";
+
+    template <typename LowLengths>
+    static constexpr auto Make(const LowLengths& low_lengths)
+    {
+        return ck::make_merge_transform_v3_division_mod(low_lengths);
+    }
+};
+
+// the variant picked by merge_transform_selector
+struct MergeSelected
+{
+    static constexpr const char* Name = "make_merge_transform";
+
+    template <typename LowLengths>
+    static constexpr auto Make(const LowLengths& low_lengths)
+    {
+        return ck::make_merge_transform(low_lengths);
+    }
+};
+
+constexpr index_t num_index = 1 << 16;
+
+// CalculateLowerIndex() on random upper indices, and UpdateLowerIndex() walking the upper index
+// with a constant step, as a slice window does
+template <typename MergeVariant, typename LowLengths>
+void add_merge_benchmarks(HostBenchmarkSuite& suite,
+                          const std::string& params,
+                          const LowLengths& low_lengths,
+                          index_t step)
+{
+    const auto merge = MergeVariant::Make(low_lengths);
+
+    using Merge = ck::remove_cvref_t<decltype(merge)>;
+
+    const index_t up_length = merge.GetUpperLengths()[Number<0>{}];
+
+    auto idx_up = std::make_shared<std::vector<index_t>>(num_index);
+
+    std::mt19937 gen(11939);
+    std::uniform_int_distribution<index_t> dis(0, up_length - 1);
+
+    for(auto& i : *idx_up)
+    {
+        i = dis(gen);
+    }
+
+    suite.Add(std::string(MergeVariant::Name) + "::CalculateLowerIndex",
+              params,
+              [merge, idx_up] {
+                  constexpr index_t NDimLow = Merge::GetNumOfLowerDimension();
+
+                  ck::MultiIndex<NDimLow> idx_low;
+
+                  index_t sum = 0;
+
+                  for(const index_t i : *idx_up)
+                  {
+                      merge.CalculateLowerIndex(idx_low, ck::make_multi_index(i));
+
+                      ck::static_for<0, NDimLow, 1>{}([&](auto d) { sum += idx_low[d]; });
+                  }
+
+                  ck::host_bench::do_not_optimize(sum);
+              });
+
+    suite.Add(std::string(MergeVariant::Name) + "::UpdateLowerIndex",
+              params + " step=" + std::to_string(step),
+              [merge, step] {
+                  constexpr index_t NDimLow = Merge::GetNumOfLowerDimension();
+
+                  const index_t up_index_end = merge.GetUpperLengths()[Number<0>{}];
+
+                  ck::MultiIndex<NDimLow> idx_low;
+                  ck::MultiIndex<NDimLow> idx_diff_low;
+
+                  index_t up_index = 0;
+                  index_t sum      = 0;
+
+                  merge.CalculateLowerIndex(idx_low, ck::make_multi_index(up_index));
+
+                  for(index_t i = 0; i < num_index; ++i)
+                  {
+                      if(up_index + step >= up_index_end)
+                      {
+                          up_index = 0;
+                          merge.CalculateLowerIndex(idx_low, ck::make_multi_index(up_index));
+                      }
+
+                      up_index += step;
+
+                      merge.UpdateLowerIndex(idx_diff_low,
+                                             ck::make_multi_index(step),
+                                             idx_low,
+                                             ck::make_multi_index(up_index),
+                                             Number<0>{});
+
+                      ck::static_for<0, NDimLow, 1>{}([&](auto d) { sum += idx_low[d]; });
+                  }
+
+                  ck::host_bench::do_not_optimize(sum);
+              });
+}
+
+template <typename MergeVariant>
+void add_merge_variant_benchmarks(HostBenchmarkSuite& suite)
+{
+    // GemmK = Y * X * C and GemmM = N * Ho * Wo of a 3x3 convolution, known at run time
+    add_merge_benchmarks<MergeVariant>(
+        suite, "YXC=3x3x256 runtime", ck::make_tuple(index_t{3}, index_t{3}, index_t{256}), 32);
+    add_merge_benchmarks<MergeVariant>(suite,
+                                       "NHoWo=128x28x28 runtime",
+                                       ck::make_tuple(index_t{128}, index_t{28}, index_t{28}),
+                                       256);
+
+    // thread and block cluster descriptors, known at compile time
+    add_merge_benchmarks<MergeVariant>(
+        suite, "3x3x64 compile-time", ck::make_tuple(Number<3>{}, Number<3>{}, Number<64>{}), 32);
+    add_merge_benchmarks<MergeVariant>(
+        suite, "4x64x8 compile-time", ck::make_tuple(Number<4>{}, Number<64>{}, Number<8>{}), 32);
+}
+
+struct ConvFwdShape
+{
+    index_t N;
+    index_t C;
+    index_t HiWi;
+    index_t YX;
+    index_t Stride;
+
+    index_t GetHoWo() const { return (HiWi + 2 * (YX / 2) - YX) / Stride + 1; }
+
+    std::string GetParams() const
+    {
+        return "N=" + std::to_string(N) + " C=" + std::to_string(C) + " HiWi=" +
+               std::to_string(HiWi) + " YX=" + std::to_string(YX) + " S=" + std::to_string(Stride);
+    }
+};
+
+// GemmK0 x GemmM x GemmK1 descriptor of the NHWC input of a forward convolution, as made by
+// transform_forward_convolution_into_gemm_v4r4r4_nhwc_kyxc_nhwk(), with the given Merge variant
+template <typename MergeVariant, index_t GemmK1>
+auto make_conv_fwd_in_gemmk0_gemmm_gemmk1_desc(const ConvFwdShape& s)
+{
+    using ck::make_tuple;
+    using ck::Sequence;
+
+    const index_t N      = s.N;
+    const index_t C      = s.C;
+    const index_t Hi     = s.HiWi;
+    const index_t Wi     = s.HiWi;
+    const index_t Y      = s.YX;
+    const index_t X      = s.YX;
+    const index_t Ho     = s.GetHoWo();
+    const index_t Wo     = s.GetHoWo();
+    const index_t Pad    = s.YX / 2;
+    const index_t GemmM  = N * Ho * Wo;
+    const index_t GemmK0 = Y * X * C / GemmK1;
+
+    const auto in_n_hi_wi_c_desc =
+        ck::make_naive_tensor_descriptor_packed(make_tuple(N, Hi, Wi, C));
+
+    const auto in_n_hip_wip_c_desc = ck::transform_tensor_descriptor(
+        in_n_hi_wi_c_desc,
+        make_tuple(ck::make_pass_through_transform(N),
+                   ck::make_pad_transform(Hi, Pad, Pad),
+                   ck::make_pad_transform(Wi, Pad, Pad),
+                   ck::make_pass_through_transform(C)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}, Sequence<3>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}, Sequence<3>{}));
+
+    const auto in_n_y_ho_x_wo_c_desc = ck::transform_tensor_descriptor(
+        in_n_hip_wip_c_desc,
+        make_tuple(ck::make_pass_through_transform(N),
+                   ck::make_embed_transform(make_tuple(Y, Ho), make_tuple(index_t{1}, s.Stride)),
+                   ck::make_embed_transform(make_tuple(X, Wo), make_tuple(index_t{1}, s.Stride)),
+                   ck::make_pass_through_transform(C)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}, Sequence<3>{}),
+        make_tuple(Sequence<0>{}, Sequence<1, 2>{}, Sequence<3, 4>{}, Sequence<5>{}));
+
+    const auto in_gemmk_gemmm_desc = ck::transform_tensor_descriptor(
+        in_n_y_ho_x_wo_c_desc,
+        make_tuple(MergeVariant::Make(make_tuple(Y, X, C)),
+                   MergeVariant::Make(make_tuple(N, Ho, Wo))),
+        make_tuple(Sequence<1, 3, 5>{}, Sequence<0, 2, 4>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+    return ck::transform_tensor_descriptor(
+        in_gemmk_gemmm_desc,
+        make_tuple(ck::make_unmerge_transform(make_tuple(GemmK0, Number<GemmK1>{})),
+                   ck::make_pass_through_transform(GemmM)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}),
+        make_tuple(Sequence<0, 2>{}, Sequence<1>{}));
+}
+
+// move_tensor_coordinate() of the A slice window of an implicit GEMM convolution: along GemmK0 by
+// KPerBlock, as the main loop does, for num_row rows of GemmM
+template <typename MergeVariant>
+void add_conv_fwd_coordinate_benchmark(HostBenchmarkSuite& suite, const ConvFwdShape& s)
+{
+    constexpr index_t GemmK1    = 8;
+    constexpr index_t KPerBlock = 4;
+    constexpr index_t num_row   = 64;
+
+    const auto desc = make_conv_fwd_in_gemmk0_gemmm_gemmk1_desc<MergeVariant, GemmK1>(s);
+
+    const index_t GemmK0 = desc.GetLength(Number<0>{});
+    const index_t GemmM  = desc.GetLength(Number<1>{});
+
+    const auto step = ck::make_tensor_coordinate_step(desc, ck::make_multi_index(KPerBlock, 0, 0));
+
+    suite.Add(std::string("move_tensor_coordinate<") + MergeVariant::Name + ">",
+              s.GetParams() + " step=K0",
+              [desc, step, GemmK0, GemmM] {
+                  index_t sum = 0;
+
+                  for(index_t r = 0; r < num_row; ++r)
+                  {
+                      const index_t m = r * (GemmM / num_row);
+
+                      auto coord = ck::make_tensor_coordinate(desc, ck::make_multi_index(0, m, 0));
+
+                      for(index_t k0 = KPerBlock; k0 < GemmK0; k0 += KPerBlock)
+                      {
+                          ck::move_tensor_coordinate(desc, coord, step);
+
+                          sum += coord.GetOffset();
+                      }
+                  }
+
+                  ck::host_bench::do_not_optimize(sum);
+              });
+}
+
+} // namespace
+
+void add_tensor_coordinate_benchmarks(HostBenchmarkSuite& suite)
+{
+    add_merge_variant_benchmarks<MergeV1CarryCheck>(suite);
+    add_merge_variant_benchmarks<MergeV2MagicDivision>(suite);
+    add_merge_variant_benchmarks<MergeV2r2MagicDivision>(suite);
+    add_merge_variant_benchmarks<MergeV3DivisionMod>(suite);
+    add_merge_variant_benchmarks<MergeSelected>(suite);
+
+    // 3x3 layers of ResNet-50
+    for(const auto& shape : {ConvFwdShape{128, 64, 56, 3, 1}, ConvFwdShape{128, 256, 14, 3, 1}})
+    {
+        add_conv_fwd_coordinate_benchmark<MergeV1CarryCheck>(suite, shape);
+        add_conv_fwd_coordinate_benchmark<MergeV2MagicDivision>(suite, shape);
+        add_conv_fwd_coordinate_benchmark<MergeV2r2MagicDivision>(suite, shape);
+        add_conv_fwd_coordinate_benchmark<MergeV3DivisionMod>(suite, shape);
+        add_conv_fwd_coordinate_benchmark<MergeSelected>(suite, shape);
+    }
+}
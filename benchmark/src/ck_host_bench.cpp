@@ -0,0 +1,62 @@
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "host_benchmark.hpp"
+
+void add_host_tensor_benchmarks(ck::host_bench::HostBenchmarkSuite&);
+void add_check_err_benchmarks(ck::host_bench::HostBenchmarkSuite&);
+void add_reference_benchmarks(ck::host_bench::HostBenchmarkSuite&);
+void add_tensor_coordinate_benchmarks(ck::host_bench::HostBenchmarkSuite&);
+void add_magic_division_benchmarks(ck::host_bench::HostBenchmarkSuite&);
+
+int main(int argc, char* argv[])
+{
+    if(argc > 4)
+    {
+        printf("arg1: filter, runs the benchmarks whose name contains it (default: all)\n");
+        printf("arg2: number of timed repeats (default: 5)\n");
+        printf("arg3: results file, to be compared with \"ckProfiler compare\" (default: none)\n");
+        exit(1);
+    }
+
+    std::string filter   = argc > 1 ? argv[1] : "";
+    const int num_repeat = argc > 2 ? std::stoi(argv[2]) : 5;
+
+    if(filter == "all")
+    {
+        filter = "";
+    }
+
+    ck::host_bench::HostBenchmarkSuite suite;
+
+    add_host_tensor_benchmarks(suite);
+    add_check_err_benchmarks(suite);
+    add_reference_benchmarks(suite);
+    add_tensor_coordinate_benchmarks(suite);
+    add_magic_division_benchmarks(suite);
+
+    std::ofstream results;
+
+    if(argc > 3)
+    {
+        results.open(argv[3], std::ios::app);
+
+        if(!results)
+        {
+            std::cout << "cannot open " << argv[3] << std::endl;
+            return 1;
+        }
+    }
+
+    const std::size_t num_run = suite.Run(filter, num_repeat, argc > 3 ? &results : nullptr);
+
+    if(num_run == 0)
+    {
+        std::cout << "no benchmark matches \"" << filter << "\"" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -15,7 +15,7 @@
 #include "device_tensor.hpp"
 #include "device_gemm_xdl_cshuffle.hpp"
 #include "element_wise_operation.hpp"
-#include "reference_gemm.hpp"
+#include "reference_integer_gemm.hpp"
 #include "gemm_specialization.hpp"
 
 struct RequantReluRequant
@@ -100,13 +100,12 @@ using DeviceGemmInstance = ck::tensor_operation::device::DeviceGemm_Xdl_CShuffle
      16>;                        // index_t CShuffleBlockTransferScalarPerVector_NPerBlock>
 // clang-format on
 
-using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
-                                                                        BDataType,
-                                                                        CDataType,
-                                                                        float,
-                                                                        PassThrough,
-                                                                        PassThrough,
-                                                                        RequantReluRequant>;
+using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceIntegerGemm<ADataType,
+                                                                               BDataType,
+                                                                               CDataType,
+                                                                               AccDataType,
+                                                                               CShuffleDataType,
+                                                                               RequantReluRequant>;
 
 int main(int argc, char* argv[])
 {
@@ -244,8 +243,7 @@ int main(int argc, char* argv[])
         auto ref_gemm    = ReferenceGemmInstance{};
         auto ref_invoker = ref_gemm.MakeInvoker();
 
-        auto ref_argument = ref_gemm.MakeArgument(
-            a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, c_element_op);
+        auto ref_argument = ref_gemm.MakeArgument(a_m_k, b_k_n, c_m_n_host_result, c_element_op);
 
         ref_invoker.Run(ref_argument);
 
@@ -15,7 +15,7 @@
 #include "device_tensor.hpp"
 #include "device_grouped_gemm_xdl.hpp"
 #include "element_wise_operation.hpp"
-#include "reference_gemm.hpp"
+#include "reference_grouped_gemm.hpp"
 #include "gemm_specialization.hpp"
 
 template <ck::index_t... Is>
@@ -55,8 +55,13 @@ using DeviceGemmInstance = ck::tensor_operation::device::DeviceGroupedGemmXdl
         <   F16,   F16,   F16,     F32,     Row,     Col,     Row, PassThrough, PassThrough, PassThrough,   GemmDefault,   256,   256,   128,     4,  8,   32,   32,    4,    2,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,      true,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,              8,              8,      true,               7,               1,        1>;
 // clang-format on
 
-using ReferenceGemmInstance = ck::tensor_operation::host::
-    ReferenceGemm<ADataType, BDataType, CDataType, AccDataType, AElementOp, BElementOp, CElementOp>;
+using ReferenceGroupedGemmInstance = ck::tensor_operation::host::ReferenceGroupedGemm<ADataType,
+                                                                                      BDataType,
+                                                                                      CDataType,
+                                                                                      AccDataType,
+                                                                                      AElementOp,
+                                                                                      BElementOp,
+                                                                                      CElementOp>;
 
 int main(int argc, char* argv[])
 {
@@ -219,20 +224,22 @@ int main(int argc, char* argv[])
     bool pass = true;
     if(do_verification)
     {
+        auto ref_gemm    = ReferenceGroupedGemmInstance{};
+        auto ref_invoker = ref_gemm.MakeInvoker();
+
+        auto ref_argument = ref_gemm.MakeArgument(gemm_shapes,
+                                                  a_tensors,
+                                                  b_tensors,
+                                                  c_host_tensors,
+                                                  a_element_op,
+                                                  b_element_op,
+                                                  c_element_op);
+
+        ref_invoker.Run(ref_argument);
+
         for(std::size_t i = 0; i < gemm_shapes.size(); i++)
         {
             c_tensors_device[i]->FromDevice(c_device_tensors[i].mData.data());
-            auto ref_gemm    = ReferenceGemmInstance{};
-            auto ref_invoker = ref_gemm.MakeInvoker();
-
-            auto ref_argument = ref_gemm.MakeArgument(a_tensors[i],
-                                                      b_tensors[i],
-                                                      c_host_tensors[i],
-                                                      a_element_op,
-                                                      b_element_op,
-                                                      c_element_op);
-
-            ref_invoker.Run(ref_argument);
             pass &= ck::utils::check_err(c_device_tensors[i].mData, c_host_tensors[i].mData);
         }
     }
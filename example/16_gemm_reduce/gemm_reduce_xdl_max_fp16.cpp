@@ -12,7 +12,7 @@
 #include "device_tensor.hpp"
 #include "device_gemm_reduce_xdl_cshuffle.hpp"
 #include "element_wise_operation.hpp"
-#include "reference_gemm.hpp"
+#include "reference_gemm_reduce.hpp"
 #include "gemm_specialization.hpp"
 
 template <ck::index_t... Is>
@@ -57,13 +57,19 @@ using DeviceGemmReduceInstance = ck::tensor_operation::device::DeviceGemmReduce_
         <     Row,     Col,     Row,  F16,   F16,   F16,      F32,      F32, ReduceAccDataType,   DPtrsGlobal,  AElementOp,  BElementOp,  CElementOp, DsReduceOp,   DsElementOp,  DsElementOp,  DGlobalMemOp, GemmSpecialization,        1,   256,   256,   128,    32,   8,   8,   32,   32,    4,    2,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,              8,              8,         1,           1,           1,               S<1, 32, 1, 8>,               8,             S<64, 4>,                         4,                            1>;
 // clang-format on
 
-using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
-                                                                        BDataType,
-                                                                        CDataType,
-                                                                        GemmAccDataType,
-                                                                        AElementOp,
-                                                                        BElementOp,
-                                                                        CElementOp>;
+using ReferenceGemmReduceInstance =
+    ck::tensor_operation::host::ReferenceGemmReduce<ADataType,
+                                                    BDataType,
+                                                    CDataType,
+                                                    GemmAccDataType,
+                                                    ReduceAccDataType,
+                                                    DDataType,
+                                                    AElementOp,
+                                                    BElementOp,
+                                                    CElementOp,
+                                                    DsReduceOp,
+                                                    DsElementOp,
+                                                    DsElementOp>;
 
 template <typename ADataType, typename BDataType, typename CDataType, typename DDataType>
 void DumpGemmLayerNormPerf(float gemm_reduce_time, int M, int N, int K)
@@ -222,30 +228,21 @@ int main(int argc, char* argv[])
         c_device_buf.FromDevice(c_m_n_device_result.mData.data());
         d_device_buf.FromDevice(d_m_device_result.mData.data());
 
-        auto ref_gemm    = ReferenceGemmInstance{};
-        auto ref_invoker = ref_gemm.MakeInvoker();
+        auto ref_gemm_reduce = ReferenceGemmReduceInstance{};
+        auto ref_invoker     = ref_gemm_reduce.MakeInvoker();
 
-        auto ref_argument = ref_gemm.MakeArgument(
-            a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, c_element_op);
+        auto ref_argument = ref_gemm_reduce.MakeArgument(a_m_k,
+                                                         b_k_n,
+                                                         c_m_n_host_result,
+                                                         {&d_m_host_result},
+                                                         a_element_op,
+                                                         b_element_op,
+                                                         c_element_op,
+                                                         ds_element_op,
+                                                         ds_element_op);
 
         ref_invoker.Run(ref_argument);
 
-        auto d_reduce_op = DsReduceOp{}[ck::Number<0>{}];
-
-        for(int m = 0; m < M; ++m)
-        {
-            ReduceAccDataType d_acc = d_reduce_op.GetIdentityValue<ReduceAccDataType>();
-
-            for(int n = 0; n < N; ++n)
-            {
-                ReduceAccDataType curr_val =
-                    ck::type_convert<ReduceAccDataType>(c_m_n_host_result(m, n));
-                d_reduce_op(d_acc, curr_val);
-            };
-
-            d_m_host_result(m) = d_acc;
-        }
-
         pass = ck::utils::check_err(c_m_n_device_result.mData,
                                     c_m_n_host_result.mData,
                                     "Error: Incorrect results c") &&
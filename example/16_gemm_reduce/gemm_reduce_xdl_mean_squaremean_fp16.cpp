@@ -13,7 +13,7 @@
 #include "device_gemm_reduce_xdl_cshuffle.hpp"
 #include "element_wise_operation.hpp"
 #include "reduction_operator.hpp"
-#include "reference_gemm.hpp"
+#include "reference_gemm_reduce.hpp"
 #include "gemm_specialization.hpp"
 #include "reduction_operator.hpp"
 
@@ -67,13 +67,19 @@ using DeviceGemmReduceInstance = ck::tensor_operation::device::DeviceGemmReduce_
         <     Row,     Col,     Row,  F16,   F16,   F16,      F32,      F32,       F32,   DPtrsGlobal,  AElementOp,  BElementOp,  CElementOp, DxsReduceOp, DxsInElementOps, DxsOutElementOps,  DGlobalMemOp, GemmSpecialization,        1,   256,   256,   128,    32,   8,   8,   32,   32,    4,    2,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,              8,              8,         1,           1,           1,               S<1, 32, 1, 8>,               8,             S<64, 4>,                         4,                            1>;
 // clang-format on
 
-using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
-                                                                        BDataType,
-                                                                        CDataType,
-                                                                        GemmAccDataType,
-                                                                        AElementOp,
-                                                                        BElementOp,
-                                                                        CElementOp>;
+using ReferenceGemmReduceInstance =
+    ck::tensor_operation::host::ReferenceGemmReduce<ADataType,
+                                                    BDataType,
+                                                    CDataType,
+                                                    GemmAccDataType,
+                                                    ReduceAccDataType,
+                                                    DDataType,
+                                                    AElementOp,
+                                                    BElementOp,
+                                                    CElementOp,
+                                                    DxsReduceOp,
+                                                    DxsInElementOps,
+                                                    DxsOutElementOps>;
 
 template <typename ADataType, typename BDataType, typename CDataType, typename DDataType>
 void DumpGemmLayerNormPerf(float gemm_reduce_time, int M, int N, int K)
@@ -245,40 +251,21 @@ int main(int argc, char* argv[])
         d0_device_buf.FromDevice(d0_m_device_result.mData.data());
         d1_device_buf.FromDevice(d1_m_device_result.mData.data());
 
-        auto ref_gemm    = ReferenceGemmInstance{};
-        auto ref_invoker = ref_gemm.MakeInvoker();
+        auto ref_gemm_reduce = ReferenceGemmReduceInstance{};
+        auto ref_invoker     = ref_gemm_reduce.MakeInvoker();
 
-        auto ref_argument = ref_gemm.MakeArgument(
-            a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, c_element_op);
+        auto ref_argument = ref_gemm_reduce.MakeArgument(a_m_k,
+                                                         b_k_n,
+                                                         c_m_n_host_result,
+                                                         {&d0_m_host_result, &d1_m_host_result},
+                                                         a_element_op,
+                                                         b_element_op,
+                                                         c_element_op,
+                                                         dxs_in_element_op,
+                                                         dxs_out_element_op);
 
         ref_invoker.Run(ref_argument);
 
-        auto d0_reduce_op = D0ReduceOp{};
-        auto d1_reduce_op = D1ReduceOp{};
-
-        for(int m = 0; m < M; ++m)
-        {
-            auto d0_acc = d0_reduce_op.GetIdentityValue<ReduceAccDataType>();
-            auto d1_acc = d1_reduce_op.GetIdentityValue<ReduceAccDataType>();
-
-            for(int n = 0; n < N; ++n)
-            {
-                auto c_val = ck::type_convert<ReduceAccDataType>(c_m_n_host_result(m, n));
-                ReduceAccDataType d0_val;
-                ReduceAccDataType d1_val;
-
-                dxs_in_element_op(ck::Number<0>{})(d0_val, c_val);
-                dxs_in_element_op(ck::Number<1>{})(d1_val, c_val);
-                d0_reduce_op(d0_acc, d0_val);
-                d1_reduce_op(d1_acc, d1_val);
-            }
-
-            dxs_out_element_op(ck::Number<0>{})(d0_acc, d0_acc);
-            dxs_out_element_op(ck::Number<1>{})(d1_acc, d1_acc);
-            d0_m_host_result(m) = ck::type_convert<DDataType>(d0_acc);
-            d1_m_host_result(m) = ck::type_convert<DDataType>(d1_acc);
-        }
-
         pass = ck::utils::check_err(c_m_n_device_result.mData,
                                     c_m_n_host_result.mData,
                                     "Error: Incorrect results c") &&
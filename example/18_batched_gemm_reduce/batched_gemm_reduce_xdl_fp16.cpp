@@ -13,7 +13,7 @@
 #include "device_batched_gemm_reduce_xdl_cshuffle.hpp"
 #include "element_wise_operation.hpp"
 #include "reduction_operator.hpp"
-#include "reference_batched_gemm.hpp"
+#include "reference_gemm_reduce.hpp"
 #include "gemm_specialization.hpp"
 
 template <ck::index_t... Is>
@@ -64,8 +64,19 @@ using DeviceBatchedGemmReduceInstance = ck::tensor_operation::device::DeviceBatc
         <     Row,     Col,     Row,  F16,   F16,   F16,      F32,      F32,       F32,   DPtrsGlobal,  AElementOp,  BElementOp,  CElementOp, DxsReduceOp, DxsInElementOps, DxsOutElementOps, DGlobalMemOp, GemmSpecialization,        1,   256,   256,   128,    32,   8,   8,   32,   32,    4,    2,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,              8,              8,         1,           1,           1,               S<1, 32, 1, 8>,               8,             S<64, 4>,                         4,                            1>;
 // clang-format on
 
-using ReferenceBatchedGemmInstance = ck::tensor_operation::host::
-    ReferenceBatchedGemm<ADataType, BDataType, CDataType, AElementOp, BElementOp, CElementOp>;
+using ReferenceBatchedGemmReduceInstance =
+    ck::tensor_operation::host::ReferenceGemmReduce<ADataType,
+                                                    BDataType,
+                                                    CDataType,
+                                                    F32,
+                                                    ReduceAccDataType,
+                                                    DDataType,
+                                                    AElementOp,
+                                                    BElementOp,
+                                                    CElementOp,
+                                                    DxsReduceOp,
+                                                    DxsInElementOps,
+                                                    DxsOutElementOps>;
 
 int main(int argc, char* argv[])
 {
@@ -242,42 +253,22 @@ int main(int argc, char* argv[])
         d0_device_buf.FromDevice(d0_g_m_device_result.mData.data());
         d1_device_buf.FromDevice(d1_g_m_device_result.mData.data());
 
-        auto ref_batched_gemm = ReferenceBatchedGemmInstance{};
-        auto ref_invoker      = ref_batched_gemm.MakeInvoker();
+        auto ref_batched_gemm_reduce = ReferenceBatchedGemmReduceInstance{};
+        auto ref_invoker             = ref_batched_gemm_reduce.MakeInvoker();
 
-        auto ref_argument = ref_batched_gemm.MakeArgument(
-            a_g_m_k, b_g_k_n, c_g_m_n_host_result, a_element_op, b_element_op, c_element_op);
+        auto ref_argument =
+            ref_batched_gemm_reduce.MakeArgument(a_g_m_k,
+                                                 b_g_k_n,
+                                                 c_g_m_n_host_result,
+                                                 {&d0_g_m_host_result, &d1_g_m_host_result},
+                                                 a_element_op,
+                                                 b_element_op,
+                                                 c_element_op,
+                                                 DxsInElementOps{},
+                                                 DxsOutElementOps{});
 
         ref_invoker.Run(ref_argument);
 
-        auto d0_reduce_op = D0ReduceOp{};
-        auto d1_reduce_op = D1ReduceOp{};
-
-        for(int batch = 0; batch < BatchCount; ++batch)
-        {
-            for(int m = 0; m < M; ++m)
-            {
-                auto d0_acc = d0_reduce_op.GetIdentityValue<ReduceAccDataType>();
-                auto d1_acc = d1_reduce_op.GetIdentityValue<ReduceAccDataType>();
-
-                for(int n = 0; n < N; ++n)
-                {
-                    auto c_val =
-                        ck::type_convert<ReduceAccDataType>(c_g_m_n_host_result(batch, m, n));
-                    ReduceAccDataType d0_val;
-                    ReduceAccDataType d1_val;
-
-                    UnaryIdenticElementOp{}(d0_val, c_val);
-                    UnarySquareElementOp{}(d1_val, c_val);
-                    d0_reduce_op(d0_acc, d0_val);
-                    d1_reduce_op(d1_acc, d1_val);
-                }
-
-                d0_g_m_host_result(batch, m) = ck::type_convert<DDataType>(d0_acc);
-                d1_g_m_host_result(batch, m) = ck::type_convert<DDataType>(d1_acc);
-            }
-        }
-
         pass = ck::utils::check_err(c_g_m_n_host_result.mData,
                                     c_g_m_n_device_result.mData,
                                     "Error: Incorrect results c") &&
@@ -34,6 +34,7 @@
 #include "device_tensor.hpp"
 #include "binary_element_wise_operation.hpp"
 #include "device_binary_elementwise.hpp"
+#include "reference_elementwise.hpp"
 
 using F16 = ck::half_t;
 using F32 = float;
@@ -56,37 +57,8 @@ using DeviceElementwiseAddInstance =
                                                           8,
                                                           8>;
 
-template <typename HostTensorA,
-          typename HostTensorB,
-          typename HostTensorC,
-          typename ComputeDataType,
-          typename Functor,
-          int broadcastDim>
-void host_broadcast2D(
-    HostTensorC& C, const HostTensorA& A, const HostTensorB& B, int M, int N, Functor functor)
-{
-    using ctype = ck::remove_reference_t<decltype(C(0, 0))>;
-
-    for(int m = 0; m < M; ++m)
-    {
-        for(int n = 0; n < N; ++n)
-        {
-            ComputeDataType Amn = ck::type_convert<ComputeDataType>(A(m, n));
-            ComputeDataType Cmn = 0;
-            if constexpr(broadcastDim == 0)
-            {
-                ComputeDataType Bn = ck::type_convert<ComputeDataType>(B(n));
-                functor(Cmn, Amn, Bn);
-            }
-            else
-            {
-                ComputeDataType Bm = ck::type_convert<ComputeDataType>(B(m));
-                functor(Cmn, Amn, Bm);
-            }
-            C(m, n) = ck::type_convert<ctype>(Cmn);
-        }
-    }
-}
+using ReferenceElementwiseAddInstance = ck::tensor_operation::host::
+    ReferenceElementwise<Add, EltwiseComputeDataType, CDataType, ABDataType, ABDataType>;
 
 int main()
 {
@@ -149,12 +121,10 @@ int main()
         c_m_n_device_buf.FromDevice(c_m_n.mData.data());
         Tensor<CDataType> host_c_m_n(f_host_tensor_descriptor2d(M, N, Stride));
 
-        host_broadcast2D<Tensor<ABDataType>,
-                         Tensor<ABDataType>,
-                         Tensor<CDataType>,
-                         EltwiseComputeDataType,
-                         Add,
-                         0>(host_c_m_n, a_m_n, b_n, M, N, Add{});
+        auto ref_argument =
+            ReferenceElementwiseAddInstance::MakeArgument({a_m_n, b_n}, host_c_m_n, Add{});
+
+        ReferenceElementwiseAddInstance::MakeInvoker().Run(ref_argument);
 
         pass &= ck::utils::check_err(
             c_m_n.mData, host_c_m_n.mData, "Error: Incorrect results c", 1e-3, 1e-3);
@@ -9,6 +9,7 @@
 #include "device_tensor.hpp"
 #include "binary_element_wise_operation.hpp"
 #include "device_binary_elementwise.hpp"
+#include "reference_elementwise.hpp"
 
 using F16 = ck::half_t;
 using F32 = float;
@@ -31,30 +32,8 @@ using DeviceElementwiseAddInstance =
                                                           8,
                                                           8>;
 
-template <typename HostTensorA,
-          typename HostTensorB,
-          typename HostTensorC,
-          typename ComputeDataType,
-          typename Functor>
-void host_broadcast3D_am_bmnk(HostTensorC& C,
-                              const HostTensorA& A,
-                              const HostTensorB& B,
-                              const std::vector<std::size_t>& shape,
-                              Functor functor)
-{
-    using ctype = ck::remove_reference_t<decltype(C(0, 0))>;
-
-    for(std::size_t m = 0; m < shape[0]; ++m)
-        for(std::size_t n = 0; n < shape[1]; ++n)
-            for(std::size_t k = 0; k < shape[2]; ++k)
-            {
-                ComputeDataType a_val = ck::type_convert<ComputeDataType>(A(m));
-                ComputeDataType b_val = ck::type_convert<ComputeDataType>(B(m, n, k));
-                ComputeDataType c_val = 0;
-                functor(c_val, a_val, b_val);
-                C(m, n, k) = ck::type_convert<ctype>(c_val);
-            }
-}
+using ReferenceElementwiseAddInstance = ck::tensor_operation::host::
+    ReferenceElementwise<Add, EltwiseComputeDataType, CDataType, ABDataType, ABDataType>;
 
 int main()
 {
@@ -109,11 +88,11 @@ int main()
         c_m_n_k_device_buf.FromDevice(c_m_n_k.mData.data());
         Tensor<CDataType> host_c_m_n_k(mnk);
 
-        host_broadcast3D_am_bmnk<Tensor<ABDataType>,
-                                 Tensor<ABDataType>,
-                                 Tensor<CDataType>,
-                                 EltwiseComputeDataType,
-                                 Add>(host_c_m_n_k, a_m, b_m_n_k, mnk, Add{});
+        // broadcast A on second and third dimension
+        auto ref_argument = ReferenceElementwiseAddInstance::MakeArgument(
+            {a_m, b_m_n_k}, host_c_m_n_k, Add{}, {{{1, 0, 0}, {}}});
+
+        ReferenceElementwiseAddInstance::MakeInvoker().Run(ref_argument);
 
         pass &= ck::utils::check_err(
             c_m_n_k.mData, host_c_m_n_k.mData, "Error: Incorrect results c", 1e-3, 1e-3);
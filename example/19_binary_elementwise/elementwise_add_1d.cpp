@@ -34,6 +34,7 @@
 #include "device_tensor.hpp"
 #include "binary_element_wise_operation.hpp"
 #include "device_binary_elementwise.hpp"
+#include "reference_elementwise.hpp"
 
 using F16 = ck::half_t;
 using F32 = float;
@@ -56,25 +57,8 @@ using DeviceElementwiseAddInstance =
                                                           8,
                                                           8>;
 
-template <typename HostTensorA,
-          typename HostTensorB,
-          typename HostTensorC,
-          typename ComputeDataType,
-          typename Functor>
-void host_elementwise1D(
-    HostTensorC& C, const HostTensorA& A, const HostTensorB& B, int M, Functor functor)
-{
-    using ctype = ck::remove_reference_t<decltype(C(0))>;
-
-    for(int m = 0; m < M; ++m)
-    {
-        ComputeDataType Am = ck::type_convert<ComputeDataType>(A(m));
-        ComputeDataType Bm = ck::type_convert<ComputeDataType>(B(m));
-        ComputeDataType Cm = 0;
-        functor(Cm, Am, Bm);
-        C(m) = ck::type_convert<ctype>(Cm);
-    }
-}
+using ReferenceElementwiseAddInstance = ck::tensor_operation::host::
+    ReferenceElementwise<Add, EltwiseComputeDataType, CDataType, ABDataType, ABDataType>;
 
 int main()
 {
@@ -130,11 +114,10 @@ int main()
         c_m_device_buf.FromDevice(c_m.mData.data());
         Tensor<CDataType> host_c_m(f_host_tensor_descriptor1d(M, 1));
 
-        host_elementwise1D<Tensor<ABDataType>,
-                           Tensor<ABDataType>,
-                           Tensor<CDataType>,
-                           EltwiseComputeDataType,
-                           Add>(host_c_m, a_m, b_m, M, Add{});
+        auto ref_argument =
+            ReferenceElementwiseAddInstance::MakeArgument({a_m, b_m}, host_c_m, Add{});
+
+        ReferenceElementwiseAddInstance::MakeInvoker().Run(ref_argument);
 
         pass &= ck::utils::check_err(
             c_m.mData, host_c_m.mData, "Error: Incorrect results c", 1e-3, 1e-3);
@@ -34,6 +34,7 @@
 #include "device_tensor.hpp"
 #include "binary_element_wise_operation.hpp"
 #include "device_binary_elementwise.hpp"
+#include "reference_elementwise.hpp"
 
 using F16 = ck::half_t;
 using F32 = float;
@@ -56,31 +57,8 @@ using DeviceElementwiseAddInstance =
                                                           8,
                                                           8>;
 
-template <typename HostTensorA,
-          typename HostTensorB,
-          typename HostTensorC,
-          typename ComputeDataType,
-          typename Functor>
-void host_elementwise4D(HostTensorC& C,
-                        const HostTensorA& A,
-                        const HostTensorB& B,
-                        const std::vector<std::size_t>& shape,
-                        Functor functor)
-{
-    using ctype = ck::remove_reference_t<decltype(C(0, 0, 0, 0))>;
-
-    for(std::size_t n = 0; n < shape[0]; ++n)
-        for(std::size_t c = 0; c < shape[1]; ++c)
-            for(std::size_t h = 0; h < shape[2]; ++h)
-                for(std::size_t w = 0; w < shape[3]; ++w)
-                {
-                    ComputeDataType a_val = ck::type_convert<ComputeDataType>(A(n, c, h, w));
-                    ComputeDataType b_val = ck::type_convert<ComputeDataType>(B(n, c, h, w));
-                    ComputeDataType c_val = 0;
-                    functor(c_val, a_val, b_val);
-                    C(n, c, h, w) = ck::type_convert<ctype>(c_val);
-                }
-}
+using ReferenceElementwiseAddInstance = ck::tensor_operation::host::
+    ReferenceElementwise<Add, EltwiseComputeDataType, CDataType, ABDataType, ABDataType>;
 
 int main()
 {
@@ -132,11 +110,10 @@ int main()
         c_device_buf.FromDevice(c.mData.data());
         Tensor<CDataType> host_c(nchw);
 
-        host_elementwise4D<Tensor<ABDataType>,
-                           Tensor<ABDataType>,
-                           Tensor<CDataType>,
-                           EltwiseComputeDataType,
-                           Add>(host_c, a, b, nchw, Add{});
+        auto ref_argument =
+            ReferenceElementwiseAddInstance::MakeArgument({a, b}, host_c, Add{});
+
+        ReferenceElementwiseAddInstance::MakeInvoker().Run(ref_argument);
 
         pass &=
             ck::utils::check_err(c.mData, host_c.mData, "Error: Incorrect results c", 1e-3, 1e-3);
@@ -12,7 +12,7 @@
 #include "device_5ary_elementwise.hpp"
 #include "device_gemm_bias_add_reduce_xdl_cshuffle.hpp"
 #include "element_wise_operation.hpp"
-#include "reference_gemm.hpp"
+#include "reference_gemm_layernorm.hpp"
 #include "gemm_specialization.hpp"
 
 template <ck::index_t... Is>
@@ -72,13 +72,17 @@ using DeviceGemmBiasAddReduceInstance = ck::tensor_operation::device::DeviceGemm
         <     Row,     Col,     Row,  F16,   F16,   F16,   F32,   F16,      F32,      F32,       F32,   DPtrsGlobal,  AElementOp,  BElementOp,  CElementOp, C1ElementOp, DxsReduceOp, DxsInElementOps, DxsOutElementOps,  DxsGlobalMemOp, GemmSpecialization,        1,   256,   256,   128,    32,   8,   8,   32,   32,    4,    2,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,              8,              8,         1,           1,           1,               S<1, 32, 1, 8>,               8,             S<64, 4>,                         4,                            1>;
 // clang-format on
 
-using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
-                                                                        BDataType,
-                                                                        CDataType,
-                                                                        GemmAccDataType,
-                                                                        AElementOp,
-                                                                        BElementOp,
-                                                                        PassThrough>;
+using ReferenceGemmLayernormInstance =
+    ck::tensor_operation::host::ReferenceGemmLayernorm<ADataType,
+                                                       BDataType,
+                                                       CDataType,
+                                                       GammaDataType,
+                                                       BetaDataType,
+                                                       LayerNormOutDataType,
+                                                       GemmAccDataType,
+                                                       AElementOp,
+                                                       BElementOp,
+                                                       CElementOp>;
 
 using NormalizeFunctor = ck::tensor_operation::element_wise::Normalize;
 
@@ -120,22 +124,14 @@ auto f_host_tensor_descriptor2d =
         }
     };
 
-template <typename CDataType,
-          typename DDataType,
-          typename AccDataType,
-          typename C0DataType,
-          typename C1DataType,
-          typename A_functor,
-          typename B_functor,
-          typename C_functor,
-          typename C1_functor>
+template <typename A_functor, typename B_functor, typename C_functor, typename C1_functor>
 void host_gemm_layernorm(Tensor<LayerNormOutDataType>& out_m_n,
                          const Tensor<ADataType>& a_m_k,
-                         const Tensor<ADataType>& b_k_n,
+                         const Tensor<BDataType>& b_k_n,
                          const Tensor<C0DataType>& bias_n,
                          const Tensor<C1DataType>& c1_m_n,
                          const Tensor<GammaDataType>& gamma_n,
-                         const Tensor<GammaDataType>& beta_n,
+                         const Tensor<BetaDataType>& beta_n,
                          A_functor a_element_op,
                          B_functor b_element_op,
                          C_functor c_element_op,
@@ -143,75 +139,44 @@ void host_gemm_layernorm(Tensor<LayerNormOutDataType>& out_m_n,
                          int M,
                          int N)
 {
-
     int StrideC = N;
     Tensor<CDataType> c_m_n(f_host_tensor_descriptor2d(M, N, StrideC, CLayout{}));
-    Tensor<DDataType> mean_m(f_host_tensor_descriptor1d(M, 1));
-    Tensor<DDataType> meanSquare_m(f_host_tensor_descriptor1d(M, 1));
-    auto averageOpInst = UnaryDivElementOp{N};
-
-    auto ref_gemm    = ReferenceGemmInstance{};
-    auto ref_invoker = ref_gemm.MakeInvoker();
-
-    auto ref_argument =
-        ref_gemm.MakeArgument(a_m_k, b_k_n, c_m_n, a_element_op, b_element_op, PassThrough{});
 
-    ref_invoker.Run(ref_argument);
-
-    // c = activation(c + bias) + c1_functor(c1)
-    for(int m = 0; m < M; ++m)
-        for(int n = 0; n < N; ++n)
-        {
-            AccDataType acc =
-                static_cast<AccDataType>(c_m_n(m, n)) + static_cast<AccDataType>(bias_n(n));
+    // c = activation(c + bias) + c1_functor(c1), fused with the GEMM
+    auto c_epilogue = [&](GemmAccDataType& c,
+                          GemmAccDataType acc,
+                          std::size_t,
+                          std::size_t m,
+                          std::size_t n) {
+        GemmAccDataType c0 = static_cast<GemmAccDataType>(static_cast<CDataType>(acc)) +
+                             static_cast<GemmAccDataType>(bias_n(n));
+        GemmAccDataType c1 = static_cast<GemmAccDataType>(c1_m_n(m, n));
 
-            AccDataType c1 = static_cast<AccDataType>(c1_m_n(m, n));
+        c_element_op(c0, c0);
+        c1_element_op(c1, c1);
 
-            c_element_op(acc, acc);
-            c1_element_op(c1, c1);
-            acc += c1;
-            c_m_n(m, n) = static_cast<CDataType>(acc);
-        }
-
-    // reduce_mean and reduce_square_mean
-    auto reduceSumOpInst = ReduceSumOp{};
-    for(int m = 0; m < M; ++m)
-    {
-        auto mean_acc        = reduceSumOpInst.GetIdentityValue<AccDataType>();
-        auto square_mean_acc = reduceSumOpInst.GetIdentityValue<AccDataType>();
-
-        for(int n = 0; n < N; ++n)
-        {
-            AccDataType c_val        = ck::type_convert<AccDataType>(c_m_n(m, n));
-            AccDataType square_c_val = 0;
-            UnarySquareElementOp{}(square_c_val, c_val);
-
-            reduceSumOpInst(mean_acc, c_val);
-            reduceSumOpInst(square_mean_acc, square_c_val);
-        }
+        c = c0 + c1;
+    };
 
-        averageOpInst(mean_acc, mean_acc);
-        averageOpInst(square_mean_acc, square_mean_acc);
-        mean_m(m)       = ck::type_convert<DDataType>(mean_acc);
-        meanSquare_m(m) = ck::type_convert<DDataType>(square_mean_acc);
-    }
+    // the mean and variance of each row of c are accumulated as it is produced, then LayerNorm
+    // with the epsilon of the device Normalize
+    auto ref_gemm_layernorm = ReferenceGemmLayernormInstance{};
+    auto ref_invoker        = ref_gemm_layernorm.MakeInvoker();
+
+    auto ref_argument = ref_gemm_layernorm.MakeArgument(
+        a_m_k,
+        b_k_n,
+        c_m_n,
+        &gamma_n,
+        &beta_n,
+        out_m_n,
+        a_element_op,
+        b_element_op,
+        c_element_op,
+        static_cast<GemmAccDataType>(NormalizeFunctor{}.epsilon_),
+        c_epilogue);
 
-    // LayerNorm
-    auto layerNormInst = NormalizeFunctor{};
-    for(int m = 0; m < M; ++m)
-    {
-        for(int n = 0; n < N; ++n)
-        {
-            AccDataType out_acc = 0;
-            layerNormInst(out_acc,
-                          static_cast<AccDataType>(c_m_n(m, n)),
-                          static_cast<AccDataType>(mean_m(m)),
-                          static_cast<AccDataType>(meanSquare_m(m)),
-                          static_cast<AccDataType>(gamma_n(n)),
-                          static_cast<AccDataType>(beta_n(n)));
-            out_m_n(m, n) = static_cast<DDataType>(out_acc);
-        }
-    }
+    ref_invoker.Run(ref_argument);
 }
 
 template <typename ADataType,
@@ -377,19 +342,19 @@ int main()
         Tensor<LayerNormOutDataType> host_layerNorm_m_n(
             f_host_tensor_descriptor2d(M, N, StrideC, CLayout{}));
 
-        host_gemm_layernorm<CDataType, DDataType, ReduceAccDataType>(host_layerNorm_m_n,
-                                                                     a_m_k,
-                                                                     b_k_n,
-                                                                     bias_n,
-                                                                     c1_m_n,
-                                                                     gamma_n,
-                                                                     beta_n,
-                                                                     a_element_op,
-                                                                     b_element_op,
-                                                                     c_element_op,
-                                                                     c1_element_op,
-                                                                     M,
-                                                                     N);
+        host_gemm_layernorm(host_layerNorm_m_n,
+                            a_m_k,
+                            b_k_n,
+                            bias_n,
+                            c1_m_n,
+                            gamma_n,
+                            beta_n,
+                            a_element_op,
+                            b_element_op,
+                            c_element_op,
+                            c1_element_op,
+                            M,
+                            N);
 
         layerNorm_device_buf.FromDevice(layerNorm_m_n.mData.data());
         pass &= ck::utils::check_err(layerNorm_m_n.mData,
@@ -12,7 +12,7 @@
 #include "device_5ary_elementwise.hpp"
 #include "device_gemm_reduce_xdl_cshuffle.hpp"
 #include "element_wise_operation.hpp"
-#include "reference_gemm.hpp"
+#include "reference_gemm_layernorm.hpp"
 #include "gemm_specialization.hpp"
 
 template <ck::index_t... Is>
@@ -68,13 +68,17 @@ using DeviceGemmReduceInstance = ck::tensor_operation::device::DeviceGemmReduce_
         <     Row,     Col,     Row,  F16,   F16,   F16,      F32,      F32,       F32,   DPtrsGlobal,  AElementOp,  BElementOp,  CElementOp, DxsReduceOp, DxsInElementOps, DxsOutElementOps,  DxsGlobalMemOp, GemmSpecialization,        1,   256,   256,   128,    32,   8,   8,   32,   32,    4,    2,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,              8,              8,         1,           1,           1,               S<1, 32, 1, 8>,               8,             S<64, 4>,                         4,                            1>;
 // clang-format on
 
-using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
-                                                                        BDataType,
-                                                                        CDataType,
-                                                                        GemmAccDataType,
-                                                                        AElementOp,
-                                                                        BElementOp,
-                                                                        CElementOp>;
+using ReferenceGemmLayernormInstance =
+    ck::tensor_operation::host::ReferenceGemmLayernorm<ADataType,
+                                                       BDataType,
+                                                       CDataType,
+                                                       GammaDataType,
+                                                       BetaDataType,
+                                                       LayerNormOutDataType,
+                                                       GemmAccDataType,
+                                                       AElementOp,
+                                                       BElementOp,
+                                                       CElementOp>;
 
 using NormalizeFunctor = ck::tensor_operation::element_wise::Normalize;
 
@@ -116,78 +120,39 @@ auto f_host_tensor_descriptor2d =
         }
     };
 
-template <typename CDataType,
-          typename DDataType,
-          typename A_functor,
-          typename B_functor,
-          typename C_functor>
+template <typename A_functor, typename B_functor, typename C_functor>
 void host_gemm_layernorm(Tensor<LayerNormOutDataType>& out_m_n,
                          const Tensor<ADataType>& a_m_k,
-                         const Tensor<ADataType>& b_k_n,
+                         const Tensor<BDataType>& b_k_n,
                          const Tensor<GammaDataType>& gamma_n,
-                         const Tensor<GammaDataType>& beta_n,
+                         const Tensor<BetaDataType>& beta_n,
                          A_functor a_element_op,
                          B_functor b_element_op,
                          C_functor c_element_op,
                          int M,
                          int N)
 {
-    using out_type = ck::remove_reference_t<decltype(out_m_n(0, 0))>;
-
     int StrideC = N;
     Tensor<CDataType> c_m_n(f_host_tensor_descriptor2d(M, N, StrideC, CLayout{}));
-    Tensor<DDataType> mean_m(f_host_tensor_descriptor1d(M, 1));
-    Tensor<DDataType> meanSquare_m(f_host_tensor_descriptor1d(M, 1));
-    auto averageOpInst = UnaryDivElementOp{N};
-
-    auto ref_gemm    = ReferenceGemmInstance{};
-    auto ref_invoker = ref_gemm.MakeInvoker();
 
-    auto ref_argument =
-        ref_gemm.MakeArgument(a_m_k, b_k_n, c_m_n, a_element_op, b_element_op, c_element_op);
+    // GEMM, with the mean and variance of each row of c accumulated as it is produced, then
+    // LayerNorm with the epsilon of the device Normalize
+    auto ref_gemm_layernorm = ReferenceGemmLayernormInstance{};
+    auto ref_invoker        = ref_gemm_layernorm.MakeInvoker();
+
+    auto ref_argument = ref_gemm_layernorm.MakeArgument(
+        a_m_k,
+        b_k_n,
+        c_m_n,
+        &gamma_n,
+        &beta_n,
+        out_m_n,
+        a_element_op,
+        b_element_op,
+        c_element_op,
+        static_cast<GemmAccDataType>(NormalizeFunctor{}.epsilon_));
 
     ref_invoker.Run(ref_argument);
-
-    // reduce_mean and reduce_square_mean
-    auto reduceSumOpInst = ReduceSumOp{};
-    for(int m = 0; m < M; ++m)
-    {
-        auto mean_acc        = reduceSumOpInst.GetIdentityValue<ReduceAccDataType>();
-        auto square_mean_acc = reduceSumOpInst.GetIdentityValue<ReduceAccDataType>();
-
-        for(int n = 0; n < N; ++n)
-        {
-            auto c_val        = ck::type_convert<ReduceAccDataType>(c_m_n(m, n));
-            auto square_c_val = reduceSumOpInst.GetIdentityValue<ReduceAccDataType>();
-
-            UnarySquareElementOp{}(square_c_val, c_val);
-
-            reduceSumOpInst(mean_acc, c_val);
-            reduceSumOpInst(square_mean_acc, square_c_val);
-        }
-
-        averageOpInst(mean_acc, mean_acc);
-        averageOpInst(square_mean_acc, square_mean_acc);
-        mean_m(m)       = ck::type_convert<DDataType>(mean_acc);
-        meanSquare_m(m) = ck::type_convert<DDataType>(square_mean_acc);
-    }
-
-    // LayerNorm
-    auto layerNormInst = NormalizeFunctor{};
-    for(int m = 0; m < M; ++m)
-    {
-        for(int n = 0; n < N; ++n)
-        {
-            float out_f32 = 0;
-            layerNormInst(out_f32,
-                          static_cast<float>(c_m_n(m, n)),
-                          static_cast<float>(mean_m(m)),
-                          static_cast<float>(meanSquare_m(m)),
-                          static_cast<float>(gamma_n(n)),
-                          static_cast<float>(beta_n(n)));
-            out_m_n(m, n) = static_cast<out_type>(out_f32);
-        }
-    }
 }
 
 template <typename ADataType,
@@ -336,16 +301,16 @@ int main()
         Tensor<LayerNormOutDataType> host_layerNorm_m_n(
             f_host_tensor_descriptor2d(M, N, StrideC, CLayout{}));
 
-        host_gemm_layernorm<CDataType, DDataType>(host_layerNorm_m_n,
-                                                  a_m_k,
-                                                  b_k_n,
-                                                  gamma_n,
-                                                  beta_n,
-                                                  a_element_op,
-                                                  b_element_op,
-                                                  c_element_op,
-                                                  M,
-                                                  N);
+        host_gemm_layernorm(host_layerNorm_m_n,
+                            a_m_k,
+                            b_k_n,
+                            gamma_n,
+                            beta_n,
+                            a_element_op,
+                            b_element_op,
+                            c_element_op,
+                            M,
+                            N);
 
         layerNorm_device_buf.FromDevice(layerNorm_m_n.mData.data());
         pass &= ck::utils::check_err(layerNorm_m_n.mData,
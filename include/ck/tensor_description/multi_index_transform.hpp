@@ -997,23 +997,23 @@ struct Merge_v1_carry_check
     }
 };
 
-template <typename LowLengths>
+template <typename LowLengths, typename MagicDivisionType = MagicDivision>
 struct lambda_merge_generate_MagicDivision_calculate_magic_multiplier
 {
     template <index_t I>
     __host__ __device__ constexpr auto operator()(Number<I> i) const
     {
-        return MagicDivision::CalculateMagicMultiplier(LowLengths{}[i]);
+        return MagicDivisionType::CalculateMagicMultiplier(LowLengths{}[i]);
     }
 };
 
-template <typename LowLengths>
+template <typename LowLengths, typename MagicDivisionType = MagicDivision>
 struct lambda_merge_generate_MagicDivision_calculate_magic_shift
 {
     template <index_t I>
     __host__ __device__ constexpr auto operator()(Number<I> i) const
     {
-        return MagicDivision::CalculateMagicShift(LowLengths{}[i]);
+        return MagicDivisionType::CalculateMagicShift(LowLengths{}[i]);
     }
 };
 
@@ -1029,7 +1029,7 @@ struct lambda_merge_generate_MagicDivision_calculate_magic_shift
 //   4. When upper-index is uint32_t, its value need to be within 31-bit range.
 //   5. When upper-index is int32_t type (when index_t is int32_t), its value need to be
 //   non-negative.
-template <typename LowLengths>
+template <typename LowLengths, typename MagicDivisionType = MagicDivision>
 struct Merge_v2_magic_division
 {
     static constexpr index_t NDimLow = LowLengths::Size();
@@ -1040,13 +1040,14 @@ struct Merge_v2_magic_division
     using UpLengths =
         decltype(make_tuple(container_reduce(LowLengths{}, math::multiplies{}, Number<1>{})));
 
-    using LowLengthsMagicDivisorMultipiler = decltype(
-        generate_tuple(lambda_merge_generate_MagicDivision_calculate_magic_multiplier<LowLengths>{},
-                       Number<NDimLow>{}));
+    using LowLengthsMagicDivisorMultipiler = decltype(generate_tuple(
+        lambda_merge_generate_MagicDivision_calculate_magic_multiplier<LowLengths,
+                                                                       MagicDivisionType>{},
+        Number<NDimLow>{}));
 
-    using LowLengthsMagicDivisorShift = decltype(
-        generate_tuple(lambda_merge_generate_MagicDivision_calculate_magic_shift<LowLengths>{},
-                       Number<NDimLow>{}));
+    using LowLengthsMagicDivisorShift = decltype(generate_tuple(
+        lambda_merge_generate_MagicDivision_calculate_magic_shift<LowLengths, MagicDivisionType>{},
+        Number<NDimLow>{}));
 
     LowLengths low_lengths_;
     LowLengthsMagicDivisorMultipiler low_lengths_magic_divisor_multiplier_;
@@ -1058,10 +1059,12 @@ struct Merge_v2_magic_division
     __host__ __device__ constexpr Merge_v2_magic_division(const LowLengths& low_lengths)
         : low_lengths_{low_lengths},
           low_lengths_magic_divisor_multiplier_{generate_tuple(
-              [&](auto i) { return MagicDivision::CalculateMagicMultiplier(low_lengths[i]); },
+              [&](auto i) {
+                  return MagicDivisionType::CalculateMagicMultiplier(low_lengths[i]);
+              },
               Number<NDimLow>{})},
           low_lengths_magic_divisor_shift_{generate_tuple(
-              [&](auto i) { return MagicDivision::CalculateMagicShift(low_lengths[i]); },
+              [&](auto i) { return MagicDivisionType::CalculateMagicShift(low_lengths[i]); },
               Number<NDimLow>{})},
           up_lengths_{make_tuple(container_reduce(low_lengths, math::multiplies{}, Number<1>{}))}
     {
@@ -1085,9 +1088,9 @@ struct Merge_v2_magic_division
 
         static_for<NDimLow - 1, 0, -1>{}([&, this](auto i) {
             index_t tmp2 =
-                MagicDivision::DoMagicDivision(tmp,
-                                               this->low_lengths_magic_divisor_multiplier_[i],
-                                               this->low_lengths_magic_divisor_shift_[i]);
+                MagicDivisionType::DoMagicDivision(tmp,
+                                                   this->low_lengths_magic_divisor_multiplier_[i],
+                                                   this->low_lengths_magic_divisor_shift_[i]);
             idx_low(i) = tmp - tmp2 * this->low_lengths_[i];
             tmp        = tmp2;
         });
@@ -1114,9 +1117,9 @@ struct Merge_v2_magic_division
 
         static_for<NDimLow - 1, 0, -1>{}([&, this](auto i) {
             index_t tmp2 =
-                MagicDivision::DoMagicDivision(tmp,
-                                               this->low_lengths_magic_divisor_multiplier_[i],
-                                               this->low_lengths_magic_divisor_shift_[i]);
+                MagicDivisionType::DoMagicDivision(tmp,
+                                                   this->low_lengths_magic_divisor_multiplier_[i],
+                                                   this->low_lengths_magic_divisor_shift_[i]);
 
             index_t idx_low_old = idx_low[i];
 
@@ -1181,7 +1184,7 @@ struct Merge_v2_magic_division
 //   4. When upper-index is uint32_t, its value need to be within 31-bit range.
 //   5. When upper-index is int32_t type (when index_t is int32_t), its value need to be
 //   non-negative.
-template <typename LowLengths>
+template <typename LowLengths, typename MagicDivisionType = MagicDivision>
 struct Merge_v2r2_magic_division
 {
     static constexpr index_t NDimLow = LowLengths::Size();
@@ -1196,12 +1199,14 @@ struct Merge_v2r2_magic_division
         decltype(make_tuple(container_reduce(LowLengths{}, math::multiplies{}, Number<1>{})));
 
     using LowLengthsScanMagicDivisorMultipiler = decltype(generate_tuple(
-        lambda_merge_generate_MagicDivision_calculate_magic_multiplier<LowLengthsScan>{},
+        lambda_merge_generate_MagicDivision_calculate_magic_multiplier<LowLengthsScan,
+                                                                       MagicDivisionType>{},
         Number<NDimLow>{}));
 
-    using LowLengthsScanMagicDivisorShift = decltype(
-        generate_tuple(lambda_merge_generate_MagicDivision_calculate_magic_shift<LowLengthsScan>{},
-                       Number<NDimLow>{}));
+    using LowLengthsScanMagicDivisorShift = decltype(generate_tuple(
+        lambda_merge_generate_MagicDivision_calculate_magic_shift<LowLengthsScan,
+                                                                  MagicDivisionType>{},
+        Number<NDimLow>{}));
 
     LowLengths low_lengths_;
     LowLengthsScan low_lengths_scan_;
@@ -1216,10 +1221,14 @@ struct Merge_v2r2_magic_division
           low_lengths_scan_{
               container_reverse_exclusive_scan(low_lengths, math::multiplies{}, Number<1>{})},
           low_lengths_scan_magic_divisor_multiplier_{generate_tuple(
-              [&](auto i) { return MagicDivision::CalculateMagicMultiplier(low_lengths_scan_[i]); },
+              [&](auto i) {
+                  return MagicDivisionType::CalculateMagicMultiplier(low_lengths_scan_[i]);
+              },
               Number<NDimLow>{})},
           low_lengths_scan_magic_divisor_shift_{generate_tuple(
-              [&](auto i) { return MagicDivision::CalculateMagicShift(low_lengths_scan_[i]); },
+              [&](auto i) {
+                  return MagicDivisionType::CalculateMagicShift(low_lengths_scan_[i]);
+              },
               Number<NDimLow>{})},
           up_lengths_{make_tuple(container_reduce(low_lengths, math::multiplies{}, Number<1>{}))}
     {
@@ -1243,9 +1252,10 @@ struct Merge_v2r2_magic_division
 
         static_for<0, NDimLow - 1, 1>{}([&, this](auto i) {
             idx_low(i) =
-                MagicDivision::DoMagicDivision(tmp,
-                                               this->low_lengths_scan_magic_divisor_multiplier_[i],
-                                               this->low_lengths_scan_magic_divisor_shift_[i]);
+                MagicDivisionType::DoMagicDivision(
+                    tmp,
+                    this->low_lengths_scan_magic_divisor_multiplier_[i],
+                    this->low_lengths_scan_magic_divisor_shift_[i]);
 
             tmp -= idx_low[i] * this->low_lengths_scan_[i];
         });
@@ -1274,9 +1284,10 @@ struct Merge_v2r2_magic_division
             index_t idx_low_old = idx_low[i];
 
             idx_low(i) =
-                MagicDivision::DoMagicDivision(tmp,
-                                               this->low_lengths_scan_magic_divisor_multiplier_[i],
-                                               this->low_lengths_scan_magic_divisor_shift_[i]);
+                MagicDivisionType::DoMagicDivision(
+                    tmp,
+                    this->low_lengths_scan_magic_divisor_multiplier_[i],
+                    this->low_lengths_scan_magic_divisor_shift_[i]);
 
             idx_diff_low(i) = idx_low[i] - idx_low_old;
 
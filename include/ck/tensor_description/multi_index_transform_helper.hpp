@@ -49,14 +49,68 @@ __host__ __device__ constexpr auto make_embed_transform(const UpLengths& up_leng
     return Embed<UpLengths, Coefficients>{up_lengths, coefficients};
 }
 
+// Value range of the upper index of a Merge, which is the dividend of its index calculation
+enum struct MergeDividendRange
+{
+    // upper index of a valid coordinate: non-negative, and within 31-bit as it is an index_t
+    NonNegative31Bit,
+    // any int32_t upper index
+    Full32Bit
+};
+
 template <typename LowLengths>
-__host__ __device__ constexpr auto make_merge_transform(const LowLengths& low_lengths)
+__host__ __device__ constexpr bool is_merge_low_lengths_known_power_of_2()
 {
-#if CK_EXPERIMENTAL_MERGE_USE_MAGIC_DIVISION
-    return make_merge_transform_v2_magic_division(low_lengths);
-#else
-    return make_merge_transform_v1_carry_check(low_lengths);
-#endif
+    if constexpr(is_known_at_compile_time<LowLengths>::value)
+    {
+        return container_reduce(
+            LowLengths{},
+            [](auto low_length, bool r) {
+                const index_t length = low_length;
+
+                return r && length > 0 && (length & (length - 1)) == 0;
+            },
+            true);
+    }
+    else
+    {
+        return false;
+    }
+}
+
+// Selects the Merge implementation with the cheapest index calculation for a use site:
+//   1. If all low_lengths are known at compile time and are power of 2, Merge_v3_division_mod,
+//   whose division and mod by compile-time constants compile into shifts and masks.
+//   2. Otherwise Merge_v2_magic_division. If low_lengths are known at compile time, the magic
+//   numbers are compile-time constants too, and no registers are spent on them. MagicDivision is
+//   used if the upper index is within 31-bit range, which saves a 64-bit add per division over
+//   MagicDivision32BitFullRange.
+// Merge_v1_carry_check is not selected: its UpdateLowerIndex() divides the upper index step on
+// every call, unless the compiler can hoist it, and its CalculateLowerIndex() uses plain division.
+// See bench_tensor_coordinate.cpp of ck_host_bench for timings of all variants.
+template <typename LowLengths,
+          MergeDividendRange DividendRange = MergeDividendRange::NonNegative31Bit>
+struct merge_transform_selector
+{
+    using MagicDivisionType = conditional_t<DividendRange == MergeDividendRange::NonNegative31Bit,
+                                            MagicDivision,
+                                            MagicDivision32BitFullRange>;
+
+    using type = conditional_t<is_merge_low_lengths_known_power_of_2<LowLengths>(),
+                               Merge_v3_division_mod<LowLengths>,
+                               Merge_v2_magic_division<LowLengths, MagicDivisionType>>;
+};
+
+template <typename LowLengths,
+          MergeDividendRange DividendRange = MergeDividendRange::NonNegative31Bit>
+__host__ __device__ constexpr auto
+make_merge_transform(const LowLengths& low_lengths,
+                     integral_constant<MergeDividendRange, DividendRange> =
+                         integral_constant<MergeDividendRange, DividendRange>{})
+{
+    using Merge = typename merge_transform_selector<LowLengths, DividendRange>::type;
+
+    return Merge{low_lengths};
 }
 
 template <typename LowLengths>
@@ -1,13 +1,18 @@
 #pragma once
 
+#include <chrono>
 #include <string>
 
 #include "stream_config.hpp"
+#include "device_instance_traits.hpp"
+#include "device_invocation_trace.hpp"
 
 namespace ck {
 namespace tensor_operation {
 namespace device {
 
+struct BaseOperator;
+
 struct BaseArgument
 {
     BaseArgument()                    = default;
@@ -30,6 +35,13 @@ struct BaseInvoker
         return float{0};
     }
 
+    // Run(), and record the invocation in InvocationTrace if tracing is enabled. problem describes
+    // the problem of p_arg, see InvocationRecord::problem
+    float TracedRun(const BaseOperator& op,
+                    const BaseArgument* p_arg,
+                    const std::string& problem,
+                    const StreamConfig& stream_config = StreamConfig{});
+
     virtual ~BaseInvoker() {}
 };
 
@@ -42,6 +54,9 @@ struct BaseOperator
     virtual bool IsSupportedArgument(const BaseArgument*) { return false; }
     virtual std::string GetTypeString() const { return ""; }
 
+    // structured counterpart of GetTypeString(), invalid for instances that do not provide it
+    virtual InstanceTraits GetInstanceTraits() const { return InstanceTraits{}; }
+
     virtual size_t GetWorkSpaceSize(const BaseArgument*) const { return 0; }
 
     virtual void SetWorkSpacePointer(BaseArgument* p_arg, void* p_workspace) const
@@ -53,6 +68,29 @@ struct BaseOperator
     virtual ~BaseOperator() {}
 };
 
+inline float BaseInvoker::TracedRun(const BaseOperator& op,
+                                    const BaseArgument* p_arg,
+                                    const std::string& problem,
+                                    const StreamConfig& stream_config)
+{
+    if(!InvocationTrace::IsEnabled())
+    {
+        return Run(p_arg, stream_config);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    const float kernel_time_ms = Run(p_arg, stream_config);
+
+    const std::chrono::duration<float, std::milli> host_time =
+        std::chrono::steady_clock::now() - start;
+
+    InvocationTrace::GetInstance().Record(
+        op.GetTypeString(), problem, op.GetWorkSpaceSize(p_arg), kernel_time_ms, host_time.count());
+
+    return kernel_time_ms;
+}
+
 } // namespace device
 } // namespace tensor_operation
 } // namespace ck
@@ -4,6 +4,7 @@
 
 #include "device.hpp"
 #include "device_base.hpp"
+#include "tensor_dimension_coalescing.hpp"
 #include "gridwise_binary_elementwise_1d.hpp"
 
 namespace ck {
@@ -101,9 +102,27 @@ struct DeviceBinaryElementwise : public BaseOperator
               blockSize_(256),
               gridSize_(120) // FIXME - Calculate the grid size by number of CU in the future
         {
-            a_grid_desc_m_ = MakeDescriptor_M(lengths, a_strides, gridSize_, blockSize_);
-            b_grid_desc_m_ = MakeDescriptor_M(lengths, b_strides, gridSize_, blockSize_);
-            c_grid_desc_m_ = MakeDescriptor_M(lengths, c_strides, gridSize_, blockSize_);
+            // drop unit dimensions and merge contiguous ones, so that problems of higher rank
+            // can be handled by this instance and the innermost dimension is as long as possible
+            const auto dims =
+                coalesce_elementwise_dimensions(lengths, {a_strides, b_strides, c_strides});
+
+            if(dims.GetRank() <= NDim)
+            {
+                const auto dims_nd = expand_elementwise_dimensions(dims, NDim);
+
+                lengths_   = dims_nd.lengths;
+                a_strides_ = dims_nd.strides[0];
+                b_strides_ = dims_nd.strides[1];
+                c_strides_ = dims_nd.strides[2];
+            }
+
+            if(lengths_.size() == NDim)
+            {
+                a_grid_desc_m_ = MakeDescriptor_M(lengths_, a_strides_, gridSize_, blockSize_);
+                b_grid_desc_m_ = MakeDescriptor_M(lengths_, b_strides_, gridSize_, blockSize_);
+                c_grid_desc_m_ = MakeDescriptor_M(lengths_, c_strides_, gridSize_, blockSize_);
+            }
         }
 
         const ADataType* p_a_;
@@ -559,6 +559,24 @@ struct DeviceGemmDl
     }
 
     // polymorphic
+    InstanceTraits GetInstanceTraits() const override
+    {
+        InstanceTraits traits;
+
+        traits.op_name             = "DeviceGemmDl";
+        traits.block_size          = BlockSize;
+        traits.m_per_block         = MPerBlock;
+        traits.n_per_block         = NPerBlock;
+        traits.k_per_block         = K0PerBlock * K1;
+        traits.k1                  = K1;
+        traits.c_scalar_per_vector = CThreadTransferDstScalarPerVector;
+        traits.lds_bytes           = GridwiseGemm::GetSharedMemoryNumberOfByte();
+        traits.num_prefetch_stages = 2; // LDS double buffer
+        traits.gemm_spec           = GemmSpec;
+
+        return traits;
+    }
+
     std::string GetTypeString() const override
     {
         auto str = std::stringstream();
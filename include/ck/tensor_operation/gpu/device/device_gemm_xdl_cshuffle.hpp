@@ -641,6 +641,26 @@ struct DeviceGemm_Xdl_CShuffle
     }
 
     // polymorphic
+    InstanceTraits GetInstanceTraits() const override
+    {
+        InstanceTraits traits;
+
+        traits.op_name             = "DeviceGemm_Xdl_CShuffle";
+        traits.block_size          = BlockSize;
+        traits.m_per_block         = MPerBlock;
+        traits.n_per_block         = NPerBlock;
+        traits.k_per_block         = KPerBlock;
+        traits.k1                  = AK1;
+        traits.a_scalar_per_vector = ABlockTransferSrcScalarPerVector;
+        traits.b_scalar_per_vector = BBlockTransferSrcScalarPerVector;
+        traits.c_scalar_per_vector = CShuffleBlockTransferScalarPerVector_NPerBlock;
+        traits.lds_bytes           = GridwiseGemm::GetSharedMemoryNumberOfByte();
+        traits.num_prefetch_stages = NumGemmKPrefetchStage;
+        traits.gemm_spec           = GemmSpec;
+
+        return traits;
+    }
+
     std::string GetTypeString() const override
     {
         auto str = std::stringstream();
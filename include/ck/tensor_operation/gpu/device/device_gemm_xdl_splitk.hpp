@@ -618,6 +618,27 @@ struct DeviceGemmXdlSplitK
     }
 
     // polymorphic
+    InstanceTraits GetInstanceTraits() const override
+    {
+        InstanceTraits traits;
+
+        traits.op_name             = "DeviceGemmXdlSplitK";
+        traits.block_size          = BlockSize;
+        traits.m_per_block         = MPerBlock;
+        traits.n_per_block         = NPerBlock;
+        traits.k_per_block         = K0PerBlock * K1;
+        traits.k1                  = K1;
+        traits.a_scalar_per_vector = ABlockTransferSrcScalarPerVector;
+        traits.b_scalar_per_vector = BBlockTransferSrcScalarPerVector;
+        traits.c_scalar_per_vector = CThreadTransferDstScalarPerVector;
+        traits.lds_bytes           = GridwiseGemm::GetSharedMemoryNumberOfByte();
+        traits.num_prefetch_stages = 1;
+        traits.is_split_k          = true;
+        traits.gemm_spec           = GemmSpec;
+
+        return traits;
+    }
+
     std::string GetTypeString() const override
     {
         auto str = std::stringstream();
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <string>
+
+#include "config.hpp"
+#include "gemm_specialization.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Tuning parameters of a device operation instance, for host-side tooling that needs to reason
+// about instances without parsing GetTypeString(). Fields that do not apply to an instance are 0.
+struct InstanceTraits
+{
+    // name of the device operation template, e.g. "DeviceGemmXdl"
+    std::string op_name;
+
+    index_t block_size  = 0;
+    index_t m_per_block = 0;
+    index_t n_per_block = 0;
+    // in elements, i.e. K0PerBlock * K1 for instances that tile K as K0 x K1
+    index_t k_per_block = 0;
+    index_t k1          = 0;
+
+    // vector width of the global memory accesses to A, B and C
+    index_t a_scalar_per_vector = 0;
+    index_t b_scalar_per_vector = 0;
+    index_t c_scalar_per_vector = 0;
+
+    index_t lds_bytes = 0;
+
+    // number of global memory prefetch stages of the main loop
+    index_t num_prefetch_stages = 0;
+
+    // K is split over KBatch groups of blocks, whose results are accumulated atomically
+    bool is_split_k = false;
+
+    GemmSpecialization gemm_spec = GemmSpecialization::Default;
+
+    bool IsValid() const { return block_size > 0; }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
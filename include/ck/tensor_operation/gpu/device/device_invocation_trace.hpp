@@ -0,0 +1,238 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// One traced call of BaseInvoker::TracedRun(). Strings are truncated to fit, so that records can
+// be kept in a preallocated ring buffer.
+struct InvocationRecord
+{
+    static constexpr std::size_t MaxOpNameLength  = 191;
+    static constexpr std::size_t MaxProblemLength = 255;
+
+    // BaseOperator::GetTypeString() of the instance that ran
+    char op_name[MaxOpNameLength + 1] = {};
+    // problem descriptor given by the caller; by convention the arguments of the ckProfiler
+    // command that reproduces the call, e.g. "gemm 1 0 0 0 0 1 3840 4096 4096 4096 4096 4096"
+    char problem[MaxProblemLength + 1] = {};
+
+    std::size_t workspace_bytes = 0;
+    // average kernel time returned by Run(), 0 unless StreamConfig::time_kernel_ was set
+    float kernel_time_ms = 0;
+    // host wall-clock time of Run(), which only covers the launch if the kernel was not timed
+    float host_time_ms = 0;
+    uint32_t thread_id = 0;
+};
+
+// Opt-in tracing of device operation invocations. Each thread appends to its own ring buffer of
+// the last RingSize records, without locking; only the first record of a thread takes a lock, to
+// register its ring buffer. When disabled, tracing costs one relaxed atomic load per call.
+//
+// Tracing is enabled by Enable(), or by setting the environment variable CK_TRACE_INVOCATIONS
+// to the name of a file, to which the trace is written at exit. The file can be replayed with
+// "ckProfiler replay <file>".
+class InvocationTrace
+{
+    public:
+    static constexpr std::size_t RingSize = 4096;
+
+    static InvocationTrace& GetInstance()
+    {
+        static InvocationTrace trace;
+
+        return trace;
+    }
+
+    static bool IsEnabled() { return GetInstance().enabled_.load(std::memory_order_relaxed); }
+
+    void Enable(bool enable = true) { enabled_.store(enable, std::memory_order_relaxed); }
+
+    void Record(const std::string& op_name,
+                const std::string& problem,
+                std::size_t workspace_bytes,
+                float kernel_time_ms,
+                float host_time_ms)
+    {
+        ThreadRing& ring = GetThreadRing();
+
+        const uint64_t index = ring.count.load(std::memory_order_relaxed);
+
+        Slot& slot = ring.slots[index % RingSize];
+
+        // odd sequence number while the slot is being written, see Collect()
+        slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        copy_string(slot.record.op_name, op_name, InvocationRecord::MaxOpNameLength);
+        copy_string(slot.record.problem, problem, InvocationRecord::MaxProblemLength);
+        slot.record.workspace_bytes = workspace_bytes;
+        slot.record.kernel_time_ms  = kernel_time_ms;
+        slot.record.host_time_ms    = host_time_ms;
+        slot.record.thread_id       = ring.thread_id;
+
+        slot.sequence.store(2 * index + 2, std::memory_order_release);
+        ring.count.store(index + 1, std::memory_order_release);
+    }
+
+    // Snapshot of the records of all threads, oldest first within each thread. Records that are
+    // being overwritten while the snapshot is taken are skipped.
+    std::vector<InvocationRecord> Collect()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::vector<InvocationRecord> records;
+
+        for(const auto& ring : rings_)
+        {
+            const uint64_t end   = ring->count.load(std::memory_order_acquire);
+            const uint64_t begin = end > RingSize ? end - RingSize : 0;
+
+            for(uint64_t index = begin; index < end; ++index)
+            {
+                const Slot& slot = ring->slots[index % RingSize];
+
+                if(slot.sequence.load(std::memory_order_acquire) != 2 * index + 2)
+                {
+                    continue;
+                }
+
+                InvocationRecord record = slot.record;
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if(slot.sequence.load(std::memory_order_relaxed) == 2 * index + 2)
+                {
+                    records.push_back(record);
+                }
+            }
+        }
+
+        return records;
+    }
+
+    // Write the trace in the replay format: one tab-separated line per invocation with thread id,
+    // op name, workspace bytes, kernel time (ms), host time (ms) and problem, after a header line
+    void Dump(std::ostream& os)
+    {
+        os << "# thread\top\tworkspace_bytes\tkernel_time_ms\thost_time_ms\tproblem\n";
+
+        for(const auto& record : Collect())
+        {
+            os << record.thread_id << '\t' << record.op_name << '\t' << record.workspace_bytes
+               << '\t' << record.kernel_time_ms << '\t' << record.host_time_ms << '\t'
+               << record.problem << '\n';
+        }
+    }
+
+    void Dump(const std::string& file_name)
+    {
+        std::ofstream file(file_name);
+
+        if(!file)
+        {
+            throw std::runtime_error("wrong! cannot open " + file_name);
+        }
+
+        Dump(file);
+    }
+
+    // op_name as stored in InvocationRecord::op_name, to match the instances of a dumped trace
+    static std::string GetRecordedOpName(const std::string& op_name)
+    {
+        char recorded[InvocationRecord::MaxOpNameLength + 1];
+
+        copy_string(recorded, op_name, InvocationRecord::MaxOpNameLength);
+
+        return recorded;
+    }
+
+    ~InvocationTrace()
+    {
+        if(!dump_file_name_.empty())
+        {
+            std::ofstream file(dump_file_name_);
+
+            if(file)
+            {
+                Dump(file);
+            }
+        }
+    }
+
+    private:
+    struct Slot
+    {
+        std::atomic<uint64_t> sequence{0};
+        InvocationRecord record;
+    };
+
+    struct ThreadRing
+    {
+        uint32_t thread_id = 0;
+        std::atomic<uint64_t> count{0};
+        std::array<Slot, RingSize> slots;
+    };
+
+    InvocationTrace()
+    {
+        if(const char* file_name = std::getenv("CK_TRACE_INVOCATIONS"))
+        {
+            dump_file_name_ = file_name;
+            enabled_.store(!dump_file_name_.empty(), std::memory_order_relaxed);
+        }
+    }
+
+    ThreadRing& GetThreadRing()
+    {
+        thread_local ThreadRing* p_ring = nullptr;
+
+        if(p_ring == nullptr)
+        {
+            // rings are owned by the trace, so records outlive the threads that wrote them
+            auto ring = std::make_unique<ThreadRing>();
+
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            ring->thread_id = static_cast<uint32_t>(rings_.size());
+            p_ring          = ring.get();
+            rings_.push_back(std::move(ring));
+        }
+
+        return *p_ring;
+    }
+
+    // tabs and newlines would break the replay format
+    static void copy_string(char* dst, const std::string& src, std::size_t max_length)
+    {
+        std::size_t i = 0;
+
+        for(; i < src.size() && i < max_length; ++i)
+        {
+            dst[i] = (src[i] == '\t' || src[i] == '\n') ? ' ' : src[i];
+        }
+
+        dst[i] = '\0';
+    }
+
+    std::atomic<bool> enabled_{false};
+    std::string dump_file_name_;
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<ThreadRing>> rings_;
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
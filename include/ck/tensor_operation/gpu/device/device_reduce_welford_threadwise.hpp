@@ -0,0 +1,231 @@
+#pragma once
+
+#include <iostream>
+#include <sstream>
+#include "device.hpp"
+#include "device_base.hpp"
+#include "device_reduce_common.hpp"
+#include "device_reduce_threadwise.hpp"
+#include "gridwise_2d_welford_threadwise.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Mean and population variance of the input over reduceDims, computed in a single pass by
+// reduce::Welford, with each thread reducing MThreadSliceSize rows of the reduced dimensions.
+template <typename InDataType,
+          typename AccDataType,
+          typename MeanDataType,
+          typename VarDataType,
+          index_t Rank,
+          index_t NumReduceDim,
+          bool PropagateNan,
+          index_t BlockSize,
+          index_t MThreadSliceSize,
+          index_t KThreadSliceSize,
+          index_t InSrcVectorDim,
+          index_t InSrcVectorSize>
+struct DeviceReduceWelfordThreadWise : public BaseOperator
+{
+    static_assert(Rank <= 6, "Bigger Rank size is not supported!");
+
+    static_assert((InSrcVectorDim == 0 && MThreadSliceSize % InSrcVectorSize == 0) ||
+                      (InSrcVectorDim == 1 && KThreadSliceSize % InSrcVectorSize == 0),
+                  "Invalid thread slice sizes and/or vector sizes configuration, please check!");
+
+    static constexpr index_t NumInvariantDim = Rank - NumReduceDim;
+
+    static constexpr index_t M_BlockTileSize = BlockSize * MThreadSliceSize;
+
+    // the input and output descriptors are those of the threadwise reduction, whose tiles are
+    // the same
+    using ReduceDescriptors = DeviceReduceThreadWise<InDataType,
+                                                     AccDataType,
+                                                     MeanDataType,
+                                                     Rank,
+                                                     NumReduceDim,
+                                                     reduce::Add,
+                                                     element_wise::PassThrough,
+                                                     element_wise::PassThrough,
+                                                     PropagateNan,
+                                                     false,
+                                                     false,
+                                                     BlockSize,
+                                                     MThreadSliceSize,
+                                                     KThreadSliceSize,
+                                                     InSrcVectorDim,
+                                                     InSrcVectorSize,
+                                                     1>;
+
+    struct Argument : public BaseArgument
+    {
+        Argument(const std::vector<index_t> inLengths,
+                 const std::vector<index_t> inStrides,
+                 const std::vector<index_t> outLengths,
+                 const std::vector<index_t> outStrides,
+                 const std::vector<int> reduceDims,
+                 const InDataType* in_dev,
+                 MeanDataType* mean_dev,
+                 VarDataType* variance_dev)
+            : outLengths_{outLengths},
+              outStrides_{outStrides},
+              in_dev_{in_dev},
+              mean_dev_{mean_dev},
+              variance_dev_{variance_dev}
+        {
+            inLengths_ = shuffle_tensor_dimensions<Rank, NumReduceDim>(inLengths, reduceDims);
+            inStrides_ = shuffle_tensor_dimensions<Rank, NumReduceDim>(inStrides, reduceDims);
+
+            std::tie(invariant_total_length, reduce_total_length) =
+                get_2d_lengths<Rank, NumReduceDim>(inLengths_);
+
+            if constexpr(NumInvariantDim == 0)
+                invariant_lowest_length = 1;
+            else
+                invariant_lowest_length = inLengths_[NumInvariantDim - 1];
+
+            reduce_lowest_length = inLengths_[Rank - 1];
+
+            gridSize = math::integer_least_multiple(invariant_total_length, M_BlockTileSize) /
+                       M_BlockTileSize;
+        }
+
+        std::vector<index_t> inLengths_;
+        std::vector<index_t> inStrides_;
+        std::vector<index_t> outLengths_;
+        std::vector<index_t> outStrides_;
+
+        const InDataType* in_dev_;
+        MeanDataType* mean_dev_;
+        VarDataType* variance_dev_;
+
+        index_t invariant_lowest_length;
+        index_t reduce_lowest_length;
+        long_index_t invariant_total_length;
+        long_index_t reduce_total_length;
+
+        size_t gridSize;
+    };
+
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            const auto in_grid_desc_m_k =
+                ReduceDescriptors::MakeSrc2dDescriptor(arg.inLengths_, arg.inStrides_);
+            const auto out_grid_desc_m =
+                ReduceDescriptors::MakeDst1dDescriptor(arg.outLengths_, arg.outStrides_);
+            using InGridDesc_M_K = decltype(in_grid_desc_m_k);
+            using OutGridDesc_M  = decltype(out_grid_desc_m);
+
+            using GridwiseWelford = GridwiseWelford_mk_to_m_threadwise<InDataType,
+                                                                       MeanDataType,
+                                                                       VarDataType,
+                                                                       AccDataType,
+                                                                       InGridDesc_M_K,
+                                                                       OutGridDesc_M,
+                                                                       PropagateNan,
+                                                                       BlockSize,
+                                                                       MThreadSliceSize,
+                                                                       KThreadSliceSize,
+                                                                       InSrcVectorDim,
+                                                                       InSrcVectorSize>;
+
+            const auto kernel = kernel_welford_threadwise<GridwiseWelford,
+                                                          InDataType,
+                                                          MeanDataType,
+                                                          VarDataType,
+                                                          InGridDesc_M_K,
+                                                          OutGridDesc_M>;
+
+            return launch_and_time_kernel(stream_config,
+                                          kernel,
+                                          dim3(arg.gridSize),
+                                          dim3(BlockSize),
+                                          0,
+                                          in_grid_desc_m_k,
+                                          out_grid_desc_m,
+                                          static_cast<index_t>(arg.reduce_total_length),
+                                          arg.in_dev_,
+                                          arg.mean_dev_,
+                                          arg.variance_dev_);
+        };
+
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        };
+    };
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        const Argument* pArg = dynamic_cast<const Argument*>(p_arg);
+
+        if constexpr(InSrcVectorDim == 0)
+        {
+            if constexpr(NumInvariantDim == 0)
+            {
+                return (false);
+            }
+            else
+            {
+                if(pArg->inStrides_[NumInvariantDim - 1] != 1)
+                    return (false);
+
+                if(pArg->invariant_lowest_length % InSrcVectorSize != 0)
+                    return (false);
+            };
+        }
+        else
+        {
+            if(pArg->inStrides_[Rank - 1] != 1)
+                return (false);
+
+            if(pArg->reduce_lowest_length % InSrcVectorSize != 0)
+                return (false);
+        };
+
+        return (true);
+    };
+
+    std::unique_ptr<BaseArgument> MakeArgumentPointer(const std::vector<index_t> inLengths,
+                                                      const std::vector<index_t> inStrides,
+                                                      const std::vector<index_t> outLengths,
+                                                      const std::vector<index_t> outStrides,
+                                                      const std::vector<int> reduceDims,
+                                                      const void* in_dev,
+                                                      void* mean_dev,
+                                                      void* variance_dev)
+    {
+        return std::make_unique<Argument>(inLengths,
+                                          inStrides,
+                                          outLengths,
+                                          outStrides,
+                                          reduceDims,
+                                          static_cast<const InDataType*>(in_dev),
+                                          static_cast<MeanDataType*>(mean_dev),
+                                          static_cast<VarDataType*>(variance_dev));
+    };
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() { return std::make_unique<Invoker>(); };
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceReduceWelfordThreadWise<" << BlockSize << ",";
+        str << "M_C" << BlockSize << "_S" << MThreadSliceSize << ",";
+        str << "K_C" << 1 << "_S" << KThreadSliceSize << ",";
+        str << "InSrcVectorDim_" << InSrcVectorDim << "_InSrcVectorSize_" << InSrcVectorSize << ">";
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
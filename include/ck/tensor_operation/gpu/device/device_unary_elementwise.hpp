@@ -4,6 +4,7 @@
 
 #include "device.hpp"
 #include "device_base.hpp"
+#include "tensor_dimension_coalescing.hpp"
 #include "gridwise_unary_elementwise_1d.hpp"
 
 namespace ck {
@@ -77,19 +78,40 @@ struct DeviceUnaryElementwise : public BaseOperator
             : p_a_(p_a),
               p_b_(p_b),
               shape_(shape),
+              stride_a_(stride_a),
+              stride_b_(stride_b),
               functor_(functor),
               blockSize_(256) // FIXME - Calculate the grid size by number of CU in the future
         {
+            // drop unit dimensions and merge contiguous ones, so that problems of higher rank
+            // can be handled by this instance and the innermost dimension is as long as possible
+            const auto dims = coalesce_elementwise_dimensions(shape, {stride_a, stride_b});
+
+            if(dims.GetRank() <= Dim)
+            {
+                const auto dims_nd = expand_elementwise_dimensions(dims, Dim);
+
+                shape_    = dims_nd.lengths;
+                stride_a_ = dims_nd.strides[0];
+                stride_b_ = dims_nd.strides[1];
+            }
+
             index_t tensor_size =
                 std::accumulate(shape.begin(), shape.end(), 1, std::multiplies<int>{});
-            gridSize_       = GridwiseUEltwise::CalculateGridSize(tensor_size);
-            a_grid_desc_m0_ = MakeDescriptor_M0(shape, stride_a, gridSize_, blockSize_);
-            b_grid_desc_m0_ = MakeDescriptor_M0(shape, stride_b, gridSize_, blockSize_);
+            gridSize_ = GridwiseUEltwise::CalculateGridSize(tensor_size);
+
+            if(shape_.size() == Dim)
+            {
+                a_grid_desc_m0_ = MakeDescriptor_M0(shape_, stride_a_, gridSize_, blockSize_);
+                b_grid_desc_m0_ = MakeDescriptor_M0(shape_, stride_b_, gridSize_, blockSize_);
+            }
         }
 
         const ADataType* p_a_;
         BDataType* p_b_;
         std::vector<int> shape_;
+        std::vector<index_t> stride_a_;
+        std::vector<index_t> stride_b_;
         GridDesc_M0 a_grid_desc_m0_;
         GridDesc_M0 b_grid_desc_m0_;
         ElementwiseFunctor functor_;
@@ -135,6 +157,9 @@ struct DeviceUnaryElementwise : public BaseOperator
         if(pArg == nullptr)
             return false;
 
+        if(pArg->shape_.size() != Dim)
+            return false;
+
         if(pArg->shape_.back() % ScalarPerVector != 0)
             return false;
 
@@ -0,0 +1,301 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include "config.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Host-side canonicalization of the dimensions of tensors that are traversed together by
+// elementwise and reduction operations. Dimensions of length 1 are dropped, and neighbouring
+// dimensions i and i + 1 are merged if, for every tensor,
+// stride[i] == stride[i + 1] * length[i + 1] (this includes broadcast dimensions, where both
+// strides are 0). The result describes the same element mapping with fewer dimensions, so it can
+// be handled by an instance of lower rank.
+struct CoalescedDimensions
+{
+    std::vector<index_t> lengths;
+
+    // strides of every tensor, in the order the tensors were given
+    std::vector<std::vector<index_t>> strides;
+
+    // reduction only: reduce dimensions of the coalesced input, and lengths of the output
+    std::vector<int> reduce_dims;
+    std::vector<index_t> out_lengths;
+
+    // dimension chosen for vectorized access, -1 if no tensor has unit stride in any dimension
+    int vector_dim = -1;
+
+    index_t GetRank() const { return static_cast<index_t>(lengths.size()); }
+};
+
+// largest power of 2, not exceeding max_scalar_per_vector, that divides length
+inline index_t get_max_scalar_per_vector(index_t length, index_t max_scalar_per_vector)
+{
+    index_t scalar_per_vector = 1;
+
+    while(scalar_per_vector * 2 <= max_scalar_per_vector && length % (scalar_per_vector * 2) == 0)
+    {
+        scalar_per_vector *= 2;
+    }
+
+    return scalar_per_vector;
+}
+
+namespace detail {
+
+// drop length-1 dimensions and merge neighbours of the same group with compatible strides.
+// group[i] identifies dimensions that may be merged. If all dimensions have length 1, the last one
+// is kept
+inline void coalesce_dimensions(std::vector<index_t>& lengths,
+                                std::vector<std::vector<index_t>>& strides,
+                                std::vector<int>& group)
+{
+    const std::size_t rank = lengths.size();
+
+    std::vector<index_t> new_lengths;
+    std::vector<std::vector<index_t>> new_strides(strides.size());
+    std::vector<int> new_group;
+
+    for(std::size_t i = 0; i < rank; ++i)
+    {
+        if(lengths[i] == 1 && !(i + 1 == rank && new_lengths.empty()))
+        {
+            continue;
+        }
+
+        bool mergeable = !new_lengths.empty() && new_group.back() == group[i];
+
+        for(std::size_t t = 0; t < strides.size() && mergeable; ++t)
+        {
+            mergeable = new_strides[t].back() == strides[t][i] * lengths[i];
+        }
+
+        if(mergeable)
+        {
+            new_lengths.back() *= lengths[i];
+
+            for(std::size_t t = 0; t < strides.size(); ++t)
+            {
+                new_strides[t].back() = strides[t][i];
+            }
+        }
+        else
+        {
+            new_lengths.push_back(lengths[i]);
+            new_group.push_back(group[i]);
+
+            for(std::size_t t = 0; t < strides.size(); ++t)
+            {
+                new_strides[t].push_back(strides[t][i]);
+            }
+        }
+    }
+
+    lengths = new_lengths;
+    strides = new_strides;
+    group   = new_group;
+}
+
+} // namespace detail
+
+// Elementwise operations: all tensors share lengths and differ in strides (0 for broadcast), the
+// output is the last tensor. Any permutation of dimensions that is applied to all tensors alike is
+// legal, so the dimension in which most tensors have unit stride is moved innermost before
+// merging, to enable vectorized access. Ties are resolved in favour of the dimension in which the
+// output has unit stride, then of the innermost one, so that writes are never made strided.
+inline CoalescedDimensions
+coalesce_elementwise_dimensions(const std::vector<index_t>& lengths,
+                                const std::vector<std::vector<index_t>>& strides)
+{
+    for(const auto& s : strides)
+    {
+        assert(s.size() == lengths.size());
+        (void)s;
+    }
+
+    CoalescedDimensions result;
+
+    result.lengths = lengths;
+    result.strides = strides;
+
+    const int rank = static_cast<int>(lengths.size());
+
+    auto num_unit_stride = [&](int d) {
+        return std::count_if(
+            strides.begin(), strides.end(), [&](const auto& s) { return s[d] == 1; });
+    };
+
+    int vector_dim = -1;
+
+    for(int d = rank - 1; d >= 0; --d)
+    {
+        if(lengths[d] == 1 || num_unit_stride(d) == 0)
+        {
+            continue;
+        }
+
+        if(vector_dim < 0 || num_unit_stride(d) > num_unit_stride(vector_dim) ||
+           (num_unit_stride(d) == num_unit_stride(vector_dim) && strides.back()[d] == 1 &&
+            strides.back()[vector_dim] != 1))
+        {
+            vector_dim = d;
+        }
+    }
+
+    if(vector_dim >= 0 && vector_dim != rank - 1)
+    {
+        auto move_to_back = [&](auto& v) {
+            std::rotate(v.begin() + vector_dim, v.begin() + vector_dim + 1, v.end());
+        };
+
+        move_to_back(result.lengths);
+
+        for(auto& s : result.strides)
+        {
+            move_to_back(s);
+        }
+    }
+
+    std::vector<int> group(rank, 0);
+
+    detail::coalesce_dimensions(result.lengths, result.strides, group);
+
+    result.vector_dim = vector_dim >= 0 ? result.GetRank() - 1 : -1;
+
+    return result;
+}
+
+// Reductions: invariant and reduce dimensions are only merged with dimensions of their own kind,
+// and their relative order is kept. outStrides has one entry per invariant dimension of the input,
+// in order, as taken by DeviceReduce (a single entry if all dimensions are reduced).
+// The result holds the input strides in strides[0] and the output strides in strides[1].
+// vector_dim follows the InSrcVectorDim convention of DeviceReduce: 1 if the innermost reduce
+// dimension has unit input stride, 0 if the innermost invariant dimension has, -1 otherwise.
+inline CoalescedDimensions coalesce_reduction_dimensions(const std::vector<index_t>& inLengths,
+                                                         const std::vector<index_t>& inStrides,
+                                                         const std::vector<index_t>& outStrides,
+                                                         const std::vector<int>& reduceDims)
+{
+    const int rank = static_cast<int>(inLengths.size());
+
+    assert(inStrides.size() == inLengths.size());
+
+    // expand output strides to the rank of the input, reduce dims do not move the output
+    std::vector<int> group(rank, 0);
+    std::vector<index_t> expandedOutStrides(rank, 0);
+
+    for(int d : reduceDims)
+    {
+        group[d] = 1;
+    }
+
+    for(int d = 0, i = 0; d < rank; ++d)
+    {
+        if(group[d] == 0)
+        {
+            assert(i < static_cast<int>(outStrides.size()));
+            expandedOutStrides[d] = outStrides[i++];
+        }
+    }
+
+    CoalescedDimensions result;
+
+    result.lengths = inLengths;
+    result.strides = {inStrides, expandedOutStrides};
+
+    detail::coalesce_dimensions(result.lengths, result.strides, group);
+
+    // keep a reduce dimension of length 1 if all reduce dimensions had length 1
+    if(std::find(group.begin(), group.end(), 1) == group.end())
+    {
+        if(result.lengths.size() == 1 && result.lengths[0] == 1)
+        {
+            result.lengths.clear();
+            result.strides = {{}, {}};
+            group.clear();
+        }
+
+        result.lengths.push_back(1);
+        result.strides[0].push_back(0);
+        result.strides[1].push_back(0);
+        group.push_back(1);
+    }
+
+    std::vector<index_t> compactOutStrides;
+
+    for(int d = 0; d < result.GetRank(); ++d)
+    {
+        if(group[d] == 1)
+        {
+            result.reduce_dims.push_back(d);
+        }
+        else
+        {
+            result.out_lengths.push_back(result.lengths[d]);
+            compactOutStrides.push_back(result.strides[1][d]);
+        }
+    }
+
+    if(result.out_lengths.empty())
+    {
+        result.out_lengths = {1};
+        compactOutStrides  = {1};
+    }
+
+    result.strides[1] = compactOutStrides;
+
+    // innermost dimension of each kind
+    int last_reduce_dim    = -1;
+    int last_invariant_dim = -1;
+
+    for(int d = 0; d < result.GetRank(); ++d)
+    {
+        (group[d] == 1 ? last_reduce_dim : last_invariant_dim) = d;
+    }
+
+    if(last_reduce_dim >= 0 && result.strides[0][last_reduce_dim] == 1)
+    {
+        result.vector_dim = 1;
+    }
+    else if(last_invariant_dim >= 0 && result.strides[0][last_invariant_dim] == 1)
+    {
+        result.vector_dim = 0;
+    }
+
+    return result;
+}
+
+// Prepend length-1 dimensions to the coalesced dimensions of an elementwise operation, so that
+// they can be handled by an instance of higher, fixed rank.
+inline CoalescedDimensions expand_elementwise_dimensions(const CoalescedDimensions& dims,
+                                                         index_t rank)
+{
+    assert(dims.GetRank() <= rank);
+
+    const index_t num_pad = rank - dims.GetRank();
+
+    CoalescedDimensions result = dims;
+
+    result.lengths.insert(result.lengths.begin(), num_pad, 1);
+
+    for(auto& s : result.strides)
+    {
+        s.insert(s.begin(), num_pad, 0);
+    }
+
+    if(result.vector_dim >= 0)
+    {
+        result.vector_dim += num_pad;
+    }
+
+    return result;
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
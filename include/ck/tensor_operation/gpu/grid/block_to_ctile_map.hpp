@@ -451,6 +451,358 @@ struct BlockToCTileMap_KSplit_M00_N00_M01_N01
     UnderlyingMap underlying_map_;
 };
 
+enum struct CTileOrdering
+{
+    Morton,  // Z-order
+    Hilbert, //
+};
+
+// Rows of square space-filling-curve patches
+// C-tiles are grouped into S01 x S01 patches that are visited in row-major order. Inside a full
+// patch, tiles are visited along a Morton or Hilbert curve, so that concurrently running blocks
+// share as many A and B panels as possible. Partial patches at the M/N edges fall back to
+// row-major order. S01 must be a power of 2.
+template <index_t MPerBlock, index_t NPerBlock, typename CGridDesc_M_N, CTileOrdering Ordering>
+struct BlockToCTileMap_M00_N00_S01CurveAdapt
+{
+    static constexpr auto I0 = Number<0>{};
+    static constexpr auto I1 = Number<1>{};
+
+    __host__ __device__ BlockToCTileMap_M00_N00_S01CurveAdapt() = default;
+
+    __host__ __device__ BlockToCTileMap_M00_N00_S01CurveAdapt(const CGridDesc_M_N& c_grid_desc_m_n,
+                                                              index_t S01 = 8)
+        : S01_(S01), c_grid_desc_m_n_(c_grid_desc_m_n)
+    {
+    }
+
+    __host__ constexpr index_t CalculateGridSize(const CGridDesc_M_N& c_grid_desc_m_n) const
+    {
+        const auto M0 = math::integer_divide_ceil(c_grid_desc_m_n.GetLength(I0), MPerBlock);
+        const auto N0 = math::integer_divide_ceil(c_grid_desc_m_n.GetLength(I1), NPerBlock);
+
+        const index_t grid_size = M0 * N0;
+
+        return grid_size;
+    }
+
+    template <typename TopIdx>
+    __host__ __device__ constexpr auto CalculateBottomIndex(const TopIdx& idx_top) const
+    {
+        auto block_1d_id = idx_top[I0];
+
+        const index_t M0 = math::integer_divide_ceil(c_grid_desc_m_n_.GetLength(I0), MPerBlock);
+        const index_t N0 = math::integer_divide_ceil(c_grid_desc_m_n_.GetLength(I1), NPerBlock);
+
+        block_1d_id = block_1d_id % (M0 * N0); // swallow batch index
+
+        // row of patches, all rows above it are full
+        const index_t idx_M00       = block_1d_id / (S01_ * N0);
+        const index_t M0_patch_base = idx_M00 * S01_;
+        const index_t M01_adapt     = math::min(S01_, M0 - M0_patch_base);
+
+        index_t idx_local = block_1d_id - M0_patch_base * N0;
+
+        // patch within the row, all patches left of it are full
+        const index_t idx_N00       = idx_local / (M01_adapt * S01_);
+        const index_t N0_patch_base = idx_N00 * S01_;
+        const index_t N01_adapt     = math::min(S01_, N0 - N0_patch_base);
+
+        idx_local -= N0_patch_base * M01_adapt;
+
+        index_t idx_M01 = 0;
+        index_t idx_N01 = 0;
+
+        if(M01_adapt == S01_ && N01_adapt == S01_)
+        {
+            if constexpr(Ordering == CTileOrdering::Morton)
+            {
+                DecodeMorton(idx_local, idx_M01, idx_N01);
+            }
+            else
+            {
+                DecodeHilbert(S01_, idx_local, idx_M01, idx_N01);
+            }
+        }
+        else
+        {
+            idx_M01 = idx_local / N01_adapt;
+            idx_N01 = idx_local % N01_adapt;
+        }
+
+        return make_tuple(M0_patch_base + idx_M01, N0_patch_base + idx_N01);
+    }
+
+    template <typename CTileIdx, typename CTileDim>
+    __host__ __device__ bool ValidCTileIndex(const CTileIdx& /* c_tile_idx */,
+                                             const CTileDim& /* c_tile_dim */) const
+    {
+        return true; // always valid provided that user gets grid size from CalculateGridSize()
+    }
+
+    __host__ bool CheckValidity(const CGridDesc_M_N& /* c_grid_desc_m_n */) const
+    {
+        return S01_ > 0 && (S01_ & (S01_ - 1)) == 0;
+    }
+
+    private:
+    // even bits of the curve index go to N, odd bits go to M
+    __host__ __device__ static constexpr void
+    DecodeMorton(index_t d, index_t& idx_M01, index_t& idx_N01)
+    {
+        idx_M01 = 0;
+        idx_N01 = 0;
+
+        for(index_t bit = 0; (d >> (2 * bit)) != 0; ++bit)
+        {
+            idx_N01 |= ((d >> (2 * bit)) & 1) << bit;
+            idx_M01 |= ((d >> (2 * bit + 1)) & 1) << bit;
+        }
+    }
+
+    __host__ __device__ static constexpr void
+    DecodeHilbert(index_t side, index_t d, index_t& idx_M01, index_t& idx_N01)
+    {
+        idx_M01 = 0;
+        idx_N01 = 0;
+
+        for(index_t s = 1; s < side; s *= 2)
+        {
+            const index_t rm = 1 & (d / 2);
+            const index_t rn = 1 & (d ^ rm);
+
+            // rotate quadrant
+            if(rn == 0)
+            {
+                if(rm == 1)
+                {
+                    idx_M01 = s - 1 - idx_M01;
+                    idx_N01 = s - 1 - idx_N01;
+                }
+
+                const index_t tmp = idx_M01;
+                idx_M01           = idx_N01;
+                idx_N01           = tmp;
+            }
+
+            idx_M01 += s * rm;
+            idx_N01 += s * rn;
+            d /= 4;
+        }
+    }
+
+    index_t S01_;
+    CGridDesc_M_N c_grid_desc_m_n_;
+};
+
+template <index_t MPerBlock, index_t NPerBlock, typename CGridDesc_M_N>
+using BlockToCTileMap_M00_N00_S01MortonAdapt =
+    BlockToCTileMap_M00_N00_S01CurveAdapt<MPerBlock,
+                                          NPerBlock,
+                                          CGridDesc_M_N,
+                                          CTileOrdering::Morton>;
+
+template <index_t MPerBlock, index_t NPerBlock, typename CGridDesc_M_N>
+using BlockToCTileMap_M00_N00_S01HilbertAdapt =
+    BlockToCTileMap_M00_N00_S01CurveAdapt<MPerBlock,
+                                          NPerBlock,
+                                          CGridDesc_M_N,
+                                          CTileOrdering::Hilbert>;
+
+// Stream-K / data-parallel hybrid
+// A fixed number of persistent "stream-K" (SK) blocks share the K-iterations of the first
+// sk_num_tiles C-tiles evenly, while the remaining C-tiles are processed whole by one
+// "data-parallel" (DP) block each. All K-iterations of all C-tiles are laid out in one linear
+// iteration space: tile t owns iterations [t * k_iters_per_tile, (t + 1) * k_iters_per_tile).
+// SK tiles come first in that space, followed by DP tiles.
+//
+// Fix-up: a C-tile whose K-iterations are split across several SK blocks is finalized by its
+// "owner", the block that processes the tile's first K-iteration. Every other contributor starts
+// in the middle of that tile, so each SK block produces at most one partial tile, which it stores
+// in the partial-accumulation slot with its own block index.
+template <index_t MPerBlock, index_t NPerBlock, index_t KPerBlock, typename CGridDesc_M_N>
+struct BlockToCTileMap_GemmStreamK
+{
+    static constexpr auto I0 = Number<0>{};
+    static constexpr auto I1 = Number<1>{};
+
+    __host__ __device__ BlockToCTileMap_GemmStreamK() = default;
+
+    // num_cu * occupancy is the number of persistent blocks that can be resident at the same
+    // time. sk_blocks overrides the number of stream-K blocks if non-negative.
+    __host__ __device__ BlockToCTileMap_GemmStreamK(const CGridDesc_M_N& c_grid_desc_m_n,
+                                                    index_t K,
+                                                    index_t num_cu,
+                                                    index_t occupancy = 1,
+                                                    index_t sk_blocks = -1)
+    {
+        M0_ = math::integer_divide_ceil(c_grid_desc_m_n.GetLength(I0), MPerBlock);
+        N0_ = math::integer_divide_ceil(c_grid_desc_m_n.GetLength(I1), NPerBlock);
+
+        k_iters_per_tile_ = math::max(math::integer_divide_ceil(K, KPerBlock), 1);
+
+        const index_t num_tiles = M0_ * N0_;
+        const index_t grid_size = math::max(num_cu * occupancy, 1);
+
+        // tiles that do not fill up a full wave of blocks are handled by stream-K
+        sk_num_tiles_ = sk_blocks == 0 ? 0 : num_tiles % grid_size;
+
+        const index_t sk_total_iters = sk_num_tiles_ * k_iters_per_tile_;
+
+        sk_num_blocks_ = sk_blocks < 0 ? grid_size : sk_blocks;
+        sk_num_blocks_ = math::min(sk_num_blocks_, sk_total_iters);
+
+        if(sk_num_blocks_ > 0)
+        {
+            k_iters_per_sk_block_ = sk_total_iters / sk_num_blocks_;
+            sk_num_big_blocks_    = sk_total_iters % sk_num_blocks_;
+        }
+        else
+        {
+            k_iters_per_sk_block_ = 0;
+            sk_num_big_blocks_    = 0;
+        }
+
+        dp_num_blocks_ = num_tiles - sk_num_tiles_;
+    }
+
+    __host__ constexpr index_t CalculateGridSize(const CGridDesc_M_N& /* c_grid_desc_m_n */) const
+    {
+        return sk_num_blocks_ + dp_num_blocks_;
+    }
+
+    __host__ __device__ constexpr index_t GetNumTiles() const { return M0_ * N0_; }
+
+    __host__ __device__ constexpr index_t GetKItersPerTile() const { return k_iters_per_tile_; }
+
+    __host__ __device__ constexpr index_t GetNumStreamKTiles() const { return sk_num_tiles_; }
+
+    __host__ __device__ constexpr index_t GetNumStreamKBlocks() const { return sk_num_blocks_; }
+
+    __host__ __device__ constexpr index_t GetNumDataParallelBlocks() const
+    {
+        return dp_num_blocks_;
+    }
+
+    __host__ __device__ constexpr bool IsStreamKBlock(index_t block_1d_id) const
+    {
+        return block_1d_id < sk_num_blocks_;
+    }
+
+    // [iter_begin, iter_end) of the linear K-iteration space processed by a block
+    __host__ __device__ constexpr void
+    GetBlockItr(index_t block_1d_id, index_t& iter_begin, index_t& iter_end) const
+    {
+        if(block_1d_id < sk_num_big_blocks_)
+        {
+            iter_begin = block_1d_id * (k_iters_per_sk_block_ + 1);
+            iter_end   = iter_begin + k_iters_per_sk_block_ + 1;
+        }
+        else if(block_1d_id < sk_num_blocks_)
+        {
+            iter_begin = sk_num_big_blocks_ * (k_iters_per_sk_block_ + 1) +
+                         (block_1d_id - sk_num_big_blocks_) * k_iters_per_sk_block_;
+            iter_end = iter_begin + k_iters_per_sk_block_;
+        }
+        else
+        {
+            iter_begin = (sk_num_tiles_ + block_1d_id - sk_num_blocks_) * k_iters_per_tile_;
+            iter_end   = iter_begin + k_iters_per_tile_;
+        }
+    }
+
+    // block that processes a given iteration of the linear K-iteration space
+    __host__ __device__ constexpr index_t GetBlockIdx(index_t iter) const
+    {
+        const index_t sk_total_iters = sk_num_tiles_ * k_iters_per_tile_;
+        const index_t big_iters      = sk_num_big_blocks_ * (k_iters_per_sk_block_ + 1);
+
+        if(iter >= sk_total_iters)
+        {
+            return sk_num_blocks_ + (iter - sk_total_iters) / k_iters_per_tile_;
+        }
+        else if(iter < big_iters)
+        {
+            return iter / (k_iters_per_sk_block_ + 1);
+        }
+        else
+        {
+            return sk_num_big_blocks_ + (iter - big_iters) / k_iters_per_sk_block_;
+        }
+    }
+
+    __host__ __device__ constexpr index_t GetTileIdx(index_t iter) const
+    {
+        return iter / k_iters_per_tile_;
+    }
+
+    __host__ __device__ constexpr index_t GetTileIterBegin(index_t tile_idx) const
+    {
+        return tile_idx * k_iters_per_tile_;
+    }
+
+    // number of iterations, starting at iter, that a block processes on the current C-tile
+    __host__ __device__ constexpr index_t GetCurrentIterLength(index_t iter, index_t iter_end) const
+    {
+        const index_t tile_iter_end = GetTileIterBegin(GetTileIdx(iter) + 1);
+
+        return math::min(iter_end, tile_iter_end) - iter;
+    }
+
+    // block that finalizes a C-tile, i.e. the one that processes the tile's first K-iteration
+    __host__ __device__ constexpr index_t GetTileOwnerBlockIdx(index_t tile_idx) const
+    {
+        return GetBlockIdx(GetTileIterBegin(tile_idx));
+    }
+
+    // number of blocks that contribute to a C-tile, including its owner
+    __host__ __device__ constexpr index_t GetTileNumContributors(index_t tile_idx) const
+    {
+        return GetBlockIdx(GetTileIterBegin(tile_idx + 1) - 1) - GetTileOwnerBlockIdx(tile_idx) + 1;
+    }
+
+    __host__ __device__ constexpr bool IsTileOwner(index_t block_1d_id, index_t tile_idx) const
+    {
+        return GetTileOwnerBlockIdx(tile_idx) == block_1d_id;
+    }
+
+    // partial accumulation tiles (one per stream-K block) followed by one flag per stream-K block
+    __host__ constexpr std::size_t GetWorkspaceSize(std::size_t acc_element_size) const
+    {
+        return static_cast<std::size_t>(sk_num_blocks_) * MPerBlock * NPerBlock *
+                   acc_element_size +
+               static_cast<std::size_t>(sk_num_blocks_) * sizeof(uint32_t);
+    }
+
+    // tile index -> (m0, n0)
+    template <typename TopIdx>
+    __host__ __device__ constexpr auto CalculateBottomIndex(const TopIdx& idx_top) const
+    {
+        const index_t tile_idx = idx_top[I0];
+
+        return make_tuple(tile_idx / N0_, tile_idx % N0_);
+    }
+
+    template <typename CTileIdx, typename CTileDim>
+    __host__ __device__ bool ValidCTileIndex(const CTileIdx& /* c_tile_idx */,
+                                             const CTileDim& /* c_tile_dim */) const
+    {
+        return true; // always valid provided that user gets grid size from CalculateGridSize()
+    }
+
+    __host__ bool CheckValidity(const CGridDesc_M_N& /* c_grid_desc_m_n */) const { return true; }
+
+    private:
+    index_t M0_;
+    index_t N0_;
+    index_t k_iters_per_tile_;
+    index_t sk_num_tiles_;
+    index_t sk_num_blocks_;
+    index_t sk_num_big_blocks_;
+    index_t k_iters_per_sk_block_;
+    index_t dp_num_blocks_;
+};
+
 template <typename CTileIdx, typename CTileDim>
 __host__ __device__ bool DefaultValidCTileIndex(const CTileIdx& c_tile_idx,
                                                 const CTileDim& c_tile_dim)
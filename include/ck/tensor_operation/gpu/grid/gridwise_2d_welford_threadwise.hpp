@@ -0,0 +1,196 @@
+#pragma once
+
+#include "data_type.hpp"
+#include "reduction_common.hpp"
+#include "reduction_operator.hpp"
+#include "reduction_functions_accumulate.hpp"
+#include "threadwise_tensor_slice_transfer.hpp"
+#include "element_wise_operation.hpp"
+
+namespace ck {
+
+template <typename GridwiseWelford,
+          typename InDataType,
+          typename MeanDataType,
+          typename VarDataType,
+          typename InGridDesc_M_K,
+          typename OutGridDesc_M>
+__global__ void kernel_welford_threadwise(const InGridDesc_M_K in_grid_desc_m_k,
+                                          const OutGridDesc_M out_grid_desc_m,
+                                          index_t toReduceLength,
+                                          const InDataType* const __restrict__ p_in_value_global,
+                                          MeanDataType* const __restrict__ p_out_mean_global,
+                                          VarDataType* const __restrict__ p_out_variance_global)
+{
+    GridwiseWelford::Run(in_grid_desc_m_k,
+                         out_grid_desc_m,
+                         toReduceLength,
+                         p_in_value_global,
+                         p_out_mean_global,
+                         p_out_variance_global);
+};
+
+// Each thread reduces MThreadSliceSize rows of the M x K input to their mean and population
+// variance by accumulating every value into a reduce::WelfordState. The padding of K is not
+// counted, so unlike the other reductions the padded elements are skipped rather than read as the
+// identity value.
+template <typename InDataType,
+          typename MeanDataType,
+          typename VarDataType,
+          typename AccDataType,
+          typename InGridDesc_M_K,
+          typename OutGridDesc_M,
+          bool PropagateNan,
+          index_t BlockSize,
+          index_t MThreadSliceSize,
+          index_t KThreadSliceSize,
+          index_t InSrcVectorDim,
+          index_t InSrcVectorSize>
+struct GridwiseWelford_mk_to_m_threadwise
+{
+    static_assert((InSrcVectorDim == 0 && MThreadSliceSize % InSrcVectorSize == 0) ||
+                      (InSrcVectorDim == 1 && KThreadSliceSize % InSrcVectorSize == 0),
+                  "Invalid thread slice sizes and/or vector sizes configuration, please check!");
+
+    using ThreadBufferDimAccessOrder =
+        typename conditional<InSrcVectorDim == 0, Sequence<1, 0>, Sequence<0, 1>>::type;
+
+    using ThreadReduceDstDesc_M =
+        decltype(make_naive_tensor_descriptor_packed(make_tuple(Number<MThreadSliceSize>{})));
+
+    using StateType = reduce::WelfordState<AccDataType>;
+
+    using Accumulation = detail::AccumulateWithNanCheck<PropagateNan, reduce::Welford, StateType>;
+
+    using PassThroughOp = tensor_operation::element_wise::PassThrough;
+
+    static constexpr auto I0 = Number<0>{};
+
+    // toReduceLength is the length of K before it is padded to a multiple of KThreadSliceSize
+    __device__ static void Run(const InGridDesc_M_K& in_grid_desc_m_k,
+                               const OutGridDesc_M& out_grid_desc_m,
+                               index_t toReduceLength,
+                               const InDataType* const __restrict__ p_in_value_global,
+                               MeanDataType* const __restrict__ p_out_mean_global,
+                               VarDataType* const __restrict__ p_out_variance_global)
+    {
+        const auto in_global_val_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_in_value_global,
+            in_grid_desc_m_k.GetElementSpaceSize(),
+            type_convert<InDataType>(0.0f));
+        auto mean_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_out_mean_global, out_grid_desc_m.GetElementSpaceSize());
+        auto variance_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_out_variance_global, out_grid_desc_m.GetElementSpaceSize());
+
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize * KThreadSliceSize, true>
+            in_thread_buf;
+
+        StaticBuffer<AddressSpaceEnum::Vgpr, StateType, MThreadSliceSize, true> accu_state_buf;
+
+        static_for<0, MThreadSliceSize, 1>{}([&](auto I) {
+            accu_state_buf(I) = reduce::Welford::GetIdentityValue<StateType>();
+        });
+
+        const index_t paddedLength = in_grid_desc_m_k.GetLength(Number<1>{});
+
+        using ThreadBufferLengths         = Sequence<MThreadSliceSize, KThreadSliceSize>;
+        constexpr auto thread_buffer_desc = make_naive_tensor_descriptor_packed(
+            make_tuple(Number<MThreadSliceSize>{}, Number<KThreadSliceSize>{}));
+
+        index_t thread_global_1d_id = get_block_1d_id() * BlockSize + get_thread_local_1d_id();
+
+        auto threadwise_src_val_load =
+            ThreadwiseTensorSliceTransfer_v2<InDataType,
+                                             AccDataType,
+                                             InGridDesc_M_K,
+                                             decltype(thread_buffer_desc),
+                                             ThreadBufferLengths,
+                                             ThreadBufferDimAccessOrder,
+                                             InSrcVectorDim,
+                                             InSrcVectorSize,
+                                             1,
+                                             false>(
+                in_grid_desc_m_k, make_multi_index(thread_global_1d_id * MThreadSliceSize, 0));
+
+        constexpr auto in_thread_copy_step = make_multi_index(0, KThreadSliceSize);
+
+        index_t reducedLength = 0;
+        do
+        {
+            threadwise_src_val_load.Run(in_grid_desc_m_k,
+                                        in_global_val_buf,
+                                        thread_buffer_desc,
+                                        make_tuple(I0, I0),
+                                        in_thread_buf);
+
+            static_for<0, MThreadSliceSize, 1>{}([&](auto iM) {
+                static_for<0, KThreadSliceSize, 1>{}([&](auto iK) {
+                    constexpr auto offset = thread_buffer_desc.CalculateOffset(make_tuple(iM, iK));
+
+                    if(reducedLength + iK < toReduceLength)
+                    {
+                        Accumulation::Calculate(
+                            accu_state_buf(iM),
+                            StateType::FromValue(in_thread_buf[Number<offset>{}]));
+                    }
+                });
+            });
+
+            threadwise_src_val_load.MoveSrcSliceWindow(in_grid_desc_m_k, in_thread_copy_step);
+
+            reducedLength += KThreadSliceSize;
+        } while(reducedLength < paddedLength);
+
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize, true> mean_value_buf;
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MThreadSliceSize, true>
+            variance_value_buf;
+
+        static_for<0, MThreadSliceSize, 1>{}([&](auto I) {
+            mean_value_buf(I)     = accu_state_buf[I].GetMean();
+            variance_value_buf(I) = accu_state_buf[I].GetVariance();
+        });
+
+        constexpr auto reduced_data_desc = ThreadReduceDstDesc_M{};
+
+        const auto dst_origin = make_multi_index(thread_global_1d_id * MThreadSliceSize);
+
+        auto threadwise_mean_store =
+            ThreadwiseTensorSliceTransfer_v1r3<AccDataType,
+                                               MeanDataType,
+                                               decltype(reduced_data_desc),
+                                               OutGridDesc_M,
+                                               PassThroughOp,
+                                               Sequence<MThreadSliceSize>,
+                                               Sequence<0>,
+                                               0,
+                                               1,
+                                               InMemoryDataOperationEnum::Set,
+                                               1,
+                                               false>(out_grid_desc_m, dst_origin, PassThroughOp{});
+
+        auto threadwise_variance_store =
+            ThreadwiseTensorSliceTransfer_v1r3<AccDataType,
+                                               VarDataType,
+                                               decltype(reduced_data_desc),
+                                               OutGridDesc_M,
+                                               PassThroughOp,
+                                               Sequence<MThreadSliceSize>,
+                                               Sequence<0>,
+                                               0,
+                                               1,
+                                               InMemoryDataOperationEnum::Set,
+                                               1,
+                                               false>(out_grid_desc_m, dst_origin, PassThroughOp{});
+
+        threadwise_mean_store.Run(
+            reduced_data_desc, make_tuple(I0), mean_value_buf, out_grid_desc_m, mean_global_buf);
+        threadwise_variance_store.Run(reduced_data_desc,
+                                      make_tuple(I0),
+                                      variance_value_buf,
+                                      out_grid_desc_m,
+                                      variance_global_buf);
+    };
+};
+
+} // namespace ck
@@ -7,6 +7,37 @@ namespace ck {
 using bhalf_t = ushort;
 using half_t  = _Float16;
 
+// 8-bit floating point E4M3, with 4 exponent bits of bias 7 and 3 mantissa bits, only used for
+// storage: computations are done after type_convert to float. Its largest finite value is 448,
+// it has no infinities and S.1111.111 is NaN.
+struct f8_t
+{
+    static constexpr index_t exponent_bits = 4;
+    static constexpr index_t mantissa_bits = 3;
+    static constexpr bool has_infinity     = false;
+
+    uint8_t data;
+};
+
+// 8-bit floating point E5M2, with 5 exponent bits of bias 15 and 2 mantissa bits, as stored in
+// memory. Its largest finite value is 57344 and, like for IEEE 754 formats, S.11111.00 is
+// infinity and S.11111.xx otherwise NaN.
+struct bf8_t
+{
+    static constexpr index_t exponent_bits = 5;
+    static constexpr index_t mantissa_bits = 2;
+    static constexpr bool has_infinity     = true;
+
+    uint8_t data;
+};
+
+// two 4-bit signed integers in [-8, 7] packed in a byte, the first one in the low nibble, see
+// pack_i4() and unpack_i4()
+struct pk_i4_t
+{
+    uint8_t data;
+};
+
 // vector_type
 template <typename T, index_t N>
 struct vector_type;
@@ -1025,4 +1056,210 @@ struct NumericLimits<half_t>
     __host__ __device__ static constexpr half_t QuietNaN() { return bit_cast<half_t>(binary_qnan); }
 };
 
+template <>
+struct NumericLimits<f8_t>
+{
+    static constexpr uint8_t binary_min    = 0x08;
+    static constexpr uint8_t binary_max    = 0x7E;
+    static constexpr uint8_t binary_lowest = 0xFE;
+    static constexpr uint8_t binary_qnan   = 0x7F;
+
+    __host__ __device__ static constexpr f8_t Min() { return f8_t{binary_min}; }
+
+    __host__ __device__ static constexpr f8_t Max() { return f8_t{binary_max}; }
+
+    __host__ __device__ static constexpr f8_t Lowest() { return f8_t{binary_lowest}; }
+
+    __host__ __device__ static constexpr f8_t QuietNaN() { return f8_t{binary_qnan}; }
+};
+
+template <>
+struct NumericLimits<bf8_t>
+{
+    static constexpr uint8_t binary_min    = 0x04;
+    static constexpr uint8_t binary_max    = 0x7B;
+    static constexpr uint8_t binary_lowest = 0xFB;
+    static constexpr uint8_t binary_qnan   = 0x7E;
+
+    __host__ __device__ static constexpr bf8_t Min() { return bf8_t{binary_min}; }
+
+    __host__ __device__ static constexpr bf8_t Max() { return bf8_t{binary_max}; }
+
+    __host__ __device__ static constexpr bf8_t Lowest() { return bf8_t{binary_lowest}; }
+
+    __host__ __device__ static constexpr bf8_t QuietNaN() { return bf8_t{binary_qnan}; }
+};
+
+// convert fp32 to f8_t or bf8_t, rounding to nearest, ties to even. The values beyond the
+// largest finite one, including infinities, are clamped to it if Saturate, else they become
+// infinities, or NaN for f8_t which has none. NaN stays NaN. There are no branches, so that
+// loops of conversions vectorize.
+template <typename F8, bool Saturate>
+inline __host__ __device__ F8 f8_convert_rne(float x)
+{
+    constexpr uint32_t mantissa_bits = F8::mantissa_bits;
+    constexpr uint32_t bias          = (1u << (F8::exponent_bits - 1)) - 1;
+
+    constexpr uint32_t binary_max  = NumericLimits<F8>::binary_max;
+    constexpr uint32_t binary_qnan = NumericLimits<F8>::binary_qnan;
+    constexpr uint32_t binary_overflow =
+        Saturate ? binary_max : (F8::has_infinity ? binary_max + 1 : binary_qnan);
+
+    // biased fp32 exponent of the smallest normal value of F8
+    constexpr uint32_t min_normal_exponent = 127 + 1 - bias;
+
+    const uint32_t u        = bit_cast<uint32_t>(x);
+    const uint32_t abs      = u & 0x7fffffff;
+    const uint32_t exponent = abs >> 23;
+
+    // for a normal result, the fp32 exponent and mantissa are rounded off together, so that a
+    // carry out of the mantissa increments the exponent. For a subnormal one, the mantissa with
+    // its implicit 1 is shifted to the fixed exponent of the subnormals.
+    const bool is_normal = exponent >= min_normal_exponent;
+
+    const uint32_t mantissa =
+        is_normal ? abs : (abs & 0x7fffff) | (exponent != 0 ? 0x800000 : 0);
+    const uint32_t shift =
+        is_normal ? 23 - mantissa_bits
+                  : (exponent + 31 > 23 - mantissa_bits + min_normal_exponent
+                         ? 23 - mantissa_bits + min_normal_exponent - exponent
+                         : 31);
+
+    const uint32_t half = 1u << (shift - 1);
+    const uint32_t rem  = mantissa & ((half << 1) - 1);
+
+    uint32_t y = mantissa >> shift;
+
+    y += (rem > half || (rem == half && (y & 1))) ? 1 : 0;
+    y = is_normal ? y - ((127 - bias) << mantissa_bits) : y;
+    y = y > binary_max ? binary_overflow : y;
+    y = abs > 0x7f800000 ? binary_qnan : y;
+
+    return F8{static_cast<uint8_t>(((u >> 24) & 0x80) | y)};
+}
+
+// convert f8_t or bf8_t to fp32, which is exact
+template <typename F8>
+inline __host__ __device__ float f8_convert_to_float(F8 x)
+{
+    constexpr uint32_t mantissa_bits = F8::mantissa_bits;
+    constexpr uint32_t bias          = (1u << (F8::exponent_bits - 1)) - 1;
+    constexpr uint32_t max_exponent  = (1u << F8::exponent_bits) - 1;
+
+    const uint32_t sign     = uint32_t(x.data & 0x80) << 24;
+    const uint32_t exponent = (x.data >> mantissa_bits) & max_exponent;
+    const uint32_t mantissa = x.data & ((1u << mantissa_bits) - 1);
+
+    const bool is_nan = F8::has_infinity ? (exponent == max_exponent && mantissa != 0)
+                                         : (x.data & 0x7f) == NumericLimits<F8>::binary_qnan;
+    const bool is_inf = F8::has_infinity && exponent == max_exponent && mantissa == 0;
+
+    // a subnormal is its mantissa times the smallest subnormal, 2^(1 - bias - mantissa_bits)
+    const float subnormal =
+        bit_cast<float>(sign | ((127 + 1 - bias - mantissa_bits) << 23)) * mantissa;
+    const float normal = bit_cast<float>(sign | ((exponent + 127 - bias) << 23) |
+                                         (mantissa << (23 - mantissa_bits)));
+
+    return is_nan   ? bit_cast<float>(sign | 0x7fc00000)
+           : is_inf ? bit_cast<float>(sign | 0x7f800000)
+                    : (exponent == 0 ? subnormal : normal);
+}
+
+// convert fp32 to f8_t or bf8_t like type_convert, but clamping the values beyond the largest
+// finite one, as usually done for inference
+template <typename Y>
+inline __host__ __device__ Y f8_convert_sat(float x)
+{
+    return f8_convert_rne<Y, true>(x);
+}
+
+// convert f8 to fp32
+template <>
+inline __host__ __device__ float type_convert<float, f8_t>(f8_t x)
+{
+    return f8_convert_to_float(x);
+}
+
+// convert bf8 to fp32
+template <>
+inline __host__ __device__ float type_convert<float, bf8_t>(bf8_t x)
+{
+    return f8_convert_to_float(x);
+}
+
+// convert fp32 to f8, without saturation
+template <>
+inline __host__ __device__ f8_t type_convert<f8_t, float>(float x)
+{
+    return f8_convert_rne<f8_t, false>(x);
+}
+
+// convert fp32 to bf8, without saturation
+template <>
+inline __host__ __device__ bf8_t type_convert<bf8_t, float>(float x)
+{
+    return f8_convert_rne<bf8_t, false>(x);
+}
+
+// convert f8 to fp16, which is exact
+template <>
+inline __host__ __device__ half_t type_convert<half_t, f8_t>(f8_t x)
+{
+    return type_convert<half_t>(f8_convert_to_float(x));
+}
+
+// convert bf8 to fp16, which is exact
+template <>
+inline __host__ __device__ half_t type_convert<half_t, bf8_t>(bf8_t x)
+{
+    return type_convert<half_t>(f8_convert_to_float(x));
+}
+
+// convert fp16 to f8, through fp32 which is exact
+template <>
+inline __host__ __device__ f8_t type_convert<f8_t, half_t>(half_t x)
+{
+    return f8_convert_rne<f8_t, false>(type_convert<float>(x));
+}
+
+// convert fp16 to bf8, through fp32 which is exact
+template <>
+inline __host__ __device__ bf8_t type_convert<bf8_t, half_t>(half_t x)
+{
+    return f8_convert_rne<bf8_t, false>(type_convert<float>(x));
+}
+
+// pack two int4 values in [-8, 7], the first one in the low nibble
+inline __host__ __device__ constexpr pk_i4_t pack_i4(int8_t lo, int8_t hi)
+{
+    return pk_i4_t{static_cast<uint8_t>((lo & 0xf) | ((hi & 0xf) << 4))};
+}
+
+// int4 value of nibble i of x, 0 for the low one
+inline __host__ __device__ constexpr int8_t unpack_i4(pk_i4_t x, index_t i)
+{
+    // sign extension of the nibble
+    return static_cast<int8_t>((((x.data >> (4 * i)) & 0xf) ^ 0x8) - 8);
+}
+
+// convert fp32 to an int4 value in [-8, 7], rounding to nearest, ties to even, and saturating.
+// NaN becomes 0.
+inline __host__ __device__ int8_t i4_convert_sat(float x)
+{
+    const float clamped = x < -8.f ? -8.f : (x > 7.f ? 7.f : (x == x ? x : 0.f));
+
+    return static_cast<int8_t>(__builtin_rintf(clamped));
+}
+
+// both int4 values of pk_i4_t at the limit
+template <>
+struct NumericLimits<pk_i4_t>
+{
+    __host__ __device__ static constexpr pk_i4_t Min() { return pack_i4(-8, -8); }
+
+    __host__ __device__ static constexpr pk_i4_t Max() { return pack_i4(7, 7); }
+
+    __host__ __device__ static constexpr pk_i4_t Lowest() { return pack_i4(-8, -8); }
+};
+
 } // namespace ck
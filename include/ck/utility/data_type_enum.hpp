@@ -12,6 +12,9 @@ enum struct DataTypeEnum
     Int8x4   = 4,
     BFloat16 = 5,
     Double   = 6,
+    Float8   = 7,
+    BFloat8  = 8,
+    Int4x2   = 9,
     Unknown  = 100,
 };
 
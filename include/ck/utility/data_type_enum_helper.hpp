@@ -39,6 +39,24 @@ struct get_datatype_from_enum<DataTypeEnum::Double>
     using type = double;
 };
 
+template <>
+struct get_datatype_from_enum<DataTypeEnum::Float8>
+{
+    using type = f8_t;
+};
+
+template <>
+struct get_datatype_from_enum<DataTypeEnum::BFloat8>
+{
+    using type = bf8_t;
+};
+
+template <>
+struct get_datatype_from_enum<DataTypeEnum::Int4x2>
+{
+    using type = pk_i4_t;
+};
+
 template <typename T>
 struct get_datatype_enum_from_type;
 
@@ -72,5 +90,23 @@ struct get_datatype_enum_from_type<double>
     static constexpr DataTypeEnum value = DataTypeEnum::Double;
 };
 
+template <>
+struct get_datatype_enum_from_type<f8_t>
+{
+    static constexpr DataTypeEnum value = DataTypeEnum::Float8;
+};
+
+template <>
+struct get_datatype_enum_from_type<bf8_t>
+{
+    static constexpr DataTypeEnum value = DataTypeEnum::BFloat8;
+};
+
+template <>
+struct get_datatype_enum_from_type<pk_i4_t>
+{
+    static constexpr DataTypeEnum value = DataTypeEnum::Int4x2;
+};
+
 } // namespace ck
 #endif
@@ -17,9 +17,8 @@ namespace ck {
 //   implemented, the int32_t dividend would be bit-wise interpreted as uint32_t and magic number
 //   division implementation for uint32_t is then used. Therefore, dividend value need to be
 //   non-negative.
-// TODO:
-//   1. Implement magic number divison for int32_t
-//   2. Implement magic number divison for unit32_t with 32-bit value range
+//   3. MagicDivision32BitFullRange and MagicDivision64Bit below lift these restrictions, at the
+//   cost of a 64-bit add (and for int32_t dividend, a sign fix-up) per division.
 struct MagicDivision
 {
     // uint32_t
@@ -155,6 +154,238 @@ struct MagicDivision
     }
 };
 
+// magic number division for full 32-bit value range
+//   1. For uint32_t as dividend: correct for any dividend and any divisor >= 1.
+//   2. For int32_t as dividend: correct for any dividend (rounded toward zero, as "/" does),
+//   divisor need to be positive.
+// Magic numbers are calculated the same way as MagicDivision. The difference is that the sum of
+// the high product and the dividend is kept in 64 bits: its overflow in 32 bits is what limits
+// MagicDivision to 31-bit dividends.
+struct MagicDivision32BitFullRange
+{
+    // uint32_t
+    __host__ __device__ static constexpr auto CalculateMagicNumbers(uint32_t divisor)
+    {
+        // WARNING: magic division is only applicable for divisor >= 1.
+        // The "else" logic below is to quiet down run-time error.
+        if(divisor >= 1)
+        {
+            uint32_t shift = 0;
+            for(shift = 0; shift < 32; ++shift)
+            {
+                if((uint64_t(1) << shift) >= divisor)
+                {
+                    break;
+                }
+            }
+
+            // (2^shift - divisor) < 2^31 when shift is 32, so the product fits into 64 bits
+            uint64_t one        = 1;
+            uint64_t multiplier = ((one << 32) * ((one << shift) - divisor)) / divisor + 1;
+
+            return make_tuple(uint32_t(multiplier), shift);
+        }
+        else
+        {
+            return make_tuple(uint32_t(0), uint32_t(0));
+        }
+    }
+
+    __host__ __device__ static constexpr uint32_t CalculateMagicMultiplier(uint32_t divisor)
+    {
+        auto tmp = CalculateMagicNumbers(divisor);
+
+        return tmp[Number<0>{}];
+    }
+
+    __host__ __device__ static constexpr uint32_t CalculateMagicShift(uint32_t divisor)
+    {
+        auto tmp = CalculateMagicNumbers(divisor);
+
+        return tmp[Number<1>{}];
+    }
+
+    // integral_constant<uint32_t, .>
+    template <uint32_t Divisor>
+    __host__ __device__ static constexpr auto
+        CalculateMagicNumbers(integral_constant<uint32_t, Divisor>)
+    {
+        constexpr auto tmp = CalculateMagicNumbers(uint32_t{Divisor});
+
+        constexpr uint32_t multiplier = tmp[Number<0>{}];
+        constexpr uint32_t shift      = tmp[Number<1>{}];
+
+        return make_tuple(integral_constant<uint32_t, multiplier>{},
+                          integral_constant<uint32_t, shift>{});
+    }
+
+    template <uint32_t Divisor>
+    __host__ __device__ static constexpr auto
+        CalculateMagicMultiplier(integral_constant<uint32_t, Divisor>)
+    {
+        constexpr uint32_t multiplier = CalculateMagicMultiplier(uint32_t{Divisor});
+
+        return integral_constant<uint32_t, multiplier>{};
+    }
+
+    template <uint32_t Divisor>
+    __host__ __device__ static constexpr auto
+        CalculateMagicShift(integral_constant<uint32_t, Divisor>)
+    {
+        constexpr uint32_t shift = CalculateMagicShift(uint32_t{Divisor});
+
+        return integral_constant<uint32_t, shift>{};
+    }
+
+    // integral_constant<int32_t, .>
+    template <int32_t Divisor>
+    __host__ __device__ static constexpr auto
+        CalculateMagicNumbers(integral_constant<int32_t, Divisor>)
+    {
+        return CalculateMagicNumbers(integral_constant<uint32_t, Divisor>{});
+    }
+
+    template <int32_t Divisor>
+    __host__ __device__ static constexpr auto
+        CalculateMagicMultiplier(integral_constant<int32_t, Divisor>)
+    {
+        return CalculateMagicMultiplier(integral_constant<uint32_t, Divisor>{});
+    }
+
+    template <int32_t Divisor>
+    __host__ __device__ static constexpr auto
+        CalculateMagicShift(integral_constant<int32_t, Divisor>)
+    {
+        return CalculateMagicShift(integral_constant<uint32_t, Divisor>{});
+    }
+
+    // magic division for uint32_t
+    __device__ static constexpr uint32_t
+    DoMagicDivision(uint32_t dividend, uint32_t multiplier, uint32_t shift)
+    {
+        uint32_t tmp = __umulhi(dividend, multiplier);
+        return (static_cast<uint64_t>(tmp) + dividend) >> shift;
+    }
+
+    __host__ static constexpr uint32_t
+    DoMagicDivision(uint32_t dividend, uint32_t multiplier, uint32_t shift)
+    {
+        uint32_t tmp = static_cast<uint64_t>(dividend) * multiplier >> 32;
+        return (static_cast<uint64_t>(tmp) + dividend) >> shift;
+    }
+
+    // magic division for int32_t
+    // divide the magnitude, |INT32_MIN| is still representable as uint32_t
+    __host__ __device__ static constexpr int32_t
+    DoMagicDivision(int32_t dividend_i32, uint32_t multiplier, uint32_t shift)
+    {
+        const bool is_negative = dividend_i32 < 0;
+
+        uint32_t dividend_u32 = bit_cast<uint32_t>(dividend_i32);
+        dividend_u32          = is_negative ? 0U - dividend_u32 : dividend_u32;
+
+        uint32_t quotient_u32 = DoMagicDivision(dividend_u32, multiplier, shift);
+
+        return bit_cast<int32_t>(is_negative ? 0U - quotient_u32 : quotient_u32);
+    }
+};
+
+// magic number division for 64-bit dividend
+//   1. For uint64_t as dividend: correct for dividend within [0, 2^63] and divisor within
+//   [1, 2^63].
+//   2. For int64_t (long_index_t) as dividend: correct for any dividend (rounded toward zero, as
+//   "/" does), divisor need to be positive.
+struct MagicDivision64Bit
+{
+    __host__ __device__ static constexpr auto CalculateMagicNumbers(uint64_t divisor)
+    {
+        // WARNING: magic division is only applicable for division inside this range.
+        // The "else" logic below is to quiet down run-time error.
+        if(divisor >= 1 && divisor <= (uint64_t(1) << 63))
+        {
+            uint32_t shift = 0;
+            for(shift = 0; shift < 63; ++shift)
+            {
+                if((uint64_t(1) << shift) >= divisor)
+                {
+                    break;
+                }
+            }
+
+            // multiplier = 2^64 * (2^shift - divisor) / divisor + 1
+            // 2^64 * (2^shift - divisor) does not fit into 64 bits, so the quotient is calculated
+            // by bitwise long division. remainder < divisor holds throughout.
+            uint64_t remainder = (uint64_t(1) << shift) - divisor;
+            uint64_t quotient  = 0;
+
+            for(index_t i = 0; i < 64; ++i)
+            {
+                const bool carry = (remainder >> 63) != 0;
+
+                remainder <<= 1;
+                quotient <<= 1;
+
+                if(carry || remainder >= divisor)
+                {
+                    remainder -= divisor;
+                    quotient |= 1;
+                }
+            }
+
+            return make_tuple(quotient + 1, shift);
+        }
+        else
+        {
+            return make_tuple(uint64_t(0), uint32_t(0));
+        }
+    }
+
+    __host__ __device__ static constexpr uint64_t CalculateMagicMultiplier(uint64_t divisor)
+    {
+        auto tmp = CalculateMagicNumbers(divisor);
+
+        return tmp[Number<0>{}];
+    }
+
+    __host__ __device__ static constexpr uint32_t CalculateMagicShift(uint64_t divisor)
+    {
+        auto tmp = CalculateMagicNumbers(divisor);
+
+        return tmp[Number<1>{}];
+    }
+
+    // magic division for uint64_t
+    // the high product is smaller than the dividend, so the sum below does not overflow for
+    // dividend <= 2^63
+    __device__ static constexpr uint64_t
+    DoMagicDivision(uint64_t dividend, uint64_t multiplier, uint32_t shift)
+    {
+        uint64_t tmp = __umul64hi(dividend, multiplier);
+        return (tmp + dividend) >> shift;
+    }
+
+    __host__ static constexpr uint64_t
+    DoMagicDivision(uint64_t dividend, uint64_t multiplier, uint32_t shift)
+    {
+        uint64_t tmp = static_cast<unsigned __int128>(dividend) * multiplier >> 64;
+        return (tmp + dividend) >> shift;
+    }
+
+    // magic division for int64_t
+    __host__ __device__ static constexpr int64_t
+    DoMagicDivision(int64_t dividend_i64, uint64_t multiplier, uint32_t shift)
+    {
+        const bool is_negative = dividend_i64 < 0;
+
+        uint64_t dividend_u64 = bit_cast<uint64_t>(dividend_i64);
+        dividend_u64          = is_negative ? uint64_t(0) - dividend_u64 : dividend_u64;
+
+        uint64_t quotient_u64 = DoMagicDivision(dividend_u64, multiplier, shift);
+
+        return bit_cast<int64_t>(is_negative ? uint64_t(0) - quotient_u64 : quotient_u64);
+    }
+};
+
 } // namespace ck
 
 #endif
@@ -85,6 +85,26 @@ struct AccumulateWithNanCheck<true, ReduceOperation, AccDataType>
     };
 };
 
+// A NaN in either state makes the mean of the merged state NaN
+template <typename T>
+struct AccumulateWithNanCheck<true, reduce::Welford, reduce::WelfordState<T>>
+{
+    __host__ __device__ static inline void Calculate(reduce::WelfordState<T>& accuVal,
+                                                     reduce::WelfordState<T> currVal)
+    {
+        using ck::math::isnan;
+
+        if(isnan(currVal.mean) || isnan(currVal.m2))
+        {
+            accuVal = currVal;
+        }
+        else
+        {
+            reduce::Welford{}(accuVal, currVal);
+        };
+    };
+};
+
 template <bool PropagateNan, typename ReduceOperation, typename AccDataType, typename IndexDataType>
 struct AccumulateWithIndexAndNanCheck;
 
@@ -235,6 +235,83 @@ struct AMax
     }
 };
 
+// Running statistics of a sequence of values as used by Welford's algorithm: the number of
+// values, their mean, and M2, the sum of squared differences from the mean. A single value x is
+// represented by {1, x, 0}. The count is kept in T so that the state is homogeneous.
+template <typename T>
+struct WelfordState
+{
+    T count = type_convert<T>(0.0f);
+    T mean  = type_convert<T>(0.0f);
+    T m2    = type_convert<T>(0.0f);
+
+    __host__ __device__ static constexpr WelfordState FromValue(T x)
+    {
+        return WelfordState{type_convert<T>(1.0f), x, type_convert<T>(0.0f)};
+    }
+
+    __host__ __device__ constexpr T GetMean() const { return mean; }
+
+    // population variance, 0 if no values have been accumulated
+    __host__ __device__ constexpr T GetVariance() const
+    {
+        return count > type_convert<T>(0.0f) ? m2 / count : type_convert<T>(0.0f);
+    }
+};
+
+// Numerically stable mean/variance reduction. Merging two states (Chan et al.) is associative and
+// commutative up to rounding, so partial states produced by threads, blocks or separate kernel
+// calls can be combined in any order, like the partial results of the other operators.
+struct Welford
+{
+    template <typename T>
+    __host__ __device__ static constexpr T GetIdentityValue()
+    {
+        return T{};
+    };
+
+    // partial states can not be combined by the memory operation itself
+    __host__ __device__ static constexpr bool
+    IsCompatibleInMemoryDataOperation(InMemoryDataOperationEnum operation)
+    {
+        return operation == InMemoryDataOperationEnum::Set;
+    };
+
+    template <typename T>
+    __host__ __device__ inline constexpr void operator()(WelfordState<T>& a,
+                                                         WelfordState<T> b) const
+    {
+        static_assert(is_same<T, float>::value || is_same<T, double>::value,
+                      "The data type is not supported by the Welford accumulator!");
+
+        const T count = a.count + b.count;
+
+        if(count <= type_convert<T>(0.0f))
+            return;
+
+        const T delta = b.mean - a.mean;
+
+        a.mean  = a.mean + delta * (b.count / count);
+        a.m2    = a.m2 + b.m2 + delta * delta * (a.count * b.count / count);
+        a.count = count;
+    }
+
+    // accumulate a single value
+    template <typename T>
+    __host__ __device__ inline constexpr void operator()(WelfordState<T>& a, T x) const
+    {
+        static_assert(is_same<T, float>::value || is_same<T, double>::value,
+                      "The data type is not supported by the Welford accumulator!");
+
+        const T count = a.count + type_convert<T>(1.0f);
+        const T delta = x - a.mean;
+
+        a.mean  = a.mean + delta / count;
+        a.m2    = a.m2 + delta * (x - a.mean);
+        a.count = count;
+    }
+};
+
 template <typename T>
 constexpr T GetIdentityValueForInMemoryDataOperation(InMemoryDataOperationEnum operation)
 {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <utility>
+
 #include "integral_constant.hpp"
 #include "type.hpp"
 #include "functional.hpp"
@@ -31,6 +33,33 @@ __host__ __device__ constexpr auto sequence_pop_front(Sequence<I, Is...>);
 template <typename Seq>
 __host__ __device__ constexpr auto sequence_pop_back(Seq);
 
+namespace detail {
+
+// Values of a Sequence computed by a constexpr function. Only the first size elements are used,
+// the extra element avoids a zero-size array.
+template <index_t MaxSize>
+struct sequence_values
+{
+    index_t data[MaxSize + 1] = {};
+    index_t size              = MaxSize;
+};
+
+// Sequence of the values returned by Values::Compute(). Computing the values in one constexpr
+// function, instead of with recursive templates, instantiates a single class per result.
+template <typename Values,
+          typename Indices = std::make_integer_sequence<index_t, Values::Compute().size>>
+struct sequence_from_values;
+
+template <typename Values, index_t... Is>
+struct sequence_from_values<Values, std::integer_sequence<index_t, Is...>>
+{
+    static constexpr auto values = Values::Compute();
+
+    using type = Sequence<values.data[Is]...>;
+};
+
+} // namespace detail
+
 template <index_t... Is>
 struct Sequence
 {
@@ -141,13 +170,13 @@ struct Sequence
     template <index_t... Ns>
     __host__ __device__ static constexpr auto Extract(Number<Ns>...)
     {
-        return Sequence<Type::At(Number<Ns>{})...>{};
+        return Sequence<Type::At(Ns)...>{};
     }
 
     template <index_t... Ns>
     __host__ __device__ static constexpr auto Extract(Sequence<Ns...>)
     {
-        return Sequence<Type::At(Number<Ns>{})...>{};
+        return Sequence<Type::At(Ns)...>{};
     }
 
     template <index_t I, index_t X>
@@ -155,11 +184,7 @@ struct Sequence
     {
         static_assert(I < Size(), "wrong!");
 
-        using seq_split          = sequence_split<Type, I>;
-        constexpr auto seq_left  = typename seq_split::left_type{};
-        constexpr auto seq_right = typename seq_split::right_type{}.PopFront();
-
-        return seq_left.PushBack(Number<X>{}).PushBack(seq_right);
+        return modify_sequence_elements_by_ids(Type{}, Sequence<X>{}, Sequence<I>{});
     }
 
     template <typename F>
@@ -177,114 +202,107 @@ struct Sequence
     }
 };
 
+namespace detail {
+
+template <typename Seq>
+struct sequence_merge_operand
+{
+    using type = Seq;
+};
+
+template <index_t... Xs, index_t... Ys>
+__host__ __device__ constexpr auto operator+(sequence_merge_operand<Sequence<Xs...>>,
+                                             sequence_merge_operand<Sequence<Ys...>>)
+{
+    return sequence_merge_operand<Sequence<Xs..., Ys...>>{};
+}
+
+} // namespace detail
+
 // merge sequence
 template <typename Seq, typename... Seqs>
 struct sequence_merge
 {
-    using type = typename sequence_merge<Seq, typename sequence_merge<Seqs...>::type>::type;
+    using type = typename decltype((detail::sequence_merge_operand<Seq>{} + ... +
+                                    detail::sequence_merge_operand<Seqs>{}))::type;
 };
 
-template <index_t... Xs, index_t... Ys>
-struct sequence_merge<Sequence<Xs...>, Sequence<Ys...>>
+namespace detail {
+
+template <typename F, index_t... Is>
+__host__ __device__ constexpr auto generate_sequence_impl(std::integer_sequence<index_t, Is...>)
 {
-    using type = Sequence<Xs..., Ys...>;
-};
+    return Sequence<F{}(Number<Is>{})...>{};
+}
 
-template <typename Seq>
-struct sequence_merge<Seq>
+template <index_t IBegin, index_t Increment, index_t... Is>
+__host__ __device__ constexpr auto
+generate_arithmetic_sequence_impl(std::integer_sequence<index_t, Is...>)
 {
-    using type = Seq;
-};
+    return Sequence<(IBegin + Is * Increment)...>{};
+}
+
+} // namespace detail
 
 // generate sequence
 template <index_t NSize, typename F>
 struct sequence_gen
 {
-    template <index_t IBegin, index_t NRemain, typename G>
-    struct sequence_gen_impl
-    {
-        static constexpr index_t NRemainLeft  = NRemain / 2;
-        static constexpr index_t NRemainRight = NRemain - NRemainLeft;
-        static constexpr index_t IMiddle      = IBegin + NRemainLeft;
-
-        using type = typename sequence_merge<
-            typename sequence_gen_impl<IBegin, NRemainLeft, G>::type,
-            typename sequence_gen_impl<IMiddle, NRemainRight, G>::type>::type;
-    };
-
-    template <index_t I, typename G>
-    struct sequence_gen_impl<I, 1, G>
-    {
-        static constexpr index_t Is = G{}(Number<I>{});
-        using type                  = Sequence<Is>;
-    };
-
-    template <index_t I, typename G>
-    struct sequence_gen_impl<I, 0, G>
-    {
-        using type = Sequence<>;
-    };
-
-    using type = typename sequence_gen_impl<0, NSize, F>::type;
+    using type =
+        decltype(detail::generate_sequence_impl<F>(std::make_integer_sequence<index_t, NSize>{}));
 };
 
 // arithmetic sequence
 template <index_t IBegin, index_t IEnd, index_t Increment>
 struct arithmetic_sequence_gen
 {
-    struct F
-    {
-        __host__ __device__ constexpr index_t operator()(index_t i) const
-        {
-            return i * Increment + IBegin;
-        }
-    };
-
-    using type0 = typename sequence_gen<(IEnd - IBegin) / Increment, F>::type;
-    using type1 = Sequence<>;
-
     static constexpr bool kHasContent =
         (Increment > 0 && IBegin < IEnd) || (Increment < 0 && IBegin > IEnd);
 
-    using type = typename conditional<kHasContent, type0, type1>::type;
+    static constexpr index_t NSize = kHasContent ? (IEnd - IBegin) / Increment : 0;
+
+    using type = decltype(detail::generate_arithmetic_sequence_impl<IBegin, Increment>(
+        std::make_integer_sequence<index_t, NSize>{}));
 };
 
 // uniform sequence
 template <index_t NSize, index_t I>
 struct uniform_sequence_gen
 {
-    struct F
-    {
-        __host__ __device__ constexpr index_t operator()(index_t) const { return I; }
-    };
-
-    using type = typename sequence_gen<NSize, F>::type;
+    using type = decltype(detail::generate_arithmetic_sequence_impl<I, 0>(
+        std::make_integer_sequence<index_t, NSize>{}));
 };
 
 // reverse inclusive scan (with init) sequence
 template <typename, typename, index_t>
 struct sequence_reverse_inclusive_scan;
 
-template <index_t I, index_t... Is, typename Reduce, index_t Init>
-struct sequence_reverse_inclusive_scan<Sequence<I, Is...>, Reduce, Init>
+template <index_t... Is, typename Reduce, index_t Init>
+struct sequence_reverse_inclusive_scan<Sequence<Is...>, Reduce, Init>
 {
-    using old_scan = typename sequence_reverse_inclusive_scan<Sequence<Is...>, Reduce, Init>::type;
+    struct Values
+    {
+        __host__ __device__ static constexpr auto Compute()
+        {
+            constexpr index_t n = sizeof...(Is);
 
-    static constexpr index_t new_reduce = Reduce{}(I, old_scan{}.Front());
+            const index_t xs[n + 1] = {Is..., 0};
 
-    using type = typename sequence_merge<Sequence<new_reduce>, old_scan>::type;
-};
+            detail::sequence_values<n> scan;
 
-template <index_t I, typename Reduce, index_t Init>
-struct sequence_reverse_inclusive_scan<Sequence<I>, Reduce, Init>
-{
-    using type = Sequence<Reduce{}(I, Init)>;
-};
+            index_t r = Init;
 
-template <typename Reduce, index_t Init>
-struct sequence_reverse_inclusive_scan<Sequence<>, Reduce, Init>
-{
-    using type = Sequence<>;
+            for(index_t i = n - 1; i >= 0; --i)
+            {
+                r            = Reduce{}(xs[i], r);
+                scan.data[i] = r;
+            }
+
+            return scan;
+        }
+    };
+
+    using type = typename detail::sequence_from_values<Values>::type;
 };
 
 // split sequence
@@ -304,24 +322,8 @@ struct sequence_split
 template <typename Seq>
 struct sequence_reverse
 {
-    static constexpr index_t NSize = Seq{}.Size();
-
-    using seq_split = sequence_split<Seq, NSize / 2>;
-    using type      = typename sequence_merge<
-        typename sequence_reverse<typename seq_split::right_type>::type,
-        typename sequence_reverse<typename seq_split::left_type>::type>::type;
-};
-
-template <index_t I>
-struct sequence_reverse<Sequence<I>>
-{
-    using type = Sequence<I>;
-};
-
-template <index_t I0, index_t I1>
-struct sequence_reverse<Sequence<I0, I1>>
-{
-    using type = Sequence<I1, I0>;
+    using type =
+        decltype(Seq::Extract(typename arithmetic_sequence_gen<Seq::Size() - 1, -1, -1>::type{}));
 };
 
 #if 1
@@ -346,269 +348,144 @@ struct sequence_reduce<Reduce, Seq>
 };
 #endif
 
-template <typename Values, typename Ids, typename Compare>
-struct sequence_sort_impl
-{
-    template <typename LeftValues,
-              typename LeftIds,
-              typename RightValues,
-              typename RightIds,
-              typename MergedValues,
-              typename MergedIds,
-              typename Comp>
-    struct sorted_sequence_merge_impl
-    {
-        static constexpr bool choose_left = LeftValues::Front() < RightValues::Front();
-
-        static constexpr index_t chosen_value =
-            choose_left ? LeftValues::Front() : RightValues::Front();
-        static constexpr index_t chosen_id = choose_left ? LeftIds::Front() : RightIds::Front();
-
-        using new_merged_values = decltype(MergedValues::PushBack(Number<chosen_value>{}));
-        using new_merged_ids    = decltype(MergedIds::PushBack(Number<chosen_id>{}));
-
-        using new_left_values =
-            typename conditional<choose_left, decltype(LeftValues::PopFront()), LeftValues>::type;
-        using new_left_ids =
-            typename conditional<choose_left, decltype(LeftIds::PopFront()), LeftIds>::type;
-
-        using new_right_values =
-            typename conditional<choose_left, RightValues, decltype(RightValues::PopFront())>::type;
-        using new_right_ids =
-            typename conditional<choose_left, RightIds, decltype(RightIds::PopFront())>::type;
-
-        using merge = sorted_sequence_merge_impl<new_left_values,
-                                                 new_left_ids,
-                                                 new_right_values,
-                                                 new_right_ids,
-                                                 new_merged_values,
-                                                 new_merged_ids,
-                                                 Comp>;
-        // this is output
-        using merged_values = typename merge::merged_values;
-        using merged_ids    = typename merge::merged_ids;
-    };
+namespace detail {
 
-    template <typename LeftValues,
-              typename LeftIds,
-              typename MergedValues,
-              typename MergedIds,
-              typename Comp>
-    struct sorted_sequence_merge_impl<LeftValues,
-                                      LeftIds,
-                                      Sequence<>,
-                                      Sequence<>,
-                                      MergedValues,
-                                      MergedIds,
-                                      Comp>
+// Ids of Values in sorted order. Values that compare equal are ordered by decreasing id, as the
+// recursive merge sort this replaces did.
+template <typename Values, typename Compare>
+struct sequence_sort_ids
+{
+    __host__ __device__ static constexpr auto Compute()
     {
-        using merged_values = typename sequence_merge<MergedValues, LeftValues>::type;
-        using merged_ids    = typename sequence_merge<MergedIds, LeftIds>::type;
-    };
+        constexpr index_t n = Values::Size();
 
-    template <typename RightValues,
-              typename RightIds,
-              typename MergedValues,
-              typename MergedIds,
-              typename Comp>
-    struct sorted_sequence_merge_impl<Sequence<>,
-                                      Sequence<>,
-                                      RightValues,
-                                      RightIds,
-                                      MergedValues,
-                                      MergedIds,
-                                      Comp>
-    {
-        using merged_values = typename sequence_merge<MergedValues, RightValues>::type;
-        using merged_ids    = typename sequence_merge<MergedIds, RightIds>::type;
-    };
+        sequence_values<n> ids;
 
-    template <typename LeftValues,
-              typename LeftIds,
-              typename RightValues,
-              typename RightIds,
-              typename Comp>
-    struct sorted_sequence_merge
-    {
-        using merge = sorted_sequence_merge_impl<LeftValues,
-                                                 LeftIds,
-                                                 RightValues,
-                                                 RightIds,
-                                                 Sequence<>,
-                                                 Sequence<>,
-                                                 Comp>;
-
-        using merged_values = typename merge::merged_values;
-        using merged_ids    = typename merge::merged_ids;
-    };
+        for(index_t i = 0; i < n; ++i)
+        {
+            ids.data[i] = i;
+        }
 
-    static constexpr index_t nsize = Values::Size();
+        auto is_before = [](index_t id_x, index_t id_y) {
+            const index_t x = Values::At(id_x);
+            const index_t y = Values::At(id_y);
 
-    using split_unsorted_values = sequence_split<Values, nsize / 2>;
-    using split_unsorted_ids    = sequence_split<Ids, nsize / 2>;
+            return Compare{}(x, y) || (!Compare{}(y, x) && id_x > id_y);
+        };
 
-    using left_unsorted_values = typename split_unsorted_values::left_type;
-    using left_unsorted_ids    = typename split_unsorted_ids::left_type;
-    using left_sort          = sequence_sort_impl<left_unsorted_values, left_unsorted_ids, Compare>;
-    using left_sorted_values = typename left_sort::sorted_values;
-    using left_sorted_ids    = typename left_sort::sorted_ids;
+        // insertion sort, sequences are short
+        for(index_t i = 1; i < n; ++i)
+        {
+            const index_t id = ids.data[i];
+
+            index_t j = i;
 
-    using right_unsorted_values = typename split_unsorted_values::right_type;
-    using right_unsorted_ids    = typename split_unsorted_ids::right_type;
-    using right_sort = sequence_sort_impl<right_unsorted_values, right_unsorted_ids, Compare>;
-    using right_sorted_values = typename right_sort::sorted_values;
-    using right_sorted_ids    = typename right_sort::sorted_ids;
+            for(; j > 0 && is_before(id, ids.data[j - 1]); --j)
+            {
+                ids.data[j] = ids.data[j - 1];
+            }
 
-    using merged_sorted = sorted_sequence_merge<left_sorted_values,
-                                                left_sorted_ids,
-                                                right_sorted_values,
-                                                right_sorted_ids,
-                                                Compare>;
+            ids.data[j] = id;
+        }
 
-    using sorted_values = typename merged_sorted::merged_values;
-    using sorted_ids    = typename merged_sorted::merged_ids;
+        return ids;
+    }
 };
 
-template <index_t ValueX, index_t ValueY, index_t IdX, index_t IdY, typename Compare>
-struct sequence_sort_impl<Sequence<ValueX, ValueY>, Sequence<IdX, IdY>, Compare>
+// Ids of the first of each run of equal values in sorted order
+template <typename Values, typename Less, typename Equal>
+struct sequence_unique_sort_ids
 {
-    static constexpr bool choose_x = Compare{}(ValueX, ValueY);
+    __host__ __device__ static constexpr auto Compute()
+    {
+        constexpr auto sorted_ids = sequence_sort_ids<Values, Less>::Compute();
 
-    using sorted_values =
-        typename conditional<choose_x, Sequence<ValueX, ValueY>, Sequence<ValueY, ValueX>>::type;
-    using sorted_ids = typename conditional<choose_x, Sequence<IdX, IdY>, Sequence<IdY, IdX>>::type;
-};
+        sequence_values<Values::Size()> ids;
 
-template <index_t Value, index_t Id, typename Compare>
-struct sequence_sort_impl<Sequence<Value>, Sequence<Id>, Compare>
-{
-    using sorted_values = Sequence<Value>;
-    using sorted_ids    = Sequence<Id>;
-};
+        ids.size = 0;
 
-template <typename Compare>
-struct sequence_sort_impl<Sequence<>, Sequence<>, Compare>
-{
-    using sorted_values = Sequence<>;
-    using sorted_ids    = Sequence<>;
-};
+        for(index_t i = 0; i < Values::Size(); ++i)
+        {
+            const index_t id = sorted_ids.data[i];
 
-template <typename Values, typename Compare>
-struct sequence_sort
-{
-    using unsorted_ids = typename arithmetic_sequence_gen<0, Values::Size(), 1>::type;
-    using sort         = sequence_sort_impl<Values, unsorted_ids, Compare>;
+            if(ids.size == 0 || !Equal{}(Values::At(id), Values::At(ids.data[ids.size - 1])))
+            {
+                ids.data[ids.size++] = id;
+            }
+        }
 
-    // this is output
-    using type                = typename sort::sorted_values;
-    using sorted2unsorted_map = typename sort::sorted_ids;
+        return ids;
+    }
 };
 
-template <typename Values, typename Less, typename Equal>
-struct sequence_unique_sort
+// whether SeqMap holds each of 0, ..., SeqMap::Size() - 1 once
+template <typename SeqMap>
+__host__ __device__ constexpr bool is_permutation_of_ids()
 {
-    template <typename RemainValues,
-              typename RemainIds,
-              typename UniquifiedValues,
-              typename UniquifiedIds,
-              typename Eq>
-    struct sorted_sequence_uniquify_impl
-    {
-        static constexpr index_t current_value = RemainValues::Front();
-        static constexpr index_t current_id    = RemainIds::Front();
-
-        static constexpr bool is_unique_value = (current_value != UniquifiedValues::Back());
+    constexpr index_t n = SeqMap::Size();
 
-        using new_remain_values = decltype(RemainValues::PopFront());
-        using new_remain_ids    = decltype(RemainIds::PopFront());
+    bool is_mapped[n + 1] = {};
 
-        using new_uniquified_values =
-            typename conditional<is_unique_value,
-                                 decltype(UniquifiedValues::PushBack(Number<current_value>{})),
-                                 UniquifiedValues>::type;
-
-        using new_uniquified_ids =
-            typename conditional<is_unique_value,
-                                 decltype(UniquifiedIds::PushBack(Number<current_id>{})),
-                                 UniquifiedIds>::type;
-
-        using uniquify = sorted_sequence_uniquify_impl<new_remain_values,
-                                                       new_remain_ids,
-                                                       new_uniquified_values,
-                                                       new_uniquified_ids,
-                                                       Eq>;
+    for(index_t x = 0; x < n; ++x)
+    {
+        const index_t y = SeqMap::At(x);
 
-        // this is output
-        using uniquified_values = typename uniquify::uniquified_values;
-        using uniquified_ids    = typename uniquify::uniquified_ids;
-    };
+        if(y < 0 || y >= n || is_mapped[y])
+        {
+            return false;
+        }
 
-    template <typename UniquifiedValues, typename UniquifiedIds, typename Eq>
-    struct sorted_sequence_uniquify_impl<Sequence<>,
-                                         Sequence<>,
-                                         UniquifiedValues,
-                                         UniquifiedIds,
-                                         Eq>
-    {
-        using uniquified_values = UniquifiedValues;
-        using uniquified_ids    = UniquifiedIds;
-    };
+        is_mapped[y] = true;
+    }
 
-    template <typename SortedValues, typename SortedIds, typename Eq>
-    struct sorted_sequence_uniquify
-    {
-        using uniquify = sorted_sequence_uniquify_impl<decltype(SortedValues::PopFront()),
-                                                       decltype(SortedIds::PopFront()),
-                                                       Sequence<SortedValues::Front()>,
-                                                       Sequence<SortedIds::Front()>,
-                                                       Eq>;
-
-        using uniquified_values = typename uniquify::uniquified_values;
-        using uniquified_ids    = typename uniquify::uniquified_ids;
-    };
+    return true;
+}
 
-    using sort          = sequence_sort<Values, Less>;
-    using sorted_values = typename sort::type;
-    using sorted_ids    = typename sort::sorted2unsorted_map;
+} // namespace detail
 
-    using uniquify = sorted_sequence_uniquify<sorted_values, sorted_ids, Equal>;
+template <typename Values, typename Compare>
+struct sequence_sort
+{
+    // this is output
+    using sorted2unsorted_map =
+        typename detail::sequence_from_values<detail::sequence_sort_ids<Values, Compare>>::type;
+    using type = decltype(Values::Extract(sorted2unsorted_map{}));
+};
 
+template <typename Values, typename Less, typename Equal>
+struct sequence_unique_sort
+{
     // this is output
-    using type                = typename uniquify::uniquified_values;
-    using sorted2unsorted_map = typename uniquify::uniquified_ids;
+    using sorted2unsorted_map = typename detail::sequence_from_values<
+        detail::sequence_unique_sort_ids<Values, Less, Equal>>::type;
+    using type = decltype(Values::Extract(sorted2unsorted_map{}));
 };
 
 template <typename SeqMap>
-struct is_valid_sequence_map : is_same<typename arithmetic_sequence_gen<0, SeqMap::Size(), 1>::type,
-                                       typename sequence_sort<SeqMap, math::less<index_t>>::type>
+struct is_valid_sequence_map
+    : integral_constant<bool, detail::is_permutation_of_ids<SeqMap>()>
 {
 };
 
 template <typename SeqMap>
 struct sequence_map_inverse
 {
-    template <typename X2Y, typename WorkingY2X, index_t XBegin, index_t XRemain>
-    struct sequence_map_inverse_impl
+    struct Values
     {
-        static constexpr auto new_y2x =
-            WorkingY2X::Modify(X2Y::At(Number<XBegin>{}), Number<XBegin>{});
+        __host__ __device__ static constexpr auto Compute()
+        {
+            detail::sequence_values<SeqMap::Size()> y2x;
 
-        using type =
-            typename sequence_map_inverse_impl<X2Y, decltype(new_y2x), XBegin + 1, XRemain - 1>::
-                type;
-    };
+            for(index_t x = 0; x < SeqMap::Size(); ++x)
+            {
+                y2x.data[SeqMap::At(x)] = x;
+            }
 
-    template <typename X2Y, typename WorkingY2X, index_t XBegin>
-    struct sequence_map_inverse_impl<X2Y, WorkingY2X, XBegin, 0>
-    {
-        using type = WorkingY2X;
+            return y2x;
+        }
     };
 
-    using type =
-        typename sequence_map_inverse_impl<SeqMap,
-                                           typename uniform_sequence_gen<SeqMap::Size(), 0>::type,
-                                           0,
-                                           SeqMap::Size()>::type;
+    using type = typename detail::sequence_from_values<Values>::type;
 };
 
 template <index_t... Xs, index_t... Ys>
@@ -727,7 +604,7 @@ template <typename Seq>
 __host__ __device__ constexpr auto sequence_pop_back(Seq)
 {
     static_assert(Seq::Size() > 0, "wrong! cannot pop an empty Sequence!");
-    return sequence_pop_front(Seq::Reverse()).Reverse();
+    return Seq::Extract(typename arithmetic_sequence_gen<0, Seq::Size() - 1, 1>::type{});
 }
 
 template <typename... Seqs>
@@ -786,25 +663,48 @@ __host__ __device__ constexpr auto pick_sequence_elements_by_ids(Seq, Sequence<I
     return Sequence<Seq::At(Number<Is>{})...>{};
 }
 
-#if 1
 namespace detail {
-template <typename WorkSeq, typename RemainSeq, typename RemainMask>
-struct pick_sequence_elements_by_mask_impl
+
+template <typename Mask>
+struct sequence_mask_ids
 {
-    using new_work_seq = typename conditional<RemainMask::Front(),
-                                              decltype(WorkSeq::PushBack(RemainSeq::Front())),
-                                              WorkSeq>::type;
+    __host__ __device__ static constexpr auto Compute()
+    {
+        sequence_values<Mask::Size()> ids;
 
-    using type =
-        typename pick_sequence_elements_by_mask_impl<new_work_seq,
-                                                     decltype(RemainSeq::PopFront()),
-                                                     decltype(RemainMask::PopFront())>::type;
+        ids.size = 0;
+
+        for(index_t i = 0; i < Mask::Size(); ++i)
+        {
+            if(Mask::At(i))
+            {
+                ids.data[ids.size++] = i;
+            }
+        }
+
+        return ids;
+    }
 };
 
-template <typename WorkSeq>
-struct pick_sequence_elements_by_mask_impl<WorkSeq, Sequence<>, Sequence<>>
+template <typename Seq, typename Values, typename Ids>
+struct sequence_modified_by_ids
 {
-    using type = WorkSeq;
+    __host__ __device__ static constexpr auto Compute()
+    {
+        sequence_values<Seq::Size()> r;
+
+        for(index_t i = 0; i < Seq::Size(); ++i)
+        {
+            r.data[i] = Seq::At(i);
+        }
+
+        for(index_t i = 0; i < Ids::Size(); ++i)
+        {
+            r.data[Ids::At(i)] = Values::At(i);
+        }
+
+        return r;
+    }
 };
 
 } // namespace detail
@@ -814,77 +714,43 @@ __host__ __device__ constexpr auto pick_sequence_elements_by_mask(Seq, Mask)
 {
     static_assert(Seq::Size() == Mask::Size(), "wrong!");
 
-    return typename detail::pick_sequence_elements_by_mask_impl<Sequence<>, Seq, Mask>::type{};
-}
+    using ids = typename detail::sequence_from_values<detail::sequence_mask_ids<Mask>>::type;
 
-namespace detail {
-template <typename WorkSeq, typename RemainValues, typename RemainIds>
-struct modify_sequence_elements_by_ids_impl
-{
-    using new_work_seq = decltype(WorkSeq::Modify(RemainIds::Front(), RemainValues::Front()));
-
-    using type =
-        typename modify_sequence_elements_by_ids_impl<new_work_seq,
-                                                      decltype(RemainValues::PopFront()),
-                                                      decltype(RemainIds::PopFront())>::type;
-};
-
-template <typename WorkSeq>
-struct modify_sequence_elements_by_ids_impl<WorkSeq, Sequence<>, Sequence<>>
-{
-    using type = WorkSeq;
-};
-} // namespace detail
+    return Seq::Extract(ids{});
+}
 
 template <typename Seq, typename Values, typename Ids>
 __host__ __device__ constexpr auto modify_sequence_elements_by_ids(Seq, Values, Ids)
 {
     static_assert(Values::Size() == Ids::Size() && Seq::Size() >= Values::Size(), "wrong!");
 
-    return typename detail::modify_sequence_elements_by_ids_impl<Seq, Values, Ids>::type{};
+    return typename detail::sequence_from_values<
+        detail::sequence_modified_by_ids<Seq, Values, Ids>>::type{};
 }
-#endif
 
-template <typename Seq, typename Reduce, index_t Init>
+template <index_t... Is, typename Reduce, index_t Init>
 __host__ __device__ constexpr index_t
-reduce_on_sequence(Seq, Reduce f, Number<Init> /*initial_value*/)
+reduce_on_sequence(Sequence<Is...>, Reduce f, Number<Init> /*initial_value*/)
 {
     index_t result = Init;
 
-    for(index_t i = 0; i < Seq::Size(); ++i)
-    {
-        result = f(result, Seq::At(i));
-    }
+    ((result = f(result, Is)), ...);
 
     return result;
 }
 
 // TODO: a generic any_of for any container
-template <typename Seq, typename F>
-__host__ __device__ constexpr bool sequence_any_of(Seq, F f)
+template <index_t... Is, typename F>
+__host__ __device__ constexpr bool sequence_any_of(Sequence<Is...>, F f)
 {
-    bool flag = false;
-
-    for(index_t i = 0; i < Seq::Size(); ++i)
-    {
-        flag = flag || f(Seq::At(i));
-    }
-
-    return flag;
+    return (false || ... || f(Is));
 }
 
 // TODO: a generic all_of for any container
-template <typename Seq, typename F>
-__host__ __device__ constexpr bool sequence_all_of(Seq, F f)
+template <index_t... Is, typename F>
+__host__ __device__ constexpr bool sequence_all_of(Sequence<Is...>, F f)
 {
-    bool flag = true;
-
-    for(index_t i = 0; i < Seq::Size(); ++i)
-    {
-        flag = flag && f(Seq::At(i));
-    }
-
-    return flag;
+    return (true && ... && f(Is));
 }
 
 template <typename Sx, typename Sy>
@@ -185,6 +185,37 @@ struct tuple_element
     using type = decltype(TTuple{}.At(Number<I>{}));
 };
 
+namespace detail {
+
+#if defined(__has_builtin)
+#if __has_builtin(__type_pack_element)
+#define CK_HAS_TYPE_PACK_ELEMENT 1
+#endif
+#endif
+
+#ifdef CK_HAS_TYPE_PACK_ELEMENT
+template <index_t I, typename... Xs>
+using tuple_element_data_t = __type_pack_element<I, Xs...>;
+#else
+// the TupleElementKeyData base of key I is the only match
+template <index_t I, typename... Xs>
+using tuple_element_data_t = remove_reference_t<decltype(
+    get_tuple_element_data<TupleElementKey<I>>(std::declval<Tuple<Xs...>&>()))>;
+#endif
+
+#undef CK_HAS_TYPE_PACK_ELEMENT
+
+} // namespace detail
+
+// type of At() of a non-const Tuple, found without instantiating At() or constructing the Tuple
+template <index_t I, typename... Xs>
+struct tuple_element<I, Tuple<Xs...>>
+{
+    static_assert(I < sizeof...(Xs), "wrong! out of range");
+
+    using type = detail::tuple_element_data_t<I, Xs...>&;
+};
+
 template <index_t I, typename TTuple>
 using tuple_element_t = typename tuple_element<I, TTuple>::type;
 
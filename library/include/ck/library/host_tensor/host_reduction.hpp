@@ -29,6 +29,7 @@
 
 #include <vector>
 #include <array>
+#include <algorithm>
 #include <functional>
 
 #include "reduction_enums.hpp"
@@ -401,4 +402,118 @@ struct ReductionHost
     };
 };
 
+// Host reference for the single-pass mean/variance reduction with reduce::Welford. Every value is
+// accumulated into a WelfordState<AccDataType>; the reduced dimensions can be split into
+// numPartitions contiguous ranges which are accumulated separately and then merged, mirroring
+// the partial results of a multiblock reduction.
+template <typename InDataType,
+          typename AccDataType,
+          typename MeanDataType,
+          typename VarDataType,
+          int Rank,
+          int NumReduceDim,
+          bool PropagateNan>
+struct ReductionHostWelford
+{
+    static constexpr int NumInvariantDim = Rank - NumReduceDim;
+
+    using StateType = ck::reduce::WelfordState<AccDataType>;
+
+    std::vector<size_t> outStrides;
+
+    std::array<size_t, NumReduceDim> reduceLengths;
+    std::array<size_t, NumReduceDim> reduceStrides;
+    std::array<size_t, NumInvariantDim> invariantLengths;
+    std::array<size_t, NumInvariantDim> invariantStrides;
+
+    std::vector<std::array<size_t, NumReduceDim>> reduce_dim_indexes;
+    std::vector<std::array<size_t, NumInvariantDim>> invariant_dim_indexes;
+
+    ReductionHostWelford(HostTensorDescriptor& inDesc,
+                         HostTensorDescriptor& outDesc,
+                         const std::vector<int>& invariantDims,
+                         const std::vector<int>& reduceDims)
+    {
+        this->outStrides = outDesc.GetStrides();
+
+        for(int i = 0; i < NumReduceDim; i++)
+        {
+            reduceLengths[i] = inDesc.GetLengths()[reduceDims[i]];
+            reduceStrides[i] = inDesc.GetStrides()[reduceDims[i]];
+        };
+
+        for(int i = 0; i < NumInvariantDim; i++)
+        {
+            invariantLengths[i] = inDesc.GetLengths()[invariantDims[i]];
+            invariantStrides[i] = inDesc.GetStrides()[invariantDims[i]];
+        };
+
+        reduce_dim_indexes.clear();
+        get_all_indexes<NumReduceDim>(reduceLengths, reduce_dim_indexes);
+
+        if constexpr(NumInvariantDim > 0)
+        {
+            invariant_dim_indexes.clear();
+            get_all_indexes<NumInvariantDim>(invariantLengths, invariant_dim_indexes);
+        };
+    };
+
+    void Run(const InDataType* in_data,
+             MeanDataType* out_mean,
+             VarDataType* out_variance,
+             size_t numPartitions = 1)
+    {
+        using ck::type_convert;
+
+        using Accumulation =
+            ck::detail::AccumulateWithNanCheck<PropagateNan, ck::reduce::Welford, StateType>;
+
+        numPartitions = std::max<size_t>(numPartitions, 1);
+
+        const size_t reduceSize    = reduce_dim_indexes.size();
+        const size_t partitionSize = (reduceSize + numPartitions - 1) / numPartitions;
+
+        auto reduce_func = [&](size_t offset_invariant, size_t dst_offset) {
+            StateType accuVal = ck::reduce::Welford::GetIdentityValue<StateType>();
+
+            for(size_t begin = 0; begin < reduceSize; begin += partitionSize)
+            {
+                const size_t end = std::min(begin + partitionSize, reduceSize);
+
+                StateType partialVal = ck::reduce::Welford::GetIdentityValue<StateType>();
+
+                for(size_t i = begin; i < end; i++)
+                {
+                    auto offset_reduce =
+                        get_offset_from_index<NumReduceDim>(reduceStrides, reduce_dim_indexes[i]);
+
+                    auto currVal =
+                        type_convert<AccDataType>(in_data[offset_invariant + offset_reduce]);
+
+                    Accumulation::Calculate(partialVal, StateType::FromValue(currVal));
+                };
+
+                Accumulation::Calculate(accuVal, partialVal);
+            };
+
+            out_mean[dst_offset]     = type_convert<MeanDataType>(accuVal.GetMean());
+            out_variance[dst_offset] = type_convert<VarDataType>(accuVal.GetVariance());
+        };
+
+        if constexpr(NumInvariantDim == 0)
+        {
+            reduce_func(0, 0);
+        }
+        else
+        {
+            for(const auto& invariant_index : invariant_dim_indexes)
+            {
+                reduce_func(
+                    get_offset_from_index<NumInvariantDim>(invariantStrides, invariant_index),
+                    get_offset_from_index<NumInvariantDim>(outStrides, invariant_index));
+            };
+        };
+    };
+};
+
 #endif
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "data_type.hpp"
+#include "host_tensor.hpp"
+
+// number of elements converted by a thread at a time
+constexpr std::size_t bulk_type_convert_chunk = 1 << 16;
+
+// fp32 value of each of the 256 codes of F8, which is f8_t or bf8_t
+template <typename F8>
+const std::array<float, 256>& get_f8_to_float_table()
+{
+    static const std::array<float, 256> table = [] {
+        std::array<float, 256> values;
+
+        for(std::size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = ck::type_convert<float>(F8{static_cast<uint8_t>(i)});
+        }
+
+        return values;
+    }();
+
+    return table;
+}
+
+// calls f(begin, end) for the chunks of [0, n), from num_thread threads
+template <typename F>
+void for_each_chunk(F f, std::size_t n, std::size_t num_thread)
+{
+    const std::size_t num_chunk = (n + bulk_type_convert_chunk - 1) / bulk_type_convert_chunk;
+
+    auto f_chunk = [&](std::size_t chunk) {
+        const std::size_t begin = chunk * bulk_type_convert_chunk;
+
+        f(begin, std::min(begin + bulk_type_convert_chunk, n));
+    };
+
+    num_thread = std::max<std::size_t>(std::min(num_thread, num_chunk), 1);
+
+    make_ParallelTensorFunctor(f_chunk, num_chunk)(num_thread);
+}
+
+//
+// @brief      p_dst[i] = ck::type_convert<Y>(p_src[i]) for i < n, from num_thread threads.
+//
+// @paragraph  f8_t and bf8_t are converted to fp32 with a table of their 256 values, and the
+//             conversions to them have no branches, so that the loops over a chunk vectorize
+//             where the ISA has per-lane shifts, e.g. with AVX2.
+//
+template <typename Y, typename X>
+void bulk_type_convert(const X* p_src, Y* p_dst, std::size_t n, std::size_t num_thread = 1)
+{
+    constexpr bool is_f8_to_float =
+        (std::is_same<X, ck::f8_t>::value || std::is_same<X, ck::bf8_t>::value) &&
+        std::is_same<Y, float>::value;
+
+    for_each_chunk(
+        [&](std::size_t begin, std::size_t end) {
+            if constexpr(is_f8_to_float)
+            {
+                const auto& table = get_f8_to_float_table<X>();
+
+                for(std::size_t i = begin; i < end; ++i)
+                {
+                    p_dst[i] = table[p_src[i].data];
+                }
+            }
+            else
+            {
+                for(std::size_t i = begin; i < end; ++i)
+                {
+                    p_dst[i] = ck::type_convert<Y>(p_src[i]);
+                }
+            }
+        },
+        n,
+        num_thread);
+}
+
+// p_dst[i] = ck::f8_convert_sat<Y>(p_src[i]) for i < n, from num_thread threads
+template <typename Y>
+void bulk_f8_convert_sat(const float* p_src, Y* p_dst, std::size_t n, std::size_t num_thread = 1)
+{
+    for_each_chunk(
+        [&](std::size_t begin, std::size_t end) {
+            for(std::size_t i = begin; i < end; ++i)
+            {
+                p_dst[i] = ck::f8_convert_sat<Y>(p_src[i]);
+            }
+        },
+        n,
+        num_thread);
+}
+
+// tensor of the same descriptor as src, whose elements are converted by bulk_type_convert
+template <typename Y, typename X>
+Tensor<Y> convert_tensor(const Tensor<X>& src, std::size_t num_thread = 1)
+{
+    Tensor<Y> dst(src.mDesc);
+
+    bulk_type_convert(src.mData.data(), dst.mData.data(), src.mData.size(), num_thread);
+
+    return dst;
+}
+
+// packs the pairs of consecutive values along the last dimension of src, whose length is
+// halved, into a packed tensor. The values must be in [-8, 7].
+inline Tensor<ck::pk_i4_t> pack_i4_tensor(const Tensor<int8_t>& src)
+{
+    std::vector<std::size_t> lengths = src.mDesc.GetLengths();
+
+    if(lengths.empty() || lengths.back() % 2 != 0)
+    {
+        throw std::runtime_error("wrong! length of last dimension is not even");
+    }
+
+    if(std::any_of(src.mData.begin(), src.mData.end(), [](int8_t v) { return v < -8 || v > 7; }))
+    {
+        throw std::runtime_error("wrong! value out of the range of int4");
+    }
+
+    lengths.back() /= 2;
+
+    Tensor<ck::pk_i4_t> dst(lengths);
+
+    dst.ForEach([&](auto& self, const std::vector<std::size_t>& idx) {
+        std::vector<std::size_t> src_idx = idx;
+
+        src_idx.back() = 2 * idx.back();
+
+        const int8_t lo = src(src_idx);
+
+        src_idx.back() += 1;
+
+        self(idx) = ck::pack_i4(lo, src(src_idx));
+    });
+
+    return dst;
+}
+
+// inverse of pack_i4_tensor, where the length of the last dimension is doubled
+inline Tensor<int8_t> unpack_i4_tensor(const Tensor<ck::pk_i4_t>& src)
+{
+    std::vector<std::size_t> lengths = src.mDesc.GetLengths();
+
+    if(lengths.empty())
+    {
+        throw std::runtime_error("wrong! tensor has no dimension");
+    }
+
+    lengths.back() *= 2;
+
+    Tensor<int8_t> dst(lengths);
+
+    dst.ForEach([&](auto& self, const std::vector<std::size_t>& idx) {
+        std::vector<std::size_t> src_idx = idx;
+
+        src_idx.back() = idx.back() / 2;
+
+        self(idx) = ck::unpack_i4(src(src_idx), idx.back() % 2);
+    });
+
+    return dst;
+}
@@ -5,6 +5,7 @@
 #include <sstream>
 #include "device_base.hpp"
 #include "host_tensor.hpp"
+#include "reference_tile.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -50,29 +51,53 @@ struct ReferenceBatchedGemm : public device::BaseOperator
     {
         using Argument = ReferenceBatchedGemm::Argument;
 
-        float Run(const Argument& arg)
+        // value of c_g_m_n(g, m, n), computed without writing c_g_m_n
+        static CDataType ComputeAt(const Argument& arg,
+                                   std::size_t g,
+                                   std::size_t m,
+                                   std::size_t n)
         {
-            auto f_gmk_gkn_gmn = [&](auto g, auto m, auto n) {
-                const int K = arg.a_g_m_k_.mDesc.GetLengths()[2];
+            const int K = arg.a_g_m_k_.mDesc.GetLengths()[2];
+
+            float v_acc = 0;
+
+            for(int k = 0; k < K; ++k)
+            {
+                float v_a;
+                float v_b;
 
-                float v_acc = 0;
+                arg.a_element_op_(v_a, static_cast<const float>(arg.a_g_m_k_(g, m, k)));
+                arg.b_element_op_(v_b, static_cast<const float>(arg.b_g_k_n_(g, k, n)));
 
-                for(int k = 0; k < K; ++k)
-                {
-                    float v_a;
-                    float v_b;
+                v_acc += v_a * v_b;
+            }
 
-                    arg.a_element_op_(v_a, static_cast<const float>(arg.a_g_m_k_(g, m, k)));
-                    arg.b_element_op_(v_b, static_cast<const float>(arg.b_g_k_n_(g, k, n)));
+            float v_c;
 
-                    v_acc += v_a * v_b;
-                }
+            arg.c_element_op_(v_c, v_acc);
 
-                float v_c;
+            return v_c;
+        }
+
+        // idx: {g, m, n}
+        static CDataType ComputeAt(const Argument& arg, const std::vector<std::size_t>& idx)
+        {
+            return ComputeAt(arg, idx[0], idx[1], idx[2]);
+        }
 
-                arg.c_element_op_(v_c, v_acc);
+        // computes c_g_m_n within the tile given by one range per dimension only
+        static void ComputeTile(const Argument& arg, const std::vector<IndexRange>& ranges)
+        {
+            ForEachTileIndex(
+                ranges,
+                [&](const auto& idx) { arg.c_g_m_n_(idx) = ComputeAt(arg, idx); },
+                std::thread::hardware_concurrency());
+        }
 
-                arg.c_g_m_n_(g, m, n) = v_c;
+        float Run(const Argument& arg)
+        {
+            auto f_gmk_gkn_gmn = [&](auto g, auto m, auto n) {
+                arg.c_g_m_n_(g, m, n) = ComputeAt(arg, g, m, n);
             };
 
             make_ParallelTensorFunctor(f_gmk_gkn_gmn,
@@ -24,8 +24,11 @@
  *
  *******************************************************************************/
 #pragma once
+#include <algorithm>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
+#include <vector>
 #include "device_base.hpp"
 #include "host_tensor.hpp"
 
@@ -33,6 +36,66 @@ namespace ck {
 namespace tensor_operation {
 namespace host {
 
+enum struct CGemmAlgorithm
+{
+    Direct, // c = a * b with 4 real multiplies per complex multiply-accumulate
+    Gauss,  // 3M: 3 real GEMMs, ar * br, ai * bi and (ar + ai) * (br + bi)
+};
+
+// Complex matrix, either stored as separate real and imaginary planes of the same layout, or
+// interleaved, i.e. as a (rows, cols, 2) tensor holding the real and imaginary parts last
+template <typename T>
+struct ComplexMatrixView
+{
+    T* p_real_;
+    T* p_imag_;
+
+    std::size_t rows_;
+    std::size_t cols_;
+    std::size_t row_stride_;
+    std::size_t col_stride_;
+
+    std::size_t GetOffset(std::size_t i, std::size_t j) const
+    {
+        return i * row_stride_ + j * col_stride_;
+    }
+
+    template <typename TensorType>
+    static ComplexMatrixView MakeSplit(TensorType& real, TensorType& imag)
+    {
+        const auto& lengths = real.mDesc.GetLengths();
+        const auto& strides = real.mDesc.GetStrides();
+
+        if(lengths.size() != 2 || lengths != imag.mDesc.GetLengths() ||
+           strides != imag.mDesc.GetStrides())
+        {
+            throw std::runtime_error("wrong! Incompatible real and imag sizes in CGEMM");
+        }
+
+        return {
+            real.mData.data(), imag.mData.data(), lengths[0], lengths[1], strides[0], strides[1]};
+    }
+
+    template <typename TensorType>
+    static ComplexMatrixView MakeInterleaved(TensorType& complex)
+    {
+        const auto& lengths = complex.mDesc.GetLengths();
+        const auto& strides = complex.mDesc.GetStrides();
+
+        if(lengths.size() != 3 || lengths[2] != 2)
+        {
+            throw std::runtime_error("wrong! interleaved complex tensor is not (rows, cols, 2)");
+        }
+
+        return {complex.mData.data(),
+                complex.mData.data() + strides[2],
+                lengths[0],
+                lengths[1],
+                strides[0],
+                strides[1]};
+    }
+};
+
 // FIXME: support arbitrary elementwise operation for A/B/C
 template <
     typename ADataType,
@@ -48,40 +111,43 @@ template <
         bool> = false>
 struct ReferenceCGemm : public device::BaseOperator
 {
+    // number of columns of B and C in a packed panel
+    static constexpr std::size_t NPerPanel = 128;
+
     // Argument
     struct Argument : public device::BaseArgument
     {
-        Argument(const Tensor<ADataType>& a_m_k_real,
-                 const Tensor<ADataType>& a_m_k_imag,
-                 const Tensor<BDataType>& b_k_n_real,
-                 const Tensor<BDataType>& b_k_n_imag,
-                 Tensor<CDataType>& c_m_n_real,
-                 Tensor<CDataType>& c_m_n_imag,
+        Argument(ComplexMatrixView<const ADataType> a_m_k,
+                 ComplexMatrixView<const BDataType> b_k_n,
+                 ComplexMatrixView<CDataType> c_m_n,
                  AElementwiseOperation a_element_op,
                  BElementwiseOperation b_element_op,
-                 CElementwiseOperation c_element_op)
-            : a_m_k_real_{a_m_k_real},
-              a_m_k_imag_{a_m_k_imag},
-              b_k_n_real_{b_k_n_real},
-              b_k_n_imag_{b_k_n_imag},
-              c_m_n_real_{c_m_n_real},
-              c_m_n_imag_{c_m_n_imag},
+                 CElementwiseOperation c_element_op,
+                 CGemmAlgorithm algorithm)
+            : a_m_k_{a_m_k},
+              b_k_n_{b_k_n},
+              c_m_n_{c_m_n},
               a_element_op_{a_element_op},
               b_element_op_{b_element_op},
-              c_element_op_{c_element_op}
+              c_element_op_{c_element_op},
+              algorithm_{algorithm}
         {
+            if(a_m_k_.cols_ != b_k_n_.rows_ || a_m_k_.rows_ != c_m_n_.rows_ ||
+               b_k_n_.cols_ != c_m_n_.cols_)
+            {
+                throw std::runtime_error("wrong! inconsistent CGEMM lengths");
+            }
         }
 
-        const Tensor<ADataType>& a_m_k_real_;
-        const Tensor<ADataType>& a_m_k_imag_;
-        const Tensor<BDataType>& b_k_n_real_;
-        const Tensor<BDataType>& b_k_n_imag_;
-        Tensor<CDataType>& c_m_n_real_;
-        Tensor<CDataType>& c_m_n_imag_;
+        ComplexMatrixView<const ADataType> a_m_k_;
+        ComplexMatrixView<const BDataType> b_k_n_;
+        ComplexMatrixView<CDataType> c_m_n_;
 
         AElementwiseOperation a_element_op_;
         BElementwiseOperation b_element_op_;
         CElementwiseOperation c_element_op_;
+
+        CGemmAlgorithm algorithm_;
     };
 
     // Invoker
@@ -89,55 +155,168 @@ struct ReferenceCGemm : public device::BaseOperator
     {
         using Argument = ReferenceCGemm::Argument;
 
-        float Run(const Argument& arg)
+        // Converts B to float once, as panels of NPerPanel columns each stored as K contiguous
+        // rows of NPerPanel values, so that the rows of C are computed from contiguous memory.
+        // The panels of br + bi are only needed by the Gauss algorithm.
+        static void PackB(const Argument& arg,
+                          std::vector<float>& b_real_panels,
+                          std::vector<float>& b_imag_panels,
+                          std::vector<float>& b_sum_panels)
         {
-            const std::size_t K = arg.a_m_k_real_.mDesc.GetLengths()[1];
+            const std::size_t K         = arg.b_k_n_.rows_;
+            const std::size_t N         = arg.b_k_n_.cols_;
+            const std::size_t num_panel = (N + NPerPanel - 1) / NPerPanel;
+
+            const bool is_gauss = arg.algorithm_ == CGemmAlgorithm::Gauss;
 
-            if(K != arg.a_m_k_imag_.mDesc.GetLengths()[1])
+            b_real_panels.assign(num_panel * K * NPerPanel, 0);
+            b_imag_panels.assign(num_panel * K * NPerPanel, 0);
+            b_sum_panels.assign(is_gauss ? num_panel * K * NPerPanel : 0, 0);
+
+            for(std::size_t k = 0; k < K; ++k)
             {
-                throw std::runtime_error("wrong! Incompatible real and imag sizes in CGEMM");
+                for(std::size_t n = 0; n < N; ++n)
+                {
+                    const std::size_t offset = arg.b_k_n_.GetOffset(k, n);
+                    const std::size_t i =
+                        ((n / NPerPanel) * K + k) * NPerPanel + n % NPerPanel;
+
+                    b_real_panels[i] = ck::type_convert<float>(arg.b_k_n_.p_real_[offset]);
+                    b_imag_panels[i] = ck::type_convert<float>(arg.b_k_n_.p_imag_[offset]);
+
+                    if(is_gauss)
+                    {
+                        b_sum_panels[i] = b_real_panels[i] + b_imag_panels[i];
+                    }
+                }
             }
+        }
 
-            auto f_mk_kn_mn_real = [&](auto m, auto n) {
-                float v_c_real = 0;
+        // c[n] = sum over k of a[k] * b_panel[k][n], for the first nw columns of a panel
+        static void RealPanelGemm(
+            const float* a, const float* b_panel, float* c, std::size_t K, std::size_t nw)
+        {
+            std::fill(c, c + nw, 0.f);
 
-                for(std::size_t k = 0; k < K; ++k)
+            for(std::size_t k = 0; k < K; ++k)
+            {
+                const float v_a  = a[k];
+                const float* b_k = b_panel + k * NPerPanel;
+
+                for(std::size_t n = 0; n < nw; ++n)
                 {
-                    float v_a_real = ck::type_convert<float>(arg.a_m_k_real_(m, k));
-                    float v_a_imag = ck::type_convert<float>(arg.a_m_k_imag_(m, k));
-                    float v_b_real = ck::type_convert<float>(arg.b_k_n_real_(k, n));
-                    float v_b_imag = ck::type_convert<float>(arg.b_k_n_imag_(k, n));
+                    c[n] += v_a * b_k[n];
+                }
+            }
+        }
+
+        // same as RealPanelGemm, for complex a and b, with both parts of c computed in one pass
+        static void ComplexPanelGemm(const float* a_real,
+                                     const float* a_imag,
+                                     const float* b_real_panel,
+                                     const float* b_imag_panel,
+                                     float* c_real,
+                                     float* c_imag,
+                                     std::size_t K,
+                                     std::size_t nw)
+        {
+            std::fill(c_real, c_real + nw, 0.f);
+            std::fill(c_imag, c_imag + nw, 0.f);
 
-                    v_c_real += v_a_real * v_b_real - v_a_imag * v_b_imag;
+            for(std::size_t k = 0; k < K; ++k)
+            {
+                const float v_a_real  = a_real[k];
+                const float v_a_imag  = a_imag[k];
+                const float* b_real_k = b_real_panel + k * NPerPanel;
+                const float* b_imag_k = b_imag_panel + k * NPerPanel;
+
+                for(std::size_t n = 0; n < nw; ++n)
+                {
+                    c_real[n] += v_a_real * b_real_k[n] - v_a_imag * b_imag_k[n];
+                    c_imag[n] += v_a_real * b_imag_k[n] + v_a_imag * b_real_k[n];
                 }
+            }
+        }
 
-                arg.c_m_n_real_(m, n) = v_c_real;
-            };
+        float Run(const Argument& arg)
+        {
+            const std::size_t M         = arg.c_m_n_.rows_;
+            const std::size_t N         = arg.c_m_n_.cols_;
+            const std::size_t K         = arg.a_m_k_.cols_;
+            const std::size_t num_panel = (N + NPerPanel - 1) / NPerPanel;
+
+            const bool is_gauss = arg.algorithm_ == CGemmAlgorithm::Gauss;
 
-            auto f_mk_kn_mn_imag = [&](auto m, auto n) {
-                float v_c_imag = 0;
+            std::vector<float> b_real_panels, b_imag_panels, b_sum_panels;
+
+            PackB(arg, b_real_panels, b_imag_panels, b_sum_panels);
+
+            auto f_m = [&](auto m) {
+                std::vector<float> a_real(K), a_imag(K), a_sum(is_gauss ? K : 0);
 
                 for(std::size_t k = 0; k < K; ++k)
                 {
-                    float v_a_real = ck::type_convert<float>(arg.a_m_k_real_(m, k));
-                    float v_a_imag = ck::type_convert<float>(arg.a_m_k_imag_(m, k));
-                    float v_b_real = ck::type_convert<float>(arg.b_k_n_real_(k, n));
-                    float v_b_imag = ck::type_convert<float>(arg.b_k_n_imag_(k, n));
+                    const std::size_t offset = arg.a_m_k_.GetOffset(m, k);
+
+                    a_real[k] = ck::type_convert<float>(arg.a_m_k_.p_real_[offset]);
+                    a_imag[k] = ck::type_convert<float>(arg.a_m_k_.p_imag_[offset]);
 
-                    v_c_imag += v_a_real * v_b_imag + v_a_imag * v_b_real;
+                    if(is_gauss)
+                    {
+                        a_sum[k] = a_real[k] + a_imag[k];
+                    }
                 }
 
-                arg.c_m_n_imag_(m, n) = v_c_imag;
+                std::vector<float> c_real(NPerPanel), c_imag(NPerPanel), c_sum(NPerPanel);
+
+                for(std::size_t p = 0; p < num_panel; ++p)
+                {
+                    const std::size_t n_begin = p * NPerPanel;
+                    const std::size_t nw      = std::min(NPerPanel, N - n_begin);
+                    const std::size_t i_panel = p * K * NPerPanel;
+
+                    if(is_gauss)
+                    {
+                        // c_real = ar * br - ai * bi
+                        // c_imag = (ar + ai) * (br + bi) - ar * br - ai * bi
+                        RealPanelGemm(
+                            a_real.data(), &b_real_panels[i_panel], c_real.data(), K, nw);
+                        RealPanelGemm(
+                            a_imag.data(), &b_imag_panels[i_panel], c_imag.data(), K, nw);
+                        RealPanelGemm(a_sum.data(), &b_sum_panels[i_panel], c_sum.data(), K, nw);
+
+                        for(std::size_t n = 0; n < nw; ++n)
+                        {
+                            const float t_real = c_real[n];
+                            const float t_imag = c_imag[n];
+
+                            c_real[n] = t_real - t_imag;
+                            c_imag[n] = c_sum[n] - t_real - t_imag;
+                        }
+                    }
+                    else
+                    {
+                        ComplexPanelGemm(a_real.data(),
+                                         a_imag.data(),
+                                         &b_real_panels[i_panel],
+                                         &b_imag_panels[i_panel],
+                                         c_real.data(),
+                                         c_imag.data(),
+                                         K,
+                                         nw);
+                    }
+
+                    for(std::size_t n = 0; n < nw; ++n)
+                    {
+                        const std::size_t offset = arg.c_m_n_.GetOffset(m, n_begin + n);
+
+                        arg.c_m_n_.p_real_[offset] = ck::type_convert<CDataType>(c_real[n]);
+                        arg.c_m_n_.p_imag_[offset] = ck::type_convert<CDataType>(c_imag[n]);
+                    }
+                }
             };
 
-            make_ParallelTensorFunctor(f_mk_kn_mn_real,
-                                       arg.c_m_n_real_.mDesc.GetLengths()[0],
-                                       arg.c_m_n_real_.mDesc.GetLengths()[1])(
-                std::thread::hardware_concurrency());
-            make_ParallelTensorFunctor(f_mk_kn_mn_imag,
-                                       arg.c_m_n_imag_.mDesc.GetLengths()[0],
-                                       arg.c_m_n_imag_.mDesc.GetLengths()[1])(
-                std::thread::hardware_concurrency());
+            make_ParallelTensorFunctor(f_m, M)(std::thread::hardware_concurrency());
 
             return 0;
         }
@@ -157,6 +336,7 @@ struct ReferenceCGemm : public device::BaseOperator
 
     bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
 
+    // real and imaginary parts stored as separate (M, K), (K, N) and (M, N) tensors
     static auto MakeArgument(const Tensor<ADataType>& a_m_k_real,
                              const Tensor<ADataType>& a_m_k_imag,
                              const Tensor<BDataType>& b_k_n_real,
@@ -165,17 +345,34 @@ struct ReferenceCGemm : public device::BaseOperator
                              Tensor<CDataType>& c_m_n_imag,
                              AElementwiseOperation a_element_op,
                              BElementwiseOperation b_element_op,
-                             CElementwiseOperation c_element_op)
+                             CElementwiseOperation c_element_op,
+                             CGemmAlgorithm algorithm = CGemmAlgorithm::Direct)
+    {
+        return Argument{ComplexMatrixView<const ADataType>::MakeSplit(a_m_k_real, a_m_k_imag),
+                        ComplexMatrixView<const BDataType>::MakeSplit(b_k_n_real, b_k_n_imag),
+                        ComplexMatrixView<CDataType>::MakeSplit(c_m_n_real, c_m_n_imag),
+                        a_element_op,
+                        b_element_op,
+                        c_element_op,
+                        algorithm};
+    }
+
+    // real and imaginary parts interleaved, in (M, K, 2), (K, N, 2) and (M, N, 2) tensors
+    static auto MakeArgument(const Tensor<ADataType>& a_m_k_2,
+                             const Tensor<BDataType>& b_k_n_2,
+                             Tensor<CDataType>& c_m_n_2,
+                             AElementwiseOperation a_element_op,
+                             BElementwiseOperation b_element_op,
+                             CElementwiseOperation c_element_op,
+                             CGemmAlgorithm algorithm = CGemmAlgorithm::Direct)
     {
-        return Argument{a_m_k_real,
-                        a_m_k_imag,
-                        b_k_n_real,
-                        b_k_n_imag,
-                        c_m_n_real,
-                        c_m_n_imag,
+        return Argument{ComplexMatrixView<const ADataType>::MakeInterleaved(a_m_k_2),
+                        ComplexMatrixView<const BDataType>::MakeInterleaved(b_k_n_2),
+                        ComplexMatrixView<CDataType>::MakeInterleaved(c_m_n_2),
                         a_element_op,
                         b_element_op,
-                        c_element_op};
+                        c_element_op,
+                        algorithm};
     }
 
     static auto MakeInvoker() { return Invoker{}; }
@@ -2,14 +2,19 @@
 
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
 #include "device_base.hpp"
 #include "host_tensor.hpp"
+#include "reference_tile.hpp"
 
 namespace ck {
 namespace tensor_operation {
 namespace host {
 
 // out[N, K, Ho, Wo] = in[N, C, Hi, Wi] * wei[K, C, Y, X]
+//
+// For a grouped convolution, the weight has C / G channels, and the weights of output channels
+// [g * K / G, (g + 1) * K / G) get the gradient from input channels [g * C / G, (g + 1) * C / G).
 template <typename InDataType,
           typename WeiDataType,
           typename OutDataType,
@@ -44,6 +49,19 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
               wei_element_op_{wei_element_op},
               out_element_op_{out_element_op}
         {
+            const std::size_t C = input_.mDesc.GetLengths()[1];
+            const std::size_t K = output_.mDesc.GetLengths()[1];
+
+            c_per_group_ = weight_.mDesc.GetLengths()[1];
+
+            if(c_per_group_ == 0 || C % c_per_group_ != 0 ||
+               weight_.mDesc.GetLengths()[0] != K || K % (C / c_per_group_) != 0)
+            {
+                throw std::runtime_error("wrong! inconsistent number of channels of groups");
+            }
+
+            group_count_ = C / c_per_group_;
+            k_per_group_ = K / group_count_;
         }
 
         const Tensor<InDataType>& input_;
@@ -58,6 +76,10 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
         InElementwiseOperation in_element_op_;
         WeiElementwiseOperation wei_element_op_;
         OutElementwiseOperation out_element_op_;
+
+        std::size_t group_count_;
+        std::size_t c_per_group_;
+        std::size_t k_per_group_;
     };
 
     // Invoker
@@ -65,41 +87,206 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
     {
         using Argument = ReferenceConvBwdWeight::Argument;
 
-        float Run(const Argument& arg)
+        // value of weight(k, c, x), computed without writing weight
+        static WeiDataType ComputeAt(const Argument& arg,
+                                     std::size_t k,
+                                     std::size_t c,
+                                     std::size_t x)
         {
-            if constexpr(NumDimSpatial == 1)
+            constexpr auto I0 = Number<0>{};
+
+            // first input channel of the group of k
+            const std::size_t c_begin = k / arg.k_per_group_ * arg.c_per_group_;
+
+            float v_acc = 0;
+            for(std::size_t n = 0; n < arg.output_.mDesc.GetLengths()[0]; ++n)
+            {
+                for(std::size_t wo = 0; wo < arg.output_.mDesc.GetLengths()[2]; ++wo)
+                {
+                    auto wi = ck::type_convert<ck::long_index_t>(wo * arg.conv_strides_[I0]) +
+                              ck::type_convert<ck::long_index_t>(x * arg.conv_dilations_[I0]) -
+                              ck::type_convert<ck::long_index_t>(arg.in_left_pads_[I0]);
+                    if(wi >= 0 &&
+                       ck::type_convert<std::size_t>(wi) < arg.input_.mDesc.GetLengths()[2])
+                    {
+                        float v_out;
+                        float v_in;
+
+                        arg.out_element_op_(v_out,
+                                            ck::type_convert<float>(arg.output_(n, k, wo)));
+                        arg.in_element_op_(v_in,
+                                           ck::type_convert<float>(arg.input_(n, c_begin + c, wi)));
+
+                        v_acc += v_out * v_in;
+                    }
+                }
+            }
+            float v_wei;
+
+            arg.wei_element_op_(v_wei, v_acc);
+
+            return ck::type_convert<WeiDataType>(v_wei);
+        }
+
+        // value of weight(k, c, y, x), computed without writing weight
+        static WeiDataType ComputeAt(const Argument& arg,
+                                     std::size_t k,
+                                     std::size_t c,
+                                     std::size_t y,
+                                     std::size_t x)
+        {
+            constexpr auto I0 = Number<0>{};
+            constexpr auto I1 = Number<1>{};
+
+            // first input channel of the group of k
+            const std::size_t c_begin = k / arg.k_per_group_ * arg.c_per_group_;
+
+            float v_acc = 0;
+            for(std::size_t n = 0; n < arg.output_.mDesc.GetLengths()[0]; ++n)
+            {
+                for(std::size_t ho = 0; ho < arg.output_.mDesc.GetLengths()[2]; ++ho)
+                {
+                    auto hi = ck::type_convert<ck::long_index_t>(ho * arg.conv_strides_[I0]) +
+                              ck::type_convert<ck::long_index_t>(y * arg.conv_dilations_[I0]) -
+                              ck::type_convert<ck::long_index_t>(arg.in_left_pads_[I0]);
+                    for(std::size_t wo = 0; wo < arg.output_.mDesc.GetLengths()[3]; ++wo)
+                    {
+                        auto wi =
+                            ck::type_convert<ck::long_index_t>(wo * arg.conv_strides_[I1]) +
+                            ck::type_convert<ck::long_index_t>(x *
+                                                               arg.conv_dilations_[I1]) -
+                            ck::type_convert<ck::long_index_t>(arg.in_left_pads_[I1]);
+                        if(hi >= 0 &&
+                           ck::type_convert<std::size_t>(hi) <
+                               arg.input_.mDesc.GetLengths()[2] &&
+                           wi >= 0 &&
+                           ck::type_convert<std::size_t>(wi) <
+                               arg.input_.mDesc.GetLengths()[3])
+                        {
+                            float v_out;
+                            float v_in;
+
+                            arg.out_element_op_(
+                                v_out, ck::type_convert<float>(arg.output_(n, k, ho, wo)));
+                            arg.in_element_op_(
+                                v_in, ck::type_convert<float>(arg.input_(n, c_begin + c, hi, wi)));
+
+                            v_acc += v_out * v_in;
+                        }
+                    }
+                }
+            }
+            float v_wei;
+
+            arg.wei_element_op_(v_wei, v_acc);
+
+            return ck::type_convert<WeiDataType>(v_wei);
+        }
+
+        // value of weight(k, c, z, y, x), computed without writing weight
+        static WeiDataType ComputeAt(const Argument& arg,
+                                     std::size_t k,
+                                     std::size_t c,
+                                     std::size_t z,
+                                     std::size_t y,
+                                     std::size_t x)
+        {
+            constexpr auto I0 = Number<0>{};
+            constexpr auto I1 = Number<1>{};
+            constexpr auto I2 = Number<2>{};
+
+            // first input channel of the group of k
+            const std::size_t c_begin = k / arg.k_per_group_ * arg.c_per_group_;
+
+            float v_acc = 0;
+            for(std::size_t n = 0; n < arg.output_.mDesc.GetLengths()[0]; ++n)
             {
-                constexpr auto I0 = Number<0>{};
-                auto f_kcx        = [&](auto k, auto c, auto x) {
-                    float v_acc = 0;
-                    for(std::size_t n = 0; n < arg.output_.mDesc.GetLengths()[0]; ++n)
+                for(std::size_t do_ = 0; do_ < arg.output_.mDesc.GetLengths()[2]; ++do_)
+                {
+                    auto di = ck::type_convert<ck::long_index_t>(do_ * arg.conv_strides_[I0]) +
+                              ck::type_convert<ck::long_index_t>(z * arg.conv_dilations_[I0]) -
+                              ck::type_convert<ck::long_index_t>(arg.in_left_pads_[I0]);
+                    for(std::size_t ho = 0; ho < arg.output_.mDesc.GetLengths()[3]; ++ho)
                     {
-                        for(std::size_t wo = 0; wo < arg.output_.mDesc.GetLengths()[2]; ++wo)
+                        auto hi =
+                            ck::type_convert<ck::long_index_t>(ho * arg.conv_strides_[I1]) +
+                            ck::type_convert<ck::long_index_t>(y *
+                                                               arg.conv_dilations_[I1]) -
+                            ck::type_convert<ck::long_index_t>(arg.in_left_pads_[I1]);
+                        for(std::size_t wo = 0; wo < arg.output_.mDesc.GetLengths()[4];
+                            ++wo)
                         {
                             auto wi =
-                                ck::type_convert<ck::long_index_t>(wo * arg.conv_strides_[I0]) +
-                                ck::type_convert<ck::long_index_t>(x * arg.conv_dilations_[I0]) -
-                                ck::type_convert<ck::long_index_t>(arg.in_left_pads_[I0]);
-                            if(wi >= 0 &&
-                               ck::type_convert<std::size_t>(wi) < arg.input_.mDesc.GetLengths()[2])
+                                ck::type_convert<ck::long_index_t>(wo *
+                                                                   arg.conv_strides_[I2]) +
+                                ck::type_convert<ck::long_index_t>(
+                                    x * arg.conv_dilations_[I2]) -
+                                ck::type_convert<ck::long_index_t>(arg.in_left_pads_[I2]);
+                            if(di >= 0 &&
+                               ck::type_convert<std::size_t>(di) <
+                                   arg.input_.mDesc.GetLengths()[2] &&
+                               hi >= 0 &&
+                               ck::type_convert<std::size_t>(hi) <
+                                   arg.input_.mDesc.GetLengths()[3] &&
+                               wi >= 0 &&
+                               ck::type_convert<std::size_t>(wi) <
+                                   arg.input_.mDesc.GetLengths()[4])
                             {
                                 float v_out;
                                 float v_in;
 
                                 arg.out_element_op_(v_out,
-                                                    ck::type_convert<float>(arg.output_(n, k, wo)));
+                                                    ck::type_convert<float>(
+                                                        arg.output_(n, k, do_, ho, wo)));
                                 arg.in_element_op_(v_in,
-                                                   ck::type_convert<float>(arg.input_(n, c, wi)));
+                                                   ck::type_convert<float>(
+                                                       arg.input_(n, c_begin + c, di, hi, wi)));
 
                                 v_acc += v_out * v_in;
                             }
                         }
                     }
-                    float v_wei;
+                }
+            }
+            float v_wei;
+
+            arg.wei_element_op_(v_wei, v_acc);
 
-                    arg.wei_element_op_(v_wei, v_acc);
+            return ck::type_convert<WeiDataType>(v_wei);
+        }
 
-                    arg.weight_(k, c, x) = ck::type_convert<WeiDataType>(v_wei);
+        // idx: {k, c, x}, {k, c, y, x}, {k, c, z, y, x}
+        static WeiDataType ComputeAt(const Argument& arg, const std::vector<std::size_t>& idx)
+        {
+            if constexpr(NumDimSpatial == 1)
+            {
+                return ComputeAt(arg, idx[0], idx[1], idx[2]);
+            }
+            else if constexpr(NumDimSpatial == 2)
+            {
+                return ComputeAt(arg, idx[0], idx[1], idx[2], idx[3]);
+            }
+            else if constexpr(NumDimSpatial == 3)
+            {
+                return ComputeAt(arg, idx[0], idx[1], idx[2], idx[3], idx[4]);
+            }
+        }
+
+        // computes weight within the tile given by one range per dimension only
+        static void ComputeTile(const Argument& arg, const std::vector<IndexRange>& ranges)
+        {
+            ForEachTileIndex(
+                ranges,
+                [&](const auto& idx) { arg.weight_(idx) = ComputeAt(arg, idx); },
+                std::thread::hardware_concurrency());
+        }
+
+        float Run(const Argument& arg)
+        {
+            if constexpr(NumDimSpatial == 1)
+            {
+                auto f_kcx = [&](auto k, auto c, auto x) {
+                    arg.weight_(k, c, x) = ComputeAt(arg, k, c, x);
                 };
 
                 make_ParallelTensorFunctor(f_kcx,
@@ -112,50 +299,8 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
             }
             else if constexpr(NumDimSpatial == 2)
             {
-                constexpr auto I0 = Number<0>{};
-                constexpr auto I1 = Number<1>{};
-                auto f_kcyx       = [&](auto k, auto c, auto y, auto x) {
-                    float v_acc = 0;
-                    for(std::size_t n = 0; n < arg.output_.mDesc.GetLengths()[0]; ++n)
-                    {
-                        for(std::size_t ho = 0; ho < arg.output_.mDesc.GetLengths()[2]; ++ho)
-                        {
-                            auto hi =
-                                ck::type_convert<ck::long_index_t>(ho * arg.conv_strides_[I0]) +
-                                ck::type_convert<ck::long_index_t>(y * arg.conv_dilations_[I0]) -
-                                ck::type_convert<ck::long_index_t>(arg.in_left_pads_[I0]);
-                            for(std::size_t wo = 0; wo < arg.output_.mDesc.GetLengths()[3]; ++wo)
-                            {
-                                auto wi =
-                                    ck::type_convert<ck::long_index_t>(wo * arg.conv_strides_[I1]) +
-                                    ck::type_convert<ck::long_index_t>(x *
-                                                                       arg.conv_dilations_[I1]) -
-                                    ck::type_convert<ck::long_index_t>(arg.in_left_pads_[I1]);
-                                if(hi >= 0 &&
-                                   ck::type_convert<std::size_t>(hi) <
-                                       arg.input_.mDesc.GetLengths()[2] &&
-                                   wi >= 0 &&
-                                   ck::type_convert<std::size_t>(wi) <
-                                       arg.input_.mDesc.GetLengths()[3])
-                                {
-                                    float v_out;
-                                    float v_in;
-
-                                    arg.out_element_op_(
-                                        v_out, ck::type_convert<float>(arg.output_(n, k, ho, wo)));
-                                    arg.in_element_op_(
-                                        v_in, ck::type_convert<float>(arg.input_(n, c, hi, wi)));
-
-                                    v_acc += v_out * v_in;
-                                }
-                            }
-                        }
-                    }
-                    float v_wei;
-
-                    arg.wei_element_op_(v_wei, v_acc);
-
-                    arg.weight_(k, c, y, x) = ck::type_convert<WeiDataType>(v_wei);
+                auto f_kcyx = [&](auto k, auto c, auto y, auto x) {
+                    arg.weight_(k, c, y, x) = ComputeAt(arg, k, c, y, x);
                 };
 
                 make_ParallelTensorFunctor(f_kcyx,
@@ -169,66 +314,8 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
             }
             else if constexpr(NumDimSpatial == 3)
             {
-                constexpr auto I0 = Number<0>{};
-                constexpr auto I1 = Number<1>{};
-                constexpr auto I2 = Number<2>{};
-                auto f_kczyx      = [&](auto k, auto c, auto z, auto y, auto x) {
-                    float v_acc = 0;
-                    for(std::size_t n = 0; n < arg.output_.mDesc.GetLengths()[0]; ++n)
-                    {
-                        for(std::size_t do_ = 0; do_ < arg.output_.mDesc.GetLengths()[2]; ++do_)
-                        {
-                            auto di =
-                                ck::type_convert<ck::long_index_t>(do_ * arg.conv_strides_[I0]) +
-                                ck::type_convert<ck::long_index_t>(z * arg.conv_dilations_[I0]) -
-                                ck::type_convert<ck::long_index_t>(arg.in_left_pads_[I0]);
-                            for(std::size_t ho = 0; ho < arg.output_.mDesc.GetLengths()[3]; ++ho)
-                            {
-                                auto hi =
-                                    ck::type_convert<ck::long_index_t>(ho * arg.conv_strides_[I1]) +
-                                    ck::type_convert<ck::long_index_t>(y *
-                                                                       arg.conv_dilations_[I1]) -
-                                    ck::type_convert<ck::long_index_t>(arg.in_left_pads_[I1]);
-                                for(std::size_t wo = 0; wo < arg.output_.mDesc.GetLengths()[4];
-                                    ++wo)
-                                {
-                                    auto wi =
-                                        ck::type_convert<ck::long_index_t>(wo *
-                                                                           arg.conv_strides_[I2]) +
-                                        ck::type_convert<ck::long_index_t>(
-                                            x * arg.conv_dilations_[I2]) -
-                                        ck::type_convert<ck::long_index_t>(arg.in_left_pads_[I2]);
-                                    if(di >= 0 &&
-                                       ck::type_convert<std::size_t>(di) <
-                                           arg.input_.mDesc.GetLengths()[2] &&
-                                       hi >= 0 &&
-                                       ck::type_convert<std::size_t>(hi) <
-                                           arg.input_.mDesc.GetLengths()[3] &&
-                                       wi >= 0 &&
-                                       ck::type_convert<std::size_t>(wi) <
-                                           arg.input_.mDesc.GetLengths()[4])
-                                    {
-                                        float v_out;
-                                        float v_in;
-
-                                        arg.out_element_op_(v_out,
-                                                            ck::type_convert<float>(
-                                                                arg.output_(n, k, do_, ho, wo)));
-                                        arg.in_element_op_(
-                                            v_in,
-                                            ck::type_convert<float>(arg.input_(n, c, di, hi, wi)));
-
-                                        v_acc += v_out * v_in;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                    float v_wei;
-
-                    arg.wei_element_op_(v_wei, v_acc);
-
-                    arg.weight_(k, c, z, y, x) = ck::type_convert<WeiDataType>(v_wei);
+                auto f_kczyx = [&](auto k, auto c, auto z, auto y, auto x) {
+                    arg.weight_(k, c, z, y, x) = ComputeAt(arg, k, c, z, y, x);
                 };
 
                 make_ParallelTensorFunctor(f_kczyx,
@@ -3,14 +3,19 @@
 
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
 #include "device_base.hpp"
 #include "host_tensor.hpp"
+#include "reference_tile.hpp"
 
 namespace ck {
 namespace tensor_operation {
 namespace host {
 
 // out[N, K, Ho, Wo] = in[N, C, Hi, Wi] * wei[K, C, Y, X]
+//
+// For a grouped convolution, the weight has C / G channels, and input channels
+// [g * C / G, (g + 1) * C / G) get the gradient from output channels [g * K / G, (g + 1) * K / G).
 template <typename InDataType,
           typename WeiDataType,
           typename OutDataType,
@@ -46,6 +51,19 @@ struct ReferenceConvBwdData : public device::BaseOperator
               wei_element_op_{wei_element_op},
               out_element_op_{out_element_op}
         {
+            const std::size_t C = input_.mDesc.GetLengths()[1];
+            const std::size_t K = output_.mDesc.GetLengths()[1];
+
+            c_per_group_ = weight_.mDesc.GetLengths()[1];
+
+            if(c_per_group_ == 0 || C % c_per_group_ != 0 ||
+               weight_.mDesc.GetLengths()[0] != K || K % (C / c_per_group_) != 0)
+            {
+                throw std::runtime_error("wrong! inconsistent number of channels of groups");
+            }
+
+            group_count_ = C / c_per_group_;
+            k_per_group_ = K / group_count_;
         }
 
         Tensor<InDataType>& input_;
@@ -60,6 +78,10 @@ struct ReferenceConvBwdData : public device::BaseOperator
         InElementwiseOperation in_element_op_;
         WeiElementwiseOperation wei_element_op_;
         OutElementwiseOperation out_element_op_;
+
+        std::size_t group_count_;
+        std::size_t c_per_group_;
+        std::size_t k_per_group_;
     };
 
     // Invoker
@@ -67,203 +89,203 @@ struct ReferenceConvBwdData : public device::BaseOperator
     {
         using Argument = ReferenceConvBwdData::Argument;
 
-        float Run(const Argument& arg)
+        // value of input(n, c, wi), computed without writing input
+        static InDataType ComputeAt(const Argument& arg,
+                                    std::size_t n,
+                                    std::size_t c,
+                                    std::size_t wi)
         {
-            if constexpr(NumDimSpatial == 1)
-            {
-                auto f_ncw = [&](auto n, auto c, auto wi) {
-                    std::size_t K  = arg.weight_.mDesc.GetLengths()[0];
-                    std::size_t X  = arg.weight_.mDesc.GetLengths()[2];
-                    std::size_t Wo = arg.output_.mDesc.GetLengths()[2];
+            // output channels [k_begin, k_end) and weight channel c_wei of the group of c
+            const std::size_t k_begin = c / arg.c_per_group_ * arg.k_per_group_;
+            const std::size_t k_end   = k_begin + arg.k_per_group_;
+            const std::size_t c_wei   = c % arg.c_per_group_;
+            std::size_t X  = arg.weight_.mDesc.GetLengths()[2];
+            std::size_t Wo = arg.output_.mDesc.GetLengths()[2];
 
-                    AccDataType v_acc = 0;
+            AccDataType v_acc = 0;
 
-                    for(std::size_t x = 0; x < X; ++x)
+            for(std::size_t x = 0; x < X; ++x)
+            {
+                auto w_tmp = ck::type_convert<ck::long_index_t>(wi) +
+                             ck::type_convert<ck::long_index_t>(arg.in_left_pads_[0]) -
+                             ck::type_convert<ck::long_index_t>(x * arg.conv_dilations_[0]);
+                if(w_tmp % arg.conv_strides_[0] == 0)
+                {
+                    auto wo = ck::type_convert<ck::long_index_t>(w_tmp) /
+                              ck::type_convert<ck::long_index_t>(arg.conv_strides_[0]);
+                    if(wo >= 0 && ck::type_convert<std::size_t>(wo) < Wo)
                     {
-                        auto w_tmp = ck::type_convert<ck::long_index_t>(wi) +
-                                     ck::type_convert<ck::long_index_t>(arg.in_left_pads_[0]) -
-                                     ck::type_convert<ck::long_index_t>(x * arg.conv_dilations_[0]);
-                        if(w_tmp % arg.conv_strides_[0] == 0)
+                        for(std::size_t k = k_begin; k < k_end; ++k)
                         {
-                            auto wo = ck::type_convert<ck::long_index_t>(w_tmp) /
-                                      ck::type_convert<ck::long_index_t>(arg.conv_strides_[0]);
-                            if(wo >= 0 && ck::type_convert<std::size_t>(wo) < Wo)
-                            {
-                                for(std::size_t k = 0; k < K; ++k)
-                                {
-                                    AccDataType v_out = 0;
-                                    AccDataType v_wei = 0;
+                            AccDataType v_out = 0;
+                            AccDataType v_wei = 0;
 
-                                    arg.out_element_op_(
-                                        v_out,
-                                        ck::type_convert<AccDataType>(arg.output_(n, k, wo)));
-                                    arg.wei_element_op_(
-                                        v_wei, ck::type_convert<AccDataType>(arg.weight_(k, c, x)));
+                            arg.out_element_op_(
+                                v_out,
+                                ck::type_convert<AccDataType>(arg.output_(n, k, wo)));
+                            arg.wei_element_op_(
+                                v_wei, ck::type_convert<AccDataType>(arg.weight_(k, c_wei, x)));
 
-                                    v_acc += v_out * v_wei;
-                                }
-                            }
+                            v_acc += v_out * v_wei;
                         }
                     }
+                }
+            }
 
-                    arg.in_element_op_(v_acc, v_acc);
-                    arg.input_(n, c, wi) = ck::type_convert<InDataType>(v_acc);
-                };
-
-                make_ParallelTensorFunctor(f_ncw,
-                                           arg.input_.mDesc.GetLengths()[0],
-                                           arg.input_.mDesc.GetLengths()[1],
-                                           arg.input_.mDesc.GetLengths()[2])(
-                    std::thread::hardware_concurrency());
+            arg.in_element_op_(v_acc, v_acc);
+            return ck::type_convert<InDataType>(v_acc);
+        }
 
-                return 0;
-            }
-            else if constexpr(NumDimSpatial == 2)
-            {
-                auto f_nchw = [&](auto n, auto c, auto hi, auto wi) {
-                    std::size_t K = arg.weight_.mDesc.GetLengths()[0];
-                    std::size_t Y = arg.weight_.mDesc.GetLengths()[2];
-                    std::size_t X = arg.weight_.mDesc.GetLengths()[3];
+        // value of input(n, c, hi, wi), computed without writing input
+        static InDataType ComputeAt(const Argument& arg,
+                                    std::size_t n,
+                                    std::size_t c,
+                                    std::size_t hi,
+                                    std::size_t wi)
+        {
+            // output channels [k_begin, k_end) and weight channel c_wei of the group of c
+            const std::size_t k_begin = c / arg.c_per_group_ * arg.k_per_group_;
+            const std::size_t k_end   = k_begin + arg.k_per_group_;
+            const std::size_t c_wei   = c % arg.c_per_group_;
+            std::size_t Y = arg.weight_.mDesc.GetLengths()[2];
+            std::size_t X = arg.weight_.mDesc.GetLengths()[3];
 
-                    std::size_t Ho = arg.output_.mDesc.GetLengths()[2];
-                    std::size_t Wo = arg.output_.mDesc.GetLengths()[3];
+            std::size_t Ho = arg.output_.mDesc.GetLengths()[2];
+            std::size_t Wo = arg.output_.mDesc.GetLengths()[3];
 
-                    AccDataType v_acc = 0;
+            AccDataType v_acc = 0;
 
-                    for(std::size_t y = 0; y < Y; ++y)
+            for(std::size_t y = 0; y < Y; ++y)
+            {
+                auto h_tmp = ck::type_convert<ck::long_index_t>(hi) +
+                             ck::type_convert<ck::long_index_t>(arg.in_left_pads_[0]) -
+                             ck::type_convert<ck::long_index_t>(y * arg.conv_dilations_[0]);
+                if(h_tmp % arg.conv_strides_[0] == 0)
+                {
+                    auto ho = ck::type_convert<ck::long_index_t>(h_tmp) /
+                              ck::type_convert<ck::long_index_t>(arg.conv_strides_[0]);
+                    if(ho >= 0 && ck::type_convert<std::size_t>(ho) < Ho)
                     {
-                        auto h_tmp = ck::type_convert<ck::long_index_t>(hi) +
-                                     ck::type_convert<ck::long_index_t>(arg.in_left_pads_[0]) -
-                                     ck::type_convert<ck::long_index_t>(y * arg.conv_dilations_[0]);
-                        if(h_tmp % arg.conv_strides_[0] == 0)
+                        for(std::size_t x = 0; x < X; ++x)
                         {
-                            auto ho = ck::type_convert<ck::long_index_t>(h_tmp) /
-                                      ck::type_convert<ck::long_index_t>(arg.conv_strides_[0]);
-                            if(ho >= 0 && ck::type_convert<std::size_t>(ho) < Ho)
+                            auto w_tmp =
+                                ck::type_convert<ck::long_index_t>(wi) +
+                                ck::type_convert<ck::long_index_t>(arg.in_left_pads_[1]) -
+                                ck::type_convert<ck::long_index_t>(x *
+                                                                   arg.conv_dilations_[1]);
+                            if(w_tmp % arg.conv_strides_[1] == 0)
                             {
-                                for(std::size_t x = 0; x < X; ++x)
+                                auto wo = ck::type_convert<ck::long_index_t>(w_tmp) /
+                                          ck::type_convert<ck::long_index_t>(
+                                              arg.conv_strides_[1]);
+                                if(wo >= 0 && ck::type_convert<std::size_t>(wo) < Wo)
                                 {
-                                    auto w_tmp =
-                                        ck::type_convert<ck::long_index_t>(wi) +
-                                        ck::type_convert<ck::long_index_t>(arg.in_left_pads_[1]) -
-                                        ck::type_convert<ck::long_index_t>(x *
-                                                                           arg.conv_dilations_[1]);
-                                    if(w_tmp % arg.conv_strides_[1] == 0)
+                                    for(std::size_t k = k_begin; k < k_end; ++k)
                                     {
-                                        auto wo = ck::type_convert<ck::long_index_t>(w_tmp) /
-                                                  ck::type_convert<ck::long_index_t>(
-                                                      arg.conv_strides_[1]);
-                                        if(wo >= 0 && ck::type_convert<std::size_t>(wo) < Wo)
-                                        {
-                                            for(std::size_t k = 0; k < K; ++k)
-                                            {
-                                                AccDataType v_out = 0;
-                                                AccDataType v_wei = 0;
+                                        AccDataType v_out = 0;
+                                        AccDataType v_wei = 0;
 
-                                                arg.out_element_op_(v_out,
-                                                                    ck::type_convert<AccDataType>(
-                                                                        arg.output_(n, k, ho, wo)));
-                                                arg.wei_element_op_(v_wei,
-                                                                    ck::type_convert<AccDataType>(
-                                                                        arg.weight_(k, c, y, x)));
+                                        arg.out_element_op_(v_out,
+                                                            ck::type_convert<AccDataType>(
+                                                                arg.output_(n, k, ho, wo)));
+                                        arg.wei_element_op_(v_wei,
+                                                            ck::type_convert<AccDataType>(
+                                                                arg.weight_(k, c_wei, y, x)));
 
-                                                v_acc += v_out * v_wei;
-                                            }
-                                        }
+                                        v_acc += v_out * v_wei;
                                     }
                                 }
                             }
                         }
                     }
+                }
+            }
 
-                    AccDataType v_in;
-                    arg.in_element_op_(v_in, v_acc);
-                    arg.input_(n, c, hi, wi) = ck::type_convert<InDataType>(v_in);
-                };
-
-                make_ParallelTensorFunctor(f_nchw,
-                                           arg.input_.mDesc.GetLengths()[0],
-                                           arg.input_.mDesc.GetLengths()[1],
-                                           arg.input_.mDesc.GetLengths()[2],
-                                           arg.input_.mDesc.GetLengths()[3])(
-                    std::thread::hardware_concurrency());
+            AccDataType v_in;
+            arg.in_element_op_(v_in, v_acc);
+            return ck::type_convert<InDataType>(v_in);
+        }
 
-                return 0;
-            }
-            else if constexpr(NumDimSpatial == 3)
-            {
-                auto f_ncdhw = [&](auto n, auto c, auto di, auto hi, auto wi) {
-                    std::size_t K = arg.weight_.mDesc.GetLengths()[0];
-                    std::size_t Z = arg.weight_.mDesc.GetLengths()[2];
-                    std::size_t Y = arg.weight_.mDesc.GetLengths()[3];
-                    std::size_t X = arg.weight_.mDesc.GetLengths()[4];
+        // value of input(n, c, di, hi, wi), computed without writing input
+        static InDataType ComputeAt(const Argument& arg,
+                                    std::size_t n,
+                                    std::size_t c,
+                                    std::size_t di,
+                                    std::size_t hi,
+                                    std::size_t wi)
+        {
+            // output channels [k_begin, k_end) and weight channel c_wei of the group of c
+            const std::size_t k_begin = c / arg.c_per_group_ * arg.k_per_group_;
+            const std::size_t k_end   = k_begin + arg.k_per_group_;
+            const std::size_t c_wei   = c % arg.c_per_group_;
+            std::size_t Z = arg.weight_.mDesc.GetLengths()[2];
+            std::size_t Y = arg.weight_.mDesc.GetLengths()[3];
+            std::size_t X = arg.weight_.mDesc.GetLengths()[4];
 
-                    std::size_t Do = arg.output_.mDesc.GetLengths()[2];
-                    std::size_t Ho = arg.output_.mDesc.GetLengths()[3];
-                    std::size_t Wo = arg.output_.mDesc.GetLengths()[4];
+            std::size_t Do = arg.output_.mDesc.GetLengths()[2];
+            std::size_t Ho = arg.output_.mDesc.GetLengths()[3];
+            std::size_t Wo = arg.output_.mDesc.GetLengths()[4];
 
-                    AccDataType v_acc = 0;
+            AccDataType v_acc = 0;
 
-                    for(std::size_t z = 0; z < Z; ++z)
+            for(std::size_t z = 0; z < Z; ++z)
+            {
+                auto d_tmp = ck::type_convert<ck::long_index_t>(di) +
+                             ck::type_convert<ck::long_index_t>(arg.in_left_pads_[0]) -
+                             ck::type_convert<ck::long_index_t>(z * arg.conv_dilations_[0]);
+                if(d_tmp % arg.conv_strides_[0] == 0)
+                {
+                    auto do_ = ck::type_convert<ck::long_index_t>(d_tmp) /
+                               ck::type_convert<ck::long_index_t>(arg.conv_strides_[0]);
+                    if(do_ >= 0 && ck::type_convert<std::size_t>(do_) < Do)
                     {
-                        auto d_tmp = ck::type_convert<ck::long_index_t>(di) +
-                                     ck::type_convert<ck::long_index_t>(arg.in_left_pads_[0]) -
-                                     ck::type_convert<ck::long_index_t>(z * arg.conv_dilations_[0]);
-                        if(d_tmp % arg.conv_strides_[0] == 0)
+                        for(std::size_t y = 0; y < Y; ++y)
                         {
-                            auto do_ = ck::type_convert<ck::long_index_t>(d_tmp) /
-                                       ck::type_convert<ck::long_index_t>(arg.conv_strides_[0]);
-                            if(do_ >= 0 && ck::type_convert<std::size_t>(do_) < Do)
+                            auto h_tmp =
+                                ck::type_convert<ck::long_index_t>(hi) +
+                                ck::type_convert<ck::long_index_t>(arg.in_left_pads_[1]) -
+                                ck::type_convert<ck::long_index_t>(y *
+                                                                   arg.conv_dilations_[1]);
+                            if(h_tmp % arg.conv_strides_[1] == 0)
                             {
-                                for(std::size_t y = 0; y < Y; ++y)
+                                auto ho = ck::type_convert<ck::long_index_t>(h_tmp) /
+                                          ck::type_convert<ck::long_index_t>(
+                                              arg.conv_strides_[1]);
+                                if(ho >= 0 && ck::type_convert<std::size_t>(ho) < Ho)
                                 {
-                                    auto h_tmp =
-                                        ck::type_convert<ck::long_index_t>(hi) +
-                                        ck::type_convert<ck::long_index_t>(arg.in_left_pads_[1]) -
-                                        ck::type_convert<ck::long_index_t>(y *
-                                                                           arg.conv_dilations_[1]);
-                                    if(h_tmp % arg.conv_strides_[1] == 0)
+                                    for(std::size_t x = 0; x < X; ++x)
                                     {
-                                        auto ho = ck::type_convert<ck::long_index_t>(h_tmp) /
-                                                  ck::type_convert<ck::long_index_t>(
-                                                      arg.conv_strides_[1]);
-                                        if(ho >= 0 && ck::type_convert<std::size_t>(ho) < Ho)
+                                        auto w_tmp =
+                                            ck::type_convert<ck::long_index_t>(wi) +
+                                            ck::type_convert<ck::long_index_t>(
+                                                arg.in_left_pads_[2]) -
+                                            ck::type_convert<ck::long_index_t>(
+                                                x * arg.conv_dilations_[2]);
+                                        if(w_tmp % arg.conv_strides_[2] == 0)
                                         {
-                                            for(std::size_t x = 0; x < X; ++x)
+                                            auto wo =
+                                                ck::type_convert<ck::long_index_t>(w_tmp) /
+                                                ck::type_convert<ck::long_index_t>(
+                                                    arg.conv_strides_[2]);
+                                            if(wo >= 0 &&
+                                               ck::type_convert<std::size_t>(wo) < Wo)
                                             {
-                                                auto w_tmp =
-                                                    ck::type_convert<ck::long_index_t>(wi) +
-                                                    ck::type_convert<ck::long_index_t>(
-                                                        arg.in_left_pads_[2]) -
-                                                    ck::type_convert<ck::long_index_t>(
-                                                        x * arg.conv_dilations_[2]);
-                                                if(w_tmp % arg.conv_strides_[2] == 0)
+                                                for(std::size_t k = k_begin; k < k_end; ++k)
                                                 {
-                                                    auto wo =
-                                                        ck::type_convert<ck::long_index_t>(w_tmp) /
-                                                        ck::type_convert<ck::long_index_t>(
-                                                            arg.conv_strides_[2]);
-                                                    if(wo >= 0 &&
-                                                       ck::type_convert<std::size_t>(wo) < Wo)
-                                                    {
-                                                        for(std::size_t k = 0; k < K; ++k)
-                                                        {
-                                                            AccDataType v_out = 0;
-                                                            AccDataType v_wei = 0;
-
-                                                            arg.out_element_op_(
-                                                                v_out,
-                                                                ck::type_convert<AccDataType>(
-                                                                    arg.output_(
-                                                                        n, k, do_, ho, wo)));
-                                                            arg.wei_element_op_(
-                                                                v_wei,
-                                                                ck::type_convert<AccDataType>(
-                                                                    arg.weight_(k, c, z, y, x)));
-
-                                                            v_acc += v_out * v_wei;
-                                                        }
-                                                    }
+                                                    AccDataType v_out = 0;
+                                                    AccDataType v_wei = 0;
+
+                                                    arg.out_element_op_(
+                                                        v_out,
+                                                        ck::type_convert<AccDataType>(
+                                                            arg.output_(
+                                                                n, k, do_, ho, wo)));
+                                                    arg.wei_element_op_(
+                                                        v_wei,
+                                                        ck::type_convert<AccDataType>(
+                                                            arg.weight_(k, c_wei, z, y, x)));
+
+                                                    v_acc += v_out * v_wei;
                                                 }
                                             }
                                         }
@@ -272,10 +294,75 @@ struct ReferenceConvBwdData : public device::BaseOperator
                             }
                         }
                     }
+                }
+            }
+
+            AccDataType v_in;
+            arg.in_element_op_(v_in, v_acc);
+            return ck::type_convert<InDataType>(v_in);
+        }
+
+        // idx: {n, c, wi}, {n, c, hi, wi}, {n, c, di, hi, wi}
+        static InDataType ComputeAt(const Argument& arg, const std::vector<std::size_t>& idx)
+        {
+            if constexpr(NumDimSpatial == 1)
+            {
+                return ComputeAt(arg, idx[0], idx[1], idx[2]);
+            }
+            else if constexpr(NumDimSpatial == 2)
+            {
+                return ComputeAt(arg, idx[0], idx[1], idx[2], idx[3]);
+            }
+            else if constexpr(NumDimSpatial == 3)
+            {
+                return ComputeAt(arg, idx[0], idx[1], idx[2], idx[3], idx[4]);
+            }
+        }
+
+        // computes input within the tile given by one range per dimension only
+        static void ComputeTile(const Argument& arg, const std::vector<IndexRange>& ranges)
+        {
+            ForEachTileIndex(
+                ranges,
+                [&](const auto& idx) { arg.input_(idx) = ComputeAt(arg, idx); },
+                std::thread::hardware_concurrency());
+        }
+
+        float Run(const Argument& arg)
+        {
+            if constexpr(NumDimSpatial == 1)
+            {
+                auto f_ncw = [&](auto n, auto c, auto wi) {
+                    arg.input_(n, c, wi) = ComputeAt(arg, n, c, wi);
+                };
 
-                    AccDataType v_in;
-                    arg.in_element_op_(v_in, v_acc);
-                    arg.input_(n, c, di, hi, wi) = ck::type_convert<InDataType>(v_in);
+                make_ParallelTensorFunctor(f_ncw,
+                                           arg.input_.mDesc.GetLengths()[0],
+                                           arg.input_.mDesc.GetLengths()[1],
+                                           arg.input_.mDesc.GetLengths()[2])(
+                    std::thread::hardware_concurrency());
+
+                return 0;
+            }
+            else if constexpr(NumDimSpatial == 2)
+            {
+                auto f_nchw = [&](auto n, auto c, auto hi, auto wi) {
+                    arg.input_(n, c, hi, wi) = ComputeAt(arg, n, c, hi, wi);
+                };
+
+                make_ParallelTensorFunctor(f_nchw,
+                                           arg.input_.mDesc.GetLengths()[0],
+                                           arg.input_.mDesc.GetLengths()[1],
+                                           arg.input_.mDesc.GetLengths()[2],
+                                           arg.input_.mDesc.GetLengths()[3])(
+                    std::thread::hardware_concurrency());
+
+                return 0;
+            }
+            else if constexpr(NumDimSpatial == 3)
+            {
+                auto f_ncdhw = [&](auto n, auto c, auto di, auto hi, auto wi) {
+                    arg.input_(n, c, di, hi, wi) = ComputeAt(arg, n, c, di, hi, wi);
                 };
 
                 make_ParallelTensorFunctor(f_ncdhw,
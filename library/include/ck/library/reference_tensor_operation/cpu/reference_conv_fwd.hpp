@@ -1,12 +1,20 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
 #include <iostream>
+#include <stdexcept>
 #include <type_traits>
 #include <sstream>
+#include <vector>
 
 #include "stream_config.hpp"
 #include "device_base.hpp"
 #include "host_tensor.hpp"
+#include "reference_conv_fwd_algorithm.hpp"
+#include "reference_tile.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -19,6 +27,18 @@ namespace host {
 //             counterparts for weight and output) as long as tensor descriptor
 //             lengths is in NCHW.
 //
+// @paragraph  Supports grouped convolution, where the G groups are given by the
+//             weight having C / G channels. Output channels [g * K / G, (g + 1) * K / G)
+//             are computed from input channels [g * C / G, (g + 1) * C / G). A
+//             depthwise convolution (C = K = G) is computed by a dedicated path,
+//             which slides the window of all the channels at once.
+//
+// @paragraph  Large problems can be computed by fast algorithms, which accumulate in
+//             double precision: Winograd F(4x4, 3x3) and F(2x2, 5x5) for 2D convolutions
+//             with stride 1 and dilation 1, and FFT for any shape, which pays off for
+//             large filters. By default, the algorithm is selected from the shape, see
+//             Invoker::SelectAlgorithm().
+//
 // @tparam     InDataType               Input tensor data type.
 // @tparam     WeiDataType              Weights tensor data type.
 // @tparam     OutDataType              Output tensor data type.
@@ -38,6 +58,13 @@ template <typename InDataType,
           typename std::enable_if<NumDimSpatial >= 1 && NumDimSpatial <= 3, bool>::type = false>
 struct ReferenceConvFwd : public device::BaseOperator
 {
+    // problems of fewer multiply-adds are computed by Direct when the algorithm is Auto, the
+    // transforms of the fast algorithms do not pay off for them
+    static constexpr double MinFastAlgorithmMacs = 1e7;
+
+    // bytes of the filter spectra, and of the input spectra, held at once by the FFT algorithm
+    static constexpr std::size_t MaxFftSpectraBytes = std::size_t(256) << 20;
+
     // Argument
     struct Argument : public device::BaseArgument
     {
@@ -50,7 +77,8 @@ struct ReferenceConvFwd : public device::BaseOperator
                  std::vector<ck::index_t> input_right_pads,
                  InElementwiseOperation in_element_op,
                  WeiElementwiseOperation wei_element_op,
-                 OutElementwiseOperation out_element_op)
+                 OutElementwiseOperation out_element_op,
+                 ConvFwdAlgorithm algorithm = ConvFwdAlgorithm::Auto)
             : input_{input},
               weight_{weight},
               output_{output},
@@ -60,8 +88,22 @@ struct ReferenceConvFwd : public device::BaseOperator
               in_right_pads_{input_right_pads},
               in_element_op_{in_element_op},
               wei_element_op_{wei_element_op},
-              out_element_op_{out_element_op}
+              out_element_op_{out_element_op},
+              algorithm_{algorithm}
         {
+            const std::size_t C = input_.mDesc.GetLengths()[1];
+            const std::size_t K = output_.mDesc.GetLengths()[1];
+
+            c_per_group_ = weight_.mDesc.GetLengths()[1];
+
+            if(c_per_group_ == 0 || C % c_per_group_ != 0 ||
+               weight_.mDesc.GetLengths()[0] != K || K % (C / c_per_group_) != 0)
+            {
+                throw std::runtime_error("wrong! inconsistent number of channels of groups");
+            }
+
+            group_count_ = C / c_per_group_;
+            k_per_group_ = K / group_count_;
         }
 
         const Tensor<InDataType>& input_;
@@ -76,100 +118,842 @@ struct ReferenceConvFwd : public device::BaseOperator
         InElementwiseOperation in_element_op_;
         WeiElementwiseOperation wei_element_op_;
         OutElementwiseOperation out_element_op_;
+
+        ConvFwdAlgorithm algorithm_;
+
+        std::size_t group_count_;
+        std::size_t c_per_group_;
+        std::size_t k_per_group_;
     };
 
     struct Invoker : public device::BaseInvoker
     {
         using Argument = ReferenceConvFwd::Argument;
 
-        float Run(const Argument& arg)
+        // value of output(n, k, wo), computed without writing output
+        static OutDataType ComputeAt(const Argument& arg,
+                                     std::size_t n,
+                                     std::size_t k,
+                                     std::size_t wo)
         {
-            if constexpr(NumDimSpatial == 1)
+            // first input channel of the group of k
+            const std::size_t c_begin = k / arg.k_per_group_ * arg.c_per_group_;
+
+            float v_acc = 0;
+
+            for(std::size_t c = 0; c < arg.weight_.mDesc.GetLengths()[1]; ++c)
             {
-                auto f_ncw = [&](auto n, auto k, auto wo) {
-                    float v_acc = 0;
+                for(std::size_t x = 0; x < arg.weight_.mDesc.GetLengths()[2]; ++x)
+                {
+                    auto wi = ck::type_convert<ck::long_index_t>(wo * arg.conv_strides_[0]) +
+                              ck::type_convert<ck::long_index_t>(x * arg.conv_dilations_[0]) -
+                              ck::type_convert<ck::long_index_t>(arg.in_left_pads_[0]);
+                    if(wi >= 0 &&
+                       ck::type_convert<std::size_t>(wi) < arg.input_.mDesc.GetLengths()[2])
+                    {
+                        float v_in;
+                        float v_wei;
+
+                        arg.in_element_op_(v_in,
+                                           ck::type_convert<float>(arg.input_(n, c_begin + c, wi)));
+                        arg.wei_element_op_(v_wei,
+                                            ck::type_convert<float>(arg.weight_(k, c, x)));
+
+                        v_acc += v_in * v_wei;
+                    }
+                }
+            }
+
+            float v_out;
 
-                    for(std::size_t c = 0; c < arg.weight_.mDesc.GetLengths()[1]; ++c)
+            arg.out_element_op_(v_out, v_acc);
+            return ck::type_convert<OutDataType>(v_out);
+        }
+
+        // value of output(n, k, ho, wo), computed without writing output
+        static OutDataType ComputeAt(const Argument& arg,
+                                     std::size_t n,
+                                     std::size_t k,
+                                     std::size_t ho,
+                                     std::size_t wo)
+        {
+            // first input channel of the group of k
+            const std::size_t c_begin = k / arg.k_per_group_ * arg.c_per_group_;
+
+            float v_acc = 0;
+
+            for(std::size_t c = 0; c < arg.weight_.mDesc.GetLengths()[1]; ++c)
+            {
+                for(std::size_t y = 0; y < arg.weight_.mDesc.GetLengths()[2]; ++y)
+                {
+                    auto hi = ck::type_convert<ck::long_index_t>(ho * arg.conv_strides_[0]) +
+                              ck::type_convert<ck::long_index_t>(y * arg.conv_dilations_[0]) -
+                              ck::type_convert<ck::long_index_t>(arg.in_left_pads_[0]);
+                    for(std::size_t x = 0; x < arg.weight_.mDesc.GetLengths()[3]; ++x)
                     {
-                        for(std::size_t x = 0; x < arg.weight_.mDesc.GetLengths()[2]; ++x)
+                        auto wi = ck::type_convert<ck::long_index_t>(wo * arg.conv_strides_[1]) +
+                                  ck::type_convert<ck::long_index_t>(x * arg.conv_dilations_[1]) -
+                                  ck::type_convert<ck::long_index_t>(arg.in_left_pads_[1]);
+                        if(hi >= 0 &&
+                           ck::type_convert<std::size_t>(hi) <
+                               arg.input_.mDesc.GetLengths()[2] &&
+                           wi >= 0 &&
+                           ck::type_convert<std::size_t>(wi) <
+                               arg.input_.mDesc.GetLengths()[3])
+                        {
+                            float v_in;
+                            float v_wei;
+
+                            arg.in_element_op_(
+                                v_in, ck::type_convert<float>(arg.input_(n, c_begin + c, hi, wi)));
+                            arg.wei_element_op_(
+                                v_wei, ck::type_convert<float>(arg.weight_(k, c, y, x)));
+                            v_acc += v_in * v_wei;
+                        }
+                    }
+                }
+            }
+
+            float v_out;
+
+            arg.out_element_op_(v_out, v_acc);
+            return ck::type_convert<OutDataType>(v_out);
+        }
+
+        // value of output(n, k, d_o, ho, wo), computed without writing output
+        static OutDataType ComputeAt(const Argument& arg,
+                                     std::size_t n,
+                                     std::size_t k,
+                                     std::size_t d_o,
+                                     std::size_t ho,
+                                     std::size_t wo)
+        {
+            // first input channel of the group of k
+            const std::size_t c_begin = k / arg.k_per_group_ * arg.c_per_group_;
+
+            float v_acc = 0;
+
+            for(std::size_t c = 0; c < arg.weight_.mDesc.GetLengths()[1]; ++c)
+            {
+                for(std::size_t z = 0; z < arg.weight_.mDesc.GetLengths()[2]; ++z)
+                {
+                    auto di = ck::type_convert<ck::long_index_t>(d_o * arg.conv_strides_[0]) +
+                              ck::type_convert<ck::long_index_t>(z * arg.conv_dilations_[0]) -
+                              ck::type_convert<ck::long_index_t>(arg.in_left_pads_[0]);
+                    for(std::size_t y = 0; y < arg.weight_.mDesc.GetLengths()[3]; ++y)
+                    {
+                        auto hi = ck::type_convert<ck::long_index_t>(ho * arg.conv_strides_[1]) +
+                                  ck::type_convert<ck::long_index_t>(y * arg.conv_dilations_[1]) -
+                                  ck::type_convert<ck::long_index_t>(arg.in_left_pads_[1]);
+                        for(std::size_t x = 0; x < arg.weight_.mDesc.GetLengths()[4]; ++x)
                         {
                             auto wi =
-                                ck::type_convert<ck::long_index_t>(wo * arg.conv_strides_[0]) +
-                                ck::type_convert<ck::long_index_t>(x * arg.conv_dilations_[0]) -
-                                ck::type_convert<ck::long_index_t>(arg.in_left_pads_[0]);
-                            if(wi >= 0 &&
-                               ck::type_convert<std::size_t>(wi) < arg.input_.mDesc.GetLengths()[2])
+                                ck::type_convert<ck::long_index_t>(wo *
+                                                                   arg.conv_strides_[2]) +
+                                ck::type_convert<ck::long_index_t>(x *
+                                                                   arg.conv_dilations_[2]) -
+                                ck::type_convert<ck::long_index_t>(arg.in_left_pads_[2]);
+                            if(di >= 0 &&
+                               ck::type_convert<std::size_t>(di) <
+                                   arg.input_.mDesc.GetLengths()[2] &&
+                               hi >= 0 &&
+                               ck::type_convert<std::size_t>(hi) <
+                                   arg.input_.mDesc.GetLengths()[3] &&
+                               wi >= 0 &&
+                               ck::type_convert<std::size_t>(wi) <
+                                   arg.input_.mDesc.GetLengths()[4])
                             {
                                 float v_in;
                                 float v_wei;
 
                                 arg.in_element_op_(v_in,
-                                                   ck::type_convert<float>(arg.input_(n, c, wi)));
-                                arg.wei_element_op_(v_wei,
-                                                    ck::type_convert<float>(arg.weight_(k, c, x)));
-
+                                                   ck::type_convert<float>(
+                                                       arg.input_(n, c_begin + c, di, hi, wi)));
+                                arg.wei_element_op_(
+                                    v_wei,
+                                    ck::type_convert<float>(arg.weight_(k, c, z, y, x)));
                                 v_acc += v_in * v_wei;
                             }
                         }
                     }
+                }
+            }
 
-                    float v_out;
-
-                    arg.out_element_op_(v_out, v_acc);
-                    arg.output_(n, k, wo) = ck::type_convert<OutDataType>(v_out);
-                };
+            float v_out;
 
-                make_ParallelTensorFunctor(f_ncw,
-                                           arg.output_.mDesc.GetLengths()[0],
-                                           arg.output_.mDesc.GetLengths()[1],
-                                           arg.output_.mDesc.GetLengths()[2])(
-                    std::thread::hardware_concurrency());
+            arg.out_element_op_(v_out, v_acc);
+            return ck::type_convert<OutDataType>(v_out);
+        }
 
-                return 0;
+        // idx: {n, k, wo}, {n, k, ho, wo}, {n, k, d_o, ho, wo}
+        static OutDataType ComputeAt(const Argument& arg, const std::vector<std::size_t>& idx)
+        {
+            if constexpr(NumDimSpatial == 1)
+            {
+                return ComputeAt(arg, idx[0], idx[1], idx[2]);
             }
             else if constexpr(NumDimSpatial == 2)
             {
-                auto f_nchw = [&](auto n, auto k, auto ho, auto wo) {
-                    float v_acc = 0;
+                return ComputeAt(arg, idx[0], idx[1], idx[2], idx[3]);
+            }
+            else if constexpr(NumDimSpatial == 3)
+            {
+                return ComputeAt(arg, idx[0], idx[1], idx[2], idx[3], idx[4]);
+            }
+        }
+
+        // computes output within the tile given by one range per dimension only
+        static void ComputeTile(const Argument& arg, const std::vector<IndexRange>& ranges)
+        {
+            ForEachTileIndex(
+                ranges,
+                [&](const auto& idx) { arg.output_(idx) = ComputeAt(arg, idx); },
+                std::thread::hardware_concurrency());
+        }
+
+        // depthwise convolution, i.e. output(n, g, o) = sum over t of input(n, g, i(o, t)) *
+        // weight(g, 0, t), where t are the taps of the filter. Each work item computes all the
+        // channels of the output positions of a row at once, over weights packed as (t, g), so
+        // that the inner loop over the channels is unit-stride in the packed weights, and in
+        // the input and the output too for NHWC. The taps are summed in the same order as by
+        // ComputeAt(), so results are identical.
+        static void RunDepthwise(const Argument& arg)
+        {
+            const auto& in_lengths  = arg.input_.mDesc.GetLengths();
+            const auto& wei_lengths = arg.weight_.mDesc.GetLengths();
+            const auto& out_lengths = arg.output_.mDesc.GetLengths();
+            const auto& in_strides  = arg.input_.mDesc.GetStrides();
+            const auto& wei_strides = arg.weight_.mDesc.GetStrides();
+            const auto& out_strides = arg.output_.mDesc.GetStrides();
+
+            const std::size_t G = arg.group_count_;
+
+            // filter index of each tap, in the order of the loops of ComputeAt()
+            std::vector<std::array<std::size_t, NumDimSpatial>> taps(1);
+
+            for(std::size_t d = 0; d < NumDimSpatial; ++d)
+            {
+                std::vector<std::array<std::size_t, NumDimSpatial>> next_taps;
+
+                for(const auto& tap : taps)
+                {
+                    for(std::size_t x = 0; x < wei_lengths[2 + d]; ++x)
+                    {
+                        next_taps.push_back(tap);
+                        next_taps.back()[d] = x;
+                    }
+                }
+
+                taps = std::move(next_taps);
+            }
+
+            const std::size_t num_tap = taps.size();
+
+            std::vector<float> wei_t_g(num_tap * G);
+
+            for(std::size_t t = 0; t < num_tap; ++t)
+            {
+                for(std::size_t g = 0; g < G; ++g)
+                {
+                    std::size_t offset = g * wei_strides[0];
+
+                    for(std::size_t d = 0; d < NumDimSpatial; ++d)
+                    {
+                        offset += taps[t][d] * wei_strides[2 + d];
+                    }
+
+                    arg.wei_element_op_(wei_t_g[t * G + g],
+                                        ck::type_convert<float>(arg.weight_.mData[offset]));
+                }
+            }
+
+            // output positions of a row, i.e. along the last spatial dimension
+            const std::size_t Wo = out_lengths[1 + NumDimSpatial];
+
+            std::size_t num_row = out_lengths[0];
+
+            for(std::size_t d = 0; d + 1 < NumDimSpatial; ++d)
+            {
+                num_row *= out_lengths[2 + d];
+            }
+
+            auto f_row = [&](auto row) {
+                std::array<std::size_t, NumDimSpatial> o{};
+
+                for(std::size_t d = NumDimSpatial - 1; d-- > 0;)
+                {
+                    o[d] = row % out_lengths[2 + d];
+                    row /= out_lengths[2 + d];
+                }
+
+                const std::size_t n = row;
+
+                std::vector<float> acc(G);
+
+                for(std::size_t wo = 0; wo < Wo; ++wo)
+                {
+                    o[NumDimSpatial - 1] = wo;
+
+                    std::fill(acc.begin(), acc.end(), 0.f);
+
+                    for(std::size_t t = 0; t < num_tap; ++t)
+                    {
+                        std::size_t in_offset = n * in_strides[0];
+                        bool is_in_bound      = true;
+
+                        for(std::size_t d = 0; d < NumDimSpatial; ++d)
+                        {
+                            const auto i =
+                                ck::type_convert<ck::long_index_t>(o[d] * arg.conv_strides_[d]) +
+                                ck::type_convert<ck::long_index_t>(taps[t][d] *
+                                                                   arg.conv_dilations_[d]) -
+                                ck::type_convert<ck::long_index_t>(arg.in_left_pads_[d]);
+
+                            is_in_bound = is_in_bound && i >= 0 &&
+                                          ck::type_convert<std::size_t>(i) < in_lengths[2 + d];
+                            in_offset += is_in_bound ? i * in_strides[2 + d] : 0;
+                        }
+
+                        if(!is_in_bound)
+                        {
+                            continue;
+                        }
+
+                        const InDataType* p_in = arg.input_.mData.data() + in_offset;
+                        const float* p_wei     = wei_t_g.data() + t * G;
+
+                        for(std::size_t g = 0; g < G; ++g)
+                        {
+                            float v_in;
+
+                            arg.in_element_op_(v_in,
+                                               ck::type_convert<float>(p_in[g * in_strides[1]]));
+
+                            acc[g] += v_in * p_wei[g];
+                        }
+                    }
+
+                    std::size_t out_offset = n * out_strides[0];
+
+                    for(std::size_t d = 0; d < NumDimSpatial; ++d)
+                    {
+                        out_offset += o[d] * out_strides[2 + d];
+                    }
+
+                    for(std::size_t g = 0; g < G; ++g)
+                    {
+                        float v_out;
+
+                        arg.out_element_op_(v_out, acc[g]);
+
+                        arg.output_.mData[out_offset + g * out_strides[1]] =
+                            ck::type_convert<OutDataType>(v_out);
+                    }
+                }
+            };
+
+            make_ParallelTensorFunctor(f_row, num_row)(std::thread::hardware_concurrency());
+        }
+
+        // calls f(idx) for each multi-index idx of a spatial extent, in row-major order
+        template <typename F>
+        static void ForEachSpatialIndex(const std::array<std::size_t, NumDimSpatial>& lengths, F f)
+        {
+            std::size_t num_index = 1;
+
+            for(auto length : lengths)
+            {
+                num_index *= length;
+            }
+
+            std::array<std::size_t, NumDimSpatial> idx{};
+
+            for(std::size_t i = 0; i < num_index; ++i)
+            {
+                f(idx);
+
+                for(std::size_t d = NumDimSpatial; d-- > 0;)
+                {
+                    if(++idx[d] < lengths[d])
+                    {
+                        break;
+                    }
+
+                    idx[d] = 0;
+                }
+            }
+        }
+
+        // Winograd F(4x4, 3x3) or F(2x2, 5x5), for 2D convolutions of stride 1 and dilation 1
+        static bool IsWinogradApplicable(const Argument& arg)
+        {
+            const auto& wei_lengths = arg.weight_.mDesc.GetLengths();
+
+            const auto is_one = [](auto v) { return v == 1; };
+
+            return NumDimSpatial == 2 &&
+                   std::all_of(arg.conv_strides_.begin(), arg.conv_strides_.end(), is_one) &&
+                   std::all_of(arg.conv_dilations_.begin(), arg.conv_dilations_.end(), is_one) &&
+                   wei_lengths[2] == wei_lengths[3] && (wei_lengths[2] == 3 || wei_lengths[2] == 5);
+        }
+
+        // lengths of the FFT, which hold the input window of all the outputs of each dimension
+        static std::vector<std::size_t> GetFftLengths(const Argument& arg)
+        {
+            const auto& wei_lengths = arg.weight_.mDesc.GetLengths();
+            const auto& out_lengths = arg.output_.mDesc.GetLengths();
+
+            std::vector<std::size_t> fft_lengths;
+
+            for(std::size_t d = 0; d < NumDimSpatial; ++d)
+            {
+                const std::size_t span =
+                    (std::max<std::size_t>(out_lengths[2 + d], 1) - 1) * arg.conv_strides_[d] +
+                    (wei_lengths[2 + d] - 1) * arg.conv_dilations_[d] + 1;
+
+                fft_lengths.push_back(GetFftLength(span));
+            }
+
+            return fft_lengths;
+        }
+
+        // Direct for problems of less than MinFastAlgorithmMacs multiply-adds, and for depthwise
+        // convolutions, which have their own path. Otherwise Winograd where applicable, else FFT
+        // if it takes fewer multiply-adds than Direct, whose multiply-adds are several times
+        // slower due to the index arithmetic of every tap.
+        static ConvFwdAlgorithm SelectAlgorithm(const Argument& arg)
+        {
+            if(arg.c_per_group_ == 1 && arg.k_per_group_ == 1)
+            {
+                return ConvFwdAlgorithm::Direct;
+            }
+
+            const auto& wei_lengths = arg.weight_.mDesc.GetLengths();
+            const auto& out_lengths = arg.output_.mDesc.GetLengths();
+
+            const double N  = out_lengths[0];
+            const double K  = out_lengths[1];
+            const double C  = arg.input_.mDesc.GetLengths()[1];
+            const double Cg = arg.c_per_group_;
+
+            double num_tap       = 1;
+            double num_out_pixel = 1;
+
+            for(std::size_t d = 0; d < NumDimSpatial; ++d)
+            {
+                num_tap *= wei_lengths[2 + d];
+                num_out_pixel *= out_lengths[2 + d];
+            }
+
+            const double direct_macs = N * K * Cg * num_out_pixel * num_tap;
+
+            if(direct_macs < MinFastAlgorithmMacs)
+            {
+                return ConvFwdAlgorithm::Direct;
+            }
+
+            if(IsWinogradApplicable(arg))
+            {
+                return ConvFwdAlgorithm::Winograd;
+            }
+
+            double fft_size = 1;
+
+            for(auto length : GetFftLengths(arg))
+            {
+                fft_size *= length;
+            }
 
-                    for(std::size_t c = 0; c < arg.weight_.mDesc.GetLengths()[1]; ++c)
+            // a complex multiply-add is 4 real ones, and an FFT of P points about 2.5 P log2(P)
+            const double fft_macs = 4 * N * K * Cg * fft_size +
+                                    2.5 * (N * C + K * Cg + N * K) * fft_size * std::log2(fft_size);
+
+            return fft_macs < direct_macs ? ConvFwdAlgorithm::Fft : ConvFwdAlgorithm::Direct;
+        }
+
+        // Winograd F(M x M, R x R): the input is split in tiles of M x M outputs, whose
+        // Alpha x Alpha input windows are transformed once for all the output channels. The
+        // transformed filters and inputs are multiplied element-wise, summed over the input
+        // channels of a group and transformed back to the output tile.
+        template <std::size_t M, std::size_t R>
+        static void RunWinograd(const Argument& arg)
+        {
+            using Transform = WinogradTransform<M, R>;
+
+            constexpr std::size_t Alpha   = Transform::Alpha;
+            constexpr std::size_t NumElem = Alpha * Alpha;
+
+            const Transform transform;
+
+            const auto& in_lengths  = arg.input_.mDesc.GetLengths();
+            const auto& out_lengths = arg.output_.mDesc.GetLengths();
+            const auto& in_strides  = arg.input_.mDesc.GetStrides();
+
+            const std::size_t C  = in_lengths[1];
+            const std::size_t K  = out_lengths[1];
+            const std::size_t Hi = in_lengths[2];
+            const std::size_t Wi = in_lengths[3];
+            const std::size_t Ho = out_lengths[2];
+            const std::size_t Wo = out_lengths[3];
+            const std::size_t Cg = arg.c_per_group_;
+
+            const std::size_t num_tile_h = (Ho + M - 1) / M;
+            const std::size_t num_tile_w = (Wo + M - 1) / M;
+
+            // transformed filters, as u[k][e][c] for the elements e of a transformed tile
+            std::vector<double> u(K * NumElem * Cg);
+
+            auto f_filter = [&](auto k, auto c) {
+                std::array<double, R * R> w;
+                std::array<double, NumElem> u_kc;
+
+                for(std::size_t y = 0; y < R; ++y)
+                {
+                    for(std::size_t x = 0; x < R; ++x)
                     {
-                        for(std::size_t y = 0; y < arg.weight_.mDesc.GetLengths()[2]; ++y)
+                        float v_wei;
+
+                        arg.wei_element_op_(v_wei,
+                                            ck::type_convert<float>(arg.weight_(k, c, y, x)));
+
+                        w[y * R + x] = v_wei;
+                    }
+                }
+
+                transform.TransformFilter(w.data(), u_kc.data());
+
+                for(std::size_t e = 0; e < NumElem; ++e)
+                {
+                    u[(k * NumElem + e) * Cg + c] = u_kc[e];
+                }
+            };
+
+            make_ParallelTensorFunctor(f_filter, K, Cg)(std::thread::hardware_concurrency());
+
+            auto f_tile_row = [&](auto n, auto th) {
+                // transformed input tiles of all the input channels, as v[e][c]
+                std::vector<double> v(NumElem * C);
+
+                std::array<double, NumElem> d;
+                std::array<double, NumElem> v_c;
+                std::array<double, NumElem> m;
+                std::array<double, M * M> y;
+
+                const auto hi_begin = ck::type_convert<ck::long_index_t>(th * M) -
+                                      ck::type_convert<ck::long_index_t>(arg.in_left_pads_[0]);
+
+                for(std::size_t tw = 0; tw < num_tile_w; ++tw)
+                {
+                    const auto wi_begin = ck::type_convert<ck::long_index_t>(tw * M) -
+                                          ck::type_convert<ck::long_index_t>(arg.in_left_pads_[1]);
+
+                    for(std::size_t c = 0; c < C; ++c)
+                    {
+                        const InDataType* p_in =
+                            arg.input_.mData.data() + n * in_strides[0] + c * in_strides[1];
+
+                        for(std::size_t a = 0; a < Alpha; ++a)
                         {
-                            auto hi =
-                                ck::type_convert<ck::long_index_t>(ho * arg.conv_strides_[0]) +
-                                ck::type_convert<ck::long_index_t>(y * arg.conv_dilations_[0]) -
-                                ck::type_convert<ck::long_index_t>(arg.in_left_pads_[0]);
-                            for(std::size_t x = 0; x < arg.weight_.mDesc.GetLengths()[3]; ++x)
+                            for(std::size_t b = 0; b < Alpha; ++b)
                             {
-                                auto wi =
-                                    ck::type_convert<ck::long_index_t>(wo * arg.conv_strides_[1]) +
-                                    ck::type_convert<ck::long_index_t>(x * arg.conv_dilations_[1]) -
-                                    ck::type_convert<ck::long_index_t>(arg.in_left_pads_[1]);
-                                if(hi >= 0 &&
-                                   ck::type_convert<std::size_t>(hi) <
-                                       arg.input_.mDesc.GetLengths()[2] &&
-                                   wi >= 0 &&
-                                   ck::type_convert<std::size_t>(wi) <
-                                       arg.input_.mDesc.GetLengths()[3])
-                                {
-                                    float v_in;
-                                    float v_wei;
+                                const auto hi = hi_begin + ck::type_convert<ck::long_index_t>(a);
+                                const auto wi = wi_begin + ck::type_convert<ck::long_index_t>(b);
+
+                                float v_in = 0;
 
+                                if(hi >= 0 && ck::type_convert<std::size_t>(hi) < Hi && wi >= 0 &&
+                                   ck::type_convert<std::size_t>(wi) < Wi)
+                                {
                                     arg.in_element_op_(
-                                        v_in, ck::type_convert<float>(arg.input_(n, c, hi, wi)));
-                                    arg.wei_element_op_(
-                                        v_wei, ck::type_convert<float>(arg.weight_(k, c, y, x)));
-                                    v_acc += v_in * v_wei;
+                                        v_in,
+                                        ck::type_convert<float>(
+                                            p_in[hi * in_strides[2] + wi * in_strides[3]]));
                                 }
+
+                                d[a * Alpha + b] = v_in;
+                            }
+                        }
+
+                        transform.TransformInput(d.data(), v_c.data());
+
+                        for(std::size_t e = 0; e < NumElem; ++e)
+                        {
+                            v[e * C + c] = v_c[e];
+                        }
+                    }
+
+                    for(std::size_t k = 0; k < K; ++k)
+                    {
+                        // first input channel of the group of k
+                        const std::size_t c_begin = k / arg.k_per_group_ * Cg;
+
+                        for(std::size_t e = 0; e < NumElem; ++e)
+                        {
+                            const double* p_u = u.data() + (k * NumElem + e) * Cg;
+                            const double* p_v = v.data() + e * C + c_begin;
+
+                            double acc = 0;
+
+                            for(std::size_t c = 0; c < Cg; ++c)
+                            {
+                                acc += p_u[c] * p_v[c];
+                            }
+
+                            m[e] = acc;
+                        }
+
+                        transform.TransformOutput(m.data(), y.data());
+
+                        for(std::size_t i = 0; i < M && th * M + i < Ho; ++i)
+                        {
+                            for(std::size_t j = 0; j < M && tw * M + j < Wo; ++j)
+                            {
+                                float v_out;
+
+                                arg.out_element_op_(v_out, static_cast<float>(y[i * M + j]));
+
+                                arg.output_(n, k, th * M + i, tw * M + j) =
+                                    ck::type_convert<OutDataType>(v_out);
                             }
                         }
                     }
+                }
+            };
+
+            make_ParallelTensorFunctor(f_tile_row, out_lengths[0], num_tile_h)(
+                std::thread::hardware_concurrency());
+        }
+
+        static void RunWinograd(const Argument& arg)
+        {
+            if(!IsWinogradApplicable(arg))
+            {
+                throw std::runtime_error("wrong! Winograd needs a 2D convolution of stride 1, "
+                                         "dilation 1 and a 3x3 or 5x5 filter");
+            }
+
+            if(arg.weight_.mDesc.GetLengths()[2] == 3)
+            {
+                RunWinograd<4, 3>(arg);
+            }
+            else
+            {
+                RunWinograd<2, 5>(arg);
+            }
+        }
+
+        // FFT: the correlation of an input channel with a filter is the inverse FFT of the
+        // product of the spectrum of the input with the conjugate of the one of the filter, whose
+        // taps are placed at multiples of the dilations. The products are summed over the input
+        // channels of a group before the inverse FFT, and the outputs are read at multiples of
+        // the strides. The spectra are computed for blocks of output channels and of batches,
+        // which take MaxFftSpectraBytes at most each.
+        static void RunFft(const Argument& arg)
+        {
+            using Complex = std::complex<double>;
+
+            const auto& in_lengths  = arg.input_.mDesc.GetLengths();
+            const auto& wei_lengths = arg.weight_.mDesc.GetLengths();
+            const auto& out_lengths = arg.output_.mDesc.GetLengths();
+            const auto& in_strides  = arg.input_.mDesc.GetStrides();
+            const auto& wei_strides = arg.weight_.mDesc.GetStrides();
+            const auto& out_strides = arg.output_.mDesc.GetStrides();
+
+            const std::size_t N  = out_lengths[0];
+            const std::size_t K  = out_lengths[1];
+            const std::size_t C  = in_lengths[1];
+            const std::size_t Cg = arg.c_per_group_;
+
+            const auto fft_lengths = GetFftLengths(arg);
+            const HostFft fft(fft_lengths);
+
+            const std::size_t P = fft.GetElementSpaceSize();
+
+            std::array<std::size_t, NumDimSpatial> fft_strides;
+            std::array<std::size_t, NumDimSpatial> in_spatial_lengths;
+            std::array<std::size_t, NumDimSpatial> wei_spatial_lengths;
+            std::array<std::size_t, NumDimSpatial> out_spatial_lengths;
+
+            for(std::size_t d = NumDimSpatial, stride = 1; d-- > 0;)
+            {
+                fft_strides[d] = stride;
+                stride *= fft_lengths[d];
+
+                in_spatial_lengths[d]  = in_lengths[2 + d];
+                wei_spatial_lengths[d] = wei_lengths[2 + d];
+                out_spatial_lengths[d] = out_lengths[2 + d];
+            }
+
+            const std::size_t k_block =
+                std::clamp<std::size_t>(MaxFftSpectraBytes / (Cg * P * sizeof(Complex)), 1, K);
+            const std::size_t n_block =
+                std::clamp<std::size_t>(MaxFftSpectraBytes / (C * P * sizeof(Complex)), 1, N);
+
+            std::vector<Complex> wei_spectra(k_block * Cg * P);
+            std::vector<Complex> in_spectra(n_block * C * P);
+
+            for(std::size_t k_begin = 0; k_begin < K; k_begin += k_block)
+            {
+                const std::size_t k_count = std::min(k_block, K - k_begin);
+
+                auto f_wei = [&](auto k, auto c) {
+                    Complex* p = wei_spectra.data() + (k * Cg + c) * P;
+
+                    std::fill(p, p + P, Complex{0});
+
+                    ForEachSpatialIndex(wei_spatial_lengths, [&](const auto& x) {
+                        std::size_t wei_offset =
+                            (k_begin + k) * wei_strides[0] + c * wei_strides[1];
+                        std::size_t fft_offset = 0;
+
+                        for(std::size_t d = 0; d < NumDimSpatial; ++d)
+                        {
+                            wei_offset += x[d] * wei_strides[2 + d];
+                            fft_offset += x[d] * arg.conv_dilations_[d] * fft_strides[d];
+                        }
+
+                        float v_wei;
 
-                    float v_out;
+                        arg.wei_element_op_(v_wei,
+                                            ck::type_convert<float>(arg.weight_.mData[wei_offset]));
 
-                    arg.out_element_op_(v_out, v_acc);
-                    arg.output_(n, k, ho, wo) = ck::type_convert<OutDataType>(v_out);
+                        p[fft_offset] = v_wei;
+                    });
+
+                    fft.Forward(p);
+                };
+
+                make_ParallelTensorFunctor(f_wei, k_count, Cg)(std::thread::hardware_concurrency());
+
+                for(std::size_t n_begin = 0; n_begin < N; n_begin += n_block)
+                {
+                    const std::size_t n_count = std::min(n_block, N - n_begin);
+
+                    auto f_in = [&](auto n, auto c) {
+                        Complex* p = in_spectra.data() + (n * C + c) * P;
+
+                        std::fill(p, p + P, Complex{0});
+
+                        // input i is at i + left pad, the inputs beyond the FFT are not needed
+                        ForEachSpatialIndex(in_spatial_lengths, [&](const auto& i) {
+                            std::size_t in_offset =
+                                (n_begin + n) * in_strides[0] + c * in_strides[1];
+                            std::size_t fft_offset = 0;
+
+                            for(std::size_t d = 0; d < NumDimSpatial; ++d)
+                            {
+                                const std::size_t q = i[d] + arg.in_left_pads_[d];
+
+                                if(q >= fft_lengths[d])
+                                {
+                                    return;
+                                }
+
+                                in_offset += i[d] * in_strides[2 + d];
+                                fft_offset += q * fft_strides[d];
+                            }
+
+                            float v_in;
+
+                            arg.in_element_op_(
+                                v_in, ck::type_convert<float>(arg.input_.mData[in_offset]));
+
+                            p[fft_offset] = v_in;
+                        });
+
+                        fft.Forward(p);
+                    };
+
+                    make_ParallelTensorFunctor(f_in, n_count, C)(
+                        std::thread::hardware_concurrency());
+
+                    auto f_out = [&](auto n, auto k) {
+                        std::vector<Complex> acc(P);
+
+                        // first input channel of the group of k
+                        const std::size_t c_begin = (k_begin + k) / arg.k_per_group_ * Cg;
+
+                        for(std::size_t c = 0; c < Cg; ++c)
+                        {
+                            const Complex* p_in  = in_spectra.data() + (n * C + c_begin + c) * P;
+                            const Complex* p_wei = wei_spectra.data() + (k * Cg + c) * P;
+
+                            for(std::size_t i = 0; i < P; ++i)
+                            {
+                                acc[i] += p_in[i] * std::conj(p_wei[i]);
+                            }
+                        }
+
+                        fft.Inverse(acc.data());
+
+                        ForEachSpatialIndex(out_spatial_lengths, [&](const auto& o) {
+                            std::size_t out_offset =
+                                (n_begin + n) * out_strides[0] + (k_begin + k) * out_strides[1];
+                            std::size_t fft_offset = 0;
+
+                            for(std::size_t d = 0; d < NumDimSpatial; ++d)
+                            {
+                                out_offset += o[d] * out_strides[2 + d];
+                                fft_offset += o[d] * arg.conv_strides_[d] * fft_strides[d];
+                            }
+
+                            float v_out;
+
+                            arg.out_element_op_(v_out, static_cast<float>(acc[fft_offset].real()));
+
+                            arg.output_.mData[out_offset] = ck::type_convert<OutDataType>(v_out);
+                        });
+                    };
+
+                    make_ParallelTensorFunctor(f_out, n_count, k_count)(
+                        std::thread::hardware_concurrency());
+                }
+            }
+        }
+
+        float Run(const Argument& arg)
+        {
+            const ConvFwdAlgorithm algorithm =
+                arg.algorithm_ == ConvFwdAlgorithm::Auto ? SelectAlgorithm(arg) : arg.algorithm_;
+
+            if(algorithm == ConvFwdAlgorithm::Winograd)
+            {
+                RunWinograd(arg);
+
+                return 0;
+            }
+            else if(algorithm == ConvFwdAlgorithm::Fft)
+            {
+                RunFft(arg);
+
+                return 0;
+            }
+
+            if(arg.c_per_group_ == 1 && arg.k_per_group_ == 1)
+            {
+                RunDepthwise(arg);
+
+                return 0;
+            }
+
+            if constexpr(NumDimSpatial == 1)
+            {
+                auto f_ncw = [&](auto n, auto k, auto wo) {
+                    arg.output_(n, k, wo) = ComputeAt(arg, n, k, wo);
+                };
+
+                make_ParallelTensorFunctor(f_ncw,
+                                           arg.output_.mDesc.GetLengths()[0],
+                                           arg.output_.mDesc.GetLengths()[1],
+                                           arg.output_.mDesc.GetLengths()[2])(
+                    std::thread::hardware_concurrency());
+
+                return 0;
+            }
+            else if constexpr(NumDimSpatial == 2)
+            {
+                auto f_nchw = [&](auto n, auto k, auto ho, auto wo) {
+                    arg.output_(n, k, ho, wo) = ComputeAt(arg, n, k, ho, wo);
                 };
 
                 make_ParallelTensorFunctor(f_nchw,
@@ -184,60 +968,7 @@ struct ReferenceConvFwd : public device::BaseOperator
             else if constexpr(NumDimSpatial == 3)
             {
                 auto f_nchw = [&](auto n, auto k, auto d_o, auto ho, auto wo) {
-                    float v_acc = 0;
-
-                    for(std::size_t c = 0; c < arg.weight_.mDesc.GetLengths()[1]; ++c)
-                    {
-                        for(std::size_t z = 0; z < arg.weight_.mDesc.GetLengths()[2]; ++z)
-                        {
-                            auto di =
-                                ck::type_convert<ck::long_index_t>(d_o * arg.conv_strides_[0]) +
-                                ck::type_convert<ck::long_index_t>(z * arg.conv_dilations_[0]) -
-                                ck::type_convert<ck::long_index_t>(arg.in_left_pads_[0]);
-                            for(std::size_t y = 0; y < arg.weight_.mDesc.GetLengths()[3]; ++y)
-                            {
-                                auto hi =
-                                    ck::type_convert<ck::long_index_t>(ho * arg.conv_strides_[1]) +
-                                    ck::type_convert<ck::long_index_t>(y * arg.conv_dilations_[1]) -
-                                    ck::type_convert<ck::long_index_t>(arg.in_left_pads_[1]);
-                                for(std::size_t x = 0; x < arg.weight_.mDesc.GetLengths()[4]; ++x)
-                                {
-                                    auto wi =
-                                        ck::type_convert<ck::long_index_t>(wo *
-                                                                           arg.conv_strides_[2]) +
-                                        ck::type_convert<ck::long_index_t>(x *
-                                                                           arg.conv_dilations_[2]) -
-                                        ck::type_convert<ck::long_index_t>(arg.in_left_pads_[2]);
-                                    if(di >= 0 &&
-                                       ck::type_convert<std::size_t>(di) <
-                                           arg.input_.mDesc.GetLengths()[2] &&
-                                       hi >= 0 &&
-                                       ck::type_convert<std::size_t>(hi) <
-                                           arg.input_.mDesc.GetLengths()[3] &&
-                                       wi >= 0 &&
-                                       ck::type_convert<std::size_t>(wi) <
-                                           arg.input_.mDesc.GetLengths()[4])
-                                    {
-                                        float v_in;
-                                        float v_wei;
-
-                                        arg.in_element_op_(
-                                            v_in,
-                                            ck::type_convert<float>(arg.input_(n, c, di, hi, wi)));
-                                        arg.wei_element_op_(
-                                            v_wei,
-                                            ck::type_convert<float>(arg.weight_(k, c, z, y, x)));
-                                        v_acc += v_in * v_wei;
-                                    }
-                                }
-                            }
-                        }
-                    }
-
-                    float v_out;
-
-                    arg.out_element_op_(v_out, v_acc);
-                    arg.output_(n, k, d_o, ho, wo) = ck::type_convert<OutDataType>(v_out);
+                    arg.output_(n, k, d_o, ho, wo) = ComputeAt(arg, n, k, d_o, ho, wo);
                 };
 
                 make_ParallelTensorFunctor(f_nchw,
@@ -265,7 +996,12 @@ struct ReferenceConvFwd : public device::BaseOperator
         return true;
     }
 
-    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+    bool IsSupportedArgument(const device::BaseArgument* p_arg) override
+    {
+        const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+        return arg.algorithm_ != ConvFwdAlgorithm::Winograd || Invoker::IsWinogradApplicable(arg);
+    }
 
     static auto MakeArgument(const Tensor<InDataType>& input,
                              const Tensor<WeiDataType>& weight,
@@ -276,7 +1012,8 @@ struct ReferenceConvFwd : public device::BaseOperator
                              std::vector<ck::index_t> input_right_pads,
                              InElementwiseOperation in_element_op,
                              WeiElementwiseOperation wei_element_op,
-                             OutElementwiseOperation out_element_op)
+                             OutElementwiseOperation out_element_op,
+                             ConvFwdAlgorithm algorithm = ConvFwdAlgorithm::Auto)
     {
         return Argument{input,
                         weight,
@@ -287,7 +1024,8 @@ struct ReferenceConvFwd : public device::BaseOperator
                         input_right_pads,
                         in_element_op,
                         wei_element_op,
-                        out_element_op};
+                        out_element_op,
+                        algorithm};
     }
 
     static auto MakeInvoker() { return Invoker{}; }
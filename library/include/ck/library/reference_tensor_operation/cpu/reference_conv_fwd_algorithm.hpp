@@ -0,0 +1,344 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// algorithm used by ReferenceConvFwd, where Auto selects one from the shape of the problem
+enum struct ConvFwdAlgorithm
+{
+    Auto,
+    Direct,
+    Winograd,
+    Fft
+};
+
+inline std::string GetConvFwdAlgorithmString(ConvFwdAlgorithm algorithm)
+{
+    switch(algorithm)
+    {
+    case ConvFwdAlgorithm::Auto: return "Auto";
+    case ConvFwdAlgorithm::Direct: return "Direct";
+    case ConvFwdAlgorithm::Winograd: return "Winograd";
+    case ConvFwdAlgorithm::Fft: return "Fft";
+    }
+
+    return "Unknown";
+}
+
+//
+// @brief      Transforms of the Winograd minimal filtering algorithm F(M x M, R x R), which
+//             computes an M x M tile of the correlation of an Alpha x Alpha input tile d with an
+//             R x R filter w as y = AT [(G w G^T) . (BT d BT^T)] AT^T, where . is the
+//             element-wise product and Alpha = M + R - 1.
+//
+// @paragraph  The matrices are those of the Toom-Cook algorithm for the points 0, 1, -1, 2, -2,
+//             1/2, -1/2 and infinity, computed in double precision rather than tabulated, so
+//             that any F(M, R) with Alpha <= 8 is available. The correlation is the transpose of
+//             the linear convolution of the filter with the output, so AT and BT are the
+//             transposes of the evaluation and interpolation matrices of the latter.
+//
+template <std::size_t M, std::size_t R>
+struct WinogradTransform
+{
+    static constexpr std::size_t Alpha = M + R - 1;
+
+    static_assert(M >= 1 && R >= 1 && Alpha <= 8, "wrong! not enough interpolation points");
+
+    WinogradTransform()
+    {
+        constexpr std::array<double, 7> points{0., 1., -1., 2., -2., 0.5, -0.5};
+
+        // v evaluates a polynomial of degree Alpha - 1 at the points, its last row gives the
+        // leading coefficient, i.e. the value at infinity
+        std::array<double, Alpha * Alpha> v{};
+        std::array<double, Alpha * Alpha> v_inv{};
+
+        for(std::size_t j = 0; j < Alpha; ++j)
+        {
+            for(std::size_t l = 0; l < Alpha; ++l)
+            {
+                v[j * Alpha + l] = j + 1 < Alpha ? std::pow(points[j], l) : (l + 1 == Alpha);
+                v_inv[j * Alpha + l] = j == l;
+            }
+        }
+
+        // Gauss-Jordan elimination with partial pivoting
+        for(std::size_t col = 0; col < Alpha; ++col)
+        {
+            std::size_t pivot = col;
+
+            for(std::size_t j = col + 1; j < Alpha; ++j)
+            {
+                if(std::abs(v[j * Alpha + col]) > std::abs(v[pivot * Alpha + col]))
+                {
+                    pivot = j;
+                }
+            }
+
+            for(std::size_t l = 0; l < Alpha; ++l)
+            {
+                std::swap(v[col * Alpha + l], v[pivot * Alpha + l]);
+                std::swap(v_inv[col * Alpha + l], v_inv[pivot * Alpha + l]);
+            }
+
+            const double scale = 1. / v[col * Alpha + col];
+
+            for(std::size_t l = 0; l < Alpha; ++l)
+            {
+                v[col * Alpha + l] *= scale;
+                v_inv[col * Alpha + l] *= scale;
+            }
+
+            for(std::size_t j = 0; j < Alpha; ++j)
+            {
+                const double factor = v[j * Alpha + col];
+
+                if(j == col || factor == 0.)
+                {
+                    continue;
+                }
+
+                for(std::size_t l = 0; l < Alpha; ++l)
+                {
+                    v[j * Alpha + l] -= factor * v[col * Alpha + l];
+                    v_inv[j * Alpha + l] -= factor * v_inv[col * Alpha + l];
+                }
+            }
+        }
+
+        // g and the transpose of at evaluate polynomials of degree R - 1 and M - 1
+        for(std::size_t j = 0; j < Alpha; ++j)
+        {
+            for(std::size_t k = 0; k < R; ++k)
+            {
+                g_[j * R + k] = j + 1 < Alpha ? std::pow(points[j], k) : (k + 1 == R);
+            }
+
+            for(std::size_t i = 0; i < M; ++i)
+            {
+                at_[i * Alpha + j] = j + 1 < Alpha ? std::pow(points[j], i) : (i + 1 == M);
+            }
+
+            for(std::size_t l = 0; l < Alpha; ++l)
+            {
+                bt_[j * Alpha + l] = v_inv[l * Alpha + j];
+            }
+        }
+    }
+
+    // u = G w G^T, for w of R x R and u of Alpha x Alpha, both row-major
+    void TransformFilter(const double* w, double* u) const { Sandwich<Alpha, R>(g_, w, u); }
+
+    // v = BT d BT^T, for d and v of Alpha x Alpha, both row-major
+    void TransformInput(const double* d, double* v) const { Sandwich<Alpha, Alpha>(bt_, d, v); }
+
+    // y = AT m AT^T, for m of Alpha x Alpha and y of M x M, both row-major
+    void TransformOutput(const double* m, double* y) const { Sandwich<M, Alpha>(at_, m, y); }
+
+    private:
+    // y = a x a^T, for a of Rows x Cols and x of Cols x Cols
+    template <std::size_t Rows, std::size_t Cols>
+    static void Sandwich(const std::array<double, Rows * Cols>& a, const double* x, double* y)
+    {
+        std::array<double, Rows * Cols> ax{};
+
+        for(std::size_t i = 0; i < Rows; ++i)
+        {
+            for(std::size_t l = 0; l < Cols; ++l)
+            {
+                for(std::size_t j = 0; j < Cols; ++j)
+                {
+                    ax[i * Cols + j] += a[i * Cols + l] * x[l * Cols + j];
+                }
+            }
+        }
+
+        for(std::size_t i = 0; i < Rows; ++i)
+        {
+            for(std::size_t j = 0; j < Rows; ++j)
+            {
+                double acc = 0;
+
+                for(std::size_t l = 0; l < Cols; ++l)
+                {
+                    acc += ax[i * Cols + l] * a[j * Cols + l];
+                }
+
+                y[i * Rows + j] = acc;
+            }
+        }
+    }
+
+    std::array<double, M * Alpha> at_;
+    std::array<double, Alpha * R> g_;
+    std::array<double, Alpha * Alpha> bt_;
+};
+
+// smallest power of 2 which is not less than n
+inline std::size_t GetFftLength(std::size_t n)
+{
+    std::size_t length = 1;
+
+    while(length < n)
+    {
+        length *= 2;
+    }
+
+    return length;
+}
+
+//
+// @brief      Multi-dimensional complex FFT in double precision, of a row-major array whose
+//             lengths are powers of 2, as a radix-2 transform along each dimension in turn.
+//
+// @paragraph  The twiddle factors and bit-reversal permutations are computed once, so that one
+//             HostFft can transform many arrays, also from several threads at once.
+//
+class HostFft
+{
+    public:
+    explicit HostFft(const std::vector<std::size_t>& lengths) : lengths_{lengths}
+    {
+        constexpr double pi = 3.14159265358979323846;
+
+        strides_.resize(lengths_.size());
+
+        for(std::size_t d = lengths_.size(); d-- > 0;)
+        {
+            strides_[d] = size_;
+            size_ *= lengths_[d];
+        }
+
+        for(auto length : lengths_)
+        {
+            std::vector<std::complex<double>> twiddles(length / 2);
+            std::vector<std::size_t> bit_reverse(length, 0);
+
+            for(std::size_t k = 0; k < length / 2; ++k)
+            {
+                twiddles[k] = std::polar(1., -2. * pi * k / length);
+            }
+
+            for(std::size_t i = 1, j = 0; i < length; ++i)
+            {
+                std::size_t bit = length / 2;
+
+                for(; j & bit; bit /= 2)
+                {
+                    j ^= bit;
+                }
+
+                j ^= bit;
+
+                bit_reverse[i] = j;
+            }
+
+            twiddles_.push_back(std::move(twiddles));
+            bit_reverses_.push_back(std::move(bit_reverse));
+        }
+    }
+
+    std::size_t GetElementSpaceSize() const { return size_; }
+
+    void Forward(std::complex<double>* p) const { Transform(p, false); }
+
+    // scaled by 1 / GetElementSpaceSize(), so that it undoes Forward()
+    void Inverse(std::complex<double>* p) const
+    {
+        Transform(p, true);
+
+        const double scale = 1. / size_;
+
+        for(std::size_t i = 0; i < size_; ++i)
+        {
+            p[i] *= scale;
+        }
+    }
+
+    private:
+    void Transform(std::complex<double>* p, bool is_inverse) const
+    {
+        std::vector<std::complex<double>> line;
+
+        for(std::size_t d = 0; d < lengths_.size(); ++d)
+        {
+            const std::size_t length = lengths_[d];
+            const std::size_t stride = strides_[d];
+
+            if(length == 1)
+            {
+                continue;
+            }
+
+            line.resize(length);
+
+            // lines along d start at o * length * stride + i, for i < stride
+            for(std::size_t o = 0; o < size_ / (length * stride); ++o)
+            {
+                for(std::size_t i = 0; i < stride; ++i)
+                {
+                    std::complex<double>* p_line = p + o * length * stride + i;
+
+                    for(std::size_t j = 0; j < length; ++j)
+                    {
+                        line[bit_reverses_[d][j]] = p_line[j * stride];
+                    }
+
+                    Transform1D(line.data(), d, is_inverse);
+
+                    for(std::size_t j = 0; j < length; ++j)
+                    {
+                        p_line[j * stride] = line[j];
+                    }
+                }
+            }
+        }
+    }
+
+    // in-place iterative radix-2 transform of a line in bit-reversed order along dimension d
+    void Transform1D(std::complex<double>* line, std::size_t d, bool is_inverse) const
+    {
+        const std::size_t length = lengths_[d];
+        const auto& twiddles     = twiddles_[d];
+
+        for(std::size_t half = 1; half < length; half *= 2)
+        {
+            const std::size_t twiddle_step = length / (2 * half);
+
+            for(std::size_t begin = 0; begin < length; begin += 2 * half)
+            {
+                for(std::size_t j = 0; j < half; ++j)
+                {
+                    const auto w = is_inverse ? std::conj(twiddles[j * twiddle_step])
+                                              : twiddles[j * twiddle_step];
+
+                    const auto u = line[begin + j];
+                    const auto v = line[begin + j + half] * w;
+
+                    line[begin + j]        = u + v;
+                    line[begin + j + half] = u - v;
+                }
+            }
+        }
+    }
+
+    std::vector<std::size_t> lengths_;
+    std::vector<std::size_t> strides_;
+    std::size_t size_ = 1;
+
+    std::vector<std::vector<std::complex<double>>> twiddles_;
+    std::vector<std::vector<std::size_t>> bit_reverses_;
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
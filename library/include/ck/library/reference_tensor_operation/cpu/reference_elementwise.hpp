@@ -0,0 +1,296 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "device_base.hpp"
+#include "functional2.hpp"
+#include "host_tensor.hpp"
+#include "tensor_dimension_coalescing.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+//
+// @brief      Reference implementation of an element-wise operation with 1 to 5 inputs, as done
+//             by DeviceBinaryElementwise and Device5AryElementwise.
+//
+// @paragraph  out[i] = type_convert<OutDataType>(y), where functor(y, x0, x1, ...) is called with
+//             the inputs at i converted to ComputeDataType. Every input is read through strides
+//             over the dimensions of out, with a stride of 0 for broadcast dimensions. They are
+//             either given, like for the device operations, or detected by aligning the trailing
+//             dimensions of an input with those of out, where missing dimensions and dimensions
+//             of length 1 are broadcast.
+//
+// @paragraph  The dimensions are coalesced like for the device operations, by
+//             coalesce_elementwise_dimensions(). Run() then splits the innermost dimension in
+//             chunks which are computed by a simple strided, or unit stride, loop on each thread.
+//
+template <typename ElementwiseFunctor,
+          typename ComputeDataType,
+          typename OutDataType,
+          typename... InDataTypes>
+struct ReferenceElementwise : public device::BaseOperator
+{
+    static constexpr index_t NumInput = sizeof...(InDataTypes);
+
+    static_assert(NumInput >= 1 && NumInput <= 5, "wrong! only 1 to 5 inputs are supported");
+
+    // number of elements of the innermost dimension computed by one work item
+    static constexpr std::size_t InnerChunkSize = 4096;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(std::tuple<const Tensor<InDataTypes>&...> ins,
+                 Tensor<OutDataType>& out,
+                 ElementwiseFunctor functor,
+                 std::array<std::vector<std::size_t>, NumInput> in_strides)
+            : ins_{ins}, out_{out}, functor_{functor}
+        {
+            const auto& out_lengths = out_.mDesc.GetLengths();
+
+            // strides over the dimensions of out, of each input then of out, as the device
+            // operations take them
+            std::vector<std::vector<index_t>> strides;
+
+            static_for<0, NumInput, 1>{}([&](auto I) {
+                const auto in_strides_i =
+                    in_strides[I].empty()
+                        ? GetBroadcastStrides(std::get<I>(ins_).mDesc, out_lengths)
+                        : in_strides[I];
+
+                if(in_strides_i.size() != out_lengths.size())
+                {
+                    throw std::runtime_error("wrong! input strides do not match output rank");
+                }
+
+                strides.emplace_back(in_strides_i.begin(), in_strides_i.end());
+            });
+
+            strides.emplace_back(out_.mDesc.GetStrides().begin(), out_.mDesc.GetStrides().end());
+
+            const auto dims = device::coalesce_elementwise_dimensions(
+                std::vector<index_t>(out_lengths.begin(), out_lengths.end()), strides);
+
+            lengths_.assign(dims.lengths.begin(), dims.lengths.end());
+
+            merged_strides_[0].assign(dims.strides[NumInput].begin(), dims.strides[NumInput].end());
+
+            for(std::size_t t = 0; t < NumInput; ++t)
+            {
+                merged_strides_[t + 1].assign(dims.strides[t].begin(), dims.strides[t].end());
+            }
+
+            if(lengths_.empty())
+            {
+                lengths_.push_back(1);
+
+                for(auto& s : merged_strides_)
+                {
+                    s.push_back(0);
+                }
+            }
+        }
+
+        // strides of a tensor broadcast to out_lengths, by aligning the trailing dimensions
+        static std::vector<std::size_t>
+        GetBroadcastStrides(const HostTensorDescriptor& in_desc,
+                            const std::vector<std::size_t>& out_lengths)
+        {
+            const auto& in_lengths = in_desc.GetLengths();
+            const auto& in_strides = in_desc.GetStrides();
+
+            if(in_lengths.size() > out_lengths.size())
+            {
+                throw std::runtime_error("wrong! input has more dimensions than output");
+            }
+
+            const std::size_t rank_diff = out_lengths.size() - in_lengths.size();
+
+            std::vector<std::size_t> strides(out_lengths.size(), 0);
+
+            for(std::size_t d = 0; d < in_lengths.size(); ++d)
+            {
+                if(in_lengths[d] == out_lengths[d + rank_diff])
+                {
+                    strides[d + rank_diff] = in_strides[d];
+                }
+                else if(in_lengths[d] != 1)
+                {
+                    throw std::runtime_error("wrong! input lengths cannot be broadcast to output");
+                }
+            }
+
+            return strides;
+        }
+
+        std::tuple<const Tensor<InDataTypes>&...> ins_;
+        Tensor<OutDataType>& out_;
+
+        ElementwiseFunctor functor_;
+
+        // lengths after merging dimensions, and the strides of out then of each input
+        std::vector<std::size_t> lengths_;
+        std::array<std::vector<std::size_t>, NumInput + 1> merged_strides_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceElementwise::Argument;
+
+        template <bool IsUnitStride, std::size_t... Is>
+        static void RunInner(const Argument& arg,
+                             const std::array<std::size_t, NumInput + 1>& offsets,
+                             std::size_t i_begin,
+                             std::size_t i_end,
+                             std::index_sequence<Is...>)
+        {
+            OutDataType* p_out = arg.out_.mData.data() + offsets[0];
+
+            const auto p_ins =
+                std::make_tuple((std::get<Is>(arg.ins_).mData.data() + offsets[Is + 1])...);
+
+            if constexpr(IsUnitStride)
+            {
+                for(std::size_t i = i_begin; i < i_end; ++i)
+                {
+                    ComputeDataType y;
+
+                    arg.functor_(y, ck::type_convert<ComputeDataType>(std::get<Is>(p_ins)[i])...);
+
+                    p_out[i] = ck::type_convert<OutDataType>(y);
+                }
+            }
+            else
+            {
+                const std::size_t out_stride = arg.merged_strides_[0].back();
+
+                const std::array<std::size_t, NumInput> in_strides{
+                    arg.merged_strides_[Is + 1].back()...};
+
+                for(std::size_t i = i_begin; i < i_end; ++i)
+                {
+                    ComputeDataType y;
+
+                    arg.functor_(y,
+                                 ck::type_convert<ComputeDataType>(
+                                     std::get<Is>(p_ins)[i * in_strides[Is]])...);
+
+                    p_out[i * out_stride] = ck::type_convert<OutDataType>(y);
+                }
+            }
+        }
+
+        float Run(const Argument& arg)
+        {
+            const auto& lengths = arg.lengths_;
+            const auto& strides = arg.merged_strides_;
+
+            const std::size_t rank         = lengths.size();
+            const std::size_t inner_length = lengths.back();
+            const std::size_t num_chunk    = (inner_length + InnerChunkSize - 1) / InnerChunkSize;
+
+            std::size_t num_row = 1;
+
+            for(std::size_t d = 0; d + 1 < rank; ++d)
+            {
+                num_row *= lengths[d];
+            }
+
+            const bool is_unit_stride = std::all_of(
+                strides.begin(), strides.end(), [](auto& s) { return s.back() == 1; });
+
+            auto f_work = [&](auto work) {
+                std::size_t row = work / num_chunk;
+
+                const std::size_t i_begin = work % num_chunk * InnerChunkSize;
+                const std::size_t i_end   = std::min(i_begin + InnerChunkSize, inner_length);
+
+                std::array<std::size_t, NumInput + 1> offsets{};
+
+                for(std::size_t d = rank - 1; d-- > 0;)
+                {
+                    const std::size_t idx = row % lengths[d];
+
+                    row /= lengths[d];
+
+                    for(std::size_t t = 0; t <= NumInput; ++t)
+                    {
+                        offsets[t] += idx * strides[t][d];
+                    }
+                }
+
+                if(is_unit_stride)
+                {
+                    RunInner<true>(
+                        arg, offsets, i_begin, i_end, std::make_index_sequence<NumInput>{});
+                }
+                else
+                {
+                    RunInner<false>(
+                        arg, offsets, i_begin, i_end, std::make_index_sequence<NumInput>{});
+                }
+            };
+
+            make_ParallelTensorFunctor(f_work, num_row * num_chunk)(
+                std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    // in_strides: for each input, its strides over the dimensions of out, with 0 for the broadcast
+    // dimensions, or empty to broadcast the input by aligning its trailing dimensions with out
+    static auto MakeArgument(std::tuple<const Tensor<InDataTypes>&...> ins,
+                             Tensor<OutDataType>& out,
+                             ElementwiseFunctor functor,
+                             std::array<std::vector<std::size_t>, NumInput> in_strides = {})
+    {
+        return Argument{ins, out, functor, in_strides};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceElementwise"
+            << "<" << NumInput << ">"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
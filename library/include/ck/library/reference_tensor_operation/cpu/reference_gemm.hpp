@@ -3,6 +3,7 @@
 #include <sstream>
 #include "device_base.hpp"
 #include "host_tensor.hpp"
+#include "reference_tile.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -49,30 +50,49 @@ struct ReferenceGemm : public device::BaseOperator
     {
         using Argument = ReferenceGemm::Argument;
 
-        float Run(const Argument& arg)
+        // value of c_m_n(m, n), computed without writing c_m_n
+        static CDataType ComputeAt(const Argument& arg, std::size_t m, std::size_t n)
         {
-            auto f_mk_kn_mn = [&](auto m, auto n) {
-                const int K = arg.a_m_k_.mDesc.GetLengths()[1];
+            const int K = arg.a_m_k_.mDesc.GetLengths()[1];
+
+            AccDataType v_acc = 0;
+
+            for(int k = 0; k < K; ++k)
+            {
+                AccDataType v_a;
+                AccDataType v_b;
 
-                AccDataType v_acc = 0;
+                arg.a_element_op_(v_a, static_cast<const AccDataType>(arg.a_m_k_(m, k)));
+                arg.b_element_op_(v_b, static_cast<const AccDataType>(arg.b_k_n_(k, n)));
 
-                for(int k = 0; k < K; ++k)
-                {
-                    AccDataType v_a;
-                    AccDataType v_b;
+                v_acc += v_a * v_b;
+            }
 
-                    arg.a_element_op_(v_a, static_cast<const AccDataType>(arg.a_m_k_(m, k)));
-                    arg.b_element_op_(v_b, static_cast<const AccDataType>(arg.b_k_n_(k, n)));
+            AccDataType v_c;
 
-                    v_acc += v_a * v_b;
-                }
+            arg.c_element_op_(v_c, v_acc);
 
-                AccDataType v_c;
+            return v_c;
+        }
+
+        // idx: {m, n}
+        static CDataType ComputeAt(const Argument& arg, const std::vector<std::size_t>& idx)
+        {
+            return ComputeAt(arg, idx[0], idx[1]);
+        }
 
-                arg.c_element_op_(v_c, v_acc);
+        // computes c_m_n within the tile {{m_begin, m_end}, {n_begin, n_end}} only
+        static void ComputeTile(const Argument& arg, const std::vector<IndexRange>& ranges)
+        {
+            ForEachTileIndex(
+                ranges,
+                [&](const auto& idx) { arg.c_m_n_(idx) = ComputeAt(arg, idx); },
+                std::thread::hardware_concurrency());
+        }
 
-                arg.c_m_n_(m, n) = v_c;
-            };
+        float Run(const Argument& arg)
+        {
+            auto f_mk_kn_mn = [&](auto m, auto n) { arg.c_m_n_(m, n) = ComputeAt(arg, m, n); };
 
             make_ParallelTensorFunctor(
                 f_mk_kn_mn, arg.c_m_n_.mDesc.GetLengths()[0], arg.c_m_n_.mDesc.GetLengths()[1])(
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// Computes c from the GEMM result acc at (g, m, n) in place of c_element_op, for fused epilogues
+// with more operands, e.g. c = c_element_op(acc + bias[n]) + c1[m, n]. g is 0 for GEMMs that are
+// not batched.
+template <typename AccDataType>
+using ReferenceGemmCEpilogue = std::function<void(
+    AccDataType& c, AccDataType acc, std::size_t g, std::size_t m, std::size_t n)>;
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
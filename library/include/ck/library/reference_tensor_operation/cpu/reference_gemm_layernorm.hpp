@@ -0,0 +1,253 @@
+#pragma once
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "device_base.hpp"
+#include "host_tensor.hpp"
+#include "reference_gemm_epilogue.hpp"
+#include "reference_layernorm.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+//
+// @brief      Reference implementation of a GEMM followed by a layernorm of each row of C, as
+//             done by DeviceGemmReduce computing the mean and mean square of the rows followed by
+//             an element-wise Normalize.
+//
+// @paragraph  c[m, n] = c_element_op(sum_k a_element_op(a[m, k]) * b_element_op(b[k, n])) and
+//             y[m, n] = (c[m, n] - E[c[m, :]]) / sqrt(Var[c[m, :]] + epsilon) * gamma[n] +
+//             beta[n], where the statistics and the normalization read c as stored, i.e.
+//             converted to CDataType. Missing gamma and beta stand for 1 and 0.
+//
+// @paragraph  Run() computes one row of C at a time, in parallel, and accumulates each value into
+//             the statistics of the row by reduce::Welford as it is produced by the epilogue,
+//             then normalizes the row while it is still in cache.
+//
+template <typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename YDataType,
+          typename AccDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CElementwiseOperation>
+struct ReferenceGemmLayernorm : public device::BaseOperator
+{
+    // called with g = 0, as ReferenceGemmReduce does for a GEMM that is not batched
+    using CEpilogue = ReferenceGemmCEpilogue<AccDataType>;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<ADataType>& a_m_k,
+                 const Tensor<BDataType>& b_k_n,
+                 Tensor<CDataType>& c_m_n,
+                 const Tensor<GammaDataType>* p_gamma_n,
+                 const Tensor<BetaDataType>* p_beta_n,
+                 Tensor<YDataType>& y_m_n,
+                 AElementwiseOperation a_element_op,
+                 BElementwiseOperation b_element_op,
+                 CElementwiseOperation c_element_op,
+                 AccDataType epsilon,
+                 CEpilogue c_epilogue)
+            : a_m_k_{a_m_k},
+              b_k_n_{b_k_n},
+              c_m_n_{c_m_n},
+              p_gamma_n_{p_gamma_n},
+              p_beta_n_{p_beta_n},
+              y_m_n_{y_m_n},
+              a_element_op_{a_element_op},
+              b_element_op_{b_element_op},
+              c_element_op_{c_element_op},
+              epsilon_{epsilon},
+              c_epilogue_{c_epilogue}
+        {
+            const auto& a_lengths = a_m_k_.mDesc.GetLengths();
+            const auto& b_lengths = b_k_n_.mDesc.GetLengths();
+            const auto& c_lengths = c_m_n_.mDesc.GetLengths();
+
+            if(a_lengths.size() != 2 || b_lengths.size() != 2 || c_lengths.size() != 2 ||
+               a_lengths[1] != b_lengths[0] || a_lengths[0] != c_lengths[0] ||
+               b_lengths[1] != c_lengths[1])
+            {
+                throw std::runtime_error("wrong! inconsistent GEMM lengths");
+            }
+
+            const std::vector<std::size_t> n_lengths{c_lengths[1]};
+
+            if(y_m_n_.mDesc.GetLengths() != c_lengths ||
+               (p_gamma_n_ && p_gamma_n_->mDesc.GetLengths() != n_lengths) ||
+               (p_beta_n_ && p_beta_n_->mDesc.GetLengths() != n_lengths))
+            {
+                throw std::runtime_error("wrong! Y, gamma and beta lengths do not match C");
+            }
+        }
+
+        const Tensor<ADataType>& a_m_k_;
+        const Tensor<BDataType>& b_k_n_;
+        Tensor<CDataType>& c_m_n_;
+        const Tensor<GammaDataType>* p_gamma_n_;
+        const Tensor<BetaDataType>* p_beta_n_;
+        Tensor<YDataType>& y_m_n_;
+
+        AElementwiseOperation a_element_op_;
+        BElementwiseOperation b_element_op_;
+        CElementwiseOperation c_element_op_;
+        AccDataType epsilon_;
+        CEpilogue c_epilogue_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceGemmLayernorm::Argument;
+
+        static void ComputeRow(const Argument& arg, std::size_t m)
+        {
+            const std::size_t N = arg.c_m_n_.mDesc.GetLengths()[1];
+            const std::size_t K = arg.a_m_k_.mDesc.GetLengths()[1];
+
+            // accumulating along k for every n sums in the same order as ReferenceGemm
+            std::vector<AccDataType> acc_row(N, 0);
+
+            for(std::size_t k = 0; k < K; ++k)
+            {
+                AccDataType v_a;
+
+                arg.a_element_op_(v_a, static_cast<const AccDataType>(arg.a_m_k_(m, k)));
+
+                for(std::size_t n = 0; n < N; ++n)
+                {
+                    AccDataType v_b;
+
+                    arg.b_element_op_(v_b, static_cast<const AccDataType>(arg.b_k_n_(k, n)));
+
+                    acc_row[n] += v_a * v_b;
+                }
+            }
+
+            ck::reduce::WelfordState<AccDataType> welford;
+
+            for(std::size_t n = 0; n < N; ++n)
+            {
+                AccDataType v_c;
+
+                if(arg.c_epilogue_)
+                {
+                    arg.c_epilogue_(v_c, acc_row[n], 0, m, n);
+                }
+                else
+                {
+                    arg.c_element_op_(v_c, acc_row[n]);
+                }
+
+                const CDataType c = ck::type_convert<CDataType>(v_c);
+
+                arg.c_m_n_(m, n) = c;
+
+                // the row of acc is reused for c as stored
+                acc_row[n] = ck::type_convert<AccDataType>(c);
+
+                ck::reduce::Welford{}(welford, acc_row[n]);
+            }
+
+            const AccDataType mean  = welford.GetMean();
+            const AccDataType scale =
+                AccDataType{1} / std::sqrt(welford.GetVariance() + arg.epsilon_);
+
+            for(std::size_t n = 0; n < N; ++n)
+            {
+                const AccDataType gamma =
+                    arg.p_gamma_n_ ? ck::type_convert<AccDataType>((*arg.p_gamma_n_)(n))
+                                   : AccDataType{1};
+                const AccDataType beta =
+                    arg.p_beta_n_ ? ck::type_convert<AccDataType>((*arg.p_beta_n_)(n))
+                                  : AccDataType{0};
+
+                arg.y_m_n_(m, n) =
+                    ck::type_convert<YDataType>((acc_row[n] - mean) * scale * gamma + beta);
+            }
+        }
+
+        float Run(const Argument& arg)
+        {
+            auto f_m = [&](auto m) { ComputeRow(arg, m); };
+
+            make_ParallelTensorFunctor(f_m, arg.c_m_n_.mDesc.GetLengths()[0])(
+                std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    // p_gamma_n and p_beta_n may be nullptr
+    static auto MakeArgument(const Tensor<ADataType>& a_m_k,
+                             const Tensor<BDataType>& b_k_n,
+                             Tensor<CDataType>& c_m_n,
+                             const Tensor<GammaDataType>* p_gamma_n,
+                             const Tensor<BetaDataType>* p_beta_n,
+                             Tensor<YDataType>& y_m_n,
+                             AElementwiseOperation a_element_op,
+                             BElementwiseOperation b_element_op,
+                             CElementwiseOperation c_element_op,
+                             AccDataType epsilon,
+                             CEpilogue c_epilogue = CEpilogue{})
+    {
+        return Argument{a_m_k,
+                        b_k_n,
+                        c_m_n,
+                        p_gamma_n,
+                        p_beta_n,
+                        y_m_n,
+                        a_element_op,
+                        b_element_op,
+                        c_element_op,
+                        epsilon,
+                        c_epilogue};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceGemmLayernorm"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,323 @@
+#pragma once
+
+#include <array>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "device_base.hpp"
+#include "functional2.hpp"
+#include "host_tensor.hpp"
+#include "reference_gemm_epilogue.hpp"
+#include "tuple.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+//
+// @brief      Reference implementation for GEMM followed by reductions of each row of C, as done
+//             by DeviceGemmReduce and DeviceBatchedGemmReduce.
+//
+// @paragraph  c[g, m, n] = c_element_op(sum_k a_element_op(a[g, m, k]) * b_element_op(b[g, k, n]))
+//             and, for each D tensor i,
+//             d_i[g, m] = out_op_i(reduce_op_i over n of in_op_i(c[g, m, n])),
+//             where the reductions read c as stored, i.e. converted to CDataType. The tensors are
+//             either batched, (G, M, K), (G, K, N), (G, M, N) and (G, M), or not, (M, K), (K, N),
+//             (M, N) and (M).
+//
+// @paragraph  Run() computes one row of C at a time and reduces it into all D tensors while it is
+//             still in cache, instead of reducing a complete C tensor afterwards.
+//
+// @tparam     DxsReduceOp       Tuple of the reduce operations, e.g. ck::Tuple<reduce::Add>.
+// @tparam     DxsInElementOps   Tuple of the element-wise operations applied to c before each
+//                               reduction.
+// @tparam     DxsOutElementOps  Tuple of the element-wise operations applied to each reduced value.
+//
+template <typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AccDataType,
+          typename ReduceAccDataType,
+          typename DDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CElementwiseOperation,
+          typename DxsReduceOp,
+          typename DxsInElementOps,
+          typename DxsOutElementOps>
+struct ReferenceGemmReduce : public device::BaseOperator
+{
+    static constexpr index_t NumDTensor = DxsReduceOp::Size();
+
+    static_assert(DxsInElementOps::Size() == NumDTensor && DxsOutElementOps::Size() == NumDTensor,
+                  "wrong! inconsistent number of D tensors");
+
+    using CEpilogue = ReferenceGemmCEpilogue<AccDataType>;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<ADataType>& a_g_m_k,
+                 const Tensor<BDataType>& b_g_k_n,
+                 Tensor<CDataType>& c_g_m_n,
+                 std::array<Tensor<DDataType>*, NumDTensor> dxs_g_m,
+                 AElementwiseOperation a_element_op,
+                 BElementwiseOperation b_element_op,
+                 CElementwiseOperation c_element_op,
+                 DxsInElementOps dxs_in_element_ops,
+                 DxsOutElementOps dxs_out_element_ops,
+                 CEpilogue c_epilogue)
+            : a_g_m_k_{a_g_m_k},
+              b_g_k_n_{b_g_k_n},
+              c_g_m_n_{c_g_m_n},
+              dxs_g_m_{dxs_g_m},
+              a_element_op_{a_element_op},
+              b_element_op_{b_element_op},
+              c_element_op_{c_element_op},
+              dxs_in_element_ops_{dxs_in_element_ops},
+              dxs_out_element_ops_{dxs_out_element_ops},
+              c_epilogue_{c_epilogue}
+        {
+            const auto& a_lengths = a_g_m_k_.mDesc.GetLengths();
+            const auto& b_lengths = b_g_k_n_.mDesc.GetLengths();
+            const auto& c_lengths = c_g_m_n_.mDesc.GetLengths();
+
+            const std::size_t rank = c_lengths.size();
+
+            if((rank != 2 && rank != 3) || a_lengths.size() != rank || b_lengths.size() != rank)
+            {
+                throw std::runtime_error("wrong! A, B and C are not all (G, M, N) or (M, N)");
+            }
+
+            const bool is_batched = rank == 3;
+
+            G_ = is_batched ? c_lengths[0] : 1;
+            M_ = c_lengths[rank - 2];
+            N_ = c_lengths[rank - 1];
+            K_ = a_lengths[rank - 1];
+
+            if((is_batched && (a_lengths[0] != G_ || b_lengths[0] != G_)) ||
+               a_lengths[rank - 2] != M_ || b_lengths[rank - 2] != K_ || b_lengths[rank - 1] != N_)
+            {
+                throw std::runtime_error("wrong! inconsistent GEMM lengths");
+            }
+
+            for(const auto p_d : dxs_g_m_)
+            {
+                const auto& d_lengths = p_d->mDesc.GetLengths();
+
+                if(d_lengths.size() != rank - 1 || d_lengths.back() != M_ ||
+                   (is_batched && d_lengths[0] != G_))
+                {
+                    throw std::runtime_error("wrong! D lengths do not match C");
+                }
+            }
+
+            a_strides_ = GetStrides(a_g_m_k_.mDesc);
+            b_strides_ = GetStrides(b_g_k_n_.mDesc);
+            c_strides_ = GetStrides(c_g_m_n_.mDesc);
+
+            for(index_t i = 0; i < NumDTensor; ++i)
+            {
+                const auto& d_strides = dxs_g_m_[i]->mDesc.GetStrides();
+
+                dxs_strides_[i] = {is_batched ? d_strides[0] : 0, d_strides.back()};
+            }
+        }
+
+        const Tensor<ADataType>& a_g_m_k_;
+        const Tensor<BDataType>& b_g_k_n_;
+        Tensor<CDataType>& c_g_m_n_;
+        std::array<Tensor<DDataType>*, NumDTensor> dxs_g_m_;
+
+        AElementwiseOperation a_element_op_;
+        BElementwiseOperation b_element_op_;
+        CElementwiseOperation c_element_op_;
+        DxsInElementOps dxs_in_element_ops_;
+        DxsOutElementOps dxs_out_element_ops_;
+        CEpilogue c_epilogue_;
+
+        std::size_t G_;
+        std::size_t M_;
+        std::size_t N_;
+        std::size_t K_;
+
+        // strides of the (G, row, col) dimensions of A, B and C, and of the (G, M) dimensions
+        // of the D tensors, with a stride of 0 for G if not batched
+        std::array<std::size_t, 3> a_strides_;
+        std::array<std::size_t, 3> b_strides_;
+        std::array<std::size_t, 3> c_strides_;
+        std::array<std::array<std::size_t, 2>, NumDTensor> dxs_strides_;
+
+        private:
+        static std::array<std::size_t, 3> GetStrides(const HostTensorDescriptor& desc)
+        {
+            const auto& strides = desc.GetStrides();
+
+            if(strides.size() == 3)
+            {
+                return {strides[0], strides[1], strides[2]};
+            }
+
+            return {0, strides[0], strides[1]};
+        }
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceGemmReduce::Argument;
+
+        float Run(const Argument& arg)
+        {
+            auto f_gm = [&](auto g, auto m) {
+                const std::size_t N = arg.N_;
+                const std::size_t K = arg.K_;
+
+                const auto& as = arg.a_strides_;
+                const auto& bs = arg.b_strides_;
+                const auto& cs = arg.c_strides_;
+
+                // accumulating along k for every n sums in the same order as ReferenceGemm
+                std::vector<AccDataType> acc_row(N, 0);
+
+                for(std::size_t k = 0; k < K; ++k)
+                {
+                    AccDataType v_a;
+
+                    arg.a_element_op_(
+                        v_a,
+                        static_cast<const AccDataType>(
+                            arg.a_g_m_k_.mData[g * as[0] + m * as[1] + k * as[2]]));
+
+                    for(std::size_t n = 0; n < N; ++n)
+                    {
+                        AccDataType v_b;
+
+                        arg.b_element_op_(
+                            v_b,
+                            static_cast<const AccDataType>(
+                                arg.b_g_k_n_.mData[g * bs[0] + k * bs[1] + n * bs[2]]));
+
+                        acc_row[n] += v_a * v_b;
+                    }
+                }
+
+                std::vector<CDataType> c_row(N);
+
+                for(std::size_t n = 0; n < N; ++n)
+                {
+                    AccDataType v_c;
+
+                    if(arg.c_epilogue_)
+                    {
+                        arg.c_epilogue_(v_c, acc_row[n], g, m, n);
+                    }
+                    else
+                    {
+                        arg.c_element_op_(v_c, acc_row[n]);
+                    }
+
+                    c_row[n] = ck::type_convert<CDataType>(v_c);
+
+                    arg.c_g_m_n_.mData[g * cs[0] + m * cs[1] + n * cs[2]] = c_row[n];
+                }
+
+                const auto dxs_reduce_op = DxsReduceOp{};
+
+                static_for<0, NumDTensor, 1>{}([&](auto I) {
+                    const auto& reduce_op = dxs_reduce_op[I];
+
+                    using DReduceOp = remove_cvref_t<decltype(reduce_op)>;
+
+                    auto d_acc = DReduceOp::template GetIdentityValue<ReduceAccDataType>();
+
+                    for(std::size_t n = 0; n < N; ++n)
+                    {
+                        const auto c_val = ck::type_convert<ReduceAccDataType>(c_row[n]);
+
+                        ReduceAccDataType d_val;
+
+                        arg.dxs_in_element_ops_[I](d_val, c_val);
+
+                        reduce_op(d_acc, d_val);
+                    }
+
+                    arg.dxs_out_element_ops_[I](d_acc, d_acc);
+
+                    const auto& ds = arg.dxs_strides_[I];
+
+                    arg.dxs_g_m_[I]->mData[g * ds[0] + m * ds[1]] =
+                        ck::type_convert<DDataType>(d_acc);
+                });
+            };
+
+            make_ParallelTensorFunctor(f_gm, arg.G_, arg.M_)(std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const Tensor<ADataType>& a_g_m_k,
+                             const Tensor<BDataType>& b_g_k_n,
+                             Tensor<CDataType>& c_g_m_n,
+                             std::array<Tensor<DDataType>*, NumDTensor> dxs_g_m,
+                             AElementwiseOperation a_element_op,
+                             BElementwiseOperation b_element_op,
+                             CElementwiseOperation c_element_op,
+                             DxsInElementOps dxs_in_element_ops,
+                             DxsOutElementOps dxs_out_element_ops,
+                             CEpilogue c_epilogue = CEpilogue{})
+    {
+        return Argument{a_g_m_k,
+                        b_g_k_n,
+                        c_g_m_n,
+                        dxs_g_m,
+                        a_element_op,
+                        b_element_op,
+                        c_element_op,
+                        dxs_in_element_ops,
+                        dxs_out_element_ops,
+                        c_epilogue};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceGemmReduce"
+            << "<" << NumDTensor << ">"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
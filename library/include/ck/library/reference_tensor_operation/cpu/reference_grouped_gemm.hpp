@@ -0,0 +1,315 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include "device_base.hpp"
+#include "device_gemm.hpp"
+#include "host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+//
+// @brief      Reference implementation of a grouped GEMM, as done by DeviceGroupedGemm, where
+//             c_g_m_n[g] = c_element_op(a_element_op(a_g_m_k[g]) * b_element_op(b_g_k_n[g])) for
+//             each group g, with its own M, N and K.
+//
+// @paragraph  The output tiles of all groups form a single list of tasks, which is split into one
+//             contiguous range per thread, for locality. A thread which is done with its range
+//             steals the remaining tiles of the other threads, one at a time, so that neither many
+//             small groups nor one large group serialize the work. Each element is computed in
+//             the same order as by ReferenceGemm, so results are identical to one ReferenceGemm
+//             per group.
+//
+template <typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AccDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CElementwiseOperation>
+struct ReferenceGroupedGemm : public device::BaseOperator
+{
+    // lengths of an output tile, the unit of work
+    static constexpr std::size_t MPerTile = 32;
+    static constexpr std::size_t NPerTile = 32;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const std::vector<Tensor<ADataType>>& a_g_m_k,
+                 const std::vector<Tensor<BDataType>>& b_g_k_n,
+                 std::vector<Tensor<CDataType>>& c_g_m_n,
+                 AElementwiseOperation a_element_op,
+                 BElementwiseOperation b_element_op,
+                 CElementwiseOperation c_element_op)
+            : a_g_m_k_{a_g_m_k},
+              b_g_k_n_{b_g_k_n},
+              c_g_m_n_{c_g_m_n},
+              a_element_op_{a_element_op},
+              b_element_op_{b_element_op},
+              c_element_op_{c_element_op}
+        {
+            const std::size_t group_count = c_g_m_n_.size();
+
+            if(a_g_m_k_.size() != group_count || b_g_k_n_.size() != group_count)
+            {
+                throw std::runtime_error("wrong! inconsistent number of groups");
+            }
+
+            tile_offsets_.push_back(0);
+
+            for(std::size_t g = 0; g < group_count; ++g)
+            {
+                const auto& a_lengths = a_g_m_k_[g].mDesc.GetLengths();
+                const auto& b_lengths = b_g_k_n_[g].mDesc.GetLengths();
+                const auto& c_lengths = c_g_m_n_[g].mDesc.GetLengths();
+
+                if(a_lengths.size() != 2 || b_lengths.size() != 2 || c_lengths.size() != 2 ||
+                   a_lengths[1] != b_lengths[0] || a_lengths[0] != c_lengths[0] ||
+                   b_lengths[1] != c_lengths[1])
+                {
+                    throw std::runtime_error("wrong! inconsistent GEMM lengths in group " +
+                                             std::to_string(g));
+                }
+
+                const std::size_t num_tile_m = (c_lengths[0] + MPerTile - 1) / MPerTile;
+                const std::size_t num_tile_n = (c_lengths[1] + NPerTile - 1) / NPerTile;
+
+                num_tile_n_.push_back(num_tile_n);
+                tile_offsets_.push_back(tile_offsets_.back() + num_tile_m * num_tile_n);
+            }
+        }
+
+        const std::vector<Tensor<ADataType>>& a_g_m_k_;
+        const std::vector<Tensor<BDataType>>& b_g_k_n_;
+        std::vector<Tensor<CDataType>>& c_g_m_n_;
+
+        AElementwiseOperation a_element_op_;
+        BElementwiseOperation b_element_op_;
+        CElementwiseOperation c_element_op_;
+
+        // number of tiles along N of each group, and index of the first tile of each group
+        // followed by the total number of tiles
+        std::vector<std::size_t> num_tile_n_;
+        std::vector<std::size_t> tile_offsets_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceGroupedGemm::Argument;
+
+        // value of c_g_m_n[g](m, n), computed without writing c_g_m_n
+        static CDataType ComputeAt(const Argument& arg, std::size_t g, std::size_t m, std::size_t n)
+        {
+            const auto& a_m_k = arg.a_g_m_k_[g];
+            const auto& b_k_n = arg.b_g_k_n_[g];
+
+            const std::size_t K = a_m_k.mDesc.GetLengths()[1];
+
+            AccDataType v_acc = 0;
+
+            for(std::size_t k = 0; k < K; ++k)
+            {
+                AccDataType v_a;
+                AccDataType v_b;
+
+                arg.a_element_op_(v_a, static_cast<const AccDataType>(a_m_k(m, k)));
+                arg.b_element_op_(v_b, static_cast<const AccDataType>(b_k_n(k, n)));
+
+                v_acc += v_a * v_b;
+            }
+
+            AccDataType v_c;
+
+            arg.c_element_op_(v_c, v_acc);
+
+            return v_c;
+        }
+
+        // idx: {g, m, n}
+        static CDataType ComputeAt(const Argument& arg, const std::vector<std::size_t>& idx)
+        {
+            return ComputeAt(arg, idx[0], idx[1], idx[2]);
+        }
+
+        // computes the tile of index tile among the tiles of all groups
+        static void ComputeTile(const Argument& arg, std::size_t tile)
+        {
+            const auto& tile_offsets = arg.tile_offsets_;
+
+            const std::size_t g =
+                std::upper_bound(tile_offsets.begin(), tile_offsets.end(), tile) -
+                tile_offsets.begin() - 1;
+
+            const std::size_t tile_in_group = tile - tile_offsets[g];
+
+            auto& c_m_n = arg.c_g_m_n_[g];
+
+            const std::size_t M = c_m_n.mDesc.GetLengths()[0];
+            const std::size_t N = c_m_n.mDesc.GetLengths()[1];
+
+            const std::size_t m_begin = tile_in_group / arg.num_tile_n_[g] * MPerTile;
+            const std::size_t n_begin = tile_in_group % arg.num_tile_n_[g] * NPerTile;
+            const std::size_t m_end   = std::min(m_begin + MPerTile, M);
+            const std::size_t n_end   = std::min(n_begin + NPerTile, N);
+
+            for(std::size_t m = m_begin; m < m_end; ++m)
+            {
+                for(std::size_t n = n_begin; n < n_end; ++n)
+                {
+                    c_m_n(m, n) = ComputeAt(arg, g, m, n);
+                }
+            }
+        }
+
+        float Run(const Argument& arg, std::size_t num_thread)
+        {
+            const std::size_t num_tile = arg.tile_offsets_.back();
+
+            num_thread = std::max<std::size_t>(std::min(num_thread, num_tile), 1);
+
+            // range of tiles [next, end) left to each thread, where the owner and the thieves
+            // both claim tiles with an atomic increment of next
+            struct alignas(64) TileRange
+            {
+                std::atomic<std::size_t> next;
+                std::size_t end;
+            };
+
+            std::unique_ptr<TileRange[]> ranges(new TileRange[num_thread]);
+
+            for(std::size_t it = 0; it < num_thread; ++it)
+            {
+                ranges[it].next = it * num_tile / num_thread;
+                ranges[it].end  = (it + 1) * num_tile / num_thread;
+            }
+
+            auto f_thread = [&](std::size_t it) {
+                for(std::size_t i = 0; i < num_thread; ++i)
+                {
+                    // own range first, then the ranges of the next threads
+                    TileRange& range = ranges[(it + i) % num_thread];
+
+                    for(std::size_t tile = range.next++; tile < range.end; tile = range.next++)
+                    {
+                        ComputeTile(arg, tile);
+                    }
+                }
+            };
+
+            {
+                std::vector<joinable_thread> threads(num_thread);
+
+                for(std::size_t it = 0; it < num_thread; ++it)
+                {
+                    threads[it] = joinable_thread(f_thread, it);
+                }
+            }
+
+            return 0;
+        }
+
+        float Run(const Argument& arg) { return Run(arg, std::thread::hardware_concurrency()); }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const std::vector<Tensor<ADataType>>& a_g_m_k,
+                             const std::vector<Tensor<BDataType>>& b_g_k_n,
+                             std::vector<Tensor<CDataType>>& c_g_m_n,
+                             AElementwiseOperation a_element_op,
+                             BElementwiseOperation b_element_op,
+                             CElementwiseOperation c_element_op)
+    {
+        return Argument{a_g_m_k, b_g_k_n, c_g_m_n, a_element_op, b_element_op, c_element_op};
+    }
+
+    // gemm_shapes: as passed to DeviceGroupedGemm::MakeArgumentPointer, checked against the
+    // lengths and strides of the tensors of each group
+    static auto MakeArgument(const std::vector<device::GemmShape>& gemm_shapes,
+                             const std::vector<Tensor<ADataType>>& a_g_m_k,
+                             const std::vector<Tensor<BDataType>>& b_g_k_n,
+                             std::vector<Tensor<CDataType>>& c_g_m_n,
+                             AElementwiseOperation a_element_op,
+                             BElementwiseOperation b_element_op,
+                             CElementwiseOperation c_element_op)
+    {
+        // row-major {stride, 1} or column-major {1, stride}
+        auto is_matrix = [](const HostTensorDescriptor& desc,
+                            ck::index_t row,
+                            ck::index_t col,
+                            ck::index_t stride) {
+            const auto& lengths = desc.GetLengths();
+            const auto& strides = desc.GetStrides();
+
+            return lengths.size() == 2 && lengths[0] == static_cast<std::size_t>(row) &&
+                   lengths[1] == static_cast<std::size_t>(col) &&
+                   ((strides[0] == static_cast<std::size_t>(stride) && strides[1] == 1) ||
+                    (strides[0] == 1 && strides[1] == static_cast<std::size_t>(stride)));
+        };
+
+        if(gemm_shapes.size() != c_g_m_n.size())
+        {
+            throw std::runtime_error("wrong! inconsistent number of groups");
+        }
+
+        for(std::size_t g = 0; g < gemm_shapes.size(); ++g)
+        {
+            const auto& shape = gemm_shapes[g];
+
+            if(g >= a_g_m_k.size() || g >= b_g_k_n.size() ||
+               !is_matrix(a_g_m_k[g].mDesc, shape.M, shape.K, shape.StrideA) ||
+               !is_matrix(b_g_k_n[g].mDesc, shape.K, shape.N, shape.StrideB) ||
+               !is_matrix(c_g_m_n[g].mDesc, shape.M, shape.N, shape.StrideC))
+            {
+                throw std::runtime_error("wrong! tensors do not match GEMM shape of group " +
+                                         std::to_string(g));
+            }
+        }
+
+        return MakeArgument(a_g_m_k, b_g_k_n, c_g_m_n, a_element_op, b_element_op, c_element_op);
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceGroupedGemm"
+            << "<" << MPerTile << ", " << NPerTile << ">"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,274 @@
+#pragma once
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "device_base.hpp"
+#include "host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+//
+// @brief      Reference implementation of an integer GEMM, e.g. int8 x int8 -> int32, with a
+//             requantization epilogue, as done by DeviceGemm_Xdl_CShuffle with integer inputs.
+//
+// @paragraph  acc[m, n] = sum_k a[m, k] * b[k, n], exactly, in AccDataType. Like on the device,
+//             acc is then converted to CShuffleDataType, optionally multiplied by a per-channel
+//             scale[n], passed through c_element_op (e.g. scale, relu and clamp, per tensor) and
+//             converted to CDataType with type_convert, so that results match bit for bit.
+//
+// @paragraph  Run() packs B once into panels of NPerPanel columns, with each group of 4
+//             consecutive k of a column stored together, as for VNNI dot product instructions,
+//             and computes each row of C as 4-way integer dot products over the panels.
+//
+template <typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AccDataType,
+          typename CShuffleDataType,
+          typename CElementwiseOperation>
+struct ReferenceIntegerGemm : public device::BaseOperator
+{
+    static_assert(std::is_integral<ADataType>::value && std::is_integral<BDataType>::value &&
+                      std::is_integral<AccDataType>::value,
+                  "wrong! ReferenceIntegerGemm needs integer A, B and accumulation");
+
+    // number of columns of B in a packed panel, and number of k in a dot product
+    static constexpr std::size_t NPerPanel = 64;
+    static constexpr std::size_t KPerDot   = 4;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<ADataType>& a_m_k,
+                 const Tensor<BDataType>& b_k_n,
+                 Tensor<CDataType>& c_m_n,
+                 CElementwiseOperation c_element_op,
+                 std::vector<CShuffleDataType> scale_n)
+            : a_m_k_{a_m_k},
+              b_k_n_{b_k_n},
+              c_m_n_{c_m_n},
+              c_element_op_{c_element_op},
+              scale_n_{std::move(scale_n)}
+        {
+            const auto& a_lengths = a_m_k_.mDesc.GetLengths();
+            const auto& b_lengths = b_k_n_.mDesc.GetLengths();
+            const auto& c_lengths = c_m_n_.mDesc.GetLengths();
+
+            if(a_lengths.size() != 2 || b_lengths.size() != 2 || c_lengths.size() != 2 ||
+               a_lengths[1] != b_lengths[0] || a_lengths[0] != c_lengths[0] ||
+               b_lengths[1] != c_lengths[1])
+            {
+                throw std::runtime_error("wrong! inconsistent GEMM lengths");
+            }
+
+            if(!scale_n_.empty() && scale_n_.size() != c_lengths[1])
+            {
+                throw std::runtime_error("wrong! number of scales is not N");
+            }
+        }
+
+        const Tensor<ADataType>& a_m_k_;
+        const Tensor<BDataType>& b_k_n_;
+        Tensor<CDataType>& c_m_n_;
+
+        CElementwiseOperation c_element_op_;
+
+        // per-channel scales, empty if only c_element_op scales
+        std::vector<CShuffleDataType> scale_n_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceIntegerGemm::Argument;
+
+        // the epilogue, on the exact accumulation of c_m_n(m, n)
+        static CDataType Requantize(const Argument& arg, AccDataType v_acc, std::size_t n)
+        {
+            CShuffleDataType v_c = ck::type_convert<CShuffleDataType>(v_acc);
+
+            if(!arg.scale_n_.empty())
+            {
+                v_c = arg.scale_n_[n] * v_c;
+            }
+
+            CShuffleDataType v_out;
+
+            arg.c_element_op_(v_out, v_c);
+
+            return ck::type_convert<CDataType>(v_out);
+        }
+
+        // value of c_m_n(m, n), computed without writing c_m_n
+        static CDataType ComputeAt(const Argument& arg, std::size_t m, std::size_t n)
+        {
+            const std::size_t K = arg.a_m_k_.mDesc.GetLengths()[1];
+
+            AccDataType v_acc = 0;
+
+            for(std::size_t k = 0; k < K; ++k)
+            {
+                v_acc += static_cast<AccDataType>(arg.a_m_k_(m, k)) *
+                         static_cast<AccDataType>(arg.b_k_n_(k, n));
+            }
+
+            return Requantize(arg, v_acc, n);
+        }
+
+        // idx: {m, n}
+        static CDataType ComputeAt(const Argument& arg, const std::vector<std::size_t>& idx)
+        {
+            return ComputeAt(arg, idx[0], idx[1]);
+        }
+
+        // B as panels of NPerPanel columns, each stored as (K / KPerDot, NPerPanel, KPerDot),
+        // with K padded with zeros to a multiple of KPerDot
+        static std::vector<BDataType> PackB(const Argument& arg, std::size_t K_padded)
+        {
+            const std::size_t K         = arg.b_k_n_.mDesc.GetLengths()[0];
+            const std::size_t N         = arg.b_k_n_.mDesc.GetLengths()[1];
+            const std::size_t num_panel = (N + NPerPanel - 1) / NPerPanel;
+
+            std::vector<BDataType> b_panels(num_panel * K_padded * NPerPanel, 0);
+
+            for(std::size_t k = 0; k < K; ++k)
+            {
+                for(std::size_t n = 0; n < N; ++n)
+                {
+                    const std::size_t p = n / NPerPanel;
+                    const std::size_t i =
+                        ((p * (K_padded / KPerDot) + k / KPerDot) * NPerPanel + n % NPerPanel) *
+                            KPerDot +
+                        k % KPerDot;
+
+                    b_panels[i] = arg.b_k_n_(k, n);
+                }
+            }
+
+            return b_panels;
+        }
+
+        // acc[n] = sum over k of a[k] * b_panel[k][n], for the first nw columns of a panel
+        static void PanelDot(const ADataType* a,
+                             const BDataType* b_panel,
+                             AccDataType* acc,
+                             std::size_t K_padded,
+                             std::size_t nw)
+        {
+            std::fill(acc, acc + nw, 0);
+
+            for(std::size_t k0 = 0; k0 < K_padded; k0 += KPerDot)
+            {
+                const AccDataType a0 = a[k0];
+                const AccDataType a1 = a[k0 + 1];
+                const AccDataType a2 = a[k0 + 2];
+                const AccDataType a3 = a[k0 + 3];
+
+                const BDataType* b_k = b_panel + k0 * NPerPanel;
+
+                for(std::size_t n = 0; n < nw; ++n)
+                {
+                    const BDataType* b = b_k + n * KPerDot;
+
+                    acc[n] += a0 * static_cast<AccDataType>(b[0]) +
+                              a1 * static_cast<AccDataType>(b[1]) +
+                              a2 * static_cast<AccDataType>(b[2]) +
+                              a3 * static_cast<AccDataType>(b[3]);
+                }
+            }
+        }
+
+        float Run(const Argument& arg)
+        {
+            const std::size_t M         = arg.c_m_n_.mDesc.GetLengths()[0];
+            const std::size_t N         = arg.c_m_n_.mDesc.GetLengths()[1];
+            const std::size_t K         = arg.a_m_k_.mDesc.GetLengths()[1];
+            const std::size_t K_padded  = (K + KPerDot - 1) / KPerDot * KPerDot;
+            const std::size_t num_panel = (N + NPerPanel - 1) / NPerPanel;
+
+            const auto b_panels = PackB(arg, K_padded);
+
+            auto f_m = [&](auto m) {
+                std::vector<ADataType> a(K_padded, 0);
+                std::vector<AccDataType> acc(NPerPanel);
+
+                for(std::size_t k = 0; k < K; ++k)
+                {
+                    a[k] = arg.a_m_k_(m, k);
+                }
+
+                for(std::size_t p = 0; p < num_panel; ++p)
+                {
+                    const std::size_t n_begin = p * NPerPanel;
+                    const std::size_t nw      = std::min(NPerPanel, N - n_begin);
+
+                    PanelDot(a.data(),
+                             &b_panels[p * K_padded * NPerPanel],
+                             acc.data(),
+                             K_padded,
+                             nw);
+
+                    for(std::size_t n = 0; n < nw; ++n)
+                    {
+                        arg.c_m_n_(m, n_begin + n) = Requantize(arg, acc[n], n_begin + n);
+                    }
+                }
+            };
+
+            make_ParallelTensorFunctor(f_m, M)(std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const Tensor<ADataType>& a_m_k,
+                             const Tensor<BDataType>& b_k_n,
+                             Tensor<CDataType>& c_m_n,
+                             CElementwiseOperation c_element_op,
+                             std::vector<CShuffleDataType> scale_n = {})
+    {
+        return Argument{a_m_k, b_k_n, c_m_n, c_element_op, std::move(scale_n)};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceIntegerGemm"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,380 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "device_base.hpp"
+#include "host_tensor.hpp"
+#include "reduction_operator.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+enum struct NormalizationType
+{
+    Layernorm, // y = (h - E[h]) / sqrt(Var[h] + epsilon) * gamma + beta
+    Rmsnorm    // y = h / sqrt(E[h^2] + epsilon) * gamma + beta
+};
+
+//
+// @brief      Reference implementation of layernorm and RMSnorm over any set of normalized
+//             dimensions, with an optional residual added to the input and optional gamma and
+//             beta, where h = x + residual and y is given by NormalizationType.
+//
+// @paragraph  The dimensions not normalized index the rows, whose elements are the indices of
+//             the normalized dimensions. Rows are processed in parallel, each in a single pass
+//             over the inputs: h is computed, written to sum if given, as the input of the next
+//             residual add, kept in a buffer of AccDataType and accumulated into the statistics
+//             by reduce::Welford, then the buffer is normalized.
+//
+// @paragraph  gamma and beta have the lengths of the normalized dimensions, in the order of
+//             norm_dims, e.g. (N) for x of (M, N) normalized over dimension 1. Missing gamma
+//             and beta stand for 1 and 0.
+//
+template <typename XDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename YDataType,
+          typename AccDataType,
+          NormalizationType NormType>
+struct ReferenceNormalization : public device::BaseOperator
+{
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<XDataType>& x,
+                 const Tensor<XDataType>* p_residual,
+                 const Tensor<GammaDataType>* p_gamma,
+                 const Tensor<BetaDataType>* p_beta,
+                 Tensor<YDataType>& y,
+                 Tensor<XDataType>* p_sum,
+                 const std::vector<index_t>& norm_dims,
+                 AccDataType epsilon)
+            : x_{x},
+              p_residual_{p_residual},
+              p_gamma_{p_gamma},
+              p_beta_{p_beta},
+              y_{y},
+              p_sum_{p_sum},
+              norm_dims_{norm_dims},
+              epsilon_{epsilon}
+        {
+            const auto& lengths = x_.mDesc.GetLengths();
+            const index_t rank  = lengths.size();
+
+            auto is_same_lengths = [&](const HostTensorDescriptor& desc) {
+                return desc.GetLengths() == lengths;
+            };
+
+            if(!is_same_lengths(y_.mDesc) ||
+               (p_residual_ && !is_same_lengths(p_residual_->mDesc)) ||
+               (p_sum_ && !is_same_lengths(p_sum_->mDesc)))
+            {
+                throw std::runtime_error("wrong! x, residual, sum and y lengths differ");
+            }
+
+            std::vector<bool> is_norm_dim(rank, false);
+
+            for(index_t dim : norm_dims_)
+            {
+                if(dim < 0 || dim >= rank || is_norm_dim[dim])
+                {
+                    throw std::runtime_error("wrong! invalid normalized dimensions");
+                }
+
+                is_norm_dim[dim] = true;
+            }
+
+            std::vector<std::size_t> norm_lengths;
+
+            for(index_t dim : norm_dims_)
+            {
+                norm_lengths.push_back(lengths[dim]);
+            }
+
+            for(index_t dim = 0; dim < rank; ++dim)
+            {
+                if(!is_norm_dim[dim])
+                {
+                    row_dims_.push_back(dim);
+                }
+            }
+
+            if((p_gamma_ && p_gamma_->mDesc.GetLengths() != norm_lengths) ||
+               (p_beta_ && p_beta_->mDesc.GetLengths() != norm_lengths))
+            {
+                throw std::runtime_error("wrong! gamma and beta lengths differ from the "
+                                         "normalized lengths");
+            }
+
+            num_row_ = 1;
+
+            for(index_t dim : row_dims_)
+            {
+                num_row_ *= lengths[dim];
+            }
+
+            // offsets of the elements of a row relative to its first one, in each tensor
+            row_length_ = 1;
+
+            for(auto length : norm_lengths)
+            {
+                row_length_ *= length;
+            }
+
+            std::vector<std::size_t> norm_idx(norm_dims_.size(), 0);
+
+            for(std::size_t j = 0; j < row_length_; ++j)
+            {
+                x_offsets_.push_back(GetOffset(x_.mDesc, norm_dims_, norm_idx));
+                y_offsets_.push_back(GetOffset(y_.mDesc, norm_dims_, norm_idx));
+
+                if(p_residual_)
+                {
+                    residual_offsets_.push_back(
+                        GetOffset(p_residual_->mDesc, norm_dims_, norm_idx));
+                }
+
+                if(p_sum_)
+                {
+                    sum_offsets_.push_back(GetOffset(p_sum_->mDesc, norm_dims_, norm_idx));
+                }
+
+                if(p_gamma_)
+                {
+                    gamma_offsets_.push_back(p_gamma_->mDesc.GetOffsetFromMultiIndex(norm_idx));
+                }
+
+                if(p_beta_)
+                {
+                    beta_offsets_.push_back(p_beta_->mDesc.GetOffsetFromMultiIndex(norm_idx));
+                }
+
+                for(std::size_t i = norm_idx.size(); i-- > 0;)
+                {
+                    if(++norm_idx[i] < norm_lengths[i])
+                    {
+                        break;
+                    }
+
+                    norm_idx[i] = 0;
+                }
+            }
+        }
+
+        // offset in desc of the index which is idx along dims and 0 along the other dimensions
+        static std::size_t GetOffset(const HostTensorDescriptor& desc,
+                                     const std::vector<index_t>& dims,
+                                     const std::vector<std::size_t>& idx)
+        {
+            std::size_t offset = 0;
+
+            for(std::size_t i = 0; i < dims.size(); ++i)
+            {
+                offset += idx[i] * desc.GetStrides()[dims[i]];
+            }
+
+            return offset;
+        }
+
+        const Tensor<XDataType>& x_;
+        const Tensor<XDataType>* p_residual_;
+        const Tensor<GammaDataType>* p_gamma_;
+        const Tensor<BetaDataType>* p_beta_;
+        Tensor<YDataType>& y_;
+        Tensor<XDataType>* p_sum_;
+        std::vector<index_t> norm_dims_;
+        std::vector<index_t> row_dims_;
+        AccDataType epsilon_;
+
+        std::size_t num_row_;
+        std::size_t row_length_;
+
+        std::vector<std::size_t> x_offsets_;
+        std::vector<std::size_t> residual_offsets_;
+        std::vector<std::size_t> sum_offsets_;
+        std::vector<std::size_t> y_offsets_;
+        std::vector<std::size_t> gamma_offsets_;
+        std::vector<std::size_t> beta_offsets_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceNormalization::Argument;
+
+        static void ComputeRow(const Argument& arg, std::size_t row)
+        {
+            const auto& lengths = arg.x_.mDesc.GetLengths();
+
+            std::vector<std::size_t> row_idx(arg.row_dims_.size());
+
+            for(std::size_t i = row_idx.size(); i-- > 0;)
+            {
+                row_idx[i] = row % lengths[arg.row_dims_[i]];
+                row /= lengths[arg.row_dims_[i]];
+            }
+
+            auto get_base = [&](const auto* p_tensor) {
+                return p_tensor ? Argument::GetOffset(p_tensor->mDesc, arg.row_dims_, row_idx) : 0;
+            };
+
+            const std::size_t x_base        = get_base(&arg.x_);
+            const std::size_t residual_base = get_base(arg.p_residual_);
+            const std::size_t sum_base      = get_base(arg.p_sum_);
+            const std::size_t y_base        = get_base(&arg.y_);
+
+            std::vector<AccDataType> h_row(arg.row_length_);
+
+            ck::reduce::WelfordState<AccDataType> welford;
+
+            for(std::size_t j = 0; j < arg.row_length_; ++j)
+            {
+                AccDataType h =
+                    ck::type_convert<AccDataType>(arg.x_.mData[x_base + arg.x_offsets_[j]]);
+
+                if(arg.p_residual_)
+                {
+                    h += ck::type_convert<AccDataType>(
+                        arg.p_residual_->mData[residual_base + arg.residual_offsets_[j]]);
+                }
+
+                if(arg.p_sum_)
+                {
+                    arg.p_sum_->mData[sum_base + arg.sum_offsets_[j]] =
+                        ck::type_convert<XDataType>(h);
+                }
+
+                h_row[j] = h;
+
+                ck::reduce::Welford{}(welford, h);
+            }
+
+            // h is normalized as (h - center) / sqrt(E[(h - center)^2] + epsilon), where the
+            // mean square of RMSnorm is Var[h] + E[h]^2, a sum of non-negative terms
+            constexpr bool is_layernorm = NormType == NormalizationType::Layernorm;
+
+            const AccDataType mean   = welford.GetMean();
+            const AccDataType center = is_layernorm ? mean : AccDataType{0};
+            const AccDataType moment =
+                is_layernorm ? welford.GetVariance() : welford.GetVariance() + mean * mean;
+
+            const AccDataType scale = AccDataType{1} / std::sqrt(moment + arg.epsilon_);
+
+            for(std::size_t j = 0; j < arg.row_length_; ++j)
+            {
+                const AccDataType gamma =
+                    arg.p_gamma_ ? ck::type_convert<AccDataType>(
+                                       arg.p_gamma_->mData[arg.gamma_offsets_[j]])
+                                 : AccDataType{1};
+                const AccDataType beta =
+                    arg.p_beta_ ? ck::type_convert<AccDataType>(
+                                      arg.p_beta_->mData[arg.beta_offsets_[j]])
+                                : AccDataType{0};
+
+                arg.y_.mData[y_base + arg.y_offsets_[j]] =
+                    ck::type_convert<YDataType>((h_row[j] - center) * scale * gamma + beta);
+            }
+        }
+
+        float Run(const Argument& arg)
+        {
+            auto f_row = [&](auto row) { ComputeRow(arg, row); };
+
+            make_ParallelTensorFunctor(f_row, arg.num_row_)(std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    // p_gamma and p_beta may be nullptr
+    static auto MakeArgument(const Tensor<XDataType>& x,
+                             const Tensor<GammaDataType>* p_gamma,
+                             const Tensor<BetaDataType>* p_beta,
+                             Tensor<YDataType>& y,
+                             const std::vector<index_t>& norm_dims,
+                             AccDataType epsilon)
+    {
+        return Argument{x, nullptr, p_gamma, p_beta, y, nullptr, norm_dims, epsilon};
+    }
+
+    // with residual added to x, and the sum written to p_sum if not nullptr
+    static auto MakeArgument(const Tensor<XDataType>& x,
+                             const Tensor<XDataType>& residual,
+                             const Tensor<GammaDataType>* p_gamma,
+                             const Tensor<BetaDataType>* p_beta,
+                             Tensor<YDataType>& y,
+                             Tensor<XDataType>* p_sum,
+                             const std::vector<index_t>& norm_dims,
+                             AccDataType epsilon)
+    {
+        return Argument{x, &residual, p_gamma, p_beta, y, p_sum, norm_dims, epsilon};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << (NormType == NormalizationType::Layernorm ? "ReferenceLayernorm"
+                                                         : "ReferenceRmsnorm")
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+template <typename XDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename YDataType,
+          typename AccDataType>
+using ReferenceLayernorm = ReferenceNormalization<XDataType,
+                                                  GammaDataType,
+                                                  BetaDataType,
+                                                  YDataType,
+                                                  AccDataType,
+                                                  NormalizationType::Layernorm>;
+
+template <typename XDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename YDataType,
+          typename AccDataType>
+using ReferenceRmsnorm = ReferenceNormalization<XDataType,
+                                                GammaDataType,
+                                                BetaDataType,
+                                                YDataType,
+                                                AccDataType,
+                                                NormalizationType::Rmsnorm>;
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,669 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "device_base.hpp"
+#include "host_tensor.hpp"
+#include "reduction_enums.hpp"
+#include "reduction_operator_mapping.hpp"
+#include "reduction_functions_accumulate.hpp"
+#include "reference_tile.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+//
+// @brief      Reference implementation for forward pooling.
+//
+// @paragraph  The tensors are indexed as (N, C, spatial dims...), i.e. NCW, NCHW or NCDHW, and
+//             any layout in memory, e.g. NHWC, is given by the strides of their descriptors. The
+//             window of an output covers the input positions out * stride - left_pad + window
+//             offset, positions in the padding are skipped. The index output of Max, Min and
+//             AMax is the offset of the selected input in the window, flattened in row-major
+//             order, and is the first such offset, or the last NaN if NaNs are propagated. AVG
+//             divides by the window size including the padding.
+//
+// @paragraph  Run() reduces the windows of one spatial dimension at a time, starting with the
+//             innermost one, so that the cost per output does not grow with the window size.
+//             Add-based reductions (ADD, AVG, NORM1, NORM2) subtract prefix sums, which are kept
+//             in double for floating point data. Max, Min and AMax combine the running reductions
+//             from the start and from the end of blocks of window length (van Herk/Gil-Werman),
+//             which needs 3 reductions per input. ComputeAt() scans the window of a single output
+//             instead.
+//
+// @tparam     NumDimSpatial  Number of spatial dimensions, 1 to 3.
+// @tparam     ReduceOpId     Any ReduceTensorOp but MUL.
+// @tparam     OutputIndex    Whether to write out_indices, for Max, Min and AMax only.
+//
+template <index_t NumDimSpatial,
+          typename InDataType,
+          typename OutDataType,
+          typename AccDataType,
+          typename IndexDataType,
+          ReduceTensorOp ReduceOpId,
+          bool PropagateNan,
+          bool OutputIndex>
+struct ReferencePoolFwd : public device::BaseOperator
+{
+    static_assert(NumDimSpatial >= 1 && NumDimSpatial <= 3, "wrong! only 1D, 2D and 3D pooling");
+
+    using ReduceOperation = typename reduce_binary_operator<ReduceOpId>::opType;
+
+    using InElementwiseOperation =
+        typename reduce_unary_operator<ReduceOpId, true, true>::InElementwiseOperation;
+
+    using AccElementwiseOperation =
+        typename reduce_unary_operator<ReduceOpId, true, true>::AccElementwiseOperation;
+
+    static constexpr bool IsSumReduction = is_same<ReduceOperation, reduce::Add>::value;
+
+    static_assert(IsSumReduction || is_same<ReduceOperation, reduce::Max>::value ||
+                      is_same<ReduceOperation, reduce::Min>::value ||
+                      is_same<ReduceOperation, reduce::AMax>::value,
+                  "wrong! MUL pooling is not supported");
+
+    static_assert(!(OutputIndex && IsSumReduction), "wrong! only Max, Min and AMax output index");
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<InDataType>& in,
+                 Tensor<OutDataType>& out,
+                 Tensor<IndexDataType>& out_indices,
+                 std::vector<index_t> window_spatial_lengths,
+                 std::vector<index_t> window_strides,
+                 std::vector<index_t> in_left_pads,
+                 std::vector<index_t> in_right_pads)
+            : in_{in},
+              out_{out},
+              out_indices_{out_indices},
+              window_spatial_lengths_{window_spatial_lengths},
+              window_strides_{window_strides},
+              in_left_pads_{in_left_pads},
+              in_right_pads_{in_right_pads}
+        {
+            const auto& in_lengths  = in_.mDesc.GetLengths();
+            const auto& out_lengths = out_.mDesc.GetLengths();
+
+            if(in_lengths.size() != NumDimSpatial + 2 || out_lengths.size() != NumDimSpatial + 2 ||
+               window_spatial_lengths_.size() != NumDimSpatial ||
+               window_strides_.size() != NumDimSpatial || in_left_pads_.size() != NumDimSpatial ||
+               in_right_pads_.size() != NumDimSpatial)
+            {
+                throw std::runtime_error("wrong! inconsistent number of pooling dimensions");
+            }
+
+            if(in_lengths[0] != out_lengths[0] || in_lengths[1] != out_lengths[1])
+            {
+                throw std::runtime_error("wrong! in and out differ in N or C");
+            }
+
+            index_t reduce_length = 1;
+
+            for(index_t d = 0; d < NumDimSpatial; ++d)
+            {
+                const long_index_t padded_length = static_cast<long_index_t>(in_lengths[d + 2]) +
+                                                   in_left_pads_[d] + in_right_pads_[d];
+
+                if(window_spatial_lengths_[d] < 1 || window_strides_[d] < 1 ||
+                   padded_length < window_spatial_lengths_[d] ||
+                   static_cast<long_index_t>(out_lengths[d + 2]) !=
+                       (padded_length - window_spatial_lengths_[d]) / window_strides_[d] + 1)
+                {
+                    throw std::runtime_error("wrong! out lengths do not match the pooling window");
+                }
+
+                reduce_length *= window_spatial_lengths_[d];
+            }
+
+            std::tie(in_elementwise_op_, acc_elementwise_op_) =
+                reduce_unary_operator<ReduceOpId, true, true>::GetElementwiseOperator(
+                    reduce_length);
+        }
+
+        const Tensor<InDataType>& in_;
+        Tensor<OutDataType>& out_;
+        Tensor<IndexDataType>& out_indices_;
+
+        std::vector<index_t> window_spatial_lengths_;
+        std::vector<index_t> window_strides_;
+        std::vector<index_t> in_left_pads_;
+        std::vector<index_t> in_right_pads_;
+
+        InElementwiseOperation in_elementwise_op_;
+        AccElementwiseOperation acc_elementwise_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferencePoolFwd::Argument;
+
+        // prefix sums of floating point data are exact enough in double
+        using SumDataType =
+            std::conditional_t<std::is_floating_point<AccDataType>::value, double, long_index_t>;
+
+        // value and index of out(idx) by a scan of its window, computed without writing out
+        static std::pair<AccDataType, IndexDataType>
+        ScanWindowAt(const Argument& arg, const std::vector<std::size_t>& idx)
+        {
+            const auto& in_lengths = arg.in_.mDesc.GetLengths();
+
+            std::vector<std::size_t> in_idx = idx;
+            std::vector<index_t> window_idx(NumDimSpatial, 0);
+
+            AccDataType acc       = ReduceOperation::template GetIdentityValue<AccDataType>();
+            IndexDataType acc_idx = 0;
+
+            for(index_t offset = 0;; ++offset)
+            {
+                bool is_valid = true;
+
+                for(index_t d = 0; d < NumDimSpatial; ++d)
+                {
+                    const long_index_t i = static_cast<long_index_t>(idx[d + 2]) *
+                                               arg.window_strides_[d] +
+                                           window_idx[d] - arg.in_left_pads_[d];
+
+                    is_valid = is_valid && i >= 0 &&
+                               i < static_cast<long_index_t>(in_lengths[d + 2]);
+
+                    in_idx[d + 2] = static_cast<std::size_t>(i);
+                }
+
+                if(is_valid)
+                {
+                    AccDataType v = type_convert<AccDataType>(arg.in_(in_idx));
+
+                    arg.in_elementwise_op_(v, v);
+
+                    if constexpr(IsSumReduction)
+                    {
+                        ck::detail::AccumulateWithNanCheck<PropagateNan,
+                                                           ReduceOperation,
+                                                           AccDataType>::Calculate(acc, v);
+                    }
+                    else
+                    {
+                        ck::detail::AccumulateWithIndexAndNanCheck<
+                            PropagateNan,
+                            ReduceOperation,
+                            AccDataType,
+                            IndexDataType>::Calculate(acc,
+                                                      v,
+                                                      acc_idx,
+                                                      static_cast<IndexDataType>(offset));
+                    }
+                }
+
+                // next offset in the window, innermost dimension fastest
+                index_t d = NumDimSpatial - 1;
+
+                for(; d >= 0; --d)
+                {
+                    if(++window_idx[d] < arg.window_spatial_lengths_[d])
+                    {
+                        break;
+                    }
+
+                    window_idx[d] = 0;
+                }
+
+                if(d < 0)
+                {
+                    break;
+                }
+            }
+
+            arg.acc_elementwise_op_(acc, acc);
+
+            return {acc, acc_idx};
+        }
+
+        // value of out(idx), computed without writing out
+        static OutDataType ComputeAt(const Argument& arg, const std::vector<std::size_t>& idx)
+        {
+            return type_convert<OutDataType>(ScanWindowAt(arg, idx).first);
+        }
+
+        // value of out_indices(idx), computed without writing out_indices
+        static IndexDataType ComputeIndexAt(const Argument& arg,
+                                            const std::vector<std::size_t>& idx)
+        {
+            return ScanWindowAt(arg, idx).second;
+        }
+
+        // computes out, and out_indices if OutputIndex, within the tile given by one range per
+        // dimension only
+        static void ComputeTile(const Argument& arg, const std::vector<IndexRange>& ranges)
+        {
+            ForEachTileIndex(
+                ranges,
+                [&](const auto& idx) {
+                    const auto r = ScanWindowAt(arg, idx);
+
+                    arg.out_(idx) = type_convert<OutDataType>(r.first);
+
+                    if constexpr(OutputIndex)
+                    {
+                        arg.out_indices_(idx) = r.second;
+                    }
+                },
+                std::thread::hardware_concurrency());
+        }
+
+        float Run(const Argument& arg)
+        {
+            const auto& in_lengths = arg.in_.mDesc.GetLengths();
+
+            auto f_nc = [&](auto n, auto c) {
+                if constexpr(IsSumReduction)
+                {
+                    RunWithPrefixSums(arg, n, c);
+                }
+                else
+                {
+                    RunWithVanHerkGilWerman(arg, n, c);
+                }
+            };
+
+            make_ParallelTensorFunctor(f_nc, in_lengths[0], in_lengths[1])(
+                std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+
+        private:
+        // Reduces buf, which holds a row-major array with the given lengths, along dimension dim
+        // to out_length elements. reduce_line(line, out_line) reduces one line along dim.
+        template <typename T, typename F>
+        static std::vector<T> ReduceAlongDim(const std::vector<T>& buf,
+                                             std::vector<std::size_t>& lengths,
+                                             index_t dim,
+                                             std::size_t out_length,
+                                             F reduce_line)
+        {
+            std::size_t num_outer = 1;
+            std::size_t num_inner = 1;
+
+            for(index_t d = 0; d < dim; ++d)
+            {
+                num_outer *= lengths[d];
+            }
+
+            for(index_t d = dim + 1; d < NumDimSpatial; ++d)
+            {
+                num_inner *= lengths[d];
+            }
+
+            const std::size_t length = lengths[dim];
+
+            std::vector<T> out(num_outer * out_length * num_inner);
+            std::vector<T> line(length);
+            std::vector<T> out_line(out_length);
+
+            for(std::size_t o = 0; o < num_outer; ++o)
+            {
+                for(std::size_t i = 0; i < num_inner; ++i)
+                {
+                    for(std::size_t k = 0; k < length; ++k)
+                    {
+                        line[k] = buf[(o * length + k) * num_inner + i];
+                    }
+
+                    reduce_line(line, out_line);
+
+                    for(std::size_t k = 0; k < out_length; ++k)
+                    {
+                        out[(o * out_length + k) * num_inner + i] = out_line[k];
+                    }
+                }
+            }
+
+            lengths[dim] = out_length;
+
+            return out;
+        }
+
+        // calls f(idx, i) for the multi-index idx of out (or in) of every spatial position i of
+        // (n, c), in row-major order
+        template <typename F>
+        static void ForEachSpatialIndex(const std::vector<std::size_t>& lengths,
+                                        std::size_t n,
+                                        std::size_t c,
+                                        F f)
+        {
+            std::vector<std::size_t> idx(NumDimSpatial + 2, 0);
+
+            idx[0] = n;
+            idx[1] = c;
+
+            std::size_t num_spatial = 1;
+
+            for(index_t d = 0; d < NumDimSpatial; ++d)
+            {
+                num_spatial *= lengths[d + 2];
+            }
+
+            for(std::size_t i = 0; i < num_spatial; ++i)
+            {
+                std::size_t r = i;
+
+                for(index_t d = NumDimSpatial - 1; d >= 0; --d)
+                {
+                    idx[d + 2] = r % lengths[d + 2];
+                    r /= lengths[d + 2];
+                }
+
+                f(idx, i);
+            }
+        }
+
+        // window sums by differences of prefix sums. Infinities and NaNs are counted instead of
+        // summed, so that they only affect the windows they are in.
+        static void RunWithPrefixSums(const Argument& arg, std::size_t n, std::size_t c)
+        {
+            const auto& in_lengths  = arg.in_.mDesc.GetLengths();
+            const auto& out_lengths = arg.out_.mDesc.GetLengths();
+
+            std::vector<std::size_t> lengths(in_lengths.begin() + 2, in_lengths.end());
+
+            std::vector<SumDataType> buf;
+
+            ForEachSpatialIndex(in_lengths, n, c, [&](const auto& idx, std::size_t) {
+                AccDataType v = type_convert<AccDataType>(arg.in_(idx));
+
+                arg.in_elementwise_op_(v, v);
+
+                buf.push_back(static_cast<SumDataType>(v));
+            });
+
+            for(index_t d = NumDimSpatial - 1; d >= 0; --d)
+            {
+                const long_index_t window_length = arg.window_spatial_lengths_[d];
+                const long_index_t window_stride = arg.window_strides_[d];
+                const long_index_t left_pad      = arg.in_left_pads_[d];
+
+                auto reduce_line = [&](const std::vector<SumDataType>& line,
+                                       std::vector<SumDataType>& out_line) {
+                    const long_index_t length = line.size();
+
+                    // sum of the finite values, and counts of NaN, +Inf and -Inf, of line[0, i)
+                    std::vector<SumDataType> sums(length + 1, 0);
+                    std::vector<std::array<index_t, 3>> num_non_finite(length + 1, {0, 0, 0});
+
+                    for(long_index_t i = 0; i < length; ++i)
+                    {
+                        sums[i + 1]           = sums[i];
+                        num_non_finite[i + 1] = num_non_finite[i];
+
+                        const SumDataType v = line[i];
+
+                        if constexpr(std::is_floating_point<SumDataType>::value)
+                        {
+                            if(std::isnan(v))
+                            {
+                                ++num_non_finite[i + 1][0];
+                                continue;
+                            }
+                            else if(std::isinf(v))
+                            {
+                                ++num_non_finite[i + 1][v > 0 ? 1 : 2];
+                                continue;
+                            }
+                        }
+
+                        sums[i + 1] += v;
+                    }
+
+                    for(std::size_t o = 0; o < out_line.size(); ++o)
+                    {
+                        const long_index_t begin =
+                            static_cast<long_index_t>(o) * window_stride - left_pad;
+
+                        const long_index_t lo = std::min(std::max(begin, long_index_t{0}), length);
+                        const long_index_t hi =
+                            std::min(std::max(begin + window_length, long_index_t{0}), length);
+
+                        const index_t num_nan = num_non_finite[hi][0] - num_non_finite[lo][0];
+                        const index_t num_pos_inf = num_non_finite[hi][1] - num_non_finite[lo][1];
+                        const index_t num_neg_inf = num_non_finite[hi][2] - num_non_finite[lo][2];
+
+                        if(num_nan > 0 || (num_pos_inf > 0 && num_neg_inf > 0))
+                        {
+                            out_line[o] = std::numeric_limits<SumDataType>::quiet_NaN();
+                        }
+                        else if(num_pos_inf > 0)
+                        {
+                            out_line[o] = std::numeric_limits<SumDataType>::infinity();
+                        }
+                        else if(num_neg_inf > 0)
+                        {
+                            out_line[o] = -std::numeric_limits<SumDataType>::infinity();
+                        }
+                        else
+                        {
+                            out_line[o] = sums[hi] - sums[lo];
+                        }
+                    }
+                };
+
+                buf = ReduceAlongDim(buf, lengths, d, out_lengths[d + 2], reduce_line);
+            }
+
+            ForEachSpatialIndex(out_lengths, n, c, [&](const auto& idx, std::size_t i) {
+                AccDataType v = static_cast<AccDataType>(buf[i]);
+
+                arg.acc_elementwise_op_(v, v);
+
+                arg.out_(idx) = type_convert<OutDataType>(v);
+            });
+        }
+
+        // reduced value and the window offset it was selected at, flattened over the dimensions
+        // reduced so far
+        struct IndexedValue
+        {
+            AccDataType value;
+            index_t index;
+        };
+
+        using Accumulation = ck::detail::
+            AccumulateWithIndexAndNanCheck<PropagateNan, ReduceOperation, AccDataType, index_t>;
+
+        // Max, Min and AMax of the windows of a line by van Herk/Gil-Werman: with the padded line
+        // split into blocks of window length, a window is the end of one block and the start of
+        // the next, whose reductions are the running reductions from the block end and start.
+        // Reducing the left operand with the right one keeps the first of equal values and the
+        // last NaN, as a scan of the window does.
+        static void RunWithVanHerkGilWerman(const Argument& arg, std::size_t n, std::size_t c)
+        {
+            const auto& in_lengths  = arg.in_.mDesc.GetLengths();
+            const auto& out_lengths = arg.out_.mDesc.GetLengths();
+
+            const AccDataType identity = ReduceOperation::template GetIdentityValue<AccDataType>();
+
+            std::vector<std::size_t> lengths(in_lengths.begin() + 2, in_lengths.end());
+
+            std::vector<IndexedValue> buf;
+
+            ForEachSpatialIndex(in_lengths, n, c, [&](const auto& idx, std::size_t) {
+                AccDataType v = type_convert<AccDataType>(arg.in_(idx));
+
+                arg.in_elementwise_op_(v, v);
+
+                // a scan without NaN check never selects a NaN, and NaNs would break the
+                // associativity of the reduction
+                if constexpr(!PropagateNan && std::is_floating_point<AccDataType>::value)
+                {
+                    if(std::isnan(v))
+                    {
+                        v = identity;
+                    }
+                }
+
+                buf.push_back({v, 0});
+            });
+
+            // number of offsets in the window of the dimensions reduced so far
+            index_t inner_window_size = 1;
+
+            for(index_t d = NumDimSpatial - 1; d >= 0; --d)
+            {
+                const index_t window_length = arg.window_spatial_lengths_[d];
+                const index_t window_stride = arg.window_strides_[d];
+                const index_t left_pad      = arg.in_left_pads_[d];
+
+                auto reduce_line = [&](const std::vector<IndexedValue>& line,
+                                       std::vector<IndexedValue>& out_line) {
+                    const index_t length = line.size();
+
+                    // padded line up to the end of the last window, the index of an element is
+                    // its position in the padded line
+                    const index_t padded_length =
+                        (out_line.size() - 1) * window_stride + window_length;
+
+                    auto get_element = [&](index_t p) {
+                        const index_t i = p - left_pad;
+
+                        return IndexedValue{i >= 0 && i < length ? line[i].value : identity, p};
+                    };
+
+                    std::vector<IndexedValue> from_start(padded_length);
+                    std::vector<IndexedValue> from_end(padded_length);
+
+                    for(index_t p = 0; p < padded_length; ++p)
+                    {
+                        from_start[p] = get_element(p);
+
+                        if(p % window_length != 0)
+                        {
+                            IndexedValue r = from_start[p - 1];
+
+                            Accumulation::Calculate(
+                                r.value, from_start[p].value, r.index, from_start[p].index);
+
+                            from_start[p] = r;
+                        }
+                    }
+
+                    for(index_t p = padded_length - 1; p >= 0; --p)
+                    {
+                        from_end[p] = get_element(p);
+
+                        if(p % window_length != window_length - 1 && p != padded_length - 1)
+                        {
+                            Accumulation::Calculate(from_end[p].value,
+                                                    from_end[p + 1].value,
+                                                    from_end[p].index,
+                                                    from_end[p + 1].index);
+                        }
+                    }
+
+                    for(std::size_t o = 0; o < out_line.size(); ++o)
+                    {
+                        const index_t begin = o * window_stride;
+
+                        IndexedValue r        = from_end[begin];
+                        const IndexedValue& s = from_start[begin + window_length - 1];
+
+                        Accumulation::Calculate(r.value, s.value, r.index, s.index);
+
+                        // window offset in this dimension, then in the ones reduced before
+                        const index_t i = r.index - left_pad;
+
+                        r.index = (r.index - begin) * inner_window_size +
+                                  (i >= 0 && i < length ? line[i].index : 0);
+
+                        out_line[o] = r;
+                    }
+                };
+
+                buf = ReduceAlongDim(buf, lengths, d, out_lengths[d + 2], reduce_line);
+
+                inner_window_size *= window_length;
+            }
+
+            ForEachSpatialIndex(out_lengths, n, c, [&](const auto& idx, std::size_t i) {
+                // a scan starts from the identity at index 0
+                IndexedValue r{identity, 0};
+
+                Accumulation::Calculate(r.value, buf[i].value, r.index, buf[i].index);
+
+                arg.acc_elementwise_op_(r.value, r.value);
+
+                arg.out_(idx) = type_convert<OutDataType>(r.value);
+
+                if constexpr(OutputIndex)
+                {
+                    arg.out_indices_(idx) = static_cast<IndexDataType>(r.index);
+                }
+            });
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const Tensor<InDataType>& in,
+                             Tensor<OutDataType>& out,
+                             Tensor<IndexDataType>& out_indices,
+                             std::vector<index_t> window_spatial_lengths,
+                             std::vector<index_t> window_strides,
+                             std::vector<index_t> in_left_pads,
+                             std::vector<index_t> in_right_pads)
+    {
+        return Argument{in,
+                        out,
+                        out_indices,
+                        window_spatial_lengths,
+                        window_strides,
+                        in_left_pads,
+                        in_right_pads};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferencePoolFwd"
+            << "<" << NumDimSpatial << "D, "
+            << static_cast<int>(ReduceOpId) << ">"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -6,6 +6,7 @@
 #include "device_base.hpp"
 #include "host_tensor.hpp"
 #include "host_tensor_generator.hpp"
+#include "reference_tile.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -50,6 +51,70 @@ struct ReferenceSoftmax : public device::BaseOperator
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
+        // value of out(idx), computed without writing out; the max and sum are only reduced over
+        // the elements sharing the scalar (non-reduced) indices of idx
+        static OutDataType ComputeAt(const Argument& arg, const std::vector<std::size_t>& idx)
+        {
+            const auto& lengths = arg.in_.mDesc.GetLengths();
+
+            // visits all indices which only differ from idx in the reduce dims
+            auto for_each_reduce_idx = [&](auto f) {
+                std::vector<std::size_t> reduce_idx = idx;
+
+                for(index_t dim : arg.sm_reduce_dims_)
+                {
+                    reduce_idx[dim] = 0;
+                }
+
+                while(true)
+                {
+                    f(reduce_idx);
+
+                    auto dim = arg.sm_reduce_dims_.rbegin();
+
+                    for(; dim != arg.sm_reduce_dims_.rend(); ++dim)
+                    {
+                        if(++reduce_idx[*dim] < lengths[*dim])
+                        {
+                            break;
+                        }
+
+                        reduce_idx[*dim] = 0;
+                    }
+
+                    if(dim == arg.sm_reduce_dims_.rend())
+                    {
+                        return;
+                    }
+                }
+            };
+
+            AccDataType reduce_max = std::numeric_limits<AccDataType>::lowest();
+
+            for_each_reduce_idx([&](const auto& reduce_idx) {
+                reduce_max = std::max(reduce_max, static_cast<AccDataType>(arg.in_(reduce_idx)));
+            });
+
+            AccDataType reduce_sum = 0;
+
+            for_each_reduce_idx([&](const auto& reduce_idx) {
+                reduce_sum += std::exp(static_cast<AccDataType>(arg.in_(reduce_idx)) - reduce_max);
+            });
+
+            return arg.alpha_ * std::exp(static_cast<AccDataType>(arg.in_(idx)) - reduce_max) /
+                       reduce_sum +
+                   arg.beta_ * arg.out_(idx);
+        }
+
+        // computes out within the tile given by one range per dimension only
+        static void ComputeTile(const Argument& arg, const std::vector<IndexRange>& ranges)
+        {
+            ForEachTileIndex(
+                ranges,
+                [&](const auto& idx) { arg.out_(idx) = ComputeAt(arg, idx); },
+                std::thread::hardware_concurrency());
+        }
+
         float Run(const Argument& arg)
         {
             std::vector<size_t> scalar_lengths;
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// half-open range [begin, end) of the indices of one dimension of a tile
+using IndexRange = std::pair<std::size_t, std::size_t>;
+
+// Calls f(idx) for every multi-index idx of the tile spanned by ranges, with one range per
+// dimension. Work is split over num_thread threads like in ParallelTensorFunctor.
+template <typename F>
+void ForEachTileIndex(const std::vector<IndexRange>& ranges, F f, std::size_t num_thread = 1)
+{
+    const std::size_t rank = ranges.size();
+
+    std::vector<std::size_t> lengths(rank);
+    std::size_t num_index = 1;
+
+    for(std::size_t d = 0; d < rank; ++d)
+    {
+        lengths[d] = ranges[d].second > ranges[d].first ? ranges[d].second - ranges[d].first : 0;
+        num_index *= lengths[d];
+    }
+
+    if(num_index == 0)
+    {
+        return;
+    }
+
+    num_thread = std::max<std::size_t>(std::min(num_thread, num_index), 1);
+
+    const std::size_t work_per_thread = (num_index + num_thread - 1) / num_thread;
+
+    std::vector<joinable_thread> threads(num_thread);
+
+    for(std::size_t it = 0; it < num_thread; ++it)
+    {
+        const std::size_t iw_begin = it * work_per_thread;
+        const std::size_t iw_end   = std::min((it + 1) * work_per_thread, num_index);
+
+        threads[it] = joinable_thread([=, &ranges, &lengths] {
+            std::vector<std::size_t> idx(rank);
+
+            for(std::size_t iw = iw_begin; iw < iw_end; ++iw)
+            {
+                std::size_t i = iw;
+
+                for(std::size_t d = rank; d-- > 0;)
+                {
+                    idx[d] = ranges[d].first + i % lengths[d];
+                    i /= lengths[d];
+                }
+
+                f(idx);
+            }
+        });
+    }
+}
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -1,7 +1,16 @@
 #pragma once
 
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <typeinfo>
 #include <vector>
 
+#include "config.hpp"
+#include "functional2.hpp"
+#include "type.hpp"
+
 namespace ck {
 namespace tensor_operation {
 namespace device {
@@ -19,6 +28,38 @@ void add_device_operation_instances(std::vector<std::unique_ptr<OpInstance>>& op
     });
 }
 
+// An add_device_*_instances function, type-erased so that it can be looked up by name in a
+// separately loaded library. signature is the mangled name of its function type, which the caller
+// checks against the type it expects before calling the function.
+struct DeviceOperationInstanceAdder
+{
+    const char* signature;
+    void* function;
+};
+
+// The add_device_*_instances functions of a per-family device operation library, by name. Filled
+// by the add_device_<family>_instance_adders function of the family when the library is first
+// queried
+struct DeviceOperationInstanceAdders
+{
+    template <typename Function>
+    void Add(const std::string& name, Function* function)
+    {
+        adders[name] = {typeid(Function).name(), reinterpret_cast<void*>(function)};
+    }
+
+    std::map<std::string, DeviceOperationInstanceAdder> adders;
+};
+
 } // namespace device
 } // namespace tensor_operation
 } // namespace ck
+
+// Define NAME##_adder, which adds the add_device_*_instances function NAME to the adders of its
+// family. Used next to the definition of NAME, in the namespace of NAME, and called by the
+// add_device_<family>_instance_adders function of the family
+#define CK_DEFINE_DEVICE_OPERATION_INSTANCE_ADDER(NAME)                                    \
+    void NAME##_adder(ck::tensor_operation::device::DeviceOperationInstanceAdders& adders) \
+    {                                                                                      \
+        adders.Add(#NAME, &NAME);                                                          \
+    }
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstdlib>
+#include <dlfcn.h>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Loads the per-family device operation libraries (libdevice_<family>_operations.so) on first use,
+// and forwards add_device_*_instances calls to them. This lets a process pay for the instances of
+// the operations it actually runs, instead of linking the device_operations archive.
+//
+// Libraries are searched in the directory given by SetLibraryPath(), else in
+// $CK_DEVICE_OPERATIONS_PATH, else in the default search path of dlopen. They are never unloaded,
+// since the instances they return keep pointing to their code.
+class DeviceOperationRegistry
+{
+    public:
+    static DeviceOperationRegistry& GetInstance()
+    {
+        static DeviceOperationRegistry registry;
+
+        return registry;
+    }
+
+    void SetLibraryPath(const std::string& path)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        library_path_ = path;
+    }
+
+    // Call add_device_*_instances function name of library family, e.g.
+    //   AddInstances("gemm", "add_device_gemm_xdl_f16_f16_f16_mk_kn_mn_instances", gemm_ptrs);
+    // The argument types must match the declaration of the function exactly.
+    template <typename... Args>
+    void AddInstances(const std::string& family, const std::string& name, Args&... args)
+    {
+        using Function = void(Args&...);
+
+        const char* signature = nullptr;
+
+        void* function = GetInstanceAdder(family, name, &signature);
+
+        if(std::string(signature) != typeid(Function).name())
+        {
+            throw std::runtime_error("wrong! " + name + " of device_" + family +
+                                     "_operations has a different signature");
+        }
+
+        reinterpret_cast<Function*>(function)(args...);
+    }
+
+    // whether the library of family has been loaded already
+    bool IsLoaded(const std::string& family)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        return libraries_.count(family) > 0;
+    }
+
+    private:
+    using EntryPoint = void* (*)(const char*, const char**);
+
+    DeviceOperationRegistry()
+    {
+        if(const char* path = std::getenv("CK_DEVICE_OPERATIONS_PATH"))
+        {
+            library_path_ = path;
+        }
+    }
+
+    void*
+    GetInstanceAdder(const std::string& family, const std::string& name, const char** signature)
+    {
+        EntryPoint entry_point = GetEntryPoint(family);
+
+        void* function = entry_point(name.c_str(), signature);
+
+        if(function == nullptr)
+        {
+            throw std::runtime_error("wrong! " + name + " not found in device_" + family +
+                                     "_operations");
+        }
+
+        return function;
+    }
+
+    EntryPoint GetEntryPoint(const std::string& family)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto it = libraries_.find(family);
+
+        if(it == libraries_.end())
+        {
+            std::string file_name = "libdevice_" + family + "_operations.so";
+
+            if(!library_path_.empty())
+            {
+                file_name = library_path_ + "/" + file_name;
+            }
+
+            void* handle = dlopen(file_name.c_str(), RTLD_NOW | RTLD_LOCAL);
+
+            if(handle == nullptr)
+            {
+                throw std::runtime_error("wrong! failed to load " + file_name + ": " + dlerror());
+            }
+
+            void* entry_point = dlsym(handle, "ck_get_device_operation_instance_adder");
+
+            if(entry_point == nullptr)
+            {
+                throw std::runtime_error("wrong! " + file_name +
+                                         " is not a device operation library");
+            }
+
+            it = libraries_.emplace(family, reinterpret_cast<EntryPoint>(entry_point)).first;
+        }
+
+        return it->second;
+    }
+
+    std::mutex mutex_;
+    std::string library_path_;
+    std::map<std::string, EntryPoint> libraries_;
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
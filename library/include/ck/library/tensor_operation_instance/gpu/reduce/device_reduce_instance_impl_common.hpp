@@ -32,6 +32,22 @@ struct ReductionConfiguration_2
 
 #define QUICK_REDUCE_TEST 1
 
+// Adds the add_device_reduce_instance_<kind> instantiation of the ADD_<KIND>_INST_BY_ID arguments
+// to the adders of the reduce family, under a name made of kind and these arguments as written,
+// e.g. "add_device_reduce_instance_threadwise<half_t, half_t, half_t, 2, 0, 0, 4, 3>"
+#define ADD_REDUCE_INST_ADDER_BY_ID(                                                        \
+    adders, kind, inT, compT, outT, ReduceOpId, NanOpt, IndicesOpt, Rank, NumReduceDim)     \
+    adders.Add("add_device_reduce_instance_" #kind "<" #inT ", " #compT ", " #outT ", "     \
+               #ReduceOpId ", " #NanOpt ", " #IndicesOpt ", " #Rank ", " #NumReduceDim ">", \
+               &add_device_reduce_instance_##kind<inT,                                      \
+                                                  compT,                                    \
+                                                  outT,                                     \
+                                                  Rank,                                     \
+                                                  NumReduceDim,                             \
+                                                  static_cast<ReduceTensorOp>(ReduceOpId),  \
+                                                  static_cast<bool>(NanOpt),                \
+                                                  static_cast<bool>(IndicesOpt)>)
+
 } // namespace device_reduce_instance
 } // namespace device
 } // namespace tensor_operation
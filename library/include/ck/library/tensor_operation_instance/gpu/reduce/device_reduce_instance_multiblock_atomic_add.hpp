@@ -167,6 +167,11 @@ void add_device_reduce_instance_multiblock_atomic_add(
                                            Rank,                                    \
                                            NumReduceDim)
 
+// Registers the instance added by ADD_MULTIBLOCK_ATOMIC_ADD_INST_BY_ID with the same arguments
+// to the DeviceOperationInstanceAdders named adders; both take the per-file list entries
+#define ADD_MULTIBLOCK_ATOMIC_ADD_INST_ADDER_BY_ID(...) \
+    ADD_REDUCE_INST_ADDER_BY_ID(adders, multiblock_atomic_add, __VA_ARGS__)
+
 #define ADD_MULTIBLOCK_ATOMIC_ADD_INST_REF_BY_TYPE(                                     \
     inT, compT, outT, ReduceOpId, PropagateNan, UseIndex, Rank, NumReduceDim)           \
     extern template void add_device_reduce_instance_multiblock_atomic_add<inT,          \
@@ -126,6 +126,11 @@ void add_device_reduce_instance_threadwise(
                                 Rank,                                     \
                                 NumReduceDim)
 
+// Registers the instance added by ADD_THREADWISE_INST_BY_ID with the same arguments
+// to the DeviceOperationInstanceAdders named adders; both take the per-file list entries
+#define ADD_THREADWISE_INST_ADDER_BY_ID(...) \
+    ADD_REDUCE_INST_ADDER_BY_ID(adders, threadwise, __VA_ARGS__)
+
 #define ADD_THREADWISE_INST_REF_BY_TYPE(                                      \
     inT, compT, outT, ReduceOpId, PropagateNan, UseIndex, Rank, NumReduceDim) \
     extern template void add_device_reduce_instance_threadwise<inT,           \
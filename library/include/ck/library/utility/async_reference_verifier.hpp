@@ -0,0 +1,119 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <utility>
+#include <vector>
+
+namespace ck {
+namespace utils {
+
+// Runs a host reference computation asynchronously, so that device instances can be profiled
+// while it is being computed. Checks against the reference result run as soon as it is available;
+// checks submitted before that are queued and run, in submission order, once it is. A queued check
+// has to own the device result it verifies, e.g. by capturing a copy of the output tensor. Without
+// a launched reference, checks run immediately. At most max_pending_checks checks are queued, so
+// that the copies of the device results they own are bounded; Verify() waits for the reference
+// rather than queue more.
+class AsyncReferenceVerifier
+{
+    public:
+    explicit AsyncReferenceVerifier(std::size_t max_pending_checks = 4)
+        : max_pending_checks_{std::max<std::size_t>(max_pending_checks, 1)}
+    {
+    }
+
+    AsyncReferenceVerifier(const AsyncReferenceVerifier&) = delete;
+    AsyncReferenceVerifier& operator=(const AsyncReferenceVerifier&) = delete;
+
+    // waits for the reference, queued checks are dropped
+    ~AsyncReferenceVerifier()
+    {
+        if(reference_.valid())
+        {
+            reference_.wait();
+        }
+    }
+
+    template <typename F>
+    void Launch(F&& reference)
+    {
+        reference_ = std::async(std::launch::async, std::forward<F>(reference));
+        ready_     = false;
+    }
+
+    bool IsReady()
+    {
+        if(!ready_ && reference_.valid() &&
+           reference_.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        {
+            // rethrows exceptions of the reference computation
+            reference_.get();
+            ready_ = true;
+        }
+
+        return ready_;
+    }
+
+    void Wait()
+    {
+        if(!ready_ && reference_.valid())
+        {
+            reference_.get();
+            ready_ = true;
+        }
+    }
+
+    void Verify(std::function<bool()> check)
+    {
+        if(pending_checks_.size() >= max_pending_checks_)
+        {
+            Wait();
+            RunPendingChecks();
+        }
+
+        pending_checks_.push_back(std::move(check));
+
+        if(IsReady())
+        {
+            RunPendingChecks();
+        }
+    }
+
+    // wait for the reference and run all queued checks; returns whether all checks submitted since
+    // the last call passed
+    bool Finish()
+    {
+        Wait();
+        RunPendingChecks();
+
+        const bool pass = pass_;
+
+        pass_ = true;
+
+        return pass;
+    }
+
+    private:
+    void RunPendingChecks()
+    {
+        for(auto& check : pending_checks_)
+        {
+            pass_ = check() && pass_;
+        }
+
+        pending_checks_.clear();
+    }
+
+    std::size_t max_pending_checks_;
+    std::future<void> reference_;
+    bool ready_ = true;
+    bool pass_  = true;
+    std::vector<std::function<bool()>> pending_checks_;
+};
+
+} // namespace utils
+} // namespace ck
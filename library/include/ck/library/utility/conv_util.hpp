@@ -77,6 +77,7 @@ using DeviceConvFwdNoOpPtr =
  * @param[in]  filter_spatial_lengths  Filter spatial dimensions lengths.
  * @param[in]  output_spatial_lengths  Convolution output spatial dimensions
  *                                     lengths.
+ * @param[in]  G                       Number of groups, C and K are split into.
  *
  * @return     The number of flops.
  */
@@ -84,7 +85,8 @@ std::size_t get_flops(ck::index_t N,
                       ck::index_t C,
                       ck::index_t K,
                       const std::vector<ck::index_t>& filter_spatial_lengths,
-                      const std::vector<ck::index_t>& output_spatial_lengths);
+                      const std::vector<ck::index_t>& output_spatial_lengths,
+                      ck::index_t G = 1);
 
 /**
  * @brief      Calculate number of bytes read/write by convolution algorithm.
@@ -95,6 +97,7 @@ std::size_t get_flops(ck::index_t N,
  * @param[in]  input_spatial_lengths   Input spatial dimensions lengths.
  * @param[in]  filter_spatial_lengths  Filter spatial dimensions lengths.
  * @param[in]  output_spatial_lengths  Output spatial dimensions lengths
+ * @param[in]  G                       Number of groups, C and K are split into.
  *
  * @tparam     InDataType              Input tensor data type.
  * @tparam     WeiDataType             Weights tensor data type.
@@ -110,17 +113,18 @@ std::size_t get_btype(ck::index_t N,
                       ck::index_t K,
                       const std::vector<ck::index_t>& input_spatial_lengths,
                       const std::vector<ck::index_t>& filter_spatial_lengths,
-                      const std::vector<ck::index_t>& output_spatial_lengths)
+                      const std::vector<ck::index_t>& output_spatial_lengths,
+                      ck::index_t G = 1)
 {
     // sizeof(InDataType) * (N * C * <input spatial lengths product>) +
-    // sizeof(WeiDataType) * (K * C * <filter spatial lengths product>) +
+    // sizeof(WeiDataType) * (K * C / G * <filter spatial lengths product>) +
     // sizeof(OutDataType) * (N * K * <output spatial lengths product>);
     return sizeof(InDataType) * (N * C *
                                  std::accumulate(std::begin(input_spatial_lengths),
                                                  std::end(input_spatial_lengths),
                                                  static_cast<std::size_t>(1),
                                                  std::multiplies<std::size_t>())) +
-           sizeof(WeiDataType) * (K * C *
+           sizeof(WeiDataType) * (K * (C / G) *
                                   std::accumulate(std::begin(filter_spatial_lengths),
                                                   std::end(filter_spatial_lengths),
                                                   static_cast<std::size_t>(1),
@@ -144,12 +148,16 @@ struct ConvParams
                const std::vector<ck::index_t>& strides,
                const std::vector<ck::index_t>& dilations,
                const std::vector<ck::index_t>& left_pads,
-               const std::vector<ck::index_t>& right_pads);
+               const std::vector<ck::index_t>& right_pads,
+               ck::index_t n_groups = 1);
 
     ck::index_t num_dim_spatial_;
     ck::index_t N_;
     ck::index_t K_;
     ck::index_t C_;
+    // number of groups, K_ and C_ are the numbers of channels of all the groups, e.g. G_ = C_ = K_
+    // for a depthwise convolution
+    ck::index_t G_;
 
     std::vector<ck::index_t> filter_spatial_lengths_;
     std::vector<ck::index_t> input_spatial_lengths_;
@@ -161,6 +169,12 @@ struct ConvParams
     std::vector<ck::index_t> input_right_pads_;
 
     std::vector<ck::index_t> GetOutputSpatialLengths() const;
+
+    // lengths of the input {N, C, Hi, Wi}, weights {K, C / G, Y, X} and output {N, K, Ho, Wo},
+    // for the host tensor descriptors
+    std::vector<std::size_t> GetInputLengths() const;
+    std::vector<std::size_t> GetWeightLengths() const;
+    std::vector<std::size_t> GetOutputLengths() const;
 };
 
 ConvParams parse_conv_params(int num_dim_spatial, int arg_idx, char* const argv[]);
@@ -168,7 +182,10 @@ ConvParams parse_conv_params(int num_dim_spatial, int arg_idx, char* const argv[
 /**
  * @brief      Gets the host tensor descriptor.
  *
- * @param[in]  dims          The tensor dimensions lengths. Always in NCHW format.
+ * @param[in]  dims          The tensor dimensions lengths. Always in NCHW format. For a
+ *                           grouped convolution, C of the input and K of the output are the
+ *                           channels of all the groups, and NHWC is then NHWGC, while C of the
+ *                           weights is the number of channels per group.
  * @param[in]  layout        The tensor data layout.
  *
  * @tparam     TensorLayout  Layout type.
@@ -437,17 +454,8 @@ class ConvFwdOpInstance : public ck::utils::OpInstance<OutDataType, InDataType,
 
     virtual InTensorsTuple GetInputTensors() const override
     {
-        std::vector<std::size_t> input_dims{static_cast<std::size_t>(params_.N_),
-                                            static_cast<std::size_t>(params_.C_)};
-        input_dims.insert(std::end(input_dims),
-                          std::begin(params_.input_spatial_lengths_),
-                          std::end(params_.input_spatial_lengths_));
-
-        std::vector<std::size_t> filter_dims{static_cast<std::size_t>(params_.K_),
-                                             static_cast<std::size_t>(params_.C_)};
-        filter_dims.insert(std::end(filter_dims),
-                           std::begin(params_.filter_spatial_lengths_),
-                           std::end(params_.filter_spatial_lengths_));
+        const std::vector<std::size_t> input_dims  = params_.GetInputLengths();
+        const std::vector<std::size_t> filter_dims = params_.GetWeightLengths();
 
         auto input = std::make_unique<Tensor<InDataType>>(
             get_host_tensor_descriptor(input_dims, InLayout{}));
@@ -465,11 +473,7 @@ class ConvFwdOpInstance : public ck::utils::OpInstance<OutDataType, InDataType,
 
     virtual TensorPtr<OutDataType> GetOutputTensor() const override
     {
-        std::vector<std::size_t> output_dims{static_cast<std::size_t>(params_.N_),
-                                             static_cast<std::size_t>(params_.K_)};
-        output_dims.insert(std::end(output_dims),
-                           std::begin(output_spatial_lengths_),
-                           std::end(output_spatial_lengths_));
+        const std::vector<std::size_t> output_dims = params_.GetOutputLengths();
         auto output = std::make_unique<Tensor<OutDataType>>(
             get_host_tensor_descriptor(output_dims, OutLayout{}));
 
@@ -517,6 +521,11 @@ class ConvFwdOpInstance : public ck::utils::OpInstance<OutDataType, InDataType,
             throw std::runtime_error(
                 "[ConvFwdOpInstance]: couldn't cast op_ptr to DeviceConvFwdNoOpPtr type!");
         }
+        if(params_.G_ != 1)
+        {
+            throw std::runtime_error(
+                "[ConvFwdOpInstance]: DeviceConvFwd does not support grouped convolution!");
+        }
 
         return conv_ptr->MakeArgumentPointer(
             static_cast<InDataType*>(in_device_buffers[0]->GetDeviceBuffer()),
@@ -543,7 +552,8 @@ class ConvFwdOpInstance : public ck::utils::OpInstance<OutDataType, InDataType,
                          params_.C_,
                          params_.K_,
                          params_.filter_spatial_lengths_,
-                         output_spatial_lengths_);
+                         output_spatial_lengths_,
+                         params_.G_);
     }
 
     virtual std::size_t GetBtype() const override
@@ -553,7 +563,8 @@ class ConvFwdOpInstance : public ck::utils::OpInstance<OutDataType, InDataType,
                                                                params_.K_,
                                                                params_.input_spatial_lengths_,
                                                                params_.filter_spatial_lengths_,
-                                                               output_spatial_lengths_);
+                                                               output_spatial_lengths_,
+                                                               params_.G_);
     }
 
     private:
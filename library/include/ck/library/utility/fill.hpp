@@ -59,6 +59,27 @@ struct FillUniformDistributionIntegerValue
     }
 };
 
+// both int4 values of each element are drawn independently, then saturated to [-8, 7]
+template <>
+struct FillUniformDistributionIntegerValue<ck::pk_i4_t>
+{
+    float a_{-5.f};
+    float b_{5.f};
+
+    template <typename ForwardIter>
+    void operator()(ForwardIter first, ForwardIter last) const
+    {
+        std::mt19937 gen(11939);
+        std::uniform_real_distribution<float> dis(a_, b_);
+        std::generate(first, last, [&dis, &gen]() {
+            int8_t lo = ck::i4_convert_sat(std::round(dis(gen)));
+            int8_t hi = ck::i4_convert_sat(std::round(dis(gen)));
+
+            return ck::pack_i4(lo, hi);
+        });
+    }
+};
+
 template <typename T>
 struct FillMonotonicSeq
 {
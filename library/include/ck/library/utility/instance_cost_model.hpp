@@ -0,0 +1,165 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "config.hpp"
+#include "math.hpp"
+#include "device_instance_traits.hpp"
+
+namespace ck {
+namespace utils {
+
+struct GemmProblemShape
+{
+    index_t M;
+    index_t N;
+    index_t K;
+    index_t a_element_bytes;
+    index_t b_element_bytes;
+    index_t KBatch = 1;
+};
+
+// Coarse description of the target GPU
+struct GpuModel
+{
+    index_t num_cu             = 120;
+    index_t lds_bytes_per_cu   = 65536;
+    index_t max_threads_per_cu = 2560;
+    // peak math throughput over DRAM bandwidth, in flop per byte, with some credit for L2 reuse
+    double flops_per_byte = 64.;
+};
+
+// Analytical estimate of how well an instance fits a GEMM problem. Every efficiency is in (0, 1],
+// and relative_time is the estimated run time over the time an ideal instance would take.
+struct InstanceCostEstimate
+{
+    // useful over computed elements of C, due to padding of the last tile in M and N
+    double tile_efficiency = 0.;
+    // same along K
+    double k_efficiency = 0.;
+    // busy over available block slots, over all waves of concurrently resident blocks
+    double wave_efficiency = 0.;
+    // flop per byte of A and B read by a block, over the balance point of the GPU, capped at 1
+    double compute_efficiency = 0.;
+
+    index_t num_tiles = 0;
+    // resident blocks per CU, limited by LDS and threads
+    index_t occupancy = 0;
+    index_t num_waves = 0;
+
+    // flop per byte of A and B read by a block
+    double arithmetic_intensity = 0.;
+
+    double relative_time = std::numeric_limits<double>::infinity();
+
+    bool IsValid() const { return occupancy > 0; }
+};
+
+inline InstanceCostEstimate
+estimate_gemm_instance_cost(const tensor_operation::device::InstanceTraits& traits,
+                            const GemmProblemShape& problem,
+                            const GpuModel& gpu = GpuModel{})
+{
+    InstanceCostEstimate cost;
+
+    if(!traits.IsValid() || traits.m_per_block <= 0 || traits.n_per_block <= 0 ||
+       traits.k_per_block <= 0)
+    {
+        return cost;
+    }
+
+    const index_t KBatch = traits.is_split_k ? math::max(problem.KBatch, 1) : 1;
+
+    const index_t M0 = math::integer_divide_ceil(problem.M, traits.m_per_block);
+    const index_t N0 = math::integer_divide_ceil(problem.N, traits.n_per_block);
+    const index_t K0 = math::integer_divide_ceil(problem.K, traits.k_per_block * KBatch);
+
+    cost.tile_efficiency = static_cast<double>(problem.M) * problem.N /
+                           (static_cast<double>(M0) * traits.m_per_block * N0 * traits.n_per_block);
+    cost.k_efficiency =
+        static_cast<double>(problem.K) / (static_cast<double>(K0) * traits.k_per_block * KBatch);
+
+    cost.occupancy = gpu.max_threads_per_cu / traits.block_size;
+
+    if(traits.lds_bytes > 0)
+    {
+        cost.occupancy = math::min(cost.occupancy, gpu.lds_bytes_per_cu / traits.lds_bytes);
+    }
+
+    if(cost.occupancy <= 0)
+    {
+        return cost;
+    }
+
+    const index_t concurrent_blocks = gpu.num_cu * cost.occupancy;
+
+    cost.num_tiles       = M0 * N0 * KBatch;
+    cost.num_waves       = math::integer_divide_ceil(cost.num_tiles, concurrent_blocks);
+    cost.wave_efficiency =
+        static_cast<double>(cost.num_tiles) / (cost.num_waves * concurrent_blocks);
+
+    // a block reads m_per_block + n_per_block rows of K and performs 2 * m_per_block * n_per_block
+    // flop per element of K
+    cost.arithmetic_intensity =
+        2. * traits.m_per_block * traits.n_per_block /
+        (static_cast<double>(traits.m_per_block) * problem.a_element_bytes +
+         static_cast<double>(traits.n_per_block) * problem.b_element_bytes);
+    cost.compute_efficiency = std::min(1., cost.arithmetic_intensity / gpu.flops_per_byte);
+
+    cost.relative_time = 1. / (cost.tile_efficiency * cost.k_efficiency * cost.wave_efficiency *
+                               cost.compute_efficiency);
+
+    return cost;
+}
+
+// Indices of the instances in order of increasing estimated time. Instances without traits can
+// not be estimated and come last, in their original order.
+template <typename DeviceOpPtr>
+std::vector<std::size_t> rank_gemm_instances(const std::vector<DeviceOpPtr>& op_ptrs,
+                                             const GemmProblemShape& problem,
+                                             const GpuModel& gpu = GpuModel{})
+{
+    std::vector<double> relative_times;
+
+    for(const auto& op_ptr : op_ptrs)
+    {
+        relative_times.push_back(
+            estimate_gemm_instance_cost(op_ptr->GetInstanceTraits(), problem, gpu).relative_time);
+    }
+
+    std::vector<std::size_t> order(op_ptrs.size());
+
+    std::iota(order.begin(), order.end(), 0);
+
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t i, std::size_t j) {
+        return relative_times[i] < relative_times[j];
+    });
+
+    return order;
+}
+
+// Keep the top_k instances with the lowest estimated time, best first
+template <typename DeviceOpPtr>
+void prune_gemm_instances(std::vector<DeviceOpPtr>& op_ptrs,
+                          const GemmProblemShape& problem,
+                          std::size_t top_k,
+                          const GpuModel& gpu = GpuModel{})
+{
+    const auto order = rank_gemm_instances(op_ptrs, problem, gpu);
+
+    std::vector<DeviceOpPtr> pruned;
+
+    for(std::size_t i = 0; i < std::min(top_k, order.size()); ++i)
+    {
+        pruned.push_back(std::move(op_ptrs[order[i]]));
+    }
+
+    op_ptrs = std::move(pruned);
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "common_header.hpp"
+
+namespace ck {
+namespace utils {
+
+// Byte-capacity LRU cache. Entries are identified by an opaque 64-bit key.
+class LruCacheModel
+{
+    public:
+    explicit LruCacheModel(std::size_t capacity_bytes) : capacity_bytes_{capacity_bytes} {}
+
+    // returns true on hit; on miss the entry is inserted, evicting least recently used entries
+    bool Access(uint64_t key, std::size_t bytes)
+    {
+        auto it = entries_.find(key);
+
+        if(it != entries_.end())
+        {
+            lru_.splice(lru_.begin(), lru_, it->second.first);
+            return true;
+        }
+
+        while(!lru_.empty() && used_bytes_ + bytes > capacity_bytes_)
+        {
+            auto victim = entries_.find(lru_.back());
+            used_bytes_ -= victim->second.second;
+            entries_.erase(victim);
+            lru_.pop_back();
+        }
+
+        lru_.push_front(key);
+        entries_.emplace(key, std::make_pair(lru_.begin(), bytes));
+        used_bytes_ += bytes;
+
+        return false;
+    }
+
+    private:
+    std::size_t capacity_bytes_;
+    std::size_t used_bytes_ = 0;
+    std::list<uint64_t> lru_;
+    std::unordered_map<uint64_t, std::pair<std::list<uint64_t>::iterator, std::size_t>> entries_;
+};
+
+struct L2LocalityProblem
+{
+    index_t M;
+    index_t N;
+    index_t K;
+    index_t MPerBlock;
+    index_t NPerBlock;
+    index_t KPerBlock;
+    std::size_t a_element_bytes;
+    std::size_t b_element_bytes;
+    // number of blocks that are resident at the same time, usually num_cu * occupancy
+    index_t concurrent_blocks;
+    std::size_t l2_bytes;
+};
+
+struct L2LocalityStats
+{
+    std::size_t a_bytes_requested = 0;
+    std::size_t b_bytes_requested = 0;
+    std::size_t a_bytes_fetched   = 0;
+    std::size_t b_bytes_fetched   = 0;
+
+    // bytes fetched from memory by each wave of concurrent blocks
+    std::vector<std::size_t> wave_bytes_fetched;
+
+    std::size_t GetBytesFetched() const { return a_bytes_fetched + b_bytes_fetched; }
+
+    // average number of times each fetched A (B) byte is used
+    double GetAReuse() const
+    {
+        return a_bytes_fetched == 0 ? 0. : static_cast<double>(a_bytes_requested) / a_bytes_fetched;
+    }
+
+    double GetBReuse() const
+    {
+        return b_bytes_fetched == 0 ? 0. : static_cast<double>(b_bytes_requested) / b_bytes_fetched;
+    }
+
+    double GetHitRate() const
+    {
+        const std::size_t requested = a_bytes_requested + b_bytes_requested;
+
+        return requested == 0 ? 0. : 1. - static_cast<double>(GetBytesFetched()) / requested;
+    }
+
+    double GetAverageBytesFetchedPerWave() const
+    {
+        return wave_bytes_fetched.empty()
+                   ? 0.
+                   : static_cast<double>(GetBytesFetched()) / wave_bytes_fetched.size();
+    }
+};
+
+// Replays the C-tile sequence produced by a block-to-C-tile map and estimates how much of the A
+// and B panels is served from L2. Blocks are issued in waves of concurrent_blocks; inside a wave
+// all blocks advance through K in lockstep, each reading one MPerBlock x KPerBlock slice of A and
+// one KPerBlock x NPerBlock slice of B per step.
+template <typename BlockToCTileMap>
+L2LocalityStats simulate_l2_locality(const BlockToCTileMap& block_2_ctile_map,
+                                     index_t grid_size,
+                                     const L2LocalityProblem& problem)
+{
+    const index_t M0     = math::integer_divide_ceil(problem.M, problem.MPerBlock);
+    const index_t N0     = math::integer_divide_ceil(problem.N, problem.NPerBlock);
+    const index_t KIters = math::integer_divide_ceil(problem.K, problem.KPerBlock);
+
+    const std::size_t a_slice_bytes =
+        std::size_t(problem.MPerBlock) * problem.KPerBlock * problem.a_element_bytes;
+    const std::size_t b_slice_bytes =
+        std::size_t(problem.NPerBlock) * problem.KPerBlock * problem.b_element_bytes;
+
+    // key layout: [63] matrix, [62:32] row/column panel, [31:0] k-slice
+    const auto a_key = [](index_t m0, index_t k0) {
+        return (uint64_t(m0) << 32) | uint64_t(uint32_t(k0));
+    };
+    const auto b_key = [](index_t n0, index_t k0) {
+        return (uint64_t(1) << 63) | (uint64_t(n0) << 32) | uint64_t(uint32_t(k0));
+    };
+
+    LruCacheModel l2(problem.l2_bytes);
+    L2LocalityStats stats;
+
+    std::vector<std::pair<index_t, index_t>> wave_tiles;
+
+    for(index_t wave_begin = 0; wave_begin < grid_size; wave_begin += problem.concurrent_blocks)
+    {
+        const index_t wave_end = math::min(wave_begin + problem.concurrent_blocks, grid_size);
+
+        wave_tiles.clear();
+
+        for(index_t block_1d_id = wave_begin; block_1d_id < wave_end; ++block_1d_id)
+        {
+            const auto idx = block_2_ctile_map.CalculateBottomIndex(make_multi_index(block_1d_id));
+
+            if(block_2_ctile_map.ValidCTileIndex(idx, make_tuple(M0, N0)))
+            {
+                wave_tiles.emplace_back(idx[Number<0>{}], idx[Number<1>{}]);
+            }
+        }
+
+        std::size_t wave_bytes = 0;
+
+        for(index_t k0 = 0; k0 < KIters; ++k0)
+        {
+            for(const auto& tile : wave_tiles)
+            {
+                stats.a_bytes_requested += a_slice_bytes;
+                stats.b_bytes_requested += b_slice_bytes;
+
+                if(!l2.Access(a_key(tile.first, k0), a_slice_bytes))
+                {
+                    stats.a_bytes_fetched += a_slice_bytes;
+                    wave_bytes += a_slice_bytes;
+                }
+
+                if(!l2.Access(b_key(tile.second, k0), b_slice_bytes))
+                {
+                    stats.b_bytes_fetched += b_slice_bytes;
+                    wave_bytes += b_slice_bytes;
+                }
+            }
+        }
+
+        stats.wave_bytes_fetched.push_back(wave_bytes);
+    }
+
+    return stats;
+}
+
+} // namespace utils
+} // namespace ck
@@ -9,9 +9,11 @@
 #include <utility>
 #include <vector>
 
+#include "async_reference_verifier.hpp"
 #include "check_err.hpp"
 #include "device_base.hpp"
 #include "functional2.hpp"
+#include "verification_policy.hpp"
 
 namespace ck {
 namespace utils {
@@ -74,14 +76,20 @@ class OpInstanceRunEngine
     using InTensorsTuple   = std::tuple<TensorPtr<InArgTypes>...>;
     using DeviceBuffers    = std::vector<DeviceMemPtr>;
     using InArgsTypesTuple = std::tuple<InArgTypes...>;
+    using VerificationPolicyPtr =
+        std::shared_ptr<const VerificationPolicy<OutDataType, InArgTypes...>>;
 
     OpInstanceRunEngine() = delete;
 
+    // Outputs are compared with check_err, using the tolerances set by SetRtol() and SetAtol(),
+    // unless a verification policy is given. The reference op is not run for policies that do
+    // not need the full reference output.
     template <typename ReferenceOp = std::function<void()>>
     OpInstanceRunEngine(const OpInstanceT& op_instance,
-                        const ReferenceOp& reference_op = ReferenceOp{},
-                        bool do_verification            = true)
-        : op_instance_{op_instance}
+                        const ReferenceOp& reference_op           = ReferenceOp{},
+                        bool do_verification                      = true,
+                        VerificationPolicyPtr verification_policy = nullptr)
+        : op_instance_{op_instance}, verification_policy_{std::move(verification_policy)}
     {
         in_tensors_ = op_instance_.GetInputTensors();
         out_tensor_ = op_instance_.GetOutputTensor();
@@ -90,10 +98,13 @@ class OpInstanceRunEngine
                                          const Tensor<InArgTypes>&...,
                                          Tensor<OutDataType>&>)
         {
-            if(do_verification)
+            if(do_verification && NeedsFullReference())
             {
                 ref_output_ = op_instance_.GetOutputTensor();
-                CallRefOpUnpackArgs(reference_op, std::make_index_sequence<kNInArgs_>{});
+                // the reference runs on the host while instances are tested or profiled
+                ref_verifier_.Launch([this, reference_op]() {
+                    CallRefOpUnpackArgs(reference_op, std::make_index_sequence<kNInArgs_>{});
+                });
             }
         }
         AllocateDeviceInputTensors(std::make_index_sequence<kNInArgs_>{});
@@ -115,19 +126,23 @@ class OpInstanceRunEngine
                 op_ptr.get(), in_device_buffers_, out_device_buffer_);
             if(op_ptr->IsSupportedArgument(argument.get()))
             {
-                std::cout << "Testing instance: " << op_ptr->GetTypeString() << std::endl;
+                std::string op_name = op_ptr->GetTypeString();
+                std::cout << "Testing instance: " << op_name << std::endl;
                 invoker->Run(argument.get());
                 out_device_buffer_->FromDevice(out_tensor_->mData.data());
-                if(!ref_output_)
+                if(!ref_output_ && NeedsFullReference())
                 {
                     throw std::runtime_error(
                         "OpInstanceRunEngine::Test: Reference value not availabe."
                         " You have to provide reference function.");
                 }
-                // TODO: enable flexible use of custom check_error functions
-                bool inst_res = CheckErr(out_tensor_->mData, ref_output_->mData);
-                std::cout << (inst_res ? "SUCCESS" : "FAILURE") << std::endl;
-                res = res && inst_res;
+                // checked once the reference is ready, against a copy of the device output
+                ref_verifier_.Verify([this, op_name, out = *out_tensor_]() {
+                    bool inst_res = VerifyOutput(out);
+                    std::cout << (inst_res ? "SUCCESS" : "FAILURE") << ": " << op_name
+                              << std::endl;
+                    return inst_res;
+                });
                 out_device_buffer_->SetZero();
             }
             else
@@ -136,7 +151,7 @@ class OpInstanceRunEngine
                           << op_ptr->GetTypeString() << std::endl;
             }
         }
-        return res;
+        return ref_verifier_.Finish() && res;
     }
 
     template <typename OpInstancePtr>
@@ -176,20 +191,21 @@ class OpInstanceRunEngine
                 if(do_verification)
                 {
                     out_device_buffer_->FromDevice(out_tensor_->mData.data());
-                    if(!ref_output_)
+                    if(!ref_output_ && NeedsFullReference())
                     {
                         throw std::runtime_error(
                             "OpInstanceRunEngine::Profile: Reference value not availabe."
                             " You have to provide reference function.");
                     }
-                    // TODO: enable flexible use of custom check_error functions
-                    CheckErr(out_tensor_->mData, ref_output_->mData);
+                    ref_verifier_.Verify(
+                        [this, out = *out_tensor_]() { return VerifyOutput(out); });
 
                     if(do_log) {}
                 }
                 out_device_buffer_->SetZero();
             }
         }
+        ref_verifier_.Finish();
         return best_config;
     }
 
@@ -203,6 +219,27 @@ class OpInstanceRunEngine
         f(*std::get<Is>(in_tensors_)..., *ref_output_);
     }
 
+    bool NeedsFullReference() const
+    {
+        return !verification_policy_ || verification_policy_->NeedsFullReference();
+    }
+
+    bool VerifyOutput(const Tensor<OutDataType>& out) const
+    {
+        if(verification_policy_)
+        {
+            return CallPolicyUnpackArgs(out, std::make_index_sequence<kNInArgs_>{});
+        }
+
+        return CheckErr(out.mData, ref_output_->mData);
+    }
+
+    template <std::size_t... Is>
+    bool CallPolicyUnpackArgs(const Tensor<OutDataType>& out, std::index_sequence<Is...>) const
+    {
+        return verification_policy_->Verify(out, ref_output_.get(), *std::get<Is>(in_tensors_)...);
+    }
+
     template <std::size_t... Is>
     void AllocateDeviceInputTensors(std::index_sequence<Is...>)
     {
@@ -222,6 +259,7 @@ class OpInstanceRunEngine
 
     static constexpr std::size_t kNInArgs_ = std::tuple_size_v<InTensorsTuple>;
     const OpInstanceT& op_instance_;
+    VerificationPolicyPtr verification_policy_;
     double rtol_{1e-5};
     double atol_{1e-8};
 
@@ -232,6 +270,9 @@ class OpInstanceRunEngine
     DeviceBuffers in_device_buffers_;
     DeviceMemPtr out_device_buffer_;
 
+    // declared last, so that the reference is done before the tensors it uses are destroyed
+    AsyncReferenceVerifier ref_verifier_;
+
     template <typename T>
     bool CheckErr(const std::vector<T>& dev_out, const std::vector<T>& ref_out) const
     {
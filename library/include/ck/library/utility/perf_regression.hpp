@@ -0,0 +1,389 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <istream>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace ck {
+namespace utils {
+
+// One timed run of a device operation instance on a problem
+struct PerfRecord
+{
+    // ckProfiler operation, e.g. "gemm"
+    std::string op;
+    // by convention the arguments of the ckProfiler command that describe the problem, see
+    // GetPerfProblem()
+    std::string problem;
+    // GetTypeString() of the instance
+    std::string instance;
+    double time_ms = 0;
+};
+
+// Results files hold one tab-separated line "op problem instance time_ms" per record. Lines that
+// are empty or start with '#' are skipped.
+inline void WritePerfRecord(std::ostream& os, const PerfRecord& record)
+{
+    os << record.op << '\t' << record.problem << '\t' << record.instance << '\t' << record.time_ms
+       << '\n';
+}
+
+inline std::vector<PerfRecord> ReadPerfRecords(std::istream& is)
+{
+    std::vector<PerfRecord> records;
+
+    std::string line;
+
+    while(std::getline(is, line))
+    {
+        if(line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        std::vector<std::string> fields;
+        std::istringstream fields_stream(line);
+        std::string field;
+
+        while(std::getline(fields_stream, field, '\t'))
+        {
+            fields.push_back(field);
+        }
+
+        if(fields.size() != 4)
+        {
+            throw std::runtime_error("wrong! malformed perf record: " + line);
+        }
+
+        records.push_back({fields[0], fields[1], fields[2], std::stod(fields[3])});
+    }
+
+    return records;
+}
+
+inline std::vector<PerfRecord> ReadPerfRecords(const std::string& file_name)
+{
+    std::ifstream file(file_name);
+
+    if(!file)
+    {
+        throw std::runtime_error("wrong! cannot open " + file_name);
+    }
+
+    return ReadPerfRecords(file);
+}
+
+// The problem of a ckProfiler command, i.e. the arguments args that follow op without those that
+// only control the run: verification, initialization, printing of tensors and kernel timing. The
+// ops taking them as positional arguments take the four of them in a row; reduce takes the
+// --verify and --dumpout options and ends with initialization and kernel timing.
+inline std::string GetPerfProblem(const std::string& op, const std::vector<std::string>& args)
+{
+    std::vector<std::string> problem_args;
+
+    if(op == "reduce")
+    {
+        const std::size_t num_args = args.size() >= 2 ? args.size() - 2 : 0;
+
+        for(std::size_t i = 0; i < num_args; ++i)
+        {
+            const std::string& arg = args[i];
+
+            const bool is_short = arg == "-v" || arg == "-o";
+            const bool is_long  = arg == "--verify" || arg == "--dumpout";
+
+            if(is_short || is_long)
+            {
+                // the value is the next argument
+                ++i;
+            }
+            else if(arg.compare(0, 2, "-v") != 0 && arg.compare(0, 2, "-o") != 0 &&
+                    arg.compare(0, 9, "--verify=") != 0 && arg.compare(0, 10, "--dumpout=") != 0)
+            {
+                problem_args.push_back(arg);
+            }
+        }
+    }
+    else
+    {
+        // index in args of the verification argument, -1 for the host-only ops
+        int run_args_begin = 2;
+
+        if(op == "conv_fwd_bias_relu" || op == "conv_fwd_bias_relu_add" ||
+           op == "conv_fwd_bias_relu_atomic_add" || op == "conv1d_bwd_data" ||
+           op == "conv2d_bwd_data" || op == "conv3d_bwd_data" || op == "conv2d_bwd_weight")
+        {
+            run_args_begin = 4;
+        }
+        else if(op == "tile_locality" || op == "replay" || op == "compare")
+        {
+            run_args_begin = -1;
+        }
+
+        for(std::size_t i = 0; i < args.size(); ++i)
+        {
+            const int index = static_cast<int>(i);
+
+            if(run_args_begin < 0 || index < run_args_begin || index >= run_args_begin + 4)
+            {
+                problem_args.push_back(args[i]);
+            }
+        }
+    }
+
+    std::string problem;
+
+    for(const auto& arg : problem_args)
+    {
+        problem += (problem.empty() ? "" : " ") + arg;
+    }
+
+    return problem;
+}
+
+// Appends the records of ckProfiler to the file named by the environment variable
+// CK_PROFILER_RESULTS, if set. Repeated runs of the same command append repeated records, which
+// give the repeat statistics used by ComparePerfResults().
+class PerfResultsLog
+{
+    public:
+    static PerfResultsLog& GetInstance()
+    {
+        static PerfResultsLog log;
+
+        return log;
+    }
+
+    bool IsEnabled() const { return !file_name_.empty(); }
+
+    // op and problem of the records that follow
+    void SetProblem(const std::string& op, const std::string& problem)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        op_      = op;
+        problem_ = problem;
+    }
+
+    // untimed runs, which report 0 ms, are not recorded
+    void Record(const std::string& instance, double time_ms)
+    {
+        if(!IsEnabled() || !(time_ms > 0))
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::ofstream file(file_name_, std::ios::app);
+
+        if(!file)
+        {
+            throw std::runtime_error("wrong! cannot open " + file_name_);
+        }
+
+        WritePerfRecord(file, {op_, problem_, Sanitize(instance), time_ms});
+    }
+
+    private:
+    PerfResultsLog()
+    {
+        if(const char* file_name = std::getenv("CK_PROFILER_RESULTS"))
+        {
+            file_name_ = file_name;
+        }
+    }
+
+    // type strings may span several lines
+    static std::string Sanitize(std::string s)
+    {
+        std::replace_if(
+            s.begin(), s.end(), [](char c) { return c == '\t' || c == '\n' || c == '\r'; }, ' ');
+
+        while(!s.empty() && s.back() == ' ')
+        {
+            s.pop_back();
+        }
+
+        return s;
+    }
+
+    std::string file_name_;
+    std::string op_;
+    std::string problem_;
+    std::mutex mutex_;
+};
+
+struct PerfStats
+{
+    std::size_t num_samples = 0;
+    double mean             = 0;
+    // sample standard deviation, 0 for a single sample
+    double stddev = 0;
+};
+
+inline PerfStats GetPerfStats(const std::vector<double>& samples)
+{
+    PerfStats stats;
+
+    stats.num_samples = samples.size();
+
+    if(samples.empty())
+    {
+        return stats;
+    }
+
+    for(double s : samples)
+    {
+        stats.mean += s;
+    }
+
+    stats.mean /= samples.size();
+
+    if(samples.size() > 1)
+    {
+        double sum_sq = 0;
+
+        for(double s : samples)
+        {
+            sum_sq += (s - stats.mean) * (s - stats.mean);
+        }
+
+        stats.stddev = std::sqrt(sum_sq / (samples.size() - 1));
+    }
+
+    return stats;
+}
+
+struct PerfThresholds
+{
+    // relative slowdown of the mean time below which a change is never a regression
+    double min_slowdown = 0.05;
+    // the slowdown also has to exceed this many standard errors of the difference of the means
+    double num_sigma = 3;
+};
+
+struct PerfComparison
+{
+    std::string op;
+    std::string problem;
+    std::string instance;
+    PerfStats baseline;
+    PerfStats current;
+    // current.mean / baseline.mean - 1
+    double slowdown    = 0;
+    bool is_regression = false;
+};
+
+struct PerfComparisonReport
+{
+    // all matched records, largest slowdown first
+    std::vector<PerfComparison> comparisons;
+    // keys "op | problem | instance" only found in the baseline or the current results
+    std::vector<std::string> missing_in_current;
+    std::vector<std::string> missing_in_baseline;
+
+    std::size_t GetNumRegressions() const
+    {
+        return std::count_if(comparisons.begin(), comparisons.end(), [](const auto& c) {
+            return c.is_regression;
+        });
+    }
+};
+
+/**
+ * @brief      Matches records of a baseline and a current run by op, problem and instance and
+ *             flags slowdowns that are larger than the noise of the measurements.
+ *
+ *             Repeated records of a key are aggregated to their mean and standard deviation. A
+ *             key regressed if its mean time grew by more than min_slowdown and the growth is
+ *             more than num_sigma standard errors of the difference of the means, so that noisy
+ *             instances need a larger slowdown to be flagged. Without repeats only min_slowdown
+ *             applies.
+ */
+inline PerfComparisonReport ComparePerfResults(const std::vector<PerfRecord>& baseline,
+                                               const std::vector<PerfRecord>& current,
+                                               const PerfThresholds& thresholds = {})
+{
+    using Key = std::tuple<std::string, std::string, std::string>;
+
+    auto group = [](const std::vector<PerfRecord>& records) {
+        std::map<Key, std::vector<double>> samples;
+
+        for(const auto& r : records)
+        {
+            samples[Key{r.op, r.problem, r.instance}].push_back(r.time_ms);
+        }
+
+        return samples;
+    };
+
+    auto key_string = [](const Key& key) {
+        return std::get<0>(key) + " | " + std::get<1>(key) + " | " + std::get<2>(key);
+    };
+
+    const auto baseline_samples = group(baseline);
+    const auto current_samples  = group(current);
+
+    PerfComparisonReport report;
+
+    for(const auto& [key, samples] : baseline_samples)
+    {
+        auto it = current_samples.find(key);
+
+        if(it == current_samples.end())
+        {
+            report.missing_in_current.push_back(key_string(key));
+            continue;
+        }
+
+        PerfComparison c;
+
+        c.op       = std::get<0>(key);
+        c.problem  = std::get<1>(key);
+        c.instance = std::get<2>(key);
+        c.baseline = GetPerfStats(samples);
+        c.current  = GetPerfStats(it->second);
+
+        if(c.baseline.mean > 0)
+        {
+            c.slowdown = c.current.mean / c.baseline.mean - 1;
+        }
+
+        const double std_error =
+            std::sqrt(c.baseline.stddev * c.baseline.stddev / c.baseline.num_samples +
+                      c.current.stddev * c.current.stddev / c.current.num_samples);
+
+        c.is_regression = c.slowdown > thresholds.min_slowdown &&
+                          c.current.mean - c.baseline.mean > thresholds.num_sigma * std_error;
+
+        report.comparisons.push_back(c);
+    }
+
+    for(const auto& [key, samples] : current_samples)
+    {
+        if(baseline_samples.count(key) == 0)
+        {
+            report.missing_in_baseline.push_back(key_string(key));
+        }
+    }
+
+    std::stable_sort(report.comparisons.begin(),
+                     report.comparisons.end(),
+                     [](const auto& a, const auto& b) { return a.slowdown > b.slowdown; });
+
+    return report;
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,267 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "check_err.hpp"
+#include "host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+
+/**
+ * @brief      Compares the output of a device operation instance against a reference.
+ *
+ *             A policy gets the device output, the reference output and the input tensors of
+ *             the operation. Policies that return false from NeedsFullReference() check the
+ *             output without a reference output, which is then not computed, and get a nullptr
+ *             instead.
+ */
+template <typename OutDataType, typename... InArgTypes>
+class VerificationPolicy
+{
+    public:
+    virtual ~VerificationPolicy() {}
+
+    virtual bool NeedsFullReference() const { return true; }
+
+    virtual bool Verify(const Tensor<OutDataType>& out,
+                        const Tensor<OutDataType>* p_ref,
+                        const Tensor<InArgTypes>&... in) const = 0;
+};
+
+// |out - ref| <= atol + rtol * |ref| for all elements, exact match for integer outputs
+template <typename OutDataType, typename... InArgTypes>
+class ToleranceVerification : public VerificationPolicy<OutDataType, InArgTypes...>
+{
+    public:
+    ToleranceVerification(double rtol, double atol) : rtol_{rtol}, atol_{atol} {}
+
+    bool Verify(const Tensor<OutDataType>& out,
+                const Tensor<OutDataType>* p_ref,
+                const Tensor<InArgTypes>&...) const override
+    {
+        return check_err(out.mData, p_ref->mData, "Error: incorrect results!", rtol_, atol_);
+    }
+
+    double GetRtol() const { return rtol_; }
+    double GetAtol() const { return atol_; }
+
+    private:
+    double rtol_;
+    double atol_;
+};
+
+// Tolerances of outputs that accumulate reduce_length products or elements, e.g. the K of a GEMM.
+// Rounding errors of the accumulation are assumed to be independent, so the tolerances grow with
+// the square root of the reduce length.
+template <typename OutDataType, typename... InArgTypes>
+class ReductionToleranceVerification : public ToleranceVerification<OutDataType, InArgTypes...>
+{
+    public:
+    ReductionToleranceVerification(std::size_t reduce_length, double rtol, double atol)
+        : ToleranceVerification<OutDataType, InArgTypes...>{
+              rtol * std::sqrt(static_cast<double>(std::max<std::size_t>(reduce_length, 1))),
+              atol * std::sqrt(static_cast<double>(std::max<std::size_t>(reduce_length, 1)))}
+    {
+    }
+};
+
+// bit-exact match, e.g. for integer requantization
+template <typename OutDataType, typename... InArgTypes>
+class ExactVerification : public VerificationPolicy<OutDataType, InArgTypes...>
+{
+    public:
+    bool Verify(const Tensor<OutDataType>& out,
+                const Tensor<OutDataType>* p_ref,
+                const Tensor<InArgTypes>&...) const override
+    {
+        const auto& ref = p_ref->mData;
+
+        if(out.mData.size() != ref.size())
+        {
+            std::cout << "out.size() != ref.size(), :" << out.mData.size() << " != " << ref.size()
+                      << std::endl;
+            return false;
+        }
+
+        std::size_t err_count = 0;
+
+        for(std::size_t i = 0; i < ref.size(); ++i)
+        {
+            if(std::memcmp(&out.mData[i], &ref[i], sizeof(OutDataType)) != 0)
+            {
+                if(++err_count < 5)
+                {
+                    std::cout << "out[" << i << "] != ref[" << i
+                              << "]: " << ck::type_convert<float>(out.mData[i])
+                              << " != " << ck::type_convert<float>(ref[i]) << std::endl;
+                }
+            }
+        }
+
+        if(err_count > 0)
+        {
+            std::cout << "Error: " << err_count << " results are not bit-exact!" << std::endl;
+        }
+
+        return err_count == 0;
+    }
+};
+
+/**
+ * @brief      Checks a random sample of the output against a point-wise reference.
+ *
+ *             Only the sampled outputs are computed by the reference, so verification cost no
+ *             longer grows with the size of the problem. The number of samples is chosen such
+ *             that, if at least a fraction detect_fraction of the outputs is wrong, at least one of
+ *             them is sampled with probability confidence. All corners of the output are checked
+ *             in addition, since boundary tiles are where most indexing bugs show up.
+ */
+template <typename OutDataType, typename... InArgTypes>
+class SampledVerification : public VerificationPolicy<OutDataType, InArgTypes...>
+{
+    public:
+    // returns the reference value of the output at the given multi-index
+    using PointReference =
+        std::function<double(const Tensor<InArgTypes>&..., const std::vector<std::size_t>&)>;
+
+    SampledVerification(PointReference point_reference,
+                        double rtol,
+                        double atol,
+                        double detect_fraction = 1e-3,
+                        double confidence      = 0.999,
+                        unsigned seed          = 5489)
+        : point_reference_{std::move(point_reference)},
+          rtol_{rtol},
+          atol_{atol},
+          num_samples_{GetNumSamples(detect_fraction, confidence)},
+          seed_{seed}
+    {
+    }
+
+    // smallest n with 1 - (1 - detect_fraction)^n >= confidence
+    static std::size_t GetNumSamples(double detect_fraction, double confidence)
+    {
+        // the number of samples is infinite or undefined otherwise
+        if(!(detect_fraction > 0) || !(confidence >= 0 && confidence < 1))
+        {
+            throw std::runtime_error(
+                "wrong! detect_fraction must be in (0, 1] and confidence in [0, 1)");
+        }
+
+        if(detect_fraction >= 1)
+        {
+            return 1;
+        }
+
+        return static_cast<std::size_t>(
+            std::ceil(std::log(1 - confidence) / std::log(1 - detect_fraction)));
+    }
+
+    std::size_t GetNumSamples() const { return num_samples_; }
+
+    bool NeedsFullReference() const override { return false; }
+
+    bool Verify(const Tensor<OutDataType>& out,
+                const Tensor<OutDataType>*,
+                const Tensor<InArgTypes>&... in) const override
+    {
+        const auto& lengths    = out.mDesc.GetLengths();
+        const std::size_t rank = lengths.size();
+
+        if(out.mDesc.GetElementSize() == 0)
+        {
+            return true;
+        }
+
+        std::vector<std::vector<std::size_t>> indices;
+
+        // corners
+        for(std::size_t corner = 0; corner < (std::size_t(1) << rank); ++corner)
+        {
+            std::vector<std::size_t> idx(rank);
+
+            for(std::size_t d = 0; d < rank; ++d)
+            {
+                idx[d] = (corner >> d) & 1 ? lengths[d] - 1 : 0;
+            }
+
+            indices.push_back(idx);
+        }
+
+        std::mt19937_64 gen(seed_);
+
+        for(std::size_t i = 0; i < num_samples_; ++i)
+        {
+            std::vector<std::size_t> idx(rank);
+
+            for(std::size_t d = 0; d < rank; ++d)
+            {
+                idx[d] = std::uniform_int_distribution<std::size_t>(0, lengths[d] - 1)(gen);
+            }
+
+            indices.push_back(idx);
+        }
+
+        std::size_t err_count = 0;
+        double max_err        = 0;
+
+        for(const auto& idx : indices)
+        {
+            const double o   = ck::type_convert<float>(out(idx));
+            const double r   = point_reference_(in..., idx);
+            const double err = std::abs(o - r);
+
+            if(err > atol_ + rtol_ * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
+            {
+                max_err = std::max(max_err, err);
+
+                if(++err_count < 5)
+                {
+                    std::cout << std::setw(12) << std::setprecision(7) << "out" << LogIndex(idx)
+                              << " != ref" << LogIndex(idx) << ": " << o << " != " << r
+                              << std::endl;
+                }
+            }
+        }
+
+        if(err_count > 0)
+        {
+            std::cout << "Error: " << err_count << " of " << indices.size()
+                      << " sampled results are incorrect, max err: " << max_err << std::endl;
+        }
+
+        return err_count == 0;
+    }
+
+    private:
+    static std::string LogIndex(const std::vector<std::size_t>& idx)
+    {
+        std::string s = "[";
+
+        for(std::size_t d = 0; d < idx.size(); ++d)
+        {
+            s += (d == 0 ? "" : ", ") + std::to_string(idx[d]);
+        }
+
+        return s + "]";
+    }
+
+    PointReference point_reference_;
+    double rtol_;
+    double atol_;
+    std::size_t num_samples_;
+    unsigned seed_;
+};
+
+} // namespace utils
+} // namespace ck
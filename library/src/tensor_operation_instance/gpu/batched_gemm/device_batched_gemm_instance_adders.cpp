@@ -0,0 +1,70 @@
+#include "config.hpp"
+#include "device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_batched_gemm_instance {
+
+void add_device_batched_gemm_xdl_bf16_bf16_bf16_gkm_gkn_gmn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_batched_gemm_xdl_bf16_bf16_bf16_gkm_gnk_gmn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_batched_gemm_xdl_bf16_bf16_bf16_gmk_gkn_gmn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_batched_gemm_xdl_bf16_bf16_bf16_gmk_gnk_gmn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_batched_gemm_xdl_f16_f16_f16_gkm_gkn_gmn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_batched_gemm_xdl_f16_f16_f16_gkm_gnk_gmn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_batched_gemm_xdl_f16_f16_f16_gmk_gkn_gmn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_batched_gemm_xdl_f16_f16_f16_gmk_gnk_gmn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_batched_gemm_xdl_f32_f32_f32_gkm_gkn_gmn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_batched_gemm_xdl_f32_f32_f32_gkm_gnk_gmn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_batched_gemm_xdl_f32_f32_f32_gmk_gkn_gmn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_batched_gemm_xdl_f32_f32_f32_gmk_gnk_gmn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_batched_gemm_xdl_int8_int8_int8_gkm_gkn_gmn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_batched_gemm_xdl_int8_int8_int8_gkm_gnk_gmn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_batched_gemm_xdl_int8_int8_int8_gmk_gkn_gmn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_batched_gemm_xdl_int8_int8_int8_gmk_gnk_gmn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+
+} // namespace device_batched_gemm_instance
+
+// Adds the add_device_*_instances functions of the batched_gemm family, called by
+// ck_get_device_operation_instance_adder when the library is first queried
+void add_device_batched_gemm_instance_adders(DeviceOperationInstanceAdders& adders)
+{
+    using namespace device_batched_gemm_instance;
+
+    add_device_batched_gemm_xdl_bf16_bf16_bf16_gkm_gkn_gmn_instances_adder(adders);
+    add_device_batched_gemm_xdl_bf16_bf16_bf16_gkm_gnk_gmn_instances_adder(adders);
+    add_device_batched_gemm_xdl_bf16_bf16_bf16_gmk_gkn_gmn_instances_adder(adders);
+    add_device_batched_gemm_xdl_bf16_bf16_bf16_gmk_gnk_gmn_instances_adder(adders);
+    add_device_batched_gemm_xdl_f16_f16_f16_gkm_gkn_gmn_instances_adder(adders);
+    add_device_batched_gemm_xdl_f16_f16_f16_gkm_gnk_gmn_instances_adder(adders);
+    add_device_batched_gemm_xdl_f16_f16_f16_gmk_gkn_gmn_instances_adder(adders);
+    add_device_batched_gemm_xdl_f16_f16_f16_gmk_gnk_gmn_instances_adder(adders);
+    add_device_batched_gemm_xdl_f32_f32_f32_gkm_gkn_gmn_instances_adder(adders);
+    add_device_batched_gemm_xdl_f32_f32_f32_gkm_gnk_gmn_instances_adder(adders);
+    add_device_batched_gemm_xdl_f32_f32_f32_gmk_gkn_gmn_instances_adder(adders);
+    add_device_batched_gemm_xdl_f32_f32_f32_gmk_gnk_gmn_instances_adder(adders);
+    add_device_batched_gemm_xdl_int8_int8_int8_gkm_gkn_gmn_instances_adder(adders);
+    add_device_batched_gemm_xdl_int8_int8_int8_gkm_gnk_gmn_instances_adder(adders);
+    add_device_batched_gemm_xdl_int8_int8_int8_gmk_gkn_gmn_instances_adder(adders);
+    add_device_batched_gemm_xdl_int8_int8_int8_gmk_gnk_gmn_instances_adder(adders);
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
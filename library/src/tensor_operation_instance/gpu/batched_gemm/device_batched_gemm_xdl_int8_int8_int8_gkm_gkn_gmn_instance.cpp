@@ -60,6 +60,9 @@ void add_device_batched_gemm_xdl_int8_int8_int8_gkm_gkn_gmn_instances(
                                    device_batched_gemm_xdl_int8_int8_int8_gkm_gkn_gmn_instances{});
 }
 
+CK_DEFINE_DEVICE_OPERATION_INSTANCE_ADDER(
+    add_device_batched_gemm_xdl_int8_int8_int8_gkm_gkn_gmn_instances)
+
 } // namespace device_batched_gemm_instance
 } // namespace device
 } // namespace tensor_operation
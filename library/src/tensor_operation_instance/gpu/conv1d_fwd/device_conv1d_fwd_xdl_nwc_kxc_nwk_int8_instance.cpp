@@ -105,6 +105,8 @@ void add_device_conv1d_fwd_xdl_nwc_kxc_nwk_int8_instances(
                                    device_conv1d_fwd_xdl_nwc_kxc_nwk_1x1_s1_p0_int8_instances{});
 }
 
+CK_DEFINE_DEVICE_OPERATION_INSTANCE_ADDER(add_device_conv1d_fwd_xdl_nwc_kxc_nwk_int8_instances)
+
 } // namespace device_conv1d_fwd_instance
 } // namespace device
 } // namespace tensor_operation
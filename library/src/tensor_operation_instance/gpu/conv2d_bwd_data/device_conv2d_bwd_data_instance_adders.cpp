@@ -0,0 +1,34 @@
+#include "config.hpp"
+#include "device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_conv2d_bwd_data_instance {
+
+void add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_bf16_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_f16_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_f32_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_int8_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+
+} // namespace device_conv2d_bwd_data_instance
+
+// Adds the add_device_*_instances functions of the conv2d_bwd_data family, called by
+// ck_get_device_operation_instance_adder when the library is first queried
+void add_device_conv2d_bwd_data_instance_adders(DeviceOperationInstanceAdders& adders)
+{
+    using namespace device_conv2d_bwd_data_instance;
+
+    add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_bf16_instances_adder(adders);
+    add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_f16_instances_adder(adders);
+    add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_f32_instances_adder(adders);
+    add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_int8_instances_adder(adders);
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
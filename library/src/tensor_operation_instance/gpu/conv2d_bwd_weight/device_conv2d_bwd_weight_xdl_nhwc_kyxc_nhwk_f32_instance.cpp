@@ -46,6 +46,9 @@ void add_device_conv2d_bwd_weight_xdl_nhwc_kyxc_nhwk_f32_instances(
                                    device_conv2d_bwd_weight_xdl_nhwc_kyxc_nhwk_f32_instances{});
 }
 
+CK_DEFINE_DEVICE_OPERATION_INSTANCE_ADDER(
+    add_device_conv2d_bwd_weight_xdl_nhwc_kyxc_nhwk_f32_instances)
+
 } // namespace device_conv2d_bwd_weight_instance
 } // namespace device
 } // namespace tensor_operation
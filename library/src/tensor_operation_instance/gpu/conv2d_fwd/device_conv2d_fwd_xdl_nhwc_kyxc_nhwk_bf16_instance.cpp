@@ -104,6 +104,8 @@ void add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_bf16_instances(
                                    device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_bf16_instances{});
 }
 
+CK_DEFINE_DEVICE_OPERATION_INSTANCE_ADDER(add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_bf16_instances)
+
 } // namespace device_conv2d_fwd_instance
 } // namespace device
 } // namespace tensor_operation
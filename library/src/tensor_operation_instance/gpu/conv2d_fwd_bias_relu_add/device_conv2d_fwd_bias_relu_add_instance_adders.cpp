@@ -0,0 +1,25 @@
+#include "config.hpp"
+#include "device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_conv2d_fwd_bias_activation_add_instance {
+
+void add_device_conv2d_fwd_xdl_c_shuffle_bias_relu_add_nhwc_kyxc_nhwk_f16_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+
+} // namespace device_conv2d_fwd_bias_activation_add_instance
+
+// Adds the add_device_*_instances functions of the conv2d_fwd_bias_relu_add family, called by
+// ck_get_device_operation_instance_adder when the library is first queried
+void add_device_conv2d_fwd_bias_relu_add_instance_adders(DeviceOperationInstanceAdders& adders)
+{
+    using namespace device_conv2d_fwd_bias_activation_add_instance;
+
+    add_device_conv2d_fwd_xdl_c_shuffle_bias_relu_add_nhwc_kyxc_nhwk_f16_instances_adder(adders);
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
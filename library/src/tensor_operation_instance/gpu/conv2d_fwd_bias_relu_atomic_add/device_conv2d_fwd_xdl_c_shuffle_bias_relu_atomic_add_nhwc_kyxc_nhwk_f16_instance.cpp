@@ -63,6 +63,9 @@ void add_device_conv2d_fwd_xdl_c_shuffle_bias_relu_atomic_add_nhwc_kyxc_nhwk_f16
     });
 }
 
+CK_DEFINE_DEVICE_OPERATION_INSTANCE_ADDER(
+    add_device_conv2d_fwd_xdl_c_shuffle_bias_relu_atomic_add_nhwc_kyxc_nhwk_f16_instances)
+
 } // namespace device_conv2d_fwd_bias_activation_atomic_add_instance
 } // namespace device
 } // namespace tensor_operation
@@ -0,0 +1,34 @@
+#include "config.hpp"
+#include "device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_conv3d_fwd_instance {
+
+void add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_bf16_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_f16_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_f32_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_int8_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+
+} // namespace device_conv3d_fwd_instance
+
+// Adds the add_device_*_instances functions of the conv3d_fwd family, called by
+// ck_get_device_operation_instance_adder when the library is first queried
+void add_device_conv3d_fwd_instance_adders(DeviceOperationInstanceAdders& adders)
+{
+    using namespace device_conv3d_fwd_instance;
+
+    add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_bf16_instances_adder(adders);
+    add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_f16_instances_adder(adders);
+    add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_f32_instances_adder(adders);
+    add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_int8_instances_adder(adders);
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
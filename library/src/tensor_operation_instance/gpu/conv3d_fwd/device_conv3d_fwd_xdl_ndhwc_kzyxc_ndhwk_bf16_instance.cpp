@@ -104,6 +104,9 @@ void add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_bf16_instances(
         instances, device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_1x1_s1_p0_bf16_instances{});
 }
 
+CK_DEFINE_DEVICE_OPERATION_INSTANCE_ADDER(
+    add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_bf16_instances)
+
 } // namespace device_conv3d_fwd_instance
 } // namespace device
 } // namespace tensor_operation
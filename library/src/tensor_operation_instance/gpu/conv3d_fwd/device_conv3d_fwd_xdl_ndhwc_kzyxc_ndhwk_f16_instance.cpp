@@ -104,6 +104,8 @@ void add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_f16_instances(
         instances, device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_1x1_s1_p0_f16_instances{});
 }
 
+CK_DEFINE_DEVICE_OPERATION_INSTANCE_ADDER(add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_f16_instances)
+
 } // namespace device_conv3d_fwd_instance
 } // namespace device
 } // namespace tensor_operation
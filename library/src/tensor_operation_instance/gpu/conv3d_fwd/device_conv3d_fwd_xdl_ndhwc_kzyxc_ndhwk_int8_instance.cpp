@@ -106,6 +106,9 @@ void add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_int8_instances(
         instances, device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_1x1_s1_p0_int8_instances{});
 }
 
+CK_DEFINE_DEVICE_OPERATION_INSTANCE_ADDER(
+    add_device_conv3d_fwd_xdl_ndhwc_kzyxc_ndhwk_int8_instances)
+
 } // namespace device_conv3d_fwd_instance
 } // namespace device
 } // namespace tensor_operation
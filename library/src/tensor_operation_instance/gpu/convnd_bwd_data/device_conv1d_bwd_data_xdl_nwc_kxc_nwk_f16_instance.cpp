@@ -80,6 +80,8 @@ void add_device_conv1d_bwd_data_xdl_nwc_kxc_nwk_f16_instances(
         instances, device_conv1d_bwd_data_xdl_nwc_kxc_nwk_1x1_s1_p0_f16_instances{});
 }
 
+CK_DEFINE_DEVICE_OPERATION_INSTANCE_ADDER(add_device_conv1d_bwd_data_xdl_nwc_kxc_nwk_f16_instances)
+
 } // namespace device_conv2d_bwd_data_instance
 } // namespace device
 } // namespace tensor_operation
@@ -0,0 +1,45 @@
+#include "config.hpp"
+#include "device_operation_instance.hpp"
+
+#ifndef CK_DEVICE_OPERATION_FAMILY_ADDERS
+#error "CK_DEVICE_OPERATION_FAMILY_ADDERS must name the add_device_*_instance_adders function"
+#endif
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// defined in <family>/device_<family>_instance_adders.cpp of the library being built
+void CK_DEVICE_OPERATION_FAMILY_ADDERS(DeviceOperationInstanceAdders& adders);
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+// Entry point of a per-family device operation library, looked up with dlsym by
+// DeviceOperationRegistry. Returns the add_device_*_instances function added under name by the
+// family of this library, and its signature, or nullptr if there is none.
+extern "C" void* ck_get_device_operation_instance_adder(const char* name, const char** signature)
+{
+    using ck::tensor_operation::device::DeviceOperationInstanceAdders;
+
+    // filled on the first query rather than by static initializers of the instance files
+    static const DeviceOperationInstanceAdders family_adders = [] {
+        DeviceOperationInstanceAdders adders;
+
+        ck::tensor_operation::device::CK_DEVICE_OPERATION_FAMILY_ADDERS(adders);
+
+        return adders;
+    }();
+
+    const auto it = family_adders.adders.find(name);
+
+    if(it == family_adders.adders.end())
+    {
+        return nullptr;
+    }
+
+    *signature = it->second.signature;
+
+    return it->second.function;
+}
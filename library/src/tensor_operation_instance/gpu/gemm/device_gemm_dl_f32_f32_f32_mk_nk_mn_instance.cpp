@@ -40,6 +40,8 @@ void add_device_gemm_dl_f32_f32_f32_mk_nk_mn_instances(
     add_device_operation_instances(instances, device_gemm_dl_f32_f32_f32_mk_nk_mn_instances{});
 }
 
+CK_DEFINE_DEVICE_OPERATION_INSTANCE_ADDER(add_device_gemm_dl_f32_f32_f32_mk_nk_mn_instances)
+
 } // namespace device_gemm_instance
 } // namespace device
 } // namespace tensor_operation
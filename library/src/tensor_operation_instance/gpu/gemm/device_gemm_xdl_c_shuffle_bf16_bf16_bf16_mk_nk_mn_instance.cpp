@@ -52,6 +52,9 @@ void add_device_gemm_xdl_c_shuffle_bf16_bf16_bf16_mk_nk_mn_instances(
                                    device_gemm_xdl_c_shuffle_bf16_bf16_bf16_mk_nk_mn_instances{});
 }
 
+CK_DEFINE_DEVICE_OPERATION_INSTANCE_ADDER(
+    add_device_gemm_xdl_c_shuffle_bf16_bf16_bf16_mk_nk_mn_instances)
+
 } // namespace device_gemm_instance
 } // namespace device
 } // namespace tensor_operation
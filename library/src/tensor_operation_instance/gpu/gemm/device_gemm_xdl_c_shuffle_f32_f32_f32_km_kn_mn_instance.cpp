@@ -54,6 +54,9 @@ void add_device_gemm_xdl_c_shuffle_f32_f32_f32_km_kn_mn_instances(
                                    device_gemm_xdl_c_shuffle_f32_f32_f32_km_kn_mn_instances{});
 }
 
+CK_DEFINE_DEVICE_OPERATION_INSTANCE_ADDER(
+    add_device_gemm_xdl_c_shuffle_f32_f32_f32_km_kn_mn_instances)
+
 } // namespace device_gemm_instance
 } // namespace device
 } // namespace tensor_operation
@@ -0,0 +1,34 @@
+#include "config.hpp"
+#include "device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_gemm_instance {
+
+void add_device_gemm_add_add_fastgelu_xdl_c_shuffle_f16_f16_f16_km_kn_mn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_gemm_add_add_fastgelu_xdl_c_shuffle_f16_f16_f16_km_nk_mn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_gemm_add_add_fastgelu_xdl_c_shuffle_f16_f16_f16_mk_kn_mn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_gemm_add_add_fastgelu_xdl_c_shuffle_f16_f16_f16_mk_nk_mn_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+
+} // namespace device_gemm_instance
+
+// Adds the add_device_*_instances functions of the gemm_add_add_fastgelu family, called by
+// ck_get_device_operation_instance_adder when the library is first queried
+void add_device_gemm_add_add_fastgelu_instance_adders(DeviceOperationInstanceAdders& adders)
+{
+    using namespace device_gemm_instance;
+
+    add_device_gemm_add_add_fastgelu_xdl_c_shuffle_f16_f16_f16_km_kn_mn_instances_adder(adders);
+    add_device_gemm_add_add_fastgelu_xdl_c_shuffle_f16_f16_f16_km_nk_mn_instances_adder(adders);
+    add_device_gemm_add_add_fastgelu_xdl_c_shuffle_f16_f16_f16_mk_kn_mn_instances_adder(adders);
+    add_device_gemm_add_add_fastgelu_xdl_c_shuffle_f16_f16_f16_mk_nk_mn_instances_adder(adders);
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
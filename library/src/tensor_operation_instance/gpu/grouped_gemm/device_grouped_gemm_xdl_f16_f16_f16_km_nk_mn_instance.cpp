@@ -47,6 +47,9 @@ void add_device_grouped_gemm_xdl_f16_f16_f16_km_nk_mn_instances(
                                    device_grouped_gemm_xdl_f16_f16_f16_km_nk_mn_instances{});
 }
 
+CK_DEFINE_DEVICE_OPERATION_INSTANCE_ADDER(
+    add_device_grouped_gemm_xdl_f16_f16_f16_km_nk_mn_instances)
+
 } // namespace device_grouped_gemm_instance
 } // namespace device
 } // namespace tensor_operation
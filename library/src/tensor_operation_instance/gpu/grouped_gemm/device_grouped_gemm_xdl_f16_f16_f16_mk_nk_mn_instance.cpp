@@ -67,6 +67,9 @@ void add_device_grouped_gemm_xdl_f16_f16_f16_mk_nk_mn_instances(
         instances, device_grouped_gemm_xdl_f16_f16_f16_mk_nk_mn_irregular_tile_instances{});
 }
 
+CK_DEFINE_DEVICE_OPERATION_INSTANCE_ADDER(
+    add_device_grouped_gemm_xdl_f16_f16_f16_mk_nk_mn_instances)
+
 } // namespace device_grouped_gemm_instance
 } // namespace device
 } // namespace tensor_operation
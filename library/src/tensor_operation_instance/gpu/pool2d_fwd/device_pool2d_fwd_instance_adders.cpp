@@ -0,0 +1,36 @@
+#include "config.hpp"
+#include "device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_pool2d_fwd_instance {
+
+void add_device_pool2d_fwd_nhwc_f16_max_instances_adder(DeviceOperationInstanceAdders& adders);
+void add_device_pool2d_fwd_nhwc_f16_max_index_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_pool2d_fwd_nhwc_f16_avg_instances_adder(DeviceOperationInstanceAdders& adders);
+void add_device_pool2d_fwd_nhwc_f32_max_instances_adder(DeviceOperationInstanceAdders& adders);
+void add_device_pool2d_fwd_nhwc_f32_max_index_instances_adder(
+    DeviceOperationInstanceAdders& adders);
+void add_device_pool2d_fwd_nhwc_f32_avg_instances_adder(DeviceOperationInstanceAdders& adders);
+
+} // namespace device_pool2d_fwd_instance
+
+// Adds the add_device_*_instances functions of the pool2d_fwd family, called by
+// ck_get_device_operation_instance_adder when the library is first queried
+void add_device_pool2d_fwd_instance_adders(DeviceOperationInstanceAdders& adders)
+{
+    using namespace device_pool2d_fwd_instance;
+
+    add_device_pool2d_fwd_nhwc_f16_max_instances_adder(adders);
+    add_device_pool2d_fwd_nhwc_f16_max_index_instances_adder(adders);
+    add_device_pool2d_fwd_nhwc_f16_avg_instances_adder(adders);
+    add_device_pool2d_fwd_nhwc_f32_max_instances_adder(adders);
+    add_device_pool2d_fwd_nhwc_f32_max_index_instances_adder(adders);
+    add_device_pool2d_fwd_nhwc_f32_avg_instances_adder(adders);
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
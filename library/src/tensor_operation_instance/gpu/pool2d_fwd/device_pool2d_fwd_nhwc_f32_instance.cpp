@@ -0,0 +1,58 @@
+#include <stdlib.h>
+
+#include "config.hpp"
+#include "device_pool2d_fwd_nhwc_nhwc.hpp"
+#include "device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_pool2d_fwd_instance {
+
+using F16 = ck::half_t;
+using F32 = float;
+
+// out[n, ho, wo, c] = reduce(in[n, hi, wi, c]) over the window of (ho, wo), vectorized along C
+template <ReduceTensorOp ReduceOpId, bool OutputIndex>
+using device_pool2d_fwd_nhwc_f32_instances = std::tuple<
+    // clang-format off
+        //#################################################|  InData|  OutData| AccData| ReduceOpId|  OutputIndex| BlockSize| MThreadCluster| KThreadCluster| MThreadSlice| KThreadSlice| InSrcOutDst|
+        //#################################################|    Type|     Type|    Type|           |             |          |           Size|           Size|         Size|         Size|  VectorSize|
+        DevicePool2dFwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<     F32,      F32,     F32, ReduceOpId,  OutputIndex,       256,            256,              1,            1,            1,           1>,
+        DevicePool2dFwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<     F32,      F32,     F32, ReduceOpId,  OutputIndex,       256,            256,              1,            1,            4,           1>,
+        DevicePool2dFwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<     F32,      F32,     F32, ReduceOpId,  OutputIndex,       256,            256,              1,            2,            1,           2>,
+        DevicePool2dFwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<     F32,      F32,     F32, ReduceOpId,  OutputIndex,       256,            256,              1,            4,            1,           4>,
+        DevicePool2dFwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<     F32,      F32,     F32, ReduceOpId,  OutputIndex,       256,            256,              1,            4,            4,           4>,
+        DevicePool2dFwd_Input_N_Hi_Wi_C_Output_N_Ho_Wo_C<     F32,      F32,     F32, ReduceOpId,  OutputIndex,       128,            128,              1,            4,            1,           4>
+    // clang-format on
+    >;
+
+void add_device_pool2d_fwd_nhwc_f32_max_instances(
+    std::vector<DevicePool2dFwdPtr<ReduceTensorOp::MAX>>& instances)
+{
+    add_device_operation_instances(
+        instances, device_pool2d_fwd_nhwc_f32_instances<ReduceTensorOp::MAX, false>{});
+}
+
+void add_device_pool2d_fwd_nhwc_f32_max_index_instances(
+    std::vector<DevicePool2dFwdPtr<ReduceTensorOp::MAX>>& instances)
+{
+    add_device_operation_instances(
+        instances, device_pool2d_fwd_nhwc_f32_instances<ReduceTensorOp::MAX, true>{});
+}
+
+void add_device_pool2d_fwd_nhwc_f32_avg_instances(
+    std::vector<DevicePool2dFwdPtr<ReduceTensorOp::AVG>>& instances)
+{
+    add_device_operation_instances(
+        instances, device_pool2d_fwd_nhwc_f32_instances<ReduceTensorOp::AVG, false>{});
+}
+
+CK_DEFINE_DEVICE_OPERATION_INSTANCE_ADDER(add_device_pool2d_fwd_nhwc_f32_max_instances)
+CK_DEFINE_DEVICE_OPERATION_INSTANCE_ADDER(add_device_pool2d_fwd_nhwc_f32_max_index_instances)
+CK_DEFINE_DEVICE_OPERATION_INSTANCE_ADDER(add_device_pool2d_fwd_nhwc_f32_avg_instances)
+
+} // namespace device_pool2d_fwd_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,76 @@
+#include "config.hpp"
+#include "device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_reduce_instance {
+
+void add_device_reduce_instance_blockwise_b16_f32_b16_adders(DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_blockwise_f16_f16_f16_adders(DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_blockwise_f16_f32_f16_adders(DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_blockwise_f32_f32_f32_adders(DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_blockwise_f32_f64_f32_adders(DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_blockwise_f64_f64_f64_adders(DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_blockwise_i8_i32_i8_adders(DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_blockwise_i8_i8_i8_adders(DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_multiblock_atomic_add_b16_f32_f32_adders(
+    DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_multiblock_atomic_add_f16_f32_f32_adders(
+    DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_multiblock_atomic_add_f32_f32_f32_adders(
+    DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_multiblock_atomic_add_f32_f64_f32_adders(
+    DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_multiblock_atomic_add_f64_f64_f64_adders(
+    DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_threadwise_b16_f32_b16_adders(
+    DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_threadwise_f16_f16_f16_adders(
+    DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_threadwise_f16_f32_f16_adders(
+    DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_threadwise_f32_f32_f32_adders(
+    DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_threadwise_f32_f64_f32_adders(
+    DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_threadwise_f64_f64_f64_adders(
+    DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_threadwise_i8_i32_i8_adders(DeviceOperationInstanceAdders& adders);
+void add_device_reduce_instance_threadwise_i8_i8_i8_adders(DeviceOperationInstanceAdders& adders);
+
+} // namespace device_reduce_instance
+
+// Adds the add_device_reduce_instance_* instantiations of the reduce family, named as by
+// ADD_REDUCE_INST_ADDER_BY_ID, called by ck_get_device_operation_instance_adder when the library
+// is first queried
+void add_device_reduce_instance_adders(DeviceOperationInstanceAdders& adders)
+{
+    using namespace device_reduce_instance;
+
+    add_device_reduce_instance_blockwise_b16_f32_b16_adders(adders);
+    add_device_reduce_instance_blockwise_f16_f16_f16_adders(adders);
+    add_device_reduce_instance_blockwise_f16_f32_f16_adders(adders);
+    add_device_reduce_instance_blockwise_f32_f32_f32_adders(adders);
+    add_device_reduce_instance_blockwise_f32_f64_f32_adders(adders);
+    add_device_reduce_instance_blockwise_f64_f64_f64_adders(adders);
+    add_device_reduce_instance_blockwise_i8_i32_i8_adders(adders);
+    add_device_reduce_instance_blockwise_i8_i8_i8_adders(adders);
+    add_device_reduce_instance_multiblock_atomic_add_b16_f32_f32_adders(adders);
+    add_device_reduce_instance_multiblock_atomic_add_f16_f32_f32_adders(adders);
+    add_device_reduce_instance_multiblock_atomic_add_f32_f32_f32_adders(adders);
+    add_device_reduce_instance_multiblock_atomic_add_f32_f64_f32_adders(adders);
+    add_device_reduce_instance_multiblock_atomic_add_f64_f64_f64_adders(adders);
+    add_device_reduce_instance_threadwise_b16_f32_b16_adders(adders);
+    add_device_reduce_instance_threadwise_f16_f16_f16_adders(adders);
+    add_device_reduce_instance_threadwise_f16_f32_f16_adders(adders);
+    add_device_reduce_instance_threadwise_f32_f32_f32_adders(adders);
+    add_device_reduce_instance_threadwise_f32_f64_f32_adders(adders);
+    add_device_reduce_instance_threadwise_f64_f64_f64_adders(adders);
+    add_device_reduce_instance_threadwise_i8_i32_i8_adders(adders);
+    add_device_reduce_instance_threadwise_i8_i8_i8_adders(adders);
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -1,4 +1,5 @@
 #include "device_reduce_instance_blockwise.hpp"
+#include "device_operation_instance.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -7,32 +8,40 @@ namespace device_reduce_instance {
 
 // clang-format off
 // InDataType | AccDataType | OutDataType | ReduceOpId | NanPropaOpt | IndicesOpt | Rank | NumReduceDim
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 2, 0, 0, 4, 3); // for MIN
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 2, 0, 0, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 2, 0, 0, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 2, 0, 0, 2, 1);       
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 3, 0, 0, 4, 3); // for MAX
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 3, 0, 0, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 3, 0, 0, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 3, 0, 0, 2, 1);       
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 4, 0, 0, 4, 3); // for AMAX
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 4, 0, 0, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 4, 0, 0, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 4, 0, 0, 2, 1);       
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 2, 0, 1, 4, 3); // for MIN
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 2, 0, 1, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 2, 0, 1, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 2, 0, 1, 2, 1);       
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 3, 0, 1, 4, 3); // for MAX
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 3, 0, 1, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 3, 0, 1, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 3, 0, 1, 2, 1);       
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 4, 0, 1, 4, 3); // for AMAX
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 4, 0, 1, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 4, 0, 1, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(half_t, half_t, half_t, 4, 0, 1, 2, 1);
+#define DEVICE_REDUCE_INSTANCE_LIST(F)                       \
+    F(half_t, half_t, half_t, 2, 0, 0, 4, 3); /* for MIN */  \
+    F(half_t, half_t, half_t, 2, 0, 0, 4, 4);                \
+    F(half_t, half_t, half_t, 2, 0, 0, 4, 1);                \
+    F(half_t, half_t, half_t, 2, 0, 0, 2, 1);                \
+    F(half_t, half_t, half_t, 3, 0, 0, 4, 3); /* for MAX */  \
+    F(half_t, half_t, half_t, 3, 0, 0, 4, 4);                \
+    F(half_t, half_t, half_t, 3, 0, 0, 4, 1);                \
+    F(half_t, half_t, half_t, 3, 0, 0, 2, 1);                \
+    F(half_t, half_t, half_t, 4, 0, 0, 4, 3); /* for AMAX */ \
+    F(half_t, half_t, half_t, 4, 0, 0, 4, 4);                \
+    F(half_t, half_t, half_t, 4, 0, 0, 4, 1);                \
+    F(half_t, half_t, half_t, 4, 0, 0, 2, 1);                \
+    F(half_t, half_t, half_t, 2, 0, 1, 4, 3); /* for MIN */  \
+    F(half_t, half_t, half_t, 2, 0, 1, 4, 4);                \
+    F(half_t, half_t, half_t, 2, 0, 1, 4, 1);                \
+    F(half_t, half_t, half_t, 2, 0, 1, 2, 1);                \
+    F(half_t, half_t, half_t, 3, 0, 1, 4, 3); /* for MAX */  \
+    F(half_t, half_t, half_t, 3, 0, 1, 4, 4);                \
+    F(half_t, half_t, half_t, 3, 0, 1, 4, 1);                \
+    F(half_t, half_t, half_t, 3, 0, 1, 2, 1);                \
+    F(half_t, half_t, half_t, 4, 0, 1, 4, 3); /* for AMAX */ \
+    F(half_t, half_t, half_t, 4, 0, 1, 4, 4);                \
+    F(half_t, half_t, half_t, 4, 0, 1, 4, 1);                \
+    F(half_t, half_t, half_t, 4, 0, 1, 2, 1);
 // clang-format on
 
+DEVICE_REDUCE_INSTANCE_LIST(ADD_BLOCKWISE_INST_BY_ID)
+
+void add_device_reduce_instance_blockwise_f16_f16_f16_adders(DeviceOperationInstanceAdders& adders)
+{
+    DEVICE_REDUCE_INSTANCE_LIST(ADD_BLOCKWISE_INST_ADDER_BY_ID)
+}
+
 } // namespace device_reduce_instance
 } // namespace device
 } // namespace tensor_operation
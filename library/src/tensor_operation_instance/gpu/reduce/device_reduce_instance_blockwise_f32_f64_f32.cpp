@@ -1,4 +1,5 @@
 #include "device_reduce_instance_blockwise.hpp"
+#include "device_operation_instance.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -7,20 +8,28 @@ namespace device_reduce_instance {
 
 // clang-format off
 // InDataType | AccDataType | OutDataType | ReduceOpId | NanPropaOpt | IndicesOpt | Rank | NumReduceDim
-ADD_BLOCKWISE_INST_BY_ID(float, double, float, 0, 0, 0, 4, 3); // for ADD
-ADD_BLOCKWISE_INST_BY_ID(float, double, float, 0, 0, 0, 4, 4);
-ADD_BLOCKWISE_INST_BY_ID(float, double, float, 0, 0, 0, 4, 1);
-ADD_BLOCKWISE_INST_BY_ID(float, double, float, 0, 0, 0, 2, 1);
-ADD_BLOCKWISE_INST_BY_ID(float, double, float, 5, 0, 0, 4, 3); // for AVG
-ADD_BLOCKWISE_INST_BY_ID(float, double, float, 5, 0, 0, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(float, double, float, 5, 0, 0, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(float, double, float, 5, 0, 0, 2, 1);       
-ADD_BLOCKWISE_INST_BY_ID(float, double, float, 7, 0, 0, 4, 3); // for NORM2
-ADD_BLOCKWISE_INST_BY_ID(float, double, float, 7, 0, 0, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(float, double, float, 7, 0, 0, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(float, double, float, 7, 0, 0, 2, 1);
+#define DEVICE_REDUCE_INSTANCE_LIST(F)                      \
+    F(float, double, float, 0, 0, 0, 4, 3); /* for ADD */   \
+    F(float, double, float, 0, 0, 0, 4, 4);                 \
+    F(float, double, float, 0, 0, 0, 4, 1);                 \
+    F(float, double, float, 0, 0, 0, 2, 1);                 \
+    F(float, double, float, 5, 0, 0, 4, 3); /* for AVG */   \
+    F(float, double, float, 5, 0, 0, 4, 4);                 \
+    F(float, double, float, 5, 0, 0, 4, 1);                 \
+    F(float, double, float, 5, 0, 0, 2, 1);                 \
+    F(float, double, float, 7, 0, 0, 4, 3); /* for NORM2 */ \
+    F(float, double, float, 7, 0, 0, 4, 4);                 \
+    F(float, double, float, 7, 0, 0, 4, 1);                 \
+    F(float, double, float, 7, 0, 0, 2, 1);
 // clang-format on
 
+DEVICE_REDUCE_INSTANCE_LIST(ADD_BLOCKWISE_INST_BY_ID)
+
+void add_device_reduce_instance_blockwise_f32_f64_f32_adders(DeviceOperationInstanceAdders& adders)
+{
+    DEVICE_REDUCE_INSTANCE_LIST(ADD_BLOCKWISE_INST_ADDER_BY_ID)
+}
+
 } // namespace device_reduce_instance
 } // namespace device
 } // namespace tensor_operation
@@ -1,4 +1,5 @@
 #include "device_reduce_instance_blockwise.hpp"
+#include "device_operation_instance.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -7,44 +8,52 @@ namespace device_reduce_instance {
 
 // clang-format off
 // InDataType | AccDataType | OutDataType | ReduceOpId | NanPropaOpt | IndicesOpt | Rank | NumReduceDim
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 0, 0, 0, 4, 3); // for ADD
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 0, 0, 0, 4, 4);
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 0, 0, 0, 4, 1);
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 0, 0, 0, 2, 1);
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 5, 0, 0, 4, 3); // for AVG
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 5, 0, 0, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 5, 0, 0, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 5, 0, 0, 2, 1);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 7, 0, 0, 4, 3); // for NORM2
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 7, 0, 0, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 7, 0, 0, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 7, 0, 0, 2, 1);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 2, 0, 0, 4, 3); // for MIN
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 2, 0, 0, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 2, 0, 0, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 2, 0, 0, 2, 1);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 3, 0, 0, 4, 3); // for MAX
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 3, 0, 0, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 3, 0, 0, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 3, 0, 0, 2, 1);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 4, 0, 0, 4, 3); // for AMAX
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 4, 0, 0, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 4, 0, 0, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 4, 0, 0, 2, 1);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 2, 0, 1, 4, 3); // for MIN
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 2, 0, 1, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 2, 0, 1, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 2, 0, 1, 2, 1);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 3, 0, 1, 4, 3); // for MAX
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 3, 0, 1, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 3, 0, 1, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 3, 0, 1, 2, 1);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 4, 0, 1, 4, 3); // for AMAX
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 4, 0, 1, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 4, 0, 1, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(double, double, double, 4, 0, 1, 2, 1);
+#define DEVICE_REDUCE_INSTANCE_LIST(F)                        \
+    F(double, double, double, 0, 0, 0, 4, 3); /* for ADD */   \
+    F(double, double, double, 0, 0, 0, 4, 4);                 \
+    F(double, double, double, 0, 0, 0, 4, 1);                 \
+    F(double, double, double, 0, 0, 0, 2, 1);                 \
+    F(double, double, double, 5, 0, 0, 4, 3); /* for AVG */   \
+    F(double, double, double, 5, 0, 0, 4, 4);                 \
+    F(double, double, double, 5, 0, 0, 4, 1);                 \
+    F(double, double, double, 5, 0, 0, 2, 1);                 \
+    F(double, double, double, 7, 0, 0, 4, 3); /* for NORM2 */ \
+    F(double, double, double, 7, 0, 0, 4, 4);                 \
+    F(double, double, double, 7, 0, 0, 4, 1);                 \
+    F(double, double, double, 7, 0, 0, 2, 1);                 \
+    F(double, double, double, 2, 0, 0, 4, 3); /* for MIN */   \
+    F(double, double, double, 2, 0, 0, 4, 4);                 \
+    F(double, double, double, 2, 0, 0, 4, 1);                 \
+    F(double, double, double, 2, 0, 0, 2, 1);                 \
+    F(double, double, double, 3, 0, 0, 4, 3); /* for MAX */   \
+    F(double, double, double, 3, 0, 0, 4, 4);                 \
+    F(double, double, double, 3, 0, 0, 4, 1);                 \
+    F(double, double, double, 3, 0, 0, 2, 1);                 \
+    F(double, double, double, 4, 0, 0, 4, 3); /* for AMAX */  \
+    F(double, double, double, 4, 0, 0, 4, 4);                 \
+    F(double, double, double, 4, 0, 0, 4, 1);                 \
+    F(double, double, double, 4, 0, 0, 2, 1);                 \
+    F(double, double, double, 2, 0, 1, 4, 3); /* for MIN */   \
+    F(double, double, double, 2, 0, 1, 4, 4);                 \
+    F(double, double, double, 2, 0, 1, 4, 1);                 \
+    F(double, double, double, 2, 0, 1, 2, 1);                 \
+    F(double, double, double, 3, 0, 1, 4, 3); /* for MAX */   \
+    F(double, double, double, 3, 0, 1, 4, 4);                 \
+    F(double, double, double, 3, 0, 1, 4, 1);                 \
+    F(double, double, double, 3, 0, 1, 2, 1);                 \
+    F(double, double, double, 4, 0, 1, 4, 3); /* for AMAX */  \
+    F(double, double, double, 4, 0, 1, 4, 4);                 \
+    F(double, double, double, 4, 0, 1, 4, 1);                 \
+    F(double, double, double, 4, 0, 1, 2, 1);
 // clang-format on
 
+DEVICE_REDUCE_INSTANCE_LIST(ADD_BLOCKWISE_INST_BY_ID)
+
+void add_device_reduce_instance_blockwise_f64_f64_f64_adders(DeviceOperationInstanceAdders& adders)
+{
+    DEVICE_REDUCE_INSTANCE_LIST(ADD_BLOCKWISE_INST_ADDER_BY_ID)
+}
+
 } // namespace device_reduce_instance
 } // namespace device
 } // namespace tensor_operation
@@ -1,4 +1,5 @@
 #include "device_reduce_instance_blockwise.hpp"
+#include "device_operation_instance.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -7,32 +8,40 @@ namespace device_reduce_instance {
 
 // clang-format off
 // InDataType | AccDataType | OutDataType | ReduceOpId | NanPropaOpt | IndicesOpt | Rank | NumReduceDim
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 2, 0, 0, 4, 3); // for MIN
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 2, 0, 0, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 2, 0, 0, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 2, 0, 0, 2, 1);       
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 3, 0, 0, 4, 3); // for MAX
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 3, 0, 0, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 3, 0, 0, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 3, 0, 0, 2, 1);       
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 4, 0, 0, 4, 3); // for AMAX
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 4, 0, 0, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 4, 0, 0, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 4, 0, 0, 2, 1);       
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 2, 0, 1, 4, 3); // for MIN
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 2, 0, 1, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 2, 0, 1, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 2, 0, 1, 2, 1);       
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 3, 0, 1, 4, 3); // for MAX
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 3, 0, 1, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 3, 0, 1, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 3, 0, 1, 2, 1);       
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 4, 0, 1, 4, 3); // for AMAX
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 4, 0, 1, 4, 4);       
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 4, 0, 1, 4, 1);       
-ADD_BLOCKWISE_INST_BY_ID(int8_t, int8_t, int8_t, 4, 0, 1, 2, 1);
+#define DEVICE_REDUCE_INSTANCE_LIST(F)                       \
+    F(int8_t, int8_t, int8_t, 2, 0, 0, 4, 3); /* for MIN */  \
+    F(int8_t, int8_t, int8_t, 2, 0, 0, 4, 4);                \
+    F(int8_t, int8_t, int8_t, 2, 0, 0, 4, 1);                \
+    F(int8_t, int8_t, int8_t, 2, 0, 0, 2, 1);                \
+    F(int8_t, int8_t, int8_t, 3, 0, 0, 4, 3); /* for MAX */  \
+    F(int8_t, int8_t, int8_t, 3, 0, 0, 4, 4);                \
+    F(int8_t, int8_t, int8_t, 3, 0, 0, 4, 1);                \
+    F(int8_t, int8_t, int8_t, 3, 0, 0, 2, 1);                \
+    F(int8_t, int8_t, int8_t, 4, 0, 0, 4, 3); /* for AMAX */ \
+    F(int8_t, int8_t, int8_t, 4, 0, 0, 4, 4);                \
+    F(int8_t, int8_t, int8_t, 4, 0, 0, 4, 1);                \
+    F(int8_t, int8_t, int8_t, 4, 0, 0, 2, 1);                \
+    F(int8_t, int8_t, int8_t, 2, 0, 1, 4, 3); /* for MIN */  \
+    F(int8_t, int8_t, int8_t, 2, 0, 1, 4, 4);                \
+    F(int8_t, int8_t, int8_t, 2, 0, 1, 4, 1);                \
+    F(int8_t, int8_t, int8_t, 2, 0, 1, 2, 1);                \
+    F(int8_t, int8_t, int8_t, 3, 0, 1, 4, 3); /* for MAX */  \
+    F(int8_t, int8_t, int8_t, 3, 0, 1, 4, 4);                \
+    F(int8_t, int8_t, int8_t, 3, 0, 1, 4, 1);                \
+    F(int8_t, int8_t, int8_t, 3, 0, 1, 2, 1);                \
+    F(int8_t, int8_t, int8_t, 4, 0, 1, 4, 3); /* for AMAX */ \
+    F(int8_t, int8_t, int8_t, 4, 0, 1, 4, 4);                \
+    F(int8_t, int8_t, int8_t, 4, 0, 1, 4, 1);                \
+    F(int8_t, int8_t, int8_t, 4, 0, 1, 2, 1);
 // clang-format on
 
+DEVICE_REDUCE_INSTANCE_LIST(ADD_BLOCKWISE_INST_BY_ID)
+
+void add_device_reduce_instance_blockwise_i8_i8_i8_adders(DeviceOperationInstanceAdders& adders)
+{
+    DEVICE_REDUCE_INSTANCE_LIST(ADD_BLOCKWISE_INST_ADDER_BY_ID)
+}
+
 } // namespace device_reduce_instance
 } // namespace device
 } // namespace tensor_operation
@@ -1,4 +1,5 @@
 #include "device_reduce_instance_multiblock_atomic_add.hpp"
+#include "device_operation_instance.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -7,16 +8,25 @@ namespace device_reduce_instance {
 
 // clang-format off
 // InDataType | AccDataType | OutDataType | ReduceOpId | NanPropaOpt | IndicesOpt | Rank | NumReduceDim
-ADD_MULTIBLOCK_ATOMIC_ADD_INST_BY_ID(double, double, double, 0, 0, 0, 4, 3); // for ADD
-ADD_MULTIBLOCK_ATOMIC_ADD_INST_BY_ID(double, double, double, 0, 0, 0, 4, 4);
-ADD_MULTIBLOCK_ATOMIC_ADD_INST_BY_ID(double, double, double, 0, 0, 0, 4, 1);
-ADD_MULTIBLOCK_ATOMIC_ADD_INST_BY_ID(double, double, double, 0, 0, 0, 2, 1);
-ADD_MULTIBLOCK_ATOMIC_ADD_INST_BY_ID(double, double, double, 5, 0, 0, 4, 3); // for AVG
-ADD_MULTIBLOCK_ATOMIC_ADD_INST_BY_ID(double, double, double, 5, 0, 0, 4, 4);       
-ADD_MULTIBLOCK_ATOMIC_ADD_INST_BY_ID(double, double, double, 5, 0, 0, 4, 1);       
-ADD_MULTIBLOCK_ATOMIC_ADD_INST_BY_ID(double, double, double, 5, 0, 0, 2, 1);
+#define DEVICE_REDUCE_INSTANCE_LIST(F)                      \
+    F(double, double, double, 0, 0, 0, 4, 3); /* for ADD */ \
+    F(double, double, double, 0, 0, 0, 4, 4);               \
+    F(double, double, double, 0, 0, 0, 4, 1);               \
+    F(double, double, double, 0, 0, 0, 2, 1);               \
+    F(double, double, double, 5, 0, 0, 4, 3); /* for AVG */ \
+    F(double, double, double, 5, 0, 0, 4, 4);               \
+    F(double, double, double, 5, 0, 0, 4, 1);               \
+    F(double, double, double, 5, 0, 0, 2, 1);
 // clang-format on
 
+DEVICE_REDUCE_INSTANCE_LIST(ADD_MULTIBLOCK_ATOMIC_ADD_INST_BY_ID)
+
+void add_device_reduce_instance_multiblock_atomic_add_f64_f64_f64_adders(
+    DeviceOperationInstanceAdders& adders)
+{
+    DEVICE_REDUCE_INSTANCE_LIST(ADD_MULTIBLOCK_ATOMIC_ADD_INST_ADDER_BY_ID)
+}
+
 } // namespace device_reduce_instance
 } // namespace device
 } // namespace tensor_operation
@@ -1,4 +1,5 @@
 #include "device_reduce_instance_threadwise.hpp"
+#include "device_operation_instance.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -7,17 +8,25 @@ namespace device_reduce_instance {
 
 // clang-format off
 // InDataType | AccDataType | OutDataType | ReduceOpId | NanPropaOpt | IndicesOpt | Rank | NumReduceDim
-ADD_THREADWISE_INST_BY_ID(int8_t, int32_t, int8_t, 0, 0, 0, 4, 3); // for ADD
-ADD_THREADWISE_INST_BY_ID(int8_t, int32_t, int8_t, 0, 0, 0, 4, 4);
-ADD_THREADWISE_INST_BY_ID(int8_t, int32_t, int8_t, 0, 0, 0, 4, 1);
-ADD_THREADWISE_INST_BY_ID(int8_t, int32_t, int8_t, 0, 0, 0, 2, 1);
-ADD_THREADWISE_INST_BY_ID(int8_t, int32_t, int8_t, 5, 0, 0, 4, 3); // for AVG
-ADD_THREADWISE_INST_BY_ID(int8_t, int32_t, int8_t, 5, 0, 0, 4, 4);
-ADD_THREADWISE_INST_BY_ID(int8_t, int32_t, int8_t, 5, 0, 0, 4, 1);
-ADD_THREADWISE_INST_BY_ID(int8_t, int32_t, int8_t, 5, 0, 0, 2, 1);
+#define DEVICE_REDUCE_INSTANCE_LIST(F)                       \
+    F(int8_t, int32_t, int8_t, 0, 0, 0, 4, 3); /* for ADD */ \
+    F(int8_t, int32_t, int8_t, 0, 0, 0, 4, 4);               \
+    F(int8_t, int32_t, int8_t, 0, 0, 0, 4, 1);               \
+    F(int8_t, int32_t, int8_t, 0, 0, 0, 2, 1);               \
+    F(int8_t, int32_t, int8_t, 5, 0, 0, 4, 3); /* for AVG */ \
+    F(int8_t, int32_t, int8_t, 5, 0, 0, 4, 4);               \
+    F(int8_t, int32_t, int8_t, 5, 0, 0, 4, 1);               \
+    F(int8_t, int32_t, int8_t, 5, 0, 0, 2, 1);
 // clang-format on
+
+DEVICE_REDUCE_INSTANCE_LIST(ADD_THREADWISE_INST_BY_ID)
 // clang-format on
 
+void add_device_reduce_instance_threadwise_i8_i32_i8_adders(DeviceOperationInstanceAdders& adders)
+{
+    DEVICE_REDUCE_INSTANCE_LIST(ADD_THREADWISE_INST_ADDER_BY_ID)
+}
+
 } // namespace device_reduce_instance
 } // namespace device
 } // namespace tensor_operation
@@ -14,6 +14,7 @@ namespace conv {
  * @param[in]  filter_spatial_lengths  Filter spatial dimensions lengths.
  * @param[in]  output_spatial_lengths  Convolution output spatial dimensions
  *                                     lengths.
+ * @param[in]  G                       Number of groups, C and K are split into.
  *
  * @return     The number of flops.
  */
@@ -21,15 +22,16 @@ std::size_t get_flops(ck::index_t N,
                       ck::index_t C,
                       ck::index_t K,
                       const std::vector<ck::index_t>& filter_spatial_lengths,
-                      const std::vector<ck::index_t>& output_spatial_lengths)
+                      const std::vector<ck::index_t>& output_spatial_lengths,
+                      ck::index_t G)
 {
-    // 2 * N * K * <output spatial lengths product> * C * <filter spatial lengths product>
+    // 2 * N * K * <output spatial lengths product> * C / G * <filter spatial lengths product>
     return static_cast<std::size_t>(2) * N * K *
            std::accumulate(std::begin(output_spatial_lengths),
                            std::end(output_spatial_lengths),
                            static_cast<std::size_t>(1),
                            std::multiplies<std::size_t>()) *
-           C *
+           (C / G) *
            std::accumulate(std::begin(filter_spatial_lengths),
                            std::end(filter_spatial_lengths),
                            static_cast<std::size_t>(1),
@@ -41,6 +43,7 @@ ConvParams::ConvParams()
       N_(128),
       K_(256),
       C_(192),
+      G_(1),
       filter_spatial_lengths_(2, 3),
       input_spatial_lengths_(2, 71),
       conv_filter_strides_(2, 2),
@@ -59,11 +62,13 @@ ConvParams::ConvParams(ck::index_t n_dim,
                        const std::vector<ck::index_t>& strides,
                        const std::vector<ck::index_t>& dilations,
                        const std::vector<ck::index_t>& left_pads,
-                       const std::vector<ck::index_t>& right_pads)
+                       const std::vector<ck::index_t>& right_pads,
+                       ck::index_t n_groups)
     : num_dim_spatial_(n_dim),
       N_(n_batch),
       K_(n_out_channels),
       C_(n_in_channels),
+      G_(n_groups),
       filter_spatial_lengths_(filters_len),
       input_spatial_lengths_(input_len),
       conv_filter_strides_(strides),
@@ -82,6 +87,11 @@ ConvParams::ConvParams(ck::index_t n_dim,
             std::runtime_error("ConvParams::GetOutputSpatialLengths: "
                                "parameter size is different from number of declared dimensions!"));
     }
+    if(G_ < 1 || C_ % G_ != 0 || K_ % G_ != 0)
+    {
+        throw(std::runtime_error("ConvParams: number of input and output channels must be "
+                                 "multiples of the number of groups!"));
+    }
 }
 
 std::vector<ck::index_t> ConvParams::GetOutputSpatialLengths() const
@@ -113,6 +123,38 @@ std::vector<ck::index_t> ConvParams::GetOutputSpatialLengths() const
     return out_spatial_len;
 }
 
+std::vector<std::size_t> ConvParams::GetInputLengths() const
+{
+    std::vector<std::size_t> input_dims{static_cast<std::size_t>(N_),
+                                        static_cast<std::size_t>(C_)};
+    input_dims.insert(std::end(input_dims),
+                      std::begin(input_spatial_lengths_),
+                      std::end(input_spatial_lengths_));
+    return input_dims;
+}
+
+std::vector<std::size_t> ConvParams::GetWeightLengths() const
+{
+    std::vector<std::size_t> filter_dims{static_cast<std::size_t>(K_),
+                                         static_cast<std::size_t>(C_ / G_)};
+    filter_dims.insert(std::end(filter_dims),
+                       std::begin(filter_spatial_lengths_),
+                       std::end(filter_spatial_lengths_));
+    return filter_dims;
+}
+
+std::vector<std::size_t> ConvParams::GetOutputLengths() const
+{
+    const std::vector<ck::index_t> output_spatial_lengths = GetOutputSpatialLengths();
+
+    std::vector<std::size_t> output_dims{static_cast<std::size_t>(N_),
+                                         static_cast<std::size_t>(K_)};
+    output_dims.insert(std::end(output_dims),
+                       std::begin(output_spatial_lengths),
+                       std::end(output_spatial_lengths));
+    return output_dims;
+}
+
 ConvParams parse_conv_params(int num_dim_spatial, int arg_idx, char* const argv[])
 {
     ck::utils::conv::ConvParams params;
@@ -230,7 +272,8 @@ std::ostream& operator<<(std::ostream& os, const ck::utils::conv::ConvParams& p)
 {
     os << "ConvParams {"
        << "\nnum_dim_spatial: " << p.num_dim_spatial_ << "\nN: " << p.N_ << "\nK: " << p.K_
-       << "\nC: " << p.C_ << "\nfilter_spatial_lengths: " << p.filter_spatial_lengths_
+       << "\nC: " << p.C_ << "\nG: " << p.G_
+       << "\nfilter_spatial_lengths: " << p.filter_spatial_lengths_
        << "\ninput_spatial_lengths: " << p.input_spatial_lengths_
        << "\nconv_filter_strides: " << p.conv_filter_strides_
        << "\nconv_filter_dilations: " << p.conv_filter_dilations_
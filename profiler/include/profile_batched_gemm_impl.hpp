@@ -2,6 +2,7 @@
 
 #include <memory>
 
+#include "async_reference_verifier.hpp"
 #include "check_err.hpp"
 #include "config.hpp"
 #include "element_wise_operation.hpp"
@@ -10,6 +11,7 @@
 #include "host_tensor_generator.hpp"
 #include "device_gemm.hpp"
 #include "reference_batched_gemm.hpp"
+#include "perf_regression.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -127,58 +129,67 @@ bool profile_batched_gemm_impl(int do_verification,
     const auto b_element_op = BElementOp{};
     const auto c_element_op = CElementOp{};
 
+    // the reference is computed on the host while the device instances are profiled
+    ck::utils::AsyncReferenceVerifier ref_verifier;
+
     if(do_verification)
     {
-        if constexpr(is_same<ADataType, ck::bhalf_t>::value &&
-                     is_same<BDataType, ck::bhalf_t>::value &&
-                     is_same<CDataType, ck::bhalf_t>::value)
-        {
-            Tensor<float> a_f32_g_m_k(
-                f_host_tensor_descriptor(BatchCount, M, K, StrideA, ALayout{}));
-            Tensor<float> b_f32_g_k_n(
-                f_host_tensor_descriptor(BatchCount, K, N, StrideB, BLayout{}));
-            c_f32_g_m_n_host_result = std::make_unique<Tensor<float>>(
-                f_host_tensor_descriptor(BatchCount, M, N, StrideC, CLayout{}));
-            c_f32_g_m_n_device_result = std::make_unique<Tensor<float>>(
-                f_host_tensor_descriptor(BatchCount, M, N, StrideC, CLayout{}));
-
-            bf16_to_f32_(a_g_m_k, a_f32_g_m_k);
-            bf16_to_f32_(b_g_k_n, b_f32_g_k_n);
-
-            using ReferenceBatchedGemmInstance = ck::tensor_operation::host::
-                ReferenceBatchedGemm<float, float, float, AElementOp, BElementOp, CElementOp>;
-
-            auto ref_batched_gemm = ReferenceBatchedGemmInstance{};
-            auto ref_invoker      = ref_batched_gemm.MakeInvoker();
-
-            auto ref_argument = ref_batched_gemm.MakeArgument(a_f32_g_m_k,
-                                                              b_f32_g_k_n,
-                                                              *c_f32_g_m_n_host_result,
-                                                              a_element_op,
-                                                              b_element_op,
-                                                              c_element_op);
-
-            ref_invoker.Run(ref_argument);
-        }
-        else
-        {
-
-            using ReferenceBatchedGemmInstance =
-                ck::tensor_operation::host::ReferenceBatchedGemm<ADataType,
-                                                                 BDataType,
-                                                                 CDataType,
-                                                                 AElementOp,
-                                                                 BElementOp,
-                                                                 CElementOp>;
-
-            auto ref_batched_gemm = ReferenceBatchedGemmInstance{};
-            auto ref_invoker      = ref_batched_gemm.MakeInvoker();
-
-            auto ref_argument = ref_batched_gemm.MakeArgument(
-                a_g_m_k, b_g_k_n, c_g_m_n_host_result, a_element_op, b_element_op, c_element_op);
+        ref_verifier.Launch([&]() {
+            if constexpr(is_same<ADataType, ck::bhalf_t>::value &&
+                         is_same<BDataType, ck::bhalf_t>::value &&
+                         is_same<CDataType, ck::bhalf_t>::value)
+            {
+                Tensor<float> a_f32_g_m_k(
+                    f_host_tensor_descriptor(BatchCount, M, K, StrideA, ALayout{}));
+                Tensor<float> b_f32_g_k_n(
+                    f_host_tensor_descriptor(BatchCount, K, N, StrideB, BLayout{}));
+                c_f32_g_m_n_host_result = std::make_unique<Tensor<float>>(
+                    f_host_tensor_descriptor(BatchCount, M, N, StrideC, CLayout{}));
+                c_f32_g_m_n_device_result = std::make_unique<Tensor<float>>(
+                    f_host_tensor_descriptor(BatchCount, M, N, StrideC, CLayout{}));
+
+                bf16_to_f32_(a_g_m_k, a_f32_g_m_k);
+                bf16_to_f32_(b_g_k_n, b_f32_g_k_n);
+
+                using ReferenceBatchedGemmInstance = ck::tensor_operation::host::
+                    ReferenceBatchedGemm<float, float, float, AElementOp, BElementOp, CElementOp>;
+
+                auto ref_batched_gemm = ReferenceBatchedGemmInstance{};
+                auto ref_invoker      = ref_batched_gemm.MakeInvoker();
+
+                auto ref_argument = ref_batched_gemm.MakeArgument(a_f32_g_m_k,
+                                                                  b_f32_g_k_n,
+                                                                  *c_f32_g_m_n_host_result,
+                                                                  a_element_op,
+                                                                  b_element_op,
+                                                                  c_element_op);
+
+                ref_invoker.Run(ref_argument);
+            }
+            else
+            {
 
-            ref_invoker.Run(ref_argument);
-        }
+                using ReferenceBatchedGemmInstance =
+                    ck::tensor_operation::host::ReferenceBatchedGemm<ADataType,
+                                                                     BDataType,
+                                                                     CDataType,
+                                                                     AElementOp,
+                                                                     BElementOp,
+                                                                     CElementOp>;
+
+                auto ref_batched_gemm = ReferenceBatchedGemmInstance{};
+                auto ref_invoker      = ref_batched_gemm.MakeInvoker();
+
+                auto ref_argument = ref_batched_gemm.MakeArgument(a_g_m_k,
+                                                                  b_g_k_n,
+                                                                  c_g_m_n_host_result,
+                                                                  a_element_op,
+                                                                  b_element_op,
+                                                                  c_element_op);
+
+                ref_invoker.Run(ref_argument);
+            }
+        });
     }
 
     DeviceMem a_device_buf(sizeof(ADataType) * a_g_m_k.mDesc.GetElementSpace());
@@ -372,6 +383,8 @@ bool profile_batched_gemm_impl(int do_verification,
             std::cout << "Perf: " << ave_time << " ms, " << tflops << " TFlops, " << gb_per_sec
                       << " GB/s, " << gemm_name << std::endl;
 
+            ck::utils::PerfResultsLog::GetInstance().Record(gemm_name, ave_time);
+
             if(tflops > best_tflops)
             {
                 best_gemm_name  = gemm_name;
@@ -384,31 +397,36 @@ bool profile_batched_gemm_impl(int do_verification,
             {
                 c_device_buf.FromDevice(c_g_m_n_device_result.mData.data());
 
-                if constexpr(is_same<ADataType, ck::bhalf_t>::value &&
-                             is_same<BDataType, ck::bhalf_t>::value &&
-                             is_same<CDataType, ck::bhalf_t>::value)
-                {
-
-                    bf16_to_f32_(c_g_m_n_device_result, *c_f32_g_m_n_device_result);
-                    float err = check_error(*c_f32_g_m_n_host_result, *c_f32_g_m_n_device_result);
-                    pass      = pass && (err < 1E-6);
-                }
-                else
-                {
-                    float err = check_error(c_g_m_n_host_result, c_g_m_n_device_result);
-                    pass      = pass && (err < 1E-6);
-                }
-
-                if(do_log)
-                {
-                    LogRangeAsType<float>(std::cout << "a : ", a_g_m_k.mData, ",") << std::endl;
-                    LogRangeAsType<float>(std::cout << "b: ", b_g_k_n.mData, ",") << std::endl;
-                    LogRangeAsType<float>(std::cout << "c_host: ", c_g_m_n_host_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "c_device: ", c_g_m_n_device_result.mData, ",")
-                        << std::endl;
-                }
+                // compared against a copy of the device result once the reference is ready
+                ref_verifier.Verify([&, c_g_m_n_device_result]() {
+                    float err = 0;
+
+                    if constexpr(is_same<ADataType, ck::bhalf_t>::value &&
+                                 is_same<BDataType, ck::bhalf_t>::value &&
+                                 is_same<CDataType, ck::bhalf_t>::value)
+                    {
+                        bf16_to_f32_(c_g_m_n_device_result, *c_f32_g_m_n_device_result);
+                        err = check_error(*c_f32_g_m_n_host_result, *c_f32_g_m_n_device_result);
+                    }
+                    else
+                    {
+                        err = check_error(c_g_m_n_host_result, c_g_m_n_device_result);
+                    }
+
+                    if(do_log)
+                    {
+                        LogRangeAsType<float>(std::cout << "a : ", a_g_m_k.mData, ",") << std::endl;
+                        LogRangeAsType<float>(std::cout << "b: ", b_g_k_n.mData, ",") << std::endl;
+                        LogRangeAsType<float>(
+                            std::cout << "c_host: ", c_g_m_n_host_result.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<float>(
+                            std::cout << "c_device: ", c_g_m_n_device_result.mData, ",")
+                            << std::endl;
+                    }
+
+                    return err < 1E-6;
+                });
             }
         }
         else
@@ -421,6 +439,8 @@ bool profile_batched_gemm_impl(int do_verification,
     std::cout << "Best Perf: " << best_ave_time << " ms, " << best_tflops << " TFlops, "
               << best_gb_per_sec << " GB/s, " << best_gemm_name << std::endl;
 
+    pass = ref_verifier.Finish() && pass;
+
     return pass;
 }
 
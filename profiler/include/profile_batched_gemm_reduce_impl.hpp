@@ -10,7 +10,8 @@
 #include "element_wise_operation.hpp"
 #include "reduction_operator.hpp"
 #include "device_gemm_reduce.hpp"
-#include "reference_batched_gemm.hpp"
+#include "reference_gemm_reduce.hpp"
+#include "perf_regression.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -135,6 +136,7 @@ bool profile_batched_gemm_reduce_impl(int do_verification,
     using D1ReduceOp            = ck::reduce::Add;
     using UnaryIdenticElementOp = ck::tensor_operation::element_wise::PassThrough;
     using UnarySquareElementOp  = ck::tensor_operation::element_wise::UnarySquare;
+    using DxsReduceOp           = ck::Tuple<D0ReduceOp, D1ReduceOp>;
     using DxsInElementOps       = ck::Tuple<UnaryIdenticElementOp, UnarySquareElementOp>;
     using DxsOutElementOps      = ck::Tuple<UnaryIdenticElementOp, UnaryIdenticElementOp>;
 
@@ -143,48 +145,38 @@ bool profile_batched_gemm_reduce_impl(int do_verification,
     const auto c_element_op       = CElementOp{};
     const auto dxs_in_element_op  = DxsInElementOps{};
     const auto dxs_out_element_op = DxsOutElementOps{};
-    const auto d0_reduce_op       = D0ReduceOp{};
-    const auto d1_reduce_op       = D1ReduceOp{};
 
     if(do_verification)
     {
-        using ReferenceBatchedGemmInstance =
-            ck::tensor_operation::host::ReferenceBatchedGemm<ADataType,
-                                                             BDataType,
-                                                             CDataType,
-                                                             AElementOp,
-                                                             BElementOp,
-                                                             CElementOp>;
-
-        auto ref_batched_gemm = ReferenceBatchedGemmInstance{};
-        auto ref_invoker      = ref_batched_gemm.MakeInvoker();
-
-        auto ref_argument = ref_batched_gemm.MakeArgument(
-            a_g_m_k, b_g_k_n, c_g_m_n_host_result, a_element_op, b_element_op, c_element_op);
+        using ReferenceGemmReduceInstance =
+            ck::tensor_operation::host::ReferenceGemmReduce<ADataType,
+                                                            BDataType,
+                                                            CDataType,
+                                                            float,
+                                                            float,
+                                                            DDataType,
+                                                            AElementOp,
+                                                            BElementOp,
+                                                            CElementOp,
+                                                            DxsReduceOp,
+                                                            DxsInElementOps,
+                                                            DxsOutElementOps>;
+
+        auto ref_batched_gemm_reduce = ReferenceGemmReduceInstance{};
+        auto ref_invoker             = ref_batched_gemm_reduce.MakeInvoker();
+
+        auto ref_argument =
+            ref_batched_gemm_reduce.MakeArgument(a_g_m_k,
+                                                 b_g_k_n,
+                                                 c_g_m_n_host_result,
+                                                 {&d0_g_m_host_result, &d1_g_m_host_result},
+                                                 a_element_op,
+                                                 b_element_op,
+                                                 c_element_op,
+                                                 dxs_in_element_op,
+                                                 dxs_out_element_op);
 
         ref_invoker.Run(ref_argument);
-
-        for(int batch = 0; batch < BatchCount; ++batch)
-        {
-            for(int m = 0; m < M; ++m)
-            {
-                float d0_acc = d0_reduce_op.GetIdentityValue<float>();
-                float d1_acc = d1_reduce_op.GetIdentityValue<float>();
-
-                for(int n = 0; n < N; ++n)
-                {
-                    float d0_val = ck::type_convert<float>(c_g_m_n_host_result(batch, m, n));
-                    float d1_val;
-
-                    UnarySquareElementOp{}(d1_val, d0_val);
-                    d0_reduce_op(d0_acc, d0_val);
-                    d1_reduce_op(d1_acc, d1_val);
-                }
-
-                d0_g_m_host_result(batch, m) = ck::type_convert<DDataType>(d0_acc);
-                d1_g_m_host_result(batch, m) = ck::type_convert<DDataType>(d1_acc);
-            }
-        }
     }
 
     DeviceMem a_device_buf(sizeof(ADataType) * a_g_m_k.mDesc.GetElementSpace());
@@ -296,6 +288,8 @@ bool profile_batched_gemm_reduce_impl(int do_verification,
             std::cout << "Perf: " << ave_time << " ms, " << tflops << " TFlops, " << gb_per_sec
                       << " GB/s, " << gemm_name << std::endl;
 
+            ck::utils::PerfResultsLog::GetInstance().Record(gemm_name, ave_time);
+
             if(tflops > best_tflops)
             {
                 best_gemm_name  = gemm_name;
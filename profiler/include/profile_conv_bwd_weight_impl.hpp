@@ -10,6 +10,8 @@
 #include "device_conv_backward_weight.hpp"
 #include "element_wise_operation.hpp"
 #include "reference_conv_backward_weight.hpp"
+#include "async_reference_verifier.hpp"
+#include "perf_regression.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -115,30 +117,35 @@ bool profile_conv_bwd_weight_impl(int do_verification,
     const auto wei_element_op = WeiElementOp{};
     const auto out_element_op = OutElementOp{};
 
+    // the reference is computed on the host while the device instances are profiled
+    ck::utils::AsyncReferenceVerifier ref_verifier;
+
     if(do_verification)
     {
-        using ReferenceConvBwdWeightInstance =
-            ck::tensor_operation::host::ReferenceConvBwdWeight<InDataType,
-                                                               WeiDataType,
-                                                               OutDataType,
-                                                               InElementOp,
-                                                               WeiElementOp,
-                                                               OutElementOp>;
-
-        auto ref_conv     = ReferenceConvBwdWeightInstance{};
-        auto ref_invoker  = ref_conv.MakeInvoker();
-        auto ref_argument = ref_conv.MakeArgument(in_n_c_hi_wi,
-                                                  wei_k_c_y_x_host_result,
-                                                  out_n_k_ho_wo,
-                                                  conv_filter_strides,
-                                                  conv_filter_dilations,
-                                                  input_left_pads,
-                                                  input_right_pads,
-                                                  in_element_op,
-                                                  wei_element_op,
-                                                  out_element_op);
-
-        ref_invoker.Run(ref_argument);
+        ref_verifier.Launch([&]() {
+            using ReferenceConvBwdWeightInstance =
+                ck::tensor_operation::host::ReferenceConvBwdWeight<InDataType,
+                                                                   WeiDataType,
+                                                                   OutDataType,
+                                                                   InElementOp,
+                                                                   WeiElementOp,
+                                                                   OutElementOp>;
+
+            auto ref_conv     = ReferenceConvBwdWeightInstance{};
+            auto ref_invoker  = ref_conv.MakeInvoker();
+            auto ref_argument = ref_conv.MakeArgument(in_n_c_hi_wi,
+                                                      wei_k_c_y_x_host_result,
+                                                      out_n_k_ho_wo,
+                                                      conv_filter_strides,
+                                                      conv_filter_dilations,
+                                                      input_left_pads,
+                                                      input_right_pads,
+                                                      in_element_op,
+                                                      wei_element_op,
+                                                      out_element_op);
+
+            ref_invoker.Run(ref_argument);
+        });
     }
 
     DeviceMem in_device_buf(sizeof(InDataType) * in_n_c_hi_wi.mDesc.GetElementSpace());
@@ -234,6 +241,8 @@ bool profile_conv_bwd_weight_impl(int do_verification,
             std::cout << "Perf: " << ave_time << " ms, " << tflops << " TFlops, " << gb_per_sec
                       << " GB/s, " << conv_name << std::endl;
 
+            ck::utils::PerfResultsLog::GetInstance().Record(conv_name, ave_time);
+
             if(tflops > best_tflops)
             {
                 best_conv_name  = conv_name;
@@ -246,27 +255,32 @@ bool profile_conv_bwd_weight_impl(int do_verification,
             {
                 wei_device_buf.FromDevice(wei_k_c_y_x_device_result.mData.data());
 
-                float max_error = check_error(wei_k_c_y_x_host_result, wei_k_c_y_x_device_result);
-
-                if(max_error > 8)
-                {
-                    pass = false;
-                    std::cout << "Fail info:" << conv_ptr->GetTypeString() << std::endl;
-                }
-
-                if(do_log)
-                {
-                    LogRangeAsType<float>(std::cout << "out: ", out_n_k_ho_wo.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(std::cout << "in : ", in_n_c_hi_wi.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "wei_host  : ", wei_k_c_y_x_host_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "wei_device: ", wei_k_c_y_x_device_result.mData, ",")
-                        << std::endl;
-                }
+                // compared against a copy of the device result once the reference is ready
+                ref_verifier.Verify([&, wei_k_c_y_x_device_result, conv_name]() {
+                    float max_error =
+                        check_error(wei_k_c_y_x_host_result, wei_k_c_y_x_device_result);
+
+                    if(max_error > 8)
+                    {
+                        std::cout << "Fail info:" << conv_name << std::endl;
+                    }
+
+                    if(do_log)
+                    {
+                        LogRangeAsType<float>(std::cout << "out: ", out_n_k_ho_wo.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<float>(std::cout << "in : ", in_n_c_hi_wi.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<float>(
+                            std::cout << "wei_host  : ", wei_k_c_y_x_host_result.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<float>(
+                            std::cout << "wei_device: ", wei_k_c_y_x_device_result.mData, ",")
+                            << std::endl;
+                    }
+
+                    return max_error <= 8;
+                });
             }
         }
     }
@@ -274,6 +288,8 @@ bool profile_conv_bwd_weight_impl(int do_verification,
     std::cout << "Best Perf: " << best_ave_time << " ms, " << best_tflops << " TFlops, "
               << best_gb_per_sec << " GB/s, " << best_conv_name << std::endl;
 
+    pass = ref_verifier.Finish() && pass;
+
     return pass;
 }
 
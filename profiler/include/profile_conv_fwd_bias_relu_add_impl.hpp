@@ -1,5 +1,6 @@
 #pragma once
 
+#include "async_reference_verifier.hpp"
 #include "check_err.hpp"
 #include "config.hpp"
 #include "device.hpp"
@@ -10,6 +11,7 @@
 #include "element_wise_operation.hpp"
 #include "device_conv_fwd_bias_activation_add.hpp"
 #include "reference_conv_fwd_bias_activation_add.hpp"
+#include "perf_regression.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -125,33 +127,38 @@ void profile_conv_fwd_bias_relu_add_impl(int do_verification,
     const auto wei_element_op = WeiElementOp{};
     const auto out_element_op = OutElementOp{};
 
+    // the reference is computed on the host while the device instances are profiled
+    ck::utils::AsyncReferenceVerifier ref_verifier;
+
     if(do_verification)
     {
-        using ReferenceConvFwdInstance =
-            ck::tensor_operation::host::ReferenceConvFwd_Bias_Activation_Add<InDataType,
-                                                                             WeiDataType,
-                                                                             OutDataType,
-                                                                             InElementOp,
-                                                                             WeiElementOp,
-                                                                             OutElementOp>;
-
-        auto ref_conv    = ReferenceConvFwdInstance{};
-        auto ref_invoker = ref_conv.MakeInvoker();
-
-        auto ref_argument = ref_conv.MakeArgument(in_n_c_hi_wi,
-                                                  wei_k_c_y_x,
-                                                  out_n_k_ho_wo_host_result,
-                                                  bias_k,
-                                                  resi_n_k_ho_wo,
-                                                  conv_filter_strides,
-                                                  conv_filter_dilations,
-                                                  input_left_pads,
-                                                  input_right_pads,
-                                                  in_element_op,
-                                                  wei_element_op,
-                                                  out_element_op);
-
-        ref_invoker.Run(ref_argument);
+        ref_verifier.Launch([&]() {
+            using ReferenceConvFwdInstance =
+                ck::tensor_operation::host::ReferenceConvFwd_Bias_Activation_Add<InDataType,
+                                                                                 WeiDataType,
+                                                                                 OutDataType,
+                                                                                 InElementOp,
+                                                                                 WeiElementOp,
+                                                                                 OutElementOp>;
+
+            auto ref_conv    = ReferenceConvFwdInstance{};
+            auto ref_invoker = ref_conv.MakeInvoker();
+
+            auto ref_argument = ref_conv.MakeArgument(in_n_c_hi_wi,
+                                                      wei_k_c_y_x,
+                                                      out_n_k_ho_wo_host_result,
+                                                      bias_k,
+                                                      resi_n_k_ho_wo,
+                                                      conv_filter_strides,
+                                                      conv_filter_dilations,
+                                                      input_left_pads,
+                                                      input_right_pads,
+                                                      in_element_op,
+                                                      wei_element_op,
+                                                      out_element_op);
+
+            ref_invoker.Run(ref_argument);
+        });
     }
 
     DeviceMem in_device_buf(sizeof(InDataType) * in_n_c_hi_wi.mDesc.GetElementSpace());
@@ -236,6 +243,8 @@ void profile_conv_fwd_bias_relu_add_impl(int do_verification,
             std::cout << "Perf: " << ave_time << " ms, " << tflops << " TFlops, " << gb_per_sec
                       << " GB/s, " << conv_name << std::endl;
 
+            ck::utils::PerfResultsLog::GetInstance().Record(conv_name, ave_time);
+
             if(tflops > best_tflops)
             {
                 best_conv_name  = conv_name;
@@ -248,26 +257,33 @@ void profile_conv_fwd_bias_relu_add_impl(int do_verification,
             {
                 out_device_buf.FromDevice(out_n_k_ho_wo_device_result.mData.data());
 
-                ck::utils::check_err(out_n_k_ho_wo_device_result.mData,
-                                     out_n_k_ho_wo_host_result.mData);
-
-                if(do_log)
-                {
-                    LogRangeAsType<float>(std::cout << "in : ", in_n_c_hi_wi.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(std::cout << "wei: ", wei_k_c_y_x.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "out_host  : ", out_n_k_ho_wo_host_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "out_device: ", out_n_k_ho_wo_device_result.mData, ",")
-                        << std::endl;
-                }
+                // compared against a copy of the device result once the reference is ready
+                ref_verifier.Verify([&, out_n_k_ho_wo_device_result]() {
+                    bool pass = ck::utils::check_err(out_n_k_ho_wo_device_result.mData,
+                                                     out_n_k_ho_wo_host_result.mData);
+
+                    if(do_log)
+                    {
+                        LogRangeAsType<float>(std::cout << "in : ", in_n_c_hi_wi.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<float>(std::cout << "wei: ", wei_k_c_y_x.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<float>(
+                            std::cout << "out_host  : ", out_n_k_ho_wo_host_result.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<float>(
+                            std::cout << "out_device: ", out_n_k_ho_wo_device_result.mData, ",")
+                            << std::endl;
+                    }
+
+                    return pass;
+                });
             }
         }
     }
 
+    ref_verifier.Finish();
+
     std::cout << "Best Perf: " << best_ave_time << " ms, " << best_tflops << " TFlops, "
               << best_gb_per_sec << " GB/s, " << best_conv_name << std::endl;
 }
@@ -1,4 +1,5 @@
 #pragma once
+#include "async_reference_verifier.hpp"
 #include "check_err.hpp"
 #include "config.hpp"
 #include "device.hpp"
@@ -9,6 +10,7 @@
 #include "device_tensor.hpp"
 #include "device_conv_fwd_bias_activation.hpp"
 #include "element_wise_operation.hpp"
+#include "perf_regression.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -192,24 +194,29 @@ void profile_conv_fwd_bias_relu_atomic_add_impl(int do_verification,
     using WeiElementOp = ck::tensor_operation::element_wise::PassThrough;
     using OutElementOp = ck::tensor_operation::element_wise::AddRelu;
 
+    // the reference is computed on the host while the device instances are profiled
+    ck::utils::AsyncReferenceVerifier ref_verifier;
+
     if(do_verification)
     {
-        cpu_conv_bias_relu_atomic_add(in_n_c_hi_wi.mData.data(),
-                                      wei_k_c_y_x.mData.data(),
-                                      out_n_k_ho_wo_host_result.mData.data(),
-                                      bias_k.mData.data(),
-                                      N,
-                                      K,
-                                      C,
-                                      Y,
-                                      X,
-                                      Hi,
-                                      Wi,
-                                      Ho,
-                                      Wo,
-                                      conv_filter_strides[0],
-                                      conv_filter_dilations[0],
-                                      input_left_pads[0]);
+        ref_verifier.Launch([&]() {
+            cpu_conv_bias_relu_atomic_add(in_n_c_hi_wi.mData.data(),
+                                          wei_k_c_y_x.mData.data(),
+                                          out_n_k_ho_wo_host_result.mData.data(),
+                                          bias_k.mData.data(),
+                                          N,
+                                          K,
+                                          C,
+                                          Y,
+                                          X,
+                                          Hi,
+                                          Wi,
+                                          Ho,
+                                          Wo,
+                                          conv_filter_strides[0],
+                                          conv_filter_dilations[0],
+                                          input_left_pads[0]);
+        });
     }
 
     DeviceMem in_device_buf(sizeof(InDataType) * in_n_c_hi_wi.mDesc.GetElementSpace());
@@ -291,6 +298,8 @@ void profile_conv_fwd_bias_relu_atomic_add_impl(int do_verification,
             std::cout << "Perf: " << ave_time << " ms, " << tflops << " TFlops, " << gb_per_sec
                       << " GB/s, " << conv_name << std::endl;
 
+            ck::utils::PerfResultsLog::GetInstance().Record(conv_name, ave_time);
+
             if(tflops > best_tflops)
             {
                 best_conv_name  = conv_name;
@@ -303,26 +312,33 @@ void profile_conv_fwd_bias_relu_atomic_add_impl(int do_verification,
             {
                 out_device_buf.FromDevice(out_n_k_ho_wo_device_result.mData.data());
 
-                ck::utils::check_err(out_n_k_ho_wo_device_result.mData,
-                                     out_n_k_ho_wo_host_result.mData);
+                // compared against a copy of the device result once the reference is ready
+                ref_verifier.Verify([&, out_n_k_ho_wo_device_result]() {
+                    bool pass = ck::utils::check_err(out_n_k_ho_wo_device_result.mData,
+                                                     out_n_k_ho_wo_host_result.mData);
 
-                if(do_log)
-                {
-                    LogRangeAsType<float>(std::cout << "in : ", in_n_c_hi_wi.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(std::cout << "wei: ", wei_k_c_y_x.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "out_host  : ", out_n_k_ho_wo_host_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "out_device: ", out_n_k_ho_wo_device_result.mData, ",")
-                        << std::endl;
-                }
+                    if(do_log)
+                    {
+                        LogRangeAsType<float>(std::cout << "in : ", in_n_c_hi_wi.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<float>(std::cout << "wei: ", wei_k_c_y_x.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<float>(
+                            std::cout << "out_host  : ", out_n_k_ho_wo_host_result.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<float>(
+                            std::cout << "out_device: ", out_n_k_ho_wo_device_result.mData, ",")
+                            << std::endl;
+                    }
+
+                    return pass;
+                });
             }
         }
     }
 
+    ref_verifier.Finish();
+
     std::cout << "Best Perf: " << best_ave_time << " ms, " << best_tflops << " TFlops, "
               << best_gb_per_sec << " GB/s, " << best_conv_name << std::endl;
 }
@@ -9,6 +9,8 @@
 #include "device_conv_bwd_data.hpp"
 #include "element_wise_operation.hpp"
 #include "reference_conv_bwd_data.hpp"
+#include "async_reference_verifier.hpp"
+#include "perf_regression.hpp"
 
 using F16  = ck::half_t;
 using F32  = float;
@@ -233,7 +235,7 @@ static bool check_out(const Tensor<T>& ref, const Tensor<T>& result)
     return true;
 }
 template <typename DataType>
-void show_data_nhwc_layout(Tensor<DataType>& nhwc)
+void show_data_nhwc_layout(const Tensor<DataType>& nhwc)
 {
     std::cout << "[";
     for(int n = 0; n < ck::type_convert<int>(nhwc.mDesc.GetLengths()[0]); n++)
@@ -338,33 +340,38 @@ bool profile_convnd_bwd_data_impl(int do_verification,
     // reset input to zero
     in_device_buf.SetZero();
 
+    // the reference is computed on the host while the device instances are profiled
+    ck::utils::AsyncReferenceVerifier ref_verifier;
+
     if(do_verification)
     {
-        auto RunReference = [&](auto& ref_conv) {
-            auto ref_invoker = ref_conv.MakeInvoker();
-
-            auto ref_argument = ref_conv.MakeArgument(input_host_result,
-                                                      weights,
-                                                      output,
-                                                      conv_filter_strides,
-                                                      conv_filter_dilations,
-                                                      input_left_pads,
-                                                      input_right_pads,
-                                                      InElementOp{},
-                                                      WeiElementOp{},
-                                                      OutElementOp{});
-            ref_invoker.Run(ref_argument);
-        };
-
-        auto ref_conv = ck::tensor_operation::host::ReferenceConvBwdData<InDataType,
-                                                                         WeiDataType,
-                                                                         OutDataType,
-                                                                         AccDataType,
-                                                                         InElementOp,
-                                                                         WeiElementOp,
-                                                                         OutElementOp,
-                                                                         NDimSpatial>();
-        RunReference(ref_conv);
+        ref_verifier.Launch([&]() {
+            auto RunReference = [&](auto& ref_conv) {
+                auto ref_invoker = ref_conv.MakeInvoker();
+
+                auto ref_argument = ref_conv.MakeArgument(input_host_result,
+                                                          weights,
+                                                          output,
+                                                          conv_filter_strides,
+                                                          conv_filter_dilations,
+                                                          input_left_pads,
+                                                          input_right_pads,
+                                                          InElementOp{},
+                                                          WeiElementOp{},
+                                                          OutElementOp{});
+                ref_invoker.Run(ref_argument);
+            };
+
+            auto ref_conv = ck::tensor_operation::host::ReferenceConvBwdData<InDataType,
+                                                                             WeiDataType,
+                                                                             OutDataType,
+                                                                             AccDataType,
+                                                                             InElementOp,
+                                                                             WeiElementOp,
+                                                                             OutElementOp,
+                                                                             NDimSpatial>();
+            RunReference(ref_conv);
+        });
     }
 
     // add device Conv instances
@@ -425,6 +432,8 @@ bool profile_convnd_bwd_data_impl(int do_verification,
             std::cout << "Perf: " << ave_time << " ms, " << tflops << " TFlops, " << gb_per_sec
                       << " GB/s" << std::endl;
 
+            ck::utils::PerfResultsLog::GetInstance().Record(conv_name, ave_time);
+
             if(tflops > best_tflops)
             {
                 best_conv_name  = conv_name;
@@ -437,43 +446,53 @@ bool profile_convnd_bwd_data_impl(int do_verification,
             {
                 in_device_buf.FromDevice(input_device_result.mData.data());
 
-                if(!check_out(input_host_result, input_device_result))
-                {
-                    std::cout << "Fail Info: " << conv_ptr->GetTypeString() << std::endl;
+                // compared against a copy of the device result once the reference is ready
+                ref_verifier.Verify([&, input_device_result, conv_name]() {
+                    bool pass = true;
 
-                    success = false;
-                }
-                else
-                {
-                    std::cout << "Pass Info: " << conv_ptr->GetTypeString() << std::endl;
-                }
+                    if(!check_out(input_host_result, input_device_result))
+                    {
+                        std::cout << "Fail Info: " << conv_name << std::endl;
 
-                check_error(input_host_result, input_device_result);
+                        pass = false;
+                    }
+                    else
+                    {
+                        std::cout << "Pass Info: " << conv_name << std::endl;
+                    }
 
-                if(do_log)
-                {
-                    std::cout << "in : ";
-                    show_data_nhwc_layout(output);
-                    std::cout << std::endl;
+                    check_error(input_host_result, input_device_result);
 
-                    std::cout << "wei: ";
-                    show_data_nhwc_layout(weights);
-                    std::cout << std::endl;
+                    if(do_log)
+                    {
+                        std::cout << "in : ";
+                        show_data_nhwc_layout(output);
+                        std::cout << std::endl;
 
-                    std::cout << "out_host  : ";
-                    show_data_nhwc_layout(input_host_result);
-                    std::cout << std::endl;
+                        std::cout << "wei: ";
+                        show_data_nhwc_layout(weights);
+                        std::cout << std::endl;
 
-                    std::cout << "out_device: ";
-                    show_data_nhwc_layout(input_device_result);
-                    std::cout << std::endl;
-                }
+                        std::cout << "out_host  : ";
+                        show_data_nhwc_layout(input_host_result);
+                        std::cout << std::endl;
+
+                        std::cout << "out_device: ";
+                        show_data_nhwc_layout(input_device_result);
+                        std::cout << std::endl;
+                    }
+
+                    return pass;
+                });
             }
         }
     }
 
     std::cout << "Best Perf: " << best_ave_time << " ms, " << best_tflops << " TFlops, "
               << best_gb_per_sec << " GB/s, " << best_conv_name << std::endl;
+
+    success = ref_verifier.Finish() && success;
+
     return success;
 }
 
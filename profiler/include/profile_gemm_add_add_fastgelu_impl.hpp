@@ -13,6 +13,7 @@
 #include "element_wise_operation.hpp"
 #include "reference_gemm.hpp"
 #include "device_gemm_multiple_d.hpp"
+#include "perf_regression.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -256,6 +257,8 @@ int profile_gemm_add_add_fastgelu_impl(int do_verification,
             std::cout << "Perf: " << std::setw(10) << ave_time << " ms, " << tflops << " TFlops, "
                       << gb_per_sec << " GB/s, " << device_op_name << std::endl;
 
+            ck::utils::PerfResultsLog::GetInstance().Record(device_op_name, ave_time);
+
             if(tflops > best_tflops)
             {
                 best_device_op_name = device_op_name;
@@ -10,7 +10,8 @@
 #include "element_wise_operation.hpp"
 #include "reduction_operator.hpp"
 #include "device_gemm_reduce.hpp"
-#include "reference_gemm.hpp"
+#include "reference_gemm_reduce.hpp"
+#include "perf_regression.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -146,6 +147,7 @@ void profile_gemm_bias_add_reduce_impl(int do_verification,
     using UnaryDivElementOp     = ck::tensor_operation::element_wise::UnaryDivide;
     using UnaryIdenticElementOp = ck::tensor_operation::element_wise::PassThrough;
     using UnarySquareElementOp  = ck::tensor_operation::element_wise::UnarySquare;
+    using DxsReduceOp           = ck::Tuple<D0ReduceOp, D1ReduceOp>;
     using DxsInElementOps       = ck::Tuple<UnaryIdenticElementOp, UnarySquareElementOp>;
     using DxsOutElementOps      = ck::Tuple<UnaryDivElementOp, UnaryDivElementOp>;
 
@@ -153,68 +155,60 @@ void profile_gemm_bias_add_reduce_impl(int do_verification,
     const auto b_element_op  = BElementOp{};
     const auto c_element_op  = CElementOp{};
     const auto c1_element_op = C1ElementOp{};
-    const auto d0_reduce_op  = D0ReduceOp{};
-    const auto d1_reduce_op  = D1ReduceOp{};
 
     auto dxs_in_element_op  = DxsInElementOps{};
     auto dxs_out_element_op = DxsOutElementOps{N, N};
 
     if(do_verification)
     {
-        using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
-                                                                                BDataType,
-                                                                                CDataType,
-                                                                                DDataType,
-                                                                                AElementOp,
-                                                                                BElementOp,
-                                                                                CElementOp>;
-
         using ReduceAccDataType = DDataType;
 
-        auto ref_gemm    = ReferenceGemmInstance{};
-        auto ref_invoker = ref_gemm.MakeInvoker();
-
-        auto ref_argument = ref_gemm.MakeArgument(
-            a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, PassThrough{});
-
-        ref_invoker.Run(ref_argument);
-
-        for(int m = 0; m < M; ++m)
-            for(int n = 0; n < N; ++n)
-            {
-                ReduceAccDataType acc = static_cast<ReduceAccDataType>(c_m_n_host_result(m, n)) +
-                                        static_cast<ReduceAccDataType>(bias_n(n));
-
-                ReduceAccDataType c1 = static_cast<ReduceAccDataType>(c1_m_n(m, n));
-                c_element_op(acc, acc);
-                c1_element_op(c1, c1);
-                acc += c1;
-                c_m_n_host_result(m, n) = static_cast<CDataType>(acc);
-            }
+        using ReferenceGemmReduceInstance =
+            ck::tensor_operation::host::ReferenceGemmReduce<ADataType,
+                                                            BDataType,
+                                                            CDataType,
+                                                            DDataType,
+                                                            ReduceAccDataType,
+                                                            DDataType,
+                                                            AElementOp,
+                                                            BElementOp,
+                                                            CElementOp,
+                                                            DxsReduceOp,
+                                                            DxsInElementOps,
+                                                            DxsOutElementOps>;
+
+        // c = c_element_op(gemm + bias[n]) + c1_element_op(c1[m, n]), where the GEMM result is
+        // rounded to CDataType before the bias is added
+        auto c_epilogue = [&](ReduceAccDataType& c,
+                              ReduceAccDataType acc,
+                              std::size_t,
+                              std::size_t m,
+                              std::size_t n) {
+            ReduceAccDataType c0 = static_cast<ReduceAccDataType>(static_cast<CDataType>(acc)) +
+                                   static_cast<ReduceAccDataType>(bias_n(n));
+            ReduceAccDataType c1 = static_cast<ReduceAccDataType>(c1_m_n(m, n));
+
+            c_element_op(c0, c0);
+            c1_element_op(c1, c1);
+
+            c = c0 + c1;
+        };
 
-        for(int m = 0; m < M; ++m)
-        {
-            auto d0_acc = d0_reduce_op.GetIdentityValue<ReduceAccDataType>();
-            auto d1_acc = d1_reduce_op.GetIdentityValue<ReduceAccDataType>();
+        auto ref_gemm_reduce = ReferenceGemmReduceInstance{};
+        auto ref_invoker     = ref_gemm_reduce.MakeInvoker();
 
-            for(int n = 0; n < N; ++n)
-            {
-                ReduceAccDataType c_val =
-                    ck::type_convert<ReduceAccDataType>(c_m_n_host_result(m, n));
-                ReduceAccDataType d0_val;
-                ReduceAccDataType d1_val;
-
-                dxs_in_element_op(ck::Number<0>{})(d0_val, c_val);
-                dxs_in_element_op(ck::Number<1>{})(d1_val, c_val);
-                d0_reduce_op(d0_acc, d0_val);
-                d1_reduce_op(d1_acc, d1_val);
-            }
+        auto ref_argument = ref_gemm_reduce.MakeArgument(a_m_k,
+                                                         b_k_n,
+                                                         c_m_n_host_result,
+                                                         {&d0_m_host_result, &d1_m_host_result},
+                                                         a_element_op,
+                                                         b_element_op,
+                                                         c_element_op,
+                                                         dxs_in_element_op,
+                                                         dxs_out_element_op,
+                                                         c_epilogue);
 
-            dxs_out_element_op(ck::Number<0>{})(d0_acc, d0_acc);
-            dxs_out_element_op(ck::Number<1>{})(d1_acc, d1_acc);
-            d0_m_host_result(m) = ck::type_convert<DDataType>(d0_acc);
-            d1_m_host_result(m) = ck::type_convert<DDataType>(d1_acc);
-        }
+        ref_invoker.Run(ref_argument);
     }
 
     DeviceMem a_device_buf(sizeof(ADataType) * a_m_k.mDesc.GetElementSpace());
@@ -335,6 +329,8 @@ void profile_gemm_bias_add_reduce_impl(int do_verification,
             std::cout << "Perf: " << ave_time << " ms, " << tflops << " TFlops, " << gb_per_sec
                       << " GB/s, " << gemm_name << std::endl;
 
+            ck::utils::PerfResultsLog::GetInstance().Record(gemm_name, ave_time);
+
             if(tflops > best_tflops)
             {
                 best_gemm_name  = gemm_name;
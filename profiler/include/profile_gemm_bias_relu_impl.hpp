@@ -11,6 +11,7 @@
 #include "element_wise_operation.hpp"
 #include "device_gemm_bias_activation.hpp"
 #include "reference_gemm_bias_activation.hpp"
+#include "perf_regression.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -227,6 +228,8 @@ void profile_gemm_bias_relu_impl(int do_verification,
             std::cout << "Perf: " << ave_time << " ms, " << tflops << " TFlops, " << gb_per_sec
                       << " GB/s, " << gemm_name << std::endl;
 
+            ck::utils::PerfResultsLog::GetInstance().Record(gemm_name, ave_time);
+
             if(tflops > best_tflops)
             {
                 best_gemm_name  = gemm_name;
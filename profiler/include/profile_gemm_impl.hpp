@@ -1,8 +1,11 @@
 #pragma once
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
+#include <type_traits>
 #include <typeinfo>
 
+#include "async_reference_verifier.hpp"
 #include "check_err.hpp"
 #include "config.hpp"
 #include "device.hpp"
@@ -14,6 +17,9 @@
 #include "element_wise_operation.hpp"
 #include "device_gemm.hpp"
 #include "reference_gemm.hpp"
+#include "instance_cost_model.hpp"
+#include "perf_regression.hpp"
+#include "profile_invocation.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -112,7 +118,8 @@ void profile_gemm_impl(int do_verification,
                        int StrideA,
                        int StrideB,
                        int StrideC,
-                       int KBatch)
+                       int KBatch,
+                       int TopK = 0)
 {
     auto f_host_tensor_descriptor =
         [](std::size_t row, std::size_t col, std::size_t stride, auto layout) {
@@ -172,6 +179,66 @@ void profile_gemm_impl(int do_verification,
     b_device_buf.ToDevice(b_k_n.mData.data());
     c_device_buf.ToDevice(c_m_n_device_result.mData.data());
 
+    // bf16 is verified in fp32
+    constexpr bool is_bf16 = is_same<ADataType, ck::bhalf_t>::value &&
+                             is_same<BDataType, ck::bhalf_t>::value &&
+                             is_same<CDataType, ck::bhalf_t>::value;
+
+    using HostCDataType = std::conditional_t<is_bf16, float, CDataType>;
+
+    Tensor<HostCDataType> c_m_n_host_result(f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
+
+    // the reference GEMM is computed once, on the host, while the device instances are profiled
+    ck::utils::AsyncReferenceVerifier ref_verifier;
+
+    if(do_verification)
+    {
+        ref_verifier.Launch([&]() {
+            if constexpr(is_bf16)
+            {
+                Tensor<float> a_f32_m_k(f_host_tensor_descriptor(M, K, StrideA, ALayout{}));
+                Tensor<float> b_f32_k_n(f_host_tensor_descriptor(K, N, StrideB, BLayout{}));
+
+                bf16_to_f32_(a_m_k, a_f32_m_k);
+                bf16_to_f32_(b_k_n, b_f32_k_n);
+
+                using ReferenceGemmInstance = ck::tensor_operation::host::
+                    ReferenceGemm<float, float, float, float, AElementOp, BElementOp, CElementOp>;
+
+                auto ref_gemm    = ReferenceGemmInstance{};
+                auto ref_invoker = ref_gemm.MakeInvoker();
+
+                auto ref_argument = ref_gemm.MakeArgument(a_f32_m_k,
+                                                          b_f32_k_n,
+                                                          c_m_n_host_result,
+                                                          a_element_op,
+                                                          b_element_op,
+                                                          c_element_op);
+
+                ref_invoker.Run(ref_argument);
+            }
+            else
+            {
+                using ReferenceGemmInstance =
+                    ck::tensor_operation::host::ReferenceGemm<ADataType,
+                                                              BDataType,
+                                                              CDataType,
+                                                              AccDataType,
+                                                              AElementOp,
+                                                              BElementOp,
+                                                              CElementOp>;
+
+                auto ref_gemm    = ReferenceGemmInstance{};
+                auto ref_invoker = ref_gemm.MakeInvoker();
+
+                auto ref_argument = ref_gemm.MakeArgument(
+                    a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, c_element_op);
+
+                ref_invoker.Run(ref_argument);
+            }
+        });
+    }
+
     // add device GEMM instances
     std::vector<ck::tensor_operation::device::device_gemm_instance::DeviceGemmNoOpPtr> gemm_ptrs;
 
@@ -437,28 +504,64 @@ void profile_gemm_impl(int do_verification,
         throw std::runtime_error("wrong! no device GEMM instance found");
     }
 
+    auto make_argument = [&](const auto& gemm_ptr) {
+        return gemm_ptr->MakeArgumentPointer(
+            static_cast<ADataType*>(a_device_buf.GetDeviceBuffer()),
+            static_cast<BDataType*>(b_device_buf.GetDeviceBuffer()),
+            static_cast<CDataType*>(c_device_buf.GetDeviceBuffer()),
+            M,
+            N,
+            K,
+            StrideA,
+            StrideB,
+            StrideC,
+            ck::tensor_operation::element_wise::PassThrough{},
+            ck::tensor_operation::element_wise::PassThrough{},
+            ck::tensor_operation::element_wise::PassThrough{},
+            KBatch);
+    };
+
+    if(TopK > 0)
+    {
+        // rank only the instances supporting this problem, so the top-k are all runnable
+        gemm_ptrs.erase(std::remove_if(gemm_ptrs.begin(),
+                                       gemm_ptrs.end(),
+                                       [&](const auto& gemm_ptr) {
+                                           return !gemm_ptr->IsSupportedArgument(
+                                               make_argument(gemm_ptr).get());
+                                       }),
+                        gemm_ptrs.end());
+
+        const ck::utils::GemmProblemShape problem{M,
+                                                  N,
+                                                  K,
+                                                  static_cast<int>(sizeof(ADataType)),
+                                                  static_cast<int>(sizeof(BDataType)),
+                                                  KBatch};
+
+        ck::utils::prune_gemm_instances(gemm_ptrs, problem, TopK);
+
+        std::cout << "profiling the top " << gemm_ptrs.size()
+                  << " instances ranked by the cost model" << std::endl;
+    }
+
     std::string best_gemm_name;
     float best_ave_time   = 0;
     float best_tflops     = 0;
     float best_gb_per_sec = 0;
 
+    const auto& invocation = ck::profiler::ProfilerInvocation::GetInstance();
+
     // profile device GEMM instances
     for(auto& gemm_ptr : gemm_ptrs)
     {
-        auto argument_ptr =
-            gemm_ptr->MakeArgumentPointer(static_cast<ADataType*>(a_device_buf.GetDeviceBuffer()),
-                                          static_cast<BDataType*>(b_device_buf.GetDeviceBuffer()),
-                                          static_cast<CDataType*>(c_device_buf.GetDeviceBuffer()),
-                                          M,
-                                          N,
-                                          K,
-                                          StrideA,
-                                          StrideB,
-                                          StrideC,
-                                          ck::tensor_operation::element_wise::PassThrough{},
-                                          ck::tensor_operation::element_wise::PassThrough{},
-                                          ck::tensor_operation::element_wise::PassThrough{},
-                                          KBatch);
+        // a replayed trace only profiles the instance that ran
+        if(!invocation.IsSelected(gemm_ptr->GetTypeString()))
+        {
+            continue;
+        }
+
+        auto argument_ptr = make_argument(gemm_ptr);
 
         auto invoker_ptr = gemm_ptr->MakeInvokerPointer();
 
@@ -470,8 +573,10 @@ void profile_gemm_impl(int do_verification,
 
             std::string gemm_name = gemm_ptr->GetTypeString();
 
-            float ave_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            float ave_time = invoker_ptr->TracedRun(*gemm_ptr,
+                                                    argument_ptr.get(),
+                                                    invocation.GetCommand(),
+                                                    StreamConfig{nullptr, time_kernel});
 
             std::size_t flop = std::size_t(2) * M * N * K;
 
@@ -485,6 +590,8 @@ void profile_gemm_impl(int do_verification,
             std::cout << "Perf: " << std::setw(10) << ave_time << " ms, " << tflops << " TFlops, "
                       << gb_per_sec << " GB/s, " << gemm_name << std::endl;
 
+            ck::utils::PerfResultsLog::GetInstance().Record(gemm_name, ave_time);
+
             if(tflops > best_tflops)
             {
                 best_gemm_name  = gemm_name;
@@ -497,73 +604,25 @@ void profile_gemm_impl(int do_verification,
             {
                 c_device_buf.FromDevice(c_m_n_device_result.mData.data());
 
-                if constexpr(is_same<ADataType, ck::bhalf_t>::value &&
-                             is_same<BDataType, ck::bhalf_t>::value &&
-                             is_same<CDataType, ck::bhalf_t>::value)
-                {
-                    Tensor<float> a_f32_m_k(f_host_tensor_descriptor(M, K, StrideA, ALayout{}));
-                    Tensor<float> b_f32_k_n(f_host_tensor_descriptor(K, N, StrideB, BLayout{}));
-                    Tensor<float> c_m_n_host_result(
-                        f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
-                    Tensor<float> c_m_n_device_f32_result(
-                        f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
-
-                    bf16_to_f32_(a_m_k, a_f32_m_k);
-                    bf16_to_f32_(b_k_n, b_f32_k_n);
-                    bf16_to_f32_(c_m_n_device_result, c_m_n_device_f32_result);
-
-                    using ReferenceGemmInstance =
-                        ck::tensor_operation::host::ReferenceGemm<float,
-                                                                  float,
-                                                                  float,
-                                                                  float,
-                                                                  AElementOp,
-                                                                  BElementOp,
-                                                                  CElementOp>;
-
-                    auto ref_gemm    = ReferenceGemmInstance{};
-                    auto ref_invoker = ref_gemm.MakeInvoker();
-
-                    auto ref_argument = ref_gemm.MakeArgument(a_f32_m_k,
-                                                              b_f32_k_n,
-                                                              c_m_n_host_result,
-                                                              a_element_op,
-                                                              b_element_op,
-                                                              c_element_op);
-
-                    ref_invoker.Run(ref_argument);
-
-                    ck::utils::check_err(c_m_n_device_f32_result.mData, c_m_n_host_result.mData);
+                // compared against a copy of the device result once the reference is ready
+                ref_verifier.Verify([&, c_m_n_device_result]() {
+                    bool pass = false;
 
-                    if(do_log)
+                    if constexpr(is_bf16)
                     {
-                        LogRangeAsType<float>(
-                            std::cout << "c_host  : ", c_m_n_host_result.mData, ",")
-                            << std::endl;
-                    }
-                }
-                else
-                {
-                    Tensor<CDataType> c_m_n_host_result(
-                        f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
-
-                    using ReferenceGemmInstance =
-                        ck::tensor_operation::host::ReferenceGemm<ADataType,
-                                                                  BDataType,
-                                                                  CDataType,
-                                                                  AccDataType,
-                                                                  AElementOp,
-                                                                  BElementOp,
-                                                                  CElementOp>;
+                        Tensor<float> c_m_n_device_f32_result(
+                            f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
 
-                    auto ref_gemm    = ReferenceGemmInstance{};
-                    auto ref_invoker = ref_gemm.MakeInvoker();
+                        bf16_to_f32_(c_m_n_device_result, c_m_n_device_f32_result);
 
-                    auto ref_argument = ref_gemm.MakeArgument(
-                        a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, c_element_op);
-
-                    ref_invoker.Run(ref_argument);
-                    ck::utils::check_err(c_m_n_device_result.mData, c_m_n_host_result.mData);
+                        pass = ck::utils::check_err(c_m_n_device_f32_result.mData,
+                                                    c_m_n_host_result.mData);
+                    }
+                    else
+                    {
+                        pass = ck::utils::check_err(c_m_n_device_result.mData,
+                                                    c_m_n_host_result.mData);
+                    }
 
                     if(do_log)
                     {
@@ -571,7 +630,9 @@ void profile_gemm_impl(int do_verification,
                             std::cout << "c_host  : ", c_m_n_host_result.mData, ",")
                             << std::endl;
                     }
-                }
+
+                    return pass;
+                });
 
                 if(do_log)
                 {
@@ -589,6 +650,8 @@ void profile_gemm_impl(int do_verification,
         }
     }
 
+    ref_verifier.Finish();
+
     if constexpr(is_same<CDataType, float>::value)
     {
         std::cout << "Best Perf for datatype = f32";
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <string>
+
+#include "device_invocation_trace.hpp"
+
+namespace ck {
+namespace profiler {
+
+// The ckProfiler command being run, which is the problem of the invocations it traces, and the
+// instance that "ckProfiler replay" pins the command to
+class ProfilerInvocation
+{
+    public:
+    static ProfilerInvocation& GetInstance()
+    {
+        static ProfilerInvocation invocation;
+
+        return invocation;
+    }
+
+    // only the gemm profiler traces the instances it runs and profiles a pinned instance only
+    static bool SupportsTracing(const std::string& op) { return op == "gemm"; }
+
+    // arguments of the command after "ckProfiler", e.g. "gemm 1 0 0 0 0 1 3840 4096 4096 ..."
+    const std::string& GetCommand() const { return command_; }
+
+    void SetCommand(const std::string& command) { command_ = command; }
+
+    // op name of the instance to profile, as recorded in the trace, or empty for all instances
+    void PinInstance(const std::string& op_name) { pinned_op_name_ = op_name; }
+
+    bool IsSelected(const std::string& type_string) const
+    {
+        return pinned_op_name_.empty() ||
+               pinned_op_name_ ==
+                   tensor_operation::device::InvocationTrace::GetRecordedOpName(type_string);
+    }
+
+    private:
+    std::string command_;
+    std::string pinned_op_name_;
+};
+
+} // namespace profiler
+} // namespace ck
@@ -0,0 +1,275 @@
+#pragma once
+
+#include <iomanip>
+
+#include "check_err.hpp"
+#include "config.hpp"
+#include "device.hpp"
+#include "host_tensor.hpp"
+#include "host_tensor_generator.hpp"
+#include "device_tensor.hpp"
+#include "reduction_enums.hpp"
+#include "reference_pool_fwd.hpp"
+#include "device_pool2d_fwd.hpp"
+#include "perf_regression.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace device_pool2d_fwd_instance {
+
+void add_device_pool2d_fwd_nhwc_f16_max_instances(
+    std::vector<DevicePool2dFwdPtr<ReduceTensorOp::MAX>>&);
+void add_device_pool2d_fwd_nhwc_f16_max_index_instances(
+    std::vector<DevicePool2dFwdPtr<ReduceTensorOp::MAX>>&);
+void add_device_pool2d_fwd_nhwc_f16_avg_instances(
+    std::vector<DevicePool2dFwdPtr<ReduceTensorOp::AVG>>&);
+void add_device_pool2d_fwd_nhwc_f32_max_instances(
+    std::vector<DevicePool2dFwdPtr<ReduceTensorOp::MAX>>&);
+void add_device_pool2d_fwd_nhwc_f32_max_index_instances(
+    std::vector<DevicePool2dFwdPtr<ReduceTensorOp::MAX>>&);
+void add_device_pool2d_fwd_nhwc_f32_avg_instances(
+    std::vector<DevicePool2dFwdPtr<ReduceTensorOp::AVG>>&);
+
+} // namespace device_pool2d_fwd_instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+namespace ck {
+namespace profiler {
+
+template <typename InDataType,
+          typename OutDataType,
+          typename AccDataType,
+          ck::ReduceTensorOp ReduceOpId,
+          bool OutputIndex>
+bool profile_pool2d_fwd_impl(int do_verification,
+                             int init_method,
+                             bool do_log,
+                             bool time_kernel,
+                             ck::index_t N,
+                             ck::index_t C,
+                             std::array<ck::index_t, 2> input_spatial_lengths,
+                             std::array<ck::index_t, 2> window_spatial_lengths,
+                             std::array<ck::index_t, 2> window_strides,
+                             std::array<ck::index_t, 2> input_left_pads,
+                             std::array<ck::index_t, 2> input_right_pads)
+{
+    // the device instances use int32_t indices and do not propagate NaN
+    using IndexDataType = int32_t;
+
+    constexpr bool PropagateNan = false;
+
+    const ck::index_t Hi = input_spatial_lengths[0];
+    const ck::index_t Wi = input_spatial_lengths[1];
+    const ck::index_t Y  = window_spatial_lengths[0];
+    const ck::index_t X  = window_spatial_lengths[1];
+
+    const ck::index_t Ho =
+        (Hi + input_left_pads[0] + input_right_pads[0] - Y) / window_strides[0] + 1;
+    const ck::index_t Wo =
+        (Wi + input_left_pads[1] + input_right_pads[1] - X) / window_strides[1] + 1;
+
+    // NHWC in memory, indexed as (n, c, h, w)
+    auto f_host_tensor_descriptor =
+        [](std::size_t N_, std::size_t C_, std::size_t H, std::size_t W) {
+            return HostTensorDescriptor(std::vector<std::size_t>({N_, C_, H, W}),
+                                        std::vector<std::size_t>({C_ * H * W, 1, W * C_, C_}));
+        };
+
+    Tensor<InDataType> in_n_c_hi_wi(f_host_tensor_descriptor(N, C, Hi, Wi));
+    Tensor<OutDataType> out_n_c_ho_wo_host(f_host_tensor_descriptor(N, C, Ho, Wo));
+    Tensor<IndexDataType> out_indices_n_c_ho_wo_host(f_host_tensor_descriptor(N, C, Ho, Wo));
+    Tensor<OutDataType> out_n_c_ho_wo_device(f_host_tensor_descriptor(N, C, Ho, Wo));
+    Tensor<IndexDataType> out_indices_n_c_ho_wo_device(f_host_tensor_descriptor(N, C, Ho, Wo));
+
+    std::cout << "in_n_c_hi_wi: " << in_n_c_hi_wi.mDesc << std::endl;
+    std::cout << "out_n_c_ho_wo: " << out_n_c_ho_wo_host.mDesc << std::endl;
+
+    switch(init_method)
+    {
+    case 0: break;
+    case 1: in_n_c_hi_wi.GenerateTensorValue(GeneratorTensor_2<InDataType>{-5, 5}); break;
+    default: in_n_c_hi_wi.GenerateTensorValue(GeneratorTensor_3<InDataType>{-5.0, 5.0});
+    }
+
+    if(do_verification)
+    {
+        using ReferencePoolFwdInstance =
+            ck::tensor_operation::host::ReferencePoolFwd<2,
+                                                         InDataType,
+                                                         OutDataType,
+                                                         AccDataType,
+                                                         IndexDataType,
+                                                         ReduceOpId,
+                                                         PropagateNan,
+                                                         OutputIndex>;
+
+        auto ref_pool     = ReferencePoolFwdInstance{};
+        auto ref_invoker  = ref_pool.MakeInvoker();
+        auto ref_argument = ref_pool.MakeArgument(
+            in_n_c_hi_wi,
+            out_n_c_ho_wo_host,
+            out_indices_n_c_ho_wo_host,
+            std::vector<ck::index_t>(window_spatial_lengths.begin(), window_spatial_lengths.end()),
+            std::vector<ck::index_t>(window_strides.begin(), window_strides.end()),
+            std::vector<ck::index_t>(input_left_pads.begin(), input_left_pads.end()),
+            std::vector<ck::index_t>(input_right_pads.begin(), input_right_pads.end()));
+
+        ref_invoker.Run(ref_argument);
+    }
+
+    DeviceMem in_device_buf(sizeof(InDataType) * in_n_c_hi_wi.mDesc.GetElementSpace());
+    DeviceMem out_device_buf(sizeof(OutDataType) * out_n_c_ho_wo_device.mDesc.GetElementSpace());
+    DeviceMem out_indices_device_buf(sizeof(IndexDataType) *
+                                     out_indices_n_c_ho_wo_device.mDesc.GetElementSpace());
+
+    in_device_buf.ToDevice(in_n_c_hi_wi.mData.data());
+
+    // add device pool2d_fwd instances
+    using namespace ck::tensor_operation::device::device_pool2d_fwd_instance;
+
+    std::vector<ck::tensor_operation::device::DevicePool2dFwdPtr<ReduceOpId>> pool_ptrs;
+
+    if constexpr(ReduceOpId == ck::ReduceTensorOp::MAX)
+    {
+        if constexpr(is_same_v<InDataType, half_t> && is_same_v<OutDataType, half_t>)
+        {
+            if constexpr(OutputIndex)
+            {
+                add_device_pool2d_fwd_nhwc_f16_max_index_instances(pool_ptrs);
+            }
+            else
+            {
+                add_device_pool2d_fwd_nhwc_f16_max_instances(pool_ptrs);
+            }
+        }
+        else if constexpr(is_same_v<InDataType, float> && is_same_v<OutDataType, float>)
+        {
+            if constexpr(OutputIndex)
+            {
+                add_device_pool2d_fwd_nhwc_f32_max_index_instances(pool_ptrs);
+            }
+            else
+            {
+                add_device_pool2d_fwd_nhwc_f32_max_instances(pool_ptrs);
+            }
+        }
+    }
+    else if constexpr(ReduceOpId == ck::ReduceTensorOp::AVG && !OutputIndex)
+    {
+        if constexpr(is_same_v<InDataType, half_t> && is_same_v<OutDataType, half_t>)
+        {
+            add_device_pool2d_fwd_nhwc_f16_avg_instances(pool_ptrs);
+        }
+        else if constexpr(is_same_v<InDataType, float> && is_same_v<OutDataType, float>)
+        {
+            add_device_pool2d_fwd_nhwc_f32_avg_instances(pool_ptrs);
+        }
+    }
+
+    if(pool_ptrs.size() <= 0)
+    {
+        throw std::runtime_error("wrong! no device pool2d_fwd instance found");
+    }
+
+    std::string best_pool_name;
+    float best_ave_time   = 0;
+    float best_gb_per_sec = 0;
+
+    bool pass = true;
+
+    // profile device pool2d_fwd instances
+    for(auto& pool_ptr : pool_ptrs)
+    {
+        auto argument_ptr = pool_ptr->MakeArgumentPointer(
+            static_cast<InDataType*>(in_device_buf.GetDeviceBuffer()),
+            static_cast<OutDataType*>(out_device_buf.GetDeviceBuffer()),
+            static_cast<IndexDataType*>(out_indices_device_buf.GetDeviceBuffer()),
+            N,
+            C,
+            input_spatial_lengths,
+            window_spatial_lengths,
+            std::array<ck::index_t, 2>{{Ho, Wo}},
+            window_strides,
+            input_left_pads,
+            input_right_pads);
+
+        auto invoker_ptr = pool_ptr->MakeInvokerPointer();
+
+        std::string pool_name = pool_ptr->GetTypeString();
+
+        if(!pool_ptr->IsSupportedArgument(argument_ptr.get()))
+        {
+            std::cout << pool_name << " does not support this problem" << std::endl;
+
+            continue;
+        }
+
+        float ave_time = invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+
+        std::size_t num_btype =
+            sizeof(InDataType) * N * C * Hi * Wi + sizeof(OutDataType) * N * C * Ho * Wo;
+
+        if constexpr(OutputIndex)
+        {
+            num_btype += sizeof(IndexDataType) * N * C * Ho * Wo;
+        }
+
+        float gb_per_sec = num_btype / 1.E6 / ave_time;
+
+        std::cout << "Perf: " << std::setw(10) << ave_time << " ms, " << gb_per_sec << " GB/s, "
+                  << pool_name << std::endl;
+
+        ck::utils::PerfResultsLog::GetInstance().Record(pool_name, ave_time);
+
+        if(gb_per_sec > best_gb_per_sec)
+        {
+            best_pool_name  = pool_name;
+            best_ave_time   = ave_time;
+            best_gb_per_sec = gb_per_sec;
+        }
+
+        if(do_verification)
+        {
+            out_device_buf.FromDevice(out_n_c_ho_wo_device.mData.data());
+
+            bool same = ck::utils::check_err(out_n_c_ho_wo_device.mData, out_n_c_ho_wo_host.mData);
+
+            if constexpr(OutputIndex)
+            {
+                out_indices_device_buf.FromDevice(out_indices_n_c_ho_wo_device.mData.data());
+
+                same = same && ck::utils::check_err(out_indices_n_c_ho_wo_device.mData,
+                                                    out_indices_n_c_ho_wo_host.mData);
+            }
+
+            if(!same)
+            {
+                std::cout << pool_name << " failed verification" << std::endl;
+            }
+
+            if(do_log)
+            {
+                LogRangeAsType<float>(std::cout << "in  : ", in_n_c_hi_wi.mData, ",")
+                    << std::endl;
+                LogRangeAsType<float>(std::cout << "out_host  : ", out_n_c_ho_wo_host.mData, ",")
+                    << std::endl;
+                LogRangeAsType<float>(
+                    std::cout << "out_device: ", out_n_c_ho_wo_device.mData, ",")
+                    << std::endl;
+            }
+
+            pass = pass && same;
+        }
+    }
+
+    std::cout << "Best Perf: " << best_ave_time << " ms, " << best_gb_per_sec << " GB/s, "
+              << best_pool_name << std::endl;
+
+    return pass;
+}
+
+} // namespace profiler
+} // namespace ck
@@ -7,6 +7,7 @@
 #include "host_reduction.hpp"
 #include "host_common_util.hpp"
 #include "host_tensor_generator.hpp"
+#include "perf_regression.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -380,9 +381,13 @@ bool profile_reduce_impl_impl(bool do_verification,
             float gb_per_sec = num_bytes / 1.E6 / avg_time;
 
             if(time_kernel)
+            {
                 std::cout << "Perf: " << avg_time << " ms, " << gb_per_sec << " GB/s, "
                           << reduce_name << std::endl;
 
+                ck::utils::PerfResultsLog::GetInstance().Record(reduce_name, avg_time);
+            }
+
             if(gb_per_sec > best_gb_per_sec)
             {
                 best_avg_time   = avg_time;
@@ -0,0 +1,102 @@
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "perf_regression.hpp"
+
+namespace {
+
+void print_stats(const ck::utils::PerfStats& stats)
+{
+    std::cout << std::setw(10) << stats.mean << " ms +- " << std::setw(8) << stats.stddev << " (n "
+              << stats.num_samples << ")";
+}
+
+} // namespace
+
+// Compare results recorded with CK_PROFILER_RESULTS=<file> against a baseline. Returns non-zero
+// if any op/problem/instance got slower by more than the thresholds, see ComparePerfResults().
+int profile_compare(int argc, char* argv[])
+{
+    if(argc < 4 || argc > 6)
+    {
+        printf("arg1: tensor operation (compare: compare a results file against a baseline)\n");
+        printf("arg2: baseline results file, as written with CK_PROFILER_RESULTS=<file>\n");
+        printf("arg3: current results file\n");
+        printf("arg4: minimum relative slowdown of a regression (default 0.05)\n");
+        printf("arg5: minimum slowdown in standard errors of the repeats (default 3)\n");
+        exit(1);
+    }
+
+    ck::utils::PerfThresholds thresholds;
+
+    if(argc > 4)
+    {
+        thresholds.min_slowdown = std::stod(argv[4]);
+    }
+
+    if(argc > 5)
+    {
+        thresholds.num_sigma = std::stod(argv[5]);
+    }
+
+    ck::utils::PerfComparisonReport report;
+
+    try
+    {
+        report = ck::utils::ComparePerfResults(ck::utils::ReadPerfRecords(std::string(argv[2])),
+                                               ck::utils::ReadPerfRecords(std::string(argv[3])),
+                                               thresholds);
+    }
+    catch(const std::exception& e)
+    {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+
+    for(const auto& key : report.missing_in_current)
+    {
+        std::cout << "warning: not in current results: " << key << std::endl;
+    }
+
+    for(const auto& key : report.missing_in_baseline)
+    {
+        std::cout << "warning: not in baseline results: " << key << std::endl;
+    }
+
+    if(report.comparisons.empty())
+    {
+        std::cout << "error: no results in common with the baseline" << std::endl;
+        return 1;
+    }
+
+    const std::size_t num_regressions = report.GetNumRegressions();
+
+    std::cout << "compared " << report.comparisons.size() << " results, " << num_regressions
+              << " regressions (slowdown > " << thresholds.min_slowdown * 100 << "% and > "
+              << thresholds.num_sigma << " sigma)" << std::endl;
+
+    // comparisons are ranked by slowdown
+    std::size_t rank = 0;
+
+    for(const auto& c : report.comparisons)
+    {
+        if(!c.is_regression)
+        {
+            continue;
+        }
+
+        std::cout << "#" << ++rank << ": " << std::fixed << std::setprecision(2) << std::setw(7)
+                  << c.slowdown * 100 << "% slower, " << std::setprecision(4) << "baseline";
+        print_stats(c.baseline);
+        std::cout << ", current";
+        print_stats(c.current);
+        std::cout << std::defaultfloat << std::endl
+                  << "    " << c.op << " " << c.problem << std::endl
+                  << "    " << c.instance << std::endl;
+    }
+
+    return num_regressions > 0 ? 1 : 0;
+}
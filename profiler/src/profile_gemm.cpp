@@ -28,7 +28,7 @@ enum struct GemmDataType
 
 int profile_gemm(int argc, char* argv[])
 {
-    if(!(argc == 14 || argc == 15))
+    if(!(argc == 14 || argc == 15 || argc == 16))
     {
         printf("arg1: tensor operation (gemm: GEMM)\n");
         printf("arg2: data type (0: fp32; 1: fp16; 2: bf16; 3: int8)\n");
@@ -42,6 +42,7 @@ int profile_gemm(int argc, char* argv[])
         printf("arg7: time kernel (0=n0, 1=yes)\n");
         printf("arg8 to 13: M, N, K, StrideA, StrideB, StrideC\n");
         printf("arg14: split k into  mulitiple batch\n");
+        printf("arg15: only profile the top k instances ranked by the cost model (0: all)\n");
         exit(1);
     }
 
@@ -60,8 +61,11 @@ int profile_gemm(int argc, char* argv[])
     const int StrideB = std::stoi(argv[12]);
     const int StrideC = std::stoi(argv[13]);
     int KBatch        = 1;
-    if(argc == 15)
+    if(argc >= 15)
         KBatch = std::stoi(argv[14]);
+    int TopK = 0;
+    if(argc == 16)
+        TopK = std::stoi(argv[15]);
 
     if(data_type == GemmDataType::F16_F16_F16 && layout == GemmMatrixLayout::MK_KN_MN)
     {
@@ -82,7 +86,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? K : StrideA,
             (StrideB < 0) ? N : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            TopK);
     }
     else if(data_type == GemmDataType::F16_F16_F16 && layout == GemmMatrixLayout::MK_NK_MN)
     {
@@ -103,7 +108,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? K : StrideA,
             (StrideB < 0) ? K : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            TopK);
     }
     else if(data_type == GemmDataType::F16_F16_F16 && layout == GemmMatrixLayout::KM_KN_MN)
     {
@@ -124,7 +130,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? N : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            TopK);
     }
     else if(data_type == GemmDataType::F16_F16_F16 && layout == GemmMatrixLayout::KM_NK_MN)
     {
@@ -145,7 +152,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? K : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            TopK);
     }
     else if(data_type == GemmDataType::F32_F32_F32 && layout == GemmMatrixLayout::MK_KN_MN)
     {
@@ -166,7 +174,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? K : StrideA,
             (StrideB < 0) ? N : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            TopK);
     }
     else if(data_type == GemmDataType::F32_F32_F32 && layout == GemmMatrixLayout::MK_NK_MN)
     {
@@ -187,7 +196,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? K : StrideA,
             (StrideB < 0) ? K : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            TopK);
     }
     else if(data_type == GemmDataType::F32_F32_F32 && layout == GemmMatrixLayout::KM_KN_MN)
     {
@@ -208,7 +218,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? N : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            TopK);
     }
     else if(data_type == GemmDataType::F32_F32_F32 && layout == GemmMatrixLayout::KM_NK_MN)
     {
@@ -229,7 +240,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? K : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            TopK);
     }
     else if(data_type == GemmDataType::INT8_INT8_INT8 && layout == GemmMatrixLayout::MK_KN_MN)
     {
@@ -250,7 +262,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? K : StrideA,
             (StrideB < 0) ? N : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            TopK);
     }
     else if(data_type == GemmDataType::INT8_INT8_INT8 && layout == GemmMatrixLayout::MK_NK_MN)
     {
@@ -271,7 +284,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? K : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            TopK);
     }
     else if(data_type == GemmDataType::INT8_INT8_INT8 && layout == GemmMatrixLayout::KM_KN_MN)
     {
@@ -292,7 +306,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? N : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            TopK);
     }
     else if(data_type == GemmDataType::INT8_INT8_INT8 && layout == GemmMatrixLayout::KM_NK_MN)
     {
@@ -313,7 +328,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? K : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            TopK);
     }
     else if(data_type == GemmDataType::BF16_BF16_BF16 && layout == GemmMatrixLayout::MK_KN_MN)
     {
@@ -334,7 +350,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? K : StrideA,
             (StrideB < 0) ? N : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            TopK);
     }
     else if(data_type == GemmDataType::BF16_BF16_BF16 && layout == GemmMatrixLayout::MK_NK_MN)
     {
@@ -355,7 +372,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? K : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            TopK);
     }
     else if(data_type == GemmDataType::BF16_BF16_BF16 && layout == GemmMatrixLayout::KM_KN_MN)
     {
@@ -376,7 +394,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? N : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            TopK);
     }
     else if(data_type == GemmDataType::BF16_BF16_BF16 && layout == GemmMatrixLayout::KM_NK_MN)
     {
@@ -397,7 +416,8 @@ int profile_gemm(int argc, char* argv[])
             (StrideA < 0) ? M : StrideA,
             (StrideB < 0) ? K : StrideB,
             (StrideC < 0) ? N : StrideC,
-            KBatch);
+            KBatch,
+            TopK);
     }
     else
     {
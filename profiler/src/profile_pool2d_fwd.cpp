@@ -0,0 +1,118 @@
+#include <iostream>
+#include <numeric>
+#include <initializer_list>
+#include <cstdlib>
+#include <stdlib.h>
+
+#include "profile_pool2d_fwd_impl.hpp"
+
+int profile_pool2d_fwd(int argc, char* argv[])
+{
+    enum struct PoolDataType
+    {
+        F32_F32, // 0
+        F16_F16, // 1
+    };
+
+    enum struct PoolOp
+    {
+        Max,      // 0
+        MaxIndex, // 1
+        Avg,      // 2
+    };
+
+    if(argc != 20)
+    {
+        // clang-format off
+        printf("arg1: tensor operation (pool2d_fwd: Pool2d forward, NHWC)\n");
+        printf("arg2: data type (0: fp32; 1: fp16)\n");
+        printf("arg3: pooling (0: max; 1: max with index; 2: average)\n");
+        printf("arg4: verification (0: no; 1: yes)\n");
+        printf("arg5: initialization (0: no init; 1: integer value; 2: decimal value)\n");
+        printf("arg6: print tensor value (0: no; 1: yes)\n");
+        printf("arg7: time kernel (0=no, 1=yes)\n");
+        printf("arg8 to 19: N, C, Y, X, Hi, Wi, Sy, Sx, LeftPy, LeftPx, RightPy, RightPx\n");
+        // clang-format on
+        exit(1);
+    }
+
+    const auto data_type       = static_cast<PoolDataType>(std::stoi(argv[2]));
+    const auto pool_op         = static_cast<PoolOp>(std::stoi(argv[3]));
+    const bool do_verification = std::stoi(argv[4]);
+    const int init_method      = std::stoi(argv[5]);
+    const bool do_log          = std::stoi(argv[6]);
+    const bool time_kernel     = std::stoi(argv[7]);
+
+    const ck::index_t N = std::stoi(argv[8]);
+    const ck::index_t C = std::stoi(argv[9]);
+
+    const std::array<ck::index_t, 2> window_spatial_lengths{{std::stoi(argv[10]),
+                                                             std::stoi(argv[11])}};
+    const std::array<ck::index_t, 2> input_spatial_lengths{{std::stoi(argv[12]),
+                                                            std::stoi(argv[13])}};
+    const std::array<ck::index_t, 2> window_strides{{std::stoi(argv[14]), std::stoi(argv[15])}};
+    const std::array<ck::index_t, 2> input_left_pads{{std::stoi(argv[16]), std::stoi(argv[17])}};
+    const std::array<ck::index_t, 2> input_right_pads{{std::stoi(argv[18]), std::stoi(argv[19])}};
+
+    using F16 = ck::half_t;
+    using F32 = float;
+
+    auto profile = [&](auto in_type, auto out_type, auto acc_type, auto reduce_op, auto index) {
+        using InDataType  = decltype(in_type);
+        using OutDataType = decltype(out_type);
+        using AccDataType = decltype(acc_type);
+
+        return ck::profiler::profile_pool2d_fwd_impl<InDataType,
+                                                     OutDataType,
+                                                     AccDataType,
+                                                     decltype(reduce_op)::value,
+                                                     decltype(index)::value>(
+            do_verification,
+            init_method,
+            do_log,
+            time_kernel,
+            N,
+            C,
+            input_spatial_lengths,
+            window_spatial_lengths,
+            window_strides,
+            input_left_pads,
+            input_right_pads);
+    };
+
+    using Max = std::integral_constant<ck::ReduceTensorOp, ck::ReduceTensorOp::MAX>;
+    using Avg = std::integral_constant<ck::ReduceTensorOp, ck::ReduceTensorOp::AVG>;
+
+    bool pass = true;
+
+    if(data_type == PoolDataType::F32_F32 && pool_op == PoolOp::Max)
+    {
+        pass = profile(F32{}, F32{}, F32{}, Max{}, std::false_type{});
+    }
+    else if(data_type == PoolDataType::F32_F32 && pool_op == PoolOp::MaxIndex)
+    {
+        pass = profile(F32{}, F32{}, F32{}, Max{}, std::true_type{});
+    }
+    else if(data_type == PoolDataType::F32_F32 && pool_op == PoolOp::Avg)
+    {
+        pass = profile(F32{}, F32{}, F32{}, Avg{}, std::false_type{});
+    }
+    else if(data_type == PoolDataType::F16_F16 && pool_op == PoolOp::Max)
+    {
+        pass = profile(F16{}, F16{}, F32{}, Max{}, std::false_type{});
+    }
+    else if(data_type == PoolDataType::F16_F16 && pool_op == PoolOp::MaxIndex)
+    {
+        pass = profile(F16{}, F16{}, F32{}, Max{}, std::true_type{});
+    }
+    else if(data_type == PoolDataType::F16_F16 && pool_op == PoolOp::Avg)
+    {
+        pass = profile(F16{}, F16{}, F32{}, Avg{}, std::false_type{});
+    }
+    else
+    {
+        std::cout << "this data_type & pooling is not implemented" << std::endl;
+    }
+
+    return pass ? 0 : 1;
+}
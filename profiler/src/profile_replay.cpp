@@ -0,0 +1,148 @@
+#include <iostream>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "profile_invocation.hpp"
+
+int profile(int, char*[]);
+
+namespace {
+
+struct ReplayEntry
+{
+    std::size_t num_invocations = 0;
+    double kernel_time_ms       = 0;
+    double host_time_ms         = 0;
+};
+
+} // namespace
+
+// Re-run the invocations of a trace, as written by InvocationTrace. Each distinct pair of problem
+// and instance is profiled once, in order of first appearance, with the ckProfiler command stored
+// in the trace pinned to the instance that ran. Only gemm commands can be pinned, see
+// ProfilerInvocation::SupportsTracing().
+int profile_replay(int argc, char* argv[])
+{
+    if(argc != 3)
+    {
+        printf("arg1: tensor operation (replay: re-profile the problems of an invocation trace)\n");
+        printf("arg2: trace file, as written with CK_TRACE_INVOCATIONS=<file>\n");
+        exit(1);
+    }
+
+    std::ifstream file(argv[2]);
+
+    if(!file)
+    {
+        std::cout << "cannot open " << argv[2] << std::endl;
+        return 1;
+    }
+
+    // problem and op name of the traced invocations
+    using ReplayKey = std::pair<std::string, std::string>;
+
+    std::vector<ReplayKey> keys;
+    std::map<ReplayKey, ReplayEntry> entries;
+
+    std::string line;
+
+    while(std::getline(file, line))
+    {
+        if(line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        // thread, op, workspace_bytes, kernel_time_ms, host_time_ms, problem
+        std::vector<std::string> fields;
+        std::istringstream fields_stream(line);
+        std::string field;
+
+        while(std::getline(fields_stream, field, '\t'))
+        {
+            fields.push_back(field);
+        }
+
+        if(fields.size() != 6 || fields[5].empty())
+        {
+            continue;
+        }
+
+        const ReplayKey key{fields[5], fields[1]};
+
+        if(entries.count(key) == 0)
+        {
+            keys.push_back(key);
+        }
+
+        auto& entry = entries[key];
+
+        entry.num_invocations += 1;
+        entry.kernel_time_ms += std::stod(fields[3]);
+        entry.host_time_ms += std::stod(fields[4]);
+    }
+
+    int result = 0;
+
+    auto& invocation = ck::profiler::ProfilerInvocation::GetInstance();
+
+    for(const auto& key : keys)
+    {
+        const std::string& problem = key.first;
+        const std::string& op_name = key.second;
+
+        const auto& entry = entries[key];
+
+        std::cout << "replay: " << problem << " on " << op_name << " (" << entry.num_invocations
+                  << " invocations, traced kernel time " << entry.kernel_time_ms
+                  << " ms, host time " << entry.host_time_ms << " ms)" << std::endl;
+
+        std::vector<std::string> args{"ckProfiler"};
+        std::istringstream args_stream(problem);
+        std::string arg;
+
+        while(args_stream >> arg)
+        {
+            args.push_back(arg);
+        }
+
+        // a trace must not replay itself
+        if(args.size() < 2 || args[1] == "replay")
+        {
+            continue;
+        }
+
+        // other profilers would run all instances instead of the pinned one
+        if(!ck::profiler::ProfilerInvocation::SupportsTracing(args[1]))
+        {
+            std::cout << "replay: skipped, " << args[1] << " can not be pinned to an instance"
+                      << std::endl;
+
+            continue;
+        }
+
+        std::vector<char*> args_ptr;
+
+        for(auto& a : args)
+        {
+            args_ptr.push_back(&a[0]);
+        }
+
+        args_ptr.push_back(nullptr);
+
+        invocation.PinInstance(op_name);
+
+        if(profile(static_cast<int>(args.size()), args_ptr.data()) != 0)
+        {
+            result = 1;
+        }
+
+        invocation.PinInstance("");
+    }
+
+    return result;
+}
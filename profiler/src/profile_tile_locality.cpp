@@ -0,0 +1,141 @@
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "tensor_descriptor_helper.hpp"
+#include "block_to_ctile_map.hpp"
+#include "l2_locality_simulator.hpp"
+
+namespace {
+
+struct TileOrderingResult
+{
+    std::string name;
+    ck::utils::L2LocalityStats stats;
+};
+
+template <ck::index_t MPerBlock, ck::index_t NPerBlock>
+std::vector<TileOrderingResult>
+simulate_tile_orderings(const ck::utils::L2LocalityProblem& problem)
+{
+    using namespace ck;
+
+    auto c_grid_desc_m_n =
+        make_naive_tensor_descriptor_packed(make_tuple(problem.M, problem.N));
+
+    using CGridDesc_M_N = decltype(c_grid_desc_m_n);
+
+    std::vector<TileOrderingResult> results;
+
+    for(index_t M01 : {1, 2, 4, 8, 16, 32})
+    {
+        BlockToCTileMap_M00_N0_M01Adapt<MPerBlock, NPerBlock, CGridDesc_M_N> map(c_grid_desc_m_n,
+                                                                                 M01);
+
+        results.push_back(
+            {"M00_N0_M01Adapt M01=" + std::to_string(M01),
+             utils::simulate_l2_locality(map, map.CalculateGridSize(c_grid_desc_m_n), problem)});
+    }
+
+    for(index_t S01 : {2, 4, 8, 16, 32})
+    {
+        BlockToCTileMap_M00_N00_S01MortonAdapt<MPerBlock, NPerBlock, CGridDesc_M_N> map(
+            c_grid_desc_m_n, S01);
+
+        results.push_back(
+            {"M00_N00_S01MortonAdapt S01=" + std::to_string(S01),
+             utils::simulate_l2_locality(map, map.CalculateGridSize(c_grid_desc_m_n), problem)});
+    }
+
+    for(index_t S01 : {2, 4, 8, 16, 32})
+    {
+        BlockToCTileMap_M00_N00_S01HilbertAdapt<MPerBlock, NPerBlock, CGridDesc_M_N> map(
+            c_grid_desc_m_n, S01);
+
+        results.push_back(
+            {"M00_N00_S01HilbertAdapt S01=" + std::to_string(S01),
+             utils::simulate_l2_locality(map, map.CalculateGridSize(c_grid_desc_m_n), problem)});
+    }
+
+    return results;
+}
+
+} // namespace
+
+int profile_tile_locality(int argc, char* argv[])
+{
+    if(argc != 12)
+    {
+        printf("arg1: tensor operation (tile_locality: C-tile ordering L2 locality simulator)\n");
+        printf("arg2 to 4: M, N, K\n");
+        printf("arg5 to 7: MPerBlock, NPerBlock, KPerBlock (MPerBlock, NPerBlock: 64, 128 or "
+               "256)\n");
+        printf("arg8: A element size in bytes\n");
+        printf("arg9: B element size in bytes\n");
+        printf("arg10: number of concurrent blocks (num_cu * occupancy)\n");
+        printf("arg11: L2 size in KB\n");
+        exit(1);
+    }
+
+    ck::utils::L2LocalityProblem problem;
+
+    problem.M                 = std::stoi(argv[2]);
+    problem.N                 = std::stoi(argv[3]);
+    problem.K                 = std::stoi(argv[4]);
+    problem.MPerBlock         = std::stoi(argv[5]);
+    problem.NPerBlock         = std::stoi(argv[6]);
+    problem.KPerBlock         = std::stoi(argv[7]);
+    problem.a_element_bytes   = std::stoi(argv[8]);
+    problem.b_element_bytes   = std::stoi(argv[9]);
+    problem.concurrent_blocks = std::stoi(argv[10]);
+    problem.l2_bytes          = std::size_t(std::stoi(argv[11])) * 1024;
+
+    std::vector<TileOrderingResult> results;
+
+    // tile sizes need to be known at compile time by the block-to-C-tile maps
+    ck::static_for<0, 3, 1>{}([&](auto i) {
+        ck::static_for<0, 3, 1>{}([&](auto j) {
+            constexpr ck::index_t MPerBlock = 64 << decltype(i)::value;
+            constexpr ck::index_t NPerBlock = 64 << decltype(j)::value;
+
+            if(problem.MPerBlock == MPerBlock && problem.NPerBlock == NPerBlock)
+            {
+                results = simulate_tile_orderings<MPerBlock, NPerBlock>(problem);
+            }
+        });
+    });
+
+    if(results.empty())
+    {
+        std::cout << "this tile size is not supported" << std::endl;
+        return 1;
+    }
+
+    std::size_t best = 0;
+
+    for(std::size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& stats = results[i].stats;
+
+        std::cout << std::setw(32) << std::left << results[i].name << std::right
+                  << " fetched: " << std::setw(10) << std::fixed << std::setprecision(2)
+                  << stats.GetBytesFetched() / (1024. * 1024.) << " MB"
+                  << ", per wave: " << std::setw(8)
+                  << stats.GetAverageBytesFetchedPerWave() / (1024. * 1024.) << " MB"
+                  << ", A reuse: " << std::setw(6) << stats.GetAReuse()
+                  << ", B reuse: " << std::setw(6) << stats.GetBReuse()
+                  << ", L2 hit rate: " << std::setw(6) << stats.GetHitRate() * 100 << " %"
+                  << std::endl;
+
+        if(stats.GetBytesFetched() < results[best].stats.GetBytesFetched())
+        {
+            best = i;
+        }
+    }
+
+    std::cout << "Best ordering: " << results[best].name << std::endl;
+
+    return 0;
+}
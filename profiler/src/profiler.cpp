@@ -3,8 +3,12 @@
 #include <initializer_list>
 #include <cstdlib>
 #include <cstring>
+#include <string>
+#include <vector>
 
 #include "profile_convnd_fwd.hpp"
+#include "perf_regression.hpp"
+#include "profile_invocation.hpp"
 
 int profile_gemm(int, char*[]);
 int profile_gemm_bias_2d(int, char*[]);
@@ -23,6 +27,10 @@ int profile_reduce(int, char*[]);
 int profile_conv_bwd_weight(int, char*[]);
 int profile_batched_gemm_reduce(int, char*[]);
 int profile_gemm_add_add_fastgelu(int, char*[]);
+int profile_pool2d_fwd(int, char*[]);
+int profile_tile_locality(int, char*[]);
+int profile_replay(int, char*[]);
+int profile_compare(int, char*[]);
 
 static void print_helper_message()
 {
@@ -42,11 +50,15 @@ static void print_helper_message()
                "                        conv3d_bwd_data: BackwardConvolution data 3 dim\n"
                "                        reduce: Reduce\n"
                "                        conv2d_bwd_weight: Backward Weight Convolution 2d\n"
-               "                        gemm_add_add_fastgelu: GEMM+Add+Add+FastGeLU\n");
+               "                        gemm_add_add_fastgelu: GEMM+Add+Add+FastGeLU\n"
+               "                        pool2d_fwd: Pool2d forward\n"
+               "                        tile_locality: C-tile ordering L2 locality simulator (host only)\n"
+               "                        replay: re-profile the problems of an invocation trace\n"
+               "                        compare: compare a results file against a baseline (host only)\n");
     // clang-format on
 }
 
-int main(int argc, char* argv[])
+int profile(int argc, char* argv[])
 {
     if(argc == 1)
     {
@@ -55,6 +67,35 @@ int main(int argc, char* argv[])
         return 0;
     }
 
+    const std::vector<std::string> args(argv + 2, argv + argc);
+
+    // results written to CK_PROFILER_RESULTS are keyed by the problem of the command
+    ck::utils::PerfResultsLog::GetInstance().SetProblem(argv[1],
+                                                        ck::utils::GetPerfProblem(argv[1], args));
+
+    if(ck::profiler::ProfilerInvocation::SupportsTracing(argv[1]))
+    {
+        // traced invocations are recorded with the command that reproduces them
+        std::string command = argv[1];
+
+        for(const auto& arg : args)
+        {
+            command += " " + arg;
+        }
+
+        ck::profiler::ProfilerInvocation::GetInstance().SetCommand(command);
+    }
+    else if(ck::tensor_operation::device::InvocationTrace::IsEnabled() &&
+            strcmp(argv[1], "replay") != 0 && strcmp(argv[1], "compare") != 0 &&
+            strcmp(argv[1], "tile_locality") != 0)
+    {
+        // the trace would stay empty
+        std::cout << "CK_TRACE_INVOCATIONS is only supported by the gemm profiler, not by "
+                  << argv[1] << std::endl;
+
+        return 1;
+    }
+
     if(strcmp(argv[1], "gemm") == 0)
     {
         return profile_gemm(argc, argv);
@@ -131,6 +172,22 @@ int main(int argc, char* argv[])
     {
         return profile_gemm_add_add_fastgelu(argc, argv);
     }
+    else if(strcmp(argv[1], "pool2d_fwd") == 0)
+    {
+        return profile_pool2d_fwd(argc, argv);
+    }
+    else if(strcmp(argv[1], "tile_locality") == 0)
+    {
+        return profile_tile_locality(argc, argv);
+    }
+    else if(strcmp(argv[1], "replay") == 0)
+    {
+        return profile_replay(argc, argv);
+    }
+    else if(strcmp(argv[1], "compare") == 0)
+    {
+        return profile_compare(argc, argv);
+    }
     else
     {
         print_helper_message();
@@ -138,3 +195,5 @@ int main(int argc, char* argv[])
         return 0;
     }
 }
+
+int main(int argc, char* argv[]) { return profile(argc, argv); }
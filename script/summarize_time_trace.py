@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""Summarizes the clang -ftime-trace output of one or more translation units.
+
+For each object file the trace <object without extension>.json is read, as written by clang next
+to the object, and the front-end and back-end times, the number of class and function template
+instantiations and the templates that took longest to instantiate are printed.
+
+If the environment variable CK_PROFILER_RESULTS is set, the times are appended to that file as
+records "compile_time <source> <phase> <time_ms>", the format written by ckProfiler, so that two
+builds can be compared with "ckProfiler compare <baseline> <current>".
+"""
+import argparse
+import collections
+import json
+import os
+import sys
+
+PHASES = ['ExecuteCompiler', 'Frontend', 'Backend', 'InstantiateClass', 'InstantiateFunction',
+          'PerformPendingInstantiations']
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description='Summarize clang -ftime-trace output')
+    parser.add_argument('objects', nargs='+', help='object files compiled with -ftime-trace')
+    parser.add_argument('--top', type=int, default=20,
+                        help='number of templates with the longest instantiation time to print')
+    return parser.parse_args()
+
+
+def get_trace_file(object_file):
+    # foo.cpp.o -> foo.cpp.json
+    return os.path.splitext(object_file)[0] + '.json'
+
+
+def summarize(trace_file):
+    with open(trace_file) as f:
+        events = json.load(f)['traceEvents']
+
+    times_ms = collections.defaultdict(float)
+    counts = collections.Counter()
+    templates_ms = collections.defaultdict(float)
+
+    # complete events only, durations are in us
+    for e in (e for e in events if e.get('ph') == 'X'):
+        name = e['name']
+
+        if name.startswith('Total '):
+            # clang's totals do not count events nested in an event of the same name
+            times_ms[name[len('Total '):]] += e['dur'] / 1000.0
+            continue
+
+        counts[name] += 1
+
+        if name in ('InstantiateClass', 'InstantiateFunction'):
+            templates_ms[e.get('args', {}).get('detail', '?')] += e['dur'] / 1000.0
+
+    return times_ms, counts, templates_ms
+
+
+def main():
+    args = parse_args()
+
+    results_file = os.environ.get('CK_PROFILER_RESULTS')
+
+    for object_file in args.objects:
+        trace_file = get_trace_file(object_file)
+
+        if not os.path.exists(trace_file):
+            print('wrong! cannot find {}, was {} compiled by clang with -ftime-trace?'.format(
+                trace_file, object_file))
+            return 1
+
+        times_ms, counts, templates_ms = summarize(trace_file)
+
+        source = os.path.basename(os.path.splitext(object_file)[0])
+
+        print(source)
+
+        for phase in PHASES:
+            print('    {:<32}{:>12.1f} ms{:>10} events'.format(phase, times_ms[phase],
+                                                                counts[phase]))
+
+        print('    templates with the longest instantiation time, inclusive of nested ones:')
+
+        top = sorted(templates_ms.items(), key=lambda x: x[1], reverse=True)[:args.top]
+
+        for template, t in top:
+            print('    {:>12.1f} ms  {}'.format(t, template[:160]))
+
+        if results_file:
+            with open(results_file, 'a') as f:
+                for phase in ('ExecuteCompiler', 'Frontend', 'Backend'):
+                    f.write('compile_time\t{}\t{}\t{}\n'.format(source, phase, times_ms[phase]))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,112 @@
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "async_reference_verifier.hpp"
+
+using ck::utils::AsyncReferenceVerifier;
+
+TEST(AsyncReferenceVerifier, QueuesChecksUntilReferenceIsReady)
+{
+    std::atomic<bool> release{false};
+    std::vector<int> reference;
+    std::vector<int> checked;
+
+    AsyncReferenceVerifier verifier;
+
+    verifier.Launch([&]() {
+        while(!release)
+        {
+            std::this_thread::yield();
+        }
+
+        reference = {1, 2, 3};
+    });
+
+    for(int i = 0; i < 3; ++i)
+    {
+        verifier.Verify([&, i]() {
+            checked.push_back(i);
+            return reference[i] == i + 1;
+        });
+    }
+
+    EXPECT_TRUE(checked.empty());
+
+    release = true;
+
+    EXPECT_TRUE(verifier.Finish());
+    EXPECT_EQ(checked, (std::vector<int>{0, 1, 2}));
+}
+
+TEST(AsyncReferenceVerifier, WaitsOnceMaxPendingChecksAreQueued)
+{
+    std::atomic<bool> release{false};
+    std::vector<int> checked;
+
+    AsyncReferenceVerifier verifier(2);
+
+    verifier.Launch([&]() {
+        while(!release)
+        {
+            std::this_thread::yield();
+        }
+    });
+
+    std::thread releaser([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        release = true;
+    });
+
+    for(int i = 0; i < 3; ++i)
+    {
+        verifier.Verify([&, i]() {
+            checked.push_back(i);
+            return true;
+        });
+    }
+
+    // the third check waited for the reference instead of being queued
+    EXPECT_EQ(checked, (std::vector<int>{0, 1, 2}));
+    EXPECT_TRUE(verifier.Finish());
+
+    releaser.join();
+}
+
+TEST(AsyncReferenceVerifier, ChecksImmediatelyOnceReady)
+{
+    AsyncReferenceVerifier verifier;
+
+    verifier.Launch([]() {});
+    verifier.Wait();
+
+    bool checked = false;
+
+    verifier.Verify([&]() {
+        checked = true;
+        return false;
+    });
+
+    EXPECT_TRUE(checked);
+    EXPECT_FALSE(verifier.Finish());
+    // results are reset by Finish()
+    EXPECT_TRUE(verifier.Finish());
+}
+
+TEST(AsyncReferenceVerifier, RethrowsReferenceException)
+{
+    AsyncReferenceVerifier verifier;
+
+    verifier.Launch([]() { throw std::runtime_error("reference failed"); });
+
+    // thrown by whichever call first finds the reference done
+    EXPECT_THROW(
+        {
+            verifier.Verify([]() { return true; });
+            verifier.Finish();
+        },
+        std::runtime_error);
+}
@@ -1,7 +1,11 @@
 #include <ck/config.hpp>
 #include "ck/tensor_operation/gpu/grid/block_to_ctile_map.hpp"
+#include "l2_locality_simulator.hpp"
 #include "gtest/gtest.h"
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
+#include <limits>
 #include <vector>
 
 using namespace ck;
@@ -316,3 +320,315 @@ TEST(BlockToCTileMap, TestBlockToCTileMap_KSplit_M00_N0_M01Adapt)
         EXPECT_TRUE(equal);
     }
 }
+
+template <CTileOrdering Ordering>
+void TestBlockToCTileMap_M00_N00_S01CurveAdapt()
+{
+    constexpr index_t MPerBlock = 128;
+    constexpr index_t NPerBlock = 128;
+
+    // clang-format off
+    // M, N, S01
+    std::vector<std::vector<index_t>> problems = {
+        {1024, 1024, 8},
+        {1024, 1024, 2},
+        {1000, 3000, 4},
+        {3840, 4096, 8},
+        {128,  8192, 4},
+        {8192, 128,  16},
+        {384,  768,  32},
+        {128,  128,  1}
+    };
+    // clang-format on
+
+    for(const auto& p : problems)
+    {
+        const index_t M = p[0], N = p[1], S01 = p[2];
+        const index_t M0 = math::integer_divide_ceil(M, MPerBlock);
+        const index_t N0 = math::integer_divide_ceil(N, NPerBlock);
+
+        auto c_grid_desc_m_n = make_naive_tensor_descriptor_packed(make_tuple(M, N));
+
+        printf("(M, N, MPerBlock, NPerBlock, S01) = (%d, %d, %d, %d, %d)\n",
+               M,
+               N,
+               MPerBlock,
+               NPerBlock,
+               S01);
+
+        BlockToCTileMap_M00_N00_S01CurveAdapt<MPerBlock,
+                                              NPerBlock,
+                                              decltype(c_grid_desc_m_n),
+                                              Ordering>
+            tile_map(c_grid_desc_m_n, S01);
+
+        EXPECT_TRUE(tile_map.CheckValidity(c_grid_desc_m_n));
+        EXPECT_EQ(tile_map.CalculateGridSize(c_grid_desc_m_n), M0 * N0);
+
+        std::vector<int> c_tile_count(M0 * N0, 0);
+
+        for(index_t i = 0; i < tile_map.CalculateGridSize(c_grid_desc_m_n); i++)
+        {
+            auto m0n0_idx = tile_map.CalculateBottomIndex(make_multi_index(i));
+
+            const index_t m0 = m0n0_idx[I0];
+            const index_t n0 = m0n0_idx[I1];
+
+            ASSERT_TRUE(0 <= m0 && m0 < M0 && 0 <= n0 && n0 < N0);
+
+            c_tile_count[m0 * N0 + n0]++;
+
+            // all tiles of a patch are visited before the next patch is entered
+            EXPECT_EQ(m0 / S01, i / (S01 * N0));
+
+            // consecutive tiles of a full Hilbert patch are neighbours
+            if constexpr(Ordering == CTileOrdering::Hilbert)
+            {
+                if(i % (S01 * S01) != 0 && (m0 / S01 + 1) * S01 <= M0 &&
+                   (n0 / S01 + 1) * S01 <= N0 && i < (M0 / S01) * S01 * N0)
+                {
+                    auto prev_idx = tile_map.CalculateBottomIndex(make_multi_index(i - 1));
+
+                    EXPECT_EQ(std::abs(prev_idx[I0] - m0) + std::abs(prev_idx[I1] - n0), 1);
+                }
+            }
+        }
+
+        EXPECT_TRUE(
+            std::all_of(c_tile_count.begin(), c_tile_count.end(), [](int c) { return c == 1; }));
+    }
+
+    auto c_grid_desc_m_n = make_naive_tensor_descriptor_packed(make_tuple(512, 512));
+
+    BlockToCTileMap_M00_N00_S01CurveAdapt<MPerBlock, NPerBlock, decltype(c_grid_desc_m_n), Ordering>
+        tile_map(c_grid_desc_m_n, 3);
+
+    EXPECT_FALSE(tile_map.CheckValidity(c_grid_desc_m_n));
+}
+
+TEST(BlockToCTileMap, TestBlockToCTileMap_M00_N00_S01MortonAdapt)
+{
+    TestBlockToCTileMap_M00_N00_S01CurveAdapt<CTileOrdering::Morton>();
+
+    const index_t M         = 512;
+    const index_t N         = 768;
+    const index_t MPerBlock = 128;
+    const index_t NPerBlock = 128;
+    const index_t S01       = 4;
+
+    auto c_grid_desc_m_n = make_naive_tensor_descriptor_packed(make_tuple(M, N));
+
+    BlockToCTileMap_M00_N00_S01MortonAdapt<MPerBlock, NPerBlock, decltype(c_grid_desc_m_n)>
+        tile_map(c_grid_desc_m_n, S01);
+
+    // clang-format off
+    std::vector<std::vector<int>> expected_m0idx_n0idx = {
+        {0, 0}, {0, 1}, {1, 0}, {1, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3},
+        {2, 0}, {2, 1}, {3, 0}, {3, 1}, {2, 2}, {2, 3}, {3, 2}, {3, 3},
+        {0, 4}, {0, 5}, {1, 4}, {1, 5}, {2, 4}, {2, 5}, {3, 4}, {3, 5}
+    };
+    // clang-format on
+
+    for(index_t i = 0; i < tile_map.CalculateGridSize(c_grid_desc_m_n); i++)
+    {
+        auto m0n0_idx = tile_map.CalculateBottomIndex(make_multi_index(i));
+        EXPECT_TRUE((expected_m0idx_n0idx[i] == std::vector<int>{m0n0_idx[I0], m0n0_idx[I1]}));
+    }
+}
+
+TEST(BlockToCTileMap, TestBlockToCTileMap_M00_N00_S01HilbertAdapt)
+{
+    TestBlockToCTileMap_M00_N00_S01CurveAdapt<CTileOrdering::Hilbert>();
+}
+
+TEST(BlockToCTileMap, TestL2LocalitySimulator)
+{
+    const index_t M         = 2048;
+    const index_t N         = 2048;
+    const index_t K         = 512;
+    const index_t MPerBlock = 128;
+    const index_t NPerBlock = 128;
+    const index_t KPerBlock = 32;
+
+    auto c_grid_desc_m_n = make_naive_tensor_descriptor_packed(make_tuple(M, N));
+
+    BlockToCTileMap_M00_N0_M01Adapt<MPerBlock, NPerBlock, decltype(c_grid_desc_m_n)> row_map(
+        c_grid_desc_m_n, 1);
+    BlockToCTileMap_M00_N00_S01HilbertAdapt<MPerBlock, NPerBlock, decltype(c_grid_desc_m_n)>
+        hilbert_map(c_grid_desc_m_n, 4);
+
+    const index_t grid_size = row_map.CalculateGridSize(c_grid_desc_m_n);
+
+    // L2 large enough to hold A and B: every byte is fetched exactly once
+    utils::L2LocalityProblem problem{
+        M, N, K, MPerBlock, NPerBlock, KPerBlock, 2, 2, 16, std::size_t(64) << 20};
+
+    auto stats = utils::simulate_l2_locality(row_map, grid_size, problem);
+
+    EXPECT_EQ(stats.a_bytes_fetched, std::size_t(M) * K * 2);
+    EXPECT_EQ(stats.b_bytes_fetched, std::size_t(K) * N * 2);
+    EXPECT_EQ(stats.a_bytes_requested, std::size_t(M) * K * 2 * (N / NPerBlock));
+    EXPECT_EQ(stats.b_bytes_requested, std::size_t(K) * N * 2 * (M / MPerBlock));
+    EXPECT_EQ(stats.wave_bytes_fetched.size(), grid_size / 16);
+
+    // L2 holding only a few panels: a 4x4 patch of 16 concurrent blocks reads 4 A and 4 B panels
+    // per wave, a row of 16 tiles reads 1 A and 16 B panels
+    problem.l2_bytes = std::size_t(MPerBlock) * KPerBlock * 2 * 32;
+
+    auto row_stats     = utils::simulate_l2_locality(row_map, grid_size, problem);
+    auto hilbert_stats = utils::simulate_l2_locality(hilbert_map, grid_size, problem);
+
+    EXPECT_EQ(row_stats.GetBytesFetched(),
+              std::size_t(grid_size / 16) * (K / KPerBlock) * 17 * MPerBlock * KPerBlock * 2);
+    EXPECT_EQ(hilbert_stats.GetBytesFetched(),
+              std::size_t(grid_size / 16) * (K / KPerBlock) * 8 * MPerBlock * KPerBlock * 2);
+    EXPECT_GT(hilbert_stats.GetHitRate(), row_stats.GetHitRate());
+}
+
+TEST(BlockToCTileMap, TestBlockToCTileMap_GemmStreamK)
+{
+    constexpr index_t MPerBlock = 128;
+    constexpr index_t NPerBlock = 128;
+    constexpr index_t KPerBlock = 32;
+
+    // clang-format off
+    // M, N, K, num_cu, occupancy, sk_blocks
+    std::vector<std::vector<index_t>> problems = {
+        {3840, 4096, 4096, 120, 1, -1},
+        {384,  384,  1024, 120, 1, -1},
+        {128,  128,  4096, 120, 2, -1},
+        {1000, 1000, 1000, 104, 1, -1},
+        {257,  1023, 77,   7,   3, -1},
+        {4096, 128,  32,   110, 1, -1},
+        {512,  512,  512,  16,  1, 0},
+        {640,  384,  4096, 8,   1, 5},
+        {100,  2000, 31,   13,  2, 64},
+        {1,    1,    1,    1,   1, -1}
+    };
+    // clang-format on
+
+    for(const auto& p : problems)
+    {
+        const index_t M = p[0], N = p[1], K = p[2];
+
+        auto c_grid_desc_m_n = make_naive_tensor_descriptor_packed(make_tuple(M, N));
+
+        BlockToCTileMap_GemmStreamK<MPerBlock, NPerBlock, KPerBlock, decltype(c_grid_desc_m_n)>
+            tile_map(c_grid_desc_m_n, K, p[3], p[4], p[5]);
+
+        const index_t num_tiles        = tile_map.GetNumTiles();
+        const index_t k_iters_per_tile = tile_map.GetKItersPerTile();
+        const index_t grid_size        = tile_map.CalculateGridSize(c_grid_desc_m_n);
+
+        printf("(M, N, K, num_cu, occupancy, sk_blocks) = (%d, %d, %d, %d, %d, %d), "
+               "grid size = %d, sk tiles = %d, sk blocks = %d\n",
+               M,
+               N,
+               K,
+               p[3],
+               p[4],
+               p[5],
+               grid_size,
+               tile_map.GetNumStreamKTiles(),
+               tile_map.GetNumStreamKBlocks());
+
+        EXPECT_TRUE(tile_map.CheckValidity(c_grid_desc_m_n));
+        EXPECT_EQ(num_tiles,
+                  math::integer_divide_ceil(M, MPerBlock) *
+                      math::integer_divide_ceil(N, NPerBlock));
+        EXPECT_EQ(grid_size,
+                  tile_map.GetNumStreamKBlocks() + tile_map.GetNumDataParallelBlocks());
+
+        // every (tile, k-iteration) must be processed by exactly one block
+        std::vector<int> iter_count(num_tiles * k_iters_per_tile, 0);
+        // every tile must have exactly one owner and the partials of all other contributors
+        std::vector<int> owner_count(num_tiles, 0);
+        std::vector<int> contributor_count(num_tiles, 0);
+
+        index_t min_iters = std::numeric_limits<index_t>::max();
+        index_t max_iters = 0;
+
+        for(index_t block_1d_id = 0; block_1d_id < grid_size; ++block_1d_id)
+        {
+            index_t iter_begin, iter_end;
+            tile_map.GetBlockItr(block_1d_id, iter_begin, iter_end);
+
+            EXPECT_LT(iter_begin, iter_end);
+
+            if(tile_map.IsStreamKBlock(block_1d_id))
+            {
+                min_iters = std::min(min_iters, iter_end - iter_begin);
+                max_iters = std::max(max_iters, iter_end - iter_begin);
+            }
+            else
+            {
+                EXPECT_EQ(iter_end - iter_begin, k_iters_per_tile);
+            }
+
+            index_t num_partial_tiles = 0;
+
+            for(index_t iter = iter_begin; iter < iter_end;)
+            {
+                const index_t tile_idx    = tile_map.GetTileIdx(iter);
+                const index_t iter_length = tile_map.GetCurrentIterLength(iter, iter_end);
+
+                EXPECT_GT(iter_length, 0);
+                ASSERT_LT(tile_idx, num_tiles);
+
+                for(index_t i = iter; i < iter + iter_length; ++i)
+                {
+                    EXPECT_EQ(tile_map.GetBlockIdx(i), block_1d_id);
+                    iter_count[i]++;
+                }
+
+                if(tile_map.IsTileOwner(block_1d_id, tile_idx))
+                {
+                    EXPECT_EQ(iter, tile_map.GetTileIterBegin(tile_idx));
+                    owner_count[tile_idx]++;
+                }
+                else
+                {
+                    num_partial_tiles++;
+                }
+
+                contributor_count[tile_idx]++;
+
+                iter += iter_length;
+            }
+
+            // a block stores at most one partial tile, in its own workspace slot
+            EXPECT_LE(num_partial_tiles, tile_map.IsStreamKBlock(block_1d_id) ? 1 : 0);
+        }
+
+        // stream-K blocks are balanced to within one iteration
+        if(tile_map.GetNumStreamKBlocks() > 0)
+        {
+            EXPECT_LE(max_iters - min_iters, 1);
+        }
+
+        EXPECT_TRUE(
+            std::all_of(iter_count.begin(), iter_count.end(), [](int c) { return c == 1; }));
+        EXPECT_TRUE(
+            std::all_of(owner_count.begin(), owner_count.end(), [](int c) { return c == 1; }));
+
+        std::vector<int> c_tile_count(num_tiles, 0);
+
+        for(index_t tile_idx = 0; tile_idx < num_tiles; ++tile_idx)
+        {
+            EXPECT_EQ(tile_map.GetTileNumContributors(tile_idx), contributor_count[tile_idx]);
+
+            auto m0n0_idx = tile_map.CalculateBottomIndex(make_multi_index(tile_idx));
+
+            const index_t m0 = m0n0_idx[I0];
+            const index_t n0 = m0n0_idx[I1];
+
+            ASSERT_TRUE(0 <= m0 && m0 < math::integer_divide_ceil(M, MPerBlock));
+            ASSERT_TRUE(0 <= n0 && n0 < math::integer_divide_ceil(N, NPerBlock));
+
+            c_tile_count[m0 * math::integer_divide_ceil(N, NPerBlock) + n0]++;
+        }
+
+        EXPECT_TRUE(
+            std::all_of(c_tile_count.begin(), c_tile_count.end(), [](int c) { return c == 1; }));
+    }
+}
@@ -149,6 +149,27 @@ TEST_F(TestConvUtil, ConvParamsGetOutputSpatialLengths3D)
         "Error: ConvParams 3D strides{3, 3, 3}, padding {1, 1, 1}, dilations {2, 2, 2}."));
 }
 
+TEST(ConvUtil, ConvParamsGroups)
+{
+    // depthwise 2D convolution of 32 channels, with 2 output channels per group
+    ck::utils::conv::ConvParams params(
+        2, 4, 64, 32, {3, 3}, {14, 14}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, 32);
+
+    EXPECT_TRUE(ck::utils::check_err(
+        params.GetInputLengths(), {4, 32, 14, 14}, "Error: wrong grouped input lengths!"));
+    EXPECT_TRUE(ck::utils::check_err(
+        params.GetWeightLengths(), {64, 1, 3, 3}, "Error: wrong grouped weights lengths!"));
+    EXPECT_TRUE(ck::utils::check_err(
+        params.GetOutputLengths(), {4, 64, 14, 14}, "Error: wrong grouped output lengths!"));
+
+    EXPECT_EQ(ck::utils::conv::get_flops(4, 32, 64, {3, 3}, {14, 14}, 32),
+              std::size_t(2) * 4 * 64 * 1 * 3 * 3 * 14 * 14);
+
+    EXPECT_THROW(ck::utils::conv::ConvParams(
+                     2, 4, 64, 30, {3, 3}, {14, 14}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, 4),
+                 std::runtime_error);
+}
+
 TEST(ConvUtil, GetHostTensorDescriptor)
 {
     namespace tl = ck::tensor_layout::convolution;
@@ -0,0 +1,73 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "config.hpp"
+#include "device_gemm.hpp"
+#include "device_reduce_instance_threadwise.hpp"
+#include "element_wise_operation.hpp"
+#include "device_operation_registry.hpp"
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using ck::tensor_operation::device::DeviceOperationRegistry;
+
+using DeviceGemmNoOpPtr =
+    ck::tensor_operation::device::DeviceGemmPtr<PassThrough, PassThrough, PassThrough>;
+using DeviceReduceAddPtr = ck::tensor_operation::device::device_reduce_instance::
+    deviceReduceThreadWisePtrType<ck::ReduceTensorOp::ADD>;
+
+class TestDeviceOperationRegistry : public ::testing::Test
+{
+    protected:
+    void SetUp() override
+    {
+        DeviceOperationRegistry::GetInstance().SetLibraryPath(CK_DEVICE_OPERATIONS_TEST_PATH);
+    }
+};
+
+TEST_F(TestDeviceOperationRegistry, LoadsFamilyOnFirstUse)
+{
+    auto& registry = DeviceOperationRegistry::GetInstance();
+
+    std::vector<DeviceGemmNoOpPtr> gemm_ptrs;
+
+    registry.AddInstances("gemm", "add_device_gemm_dl_f16_f16_f16_mk_kn_mn_instances", gemm_ptrs);
+
+    EXPECT_TRUE(registry.IsLoaded("gemm"));
+    EXPECT_FALSE(registry.IsLoaded("conv2d_fwd"));
+    EXPECT_FALSE(gemm_ptrs.empty());
+}
+
+TEST_F(TestDeviceOperationRegistry, LoadsReduceInstantiations)
+{
+    auto& registry = DeviceOperationRegistry::GetInstance();
+
+    std::vector<DeviceReduceAddPtr> reduce_ptrs;
+
+    // named after the ADD_THREADWISE_INST_BY_ID arguments of the instantiation
+    const std::string name =
+        "add_device_reduce_instance_threadwise<float, float, float, 0, 0, 0, 4, 3>";
+
+    registry.AddInstances("reduce", name, reduce_ptrs);
+
+    EXPECT_TRUE(registry.IsLoaded("reduce"));
+    EXPECT_FALSE(reduce_ptrs.empty());
+}
+
+TEST_F(TestDeviceOperationRegistry, RejectsUnknownOrMismatchedInstances)
+{
+    auto& registry = DeviceOperationRegistry::GetInstance();
+
+    std::vector<DeviceGemmNoOpPtr> gemm_ptrs;
+    std::vector<float> wrong_ptrs;
+
+    EXPECT_THROW(registry.AddInstances("gemm", "add_device_gemm_no_such_instances", gemm_ptrs),
+                 std::runtime_error);
+    EXPECT_THROW(registry.AddInstances(
+                     "gemm", "add_device_gemm_dl_f16_f16_f16_mk_kn_mn_instances", wrong_ptrs),
+                 std::runtime_error);
+    EXPECT_THROW(registry.AddInstances("no_such_family", "add_instances", gemm_ptrs),
+                 std::runtime_error);
+    EXPECT_TRUE(wrong_ptrs.empty());
+}
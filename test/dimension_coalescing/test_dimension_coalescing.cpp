@@ -0,0 +1,227 @@
+#include <ck/config.hpp>
+#include "ck/tensor_operation/gpu/device/tensor_dimension_coalescing.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <vector>
+
+using namespace ck;
+using namespace ck::tensor_operation::device;
+
+namespace {
+
+// offsets of all tensors for every element, in lexicographic order of the multi-index
+std::vector<std::vector<index_t>>
+enumerate_offsets(const std::vector<index_t>& lengths,
+                  const std::vector<std::vector<index_t>>& strides)
+{
+    std::vector<std::vector<index_t>> offsets;
+    std::vector<index_t> idx(lengths.size(), 0);
+
+    while(true)
+    {
+        std::vector<index_t> offset(strides.size(), 0);
+
+        for(std::size_t t = 0; t < strides.size(); ++t)
+        {
+            for(std::size_t d = 0; d < lengths.size(); ++d)
+            {
+                offset[t] += idx[d] * strides[t][d];
+            }
+        }
+
+        offsets.push_back(offset);
+
+        int d = static_cast<int>(lengths.size()) - 1;
+
+        for(; d >= 0; --d)
+        {
+            if(++idx[d] < lengths[d])
+                break;
+
+            idx[d] = 0;
+        }
+
+        if(d < 0)
+            break;
+    }
+
+    return offsets;
+}
+
+void check_elementwise(const std::vector<index_t>& lengths,
+                       const std::vector<std::vector<index_t>>& strides,
+                       const std::vector<index_t>& expected_lengths)
+{
+    const auto dims = coalesce_elementwise_dimensions(lengths, strides);
+
+    EXPECT_EQ(dims.lengths, expected_lengths);
+
+    // same set of elements, in any order
+    auto ref = enumerate_offsets(lengths, strides);
+    auto out = enumerate_offsets(dims.lengths, dims.strides);
+
+    std::sort(ref.begin(), ref.end());
+    std::sort(out.begin(), out.end());
+
+    EXPECT_EQ(ref, out);
+
+    // padding to a higher rank does not change the elements
+    const auto dims_nd = expand_elementwise_dimensions(dims, 6);
+    auto out_nd        = enumerate_offsets(dims_nd.lengths, dims_nd.strides);
+
+    std::sort(out_nd.begin(), out_nd.end());
+
+    EXPECT_EQ(dims_nd.GetRank(), 6);
+    EXPECT_EQ(ref, out_nd);
+}
+
+// (output offset, input offset) pairs over all elements of the input
+std::vector<std::vector<index_t>> enumerate_reduction(const std::vector<index_t>& inLengths,
+                                                      const std::vector<index_t>& inStrides,
+                                                      const std::vector<index_t>& outStrides,
+                                                      const std::vector<int>& reduceDims)
+{
+    std::vector<index_t> expandedOutStrides(inLengths.size(), 0);
+
+    for(std::size_t d = 0, i = 0; d < inLengths.size(); ++d)
+    {
+        if(std::find(reduceDims.begin(), reduceDims.end(), d) == reduceDims.end())
+        {
+            expandedOutStrides[d] = outStrides[i++];
+        }
+    }
+
+    auto offsets = enumerate_offsets(inLengths, {expandedOutStrides, inStrides});
+
+    std::sort(offsets.begin(), offsets.end());
+
+    return offsets;
+}
+
+} // namespace
+
+TEST(DimensionCoalescing, Elementwise)
+{
+    // packed tensors collapse to 1 dimension
+    check_elementwise({2, 3, 4, 5}, {{60, 20, 5, 1}, {60, 20, 5, 1}, {60, 20, 5, 1}}, {120});
+
+    // unit dimensions are dropped
+    check_elementwise({1, 8, 1, 16}, {{128, 16, 16, 1}, {7, 16, 3, 1}}, {128});
+    check_elementwise({1, 1, 1}, {{1, 1, 1}, {1, 1, 1}}, {1});
+
+    // broadcast of B along M: [M, N] + [N]
+    check_elementwise({4, 8, 16}, {{128, 16, 1}, {0, 0, 1}, {128, 16, 1}}, {32, 16});
+
+    // broadcast of B along N: [M, N] + [M], merged over both broadcast dimensions
+    check_elementwise({4, 8, 16}, {{128, 16, 1}, {8, 1, 0}, {128, 16, 1}}, {32, 16});
+
+    // padded rows can not be merged
+    check_elementwise({4, 8, 16}, {{256, 32, 1}, {256, 32, 1}}, {32, 16});
+    check_elementwise({4, 8, 16}, {{160, 16, 1}, {160, 16, 1}}, {4, 128});
+}
+
+TEST(DimensionCoalescing, ElementwiseVectorDim)
+{
+    // transposed tensors: the dimension most tensors are contiguous in is moved innermost
+    const auto dims = coalesce_elementwise_dimensions(
+        {4, 8, 16}, {{1, 64, 4}, {1, 64, 4}, {128, 16, 1}});
+
+    EXPECT_EQ(dims.lengths, (std::vector<index_t>{128, 4}));
+    EXPECT_EQ(dims.strides[0], (std::vector<index_t>{4, 1}));
+    EXPECT_EQ(dims.strides[2], (std::vector<index_t>{1, 16 * 8}));
+    EXPECT_EQ(dims.vector_dim, 1);
+
+    // ties keep the dimension the output is contiguous in
+    const auto dims_tie = coalesce_elementwise_dimensions({4, 16}, {{1, 4}, {16, 1}});
+
+    EXPECT_EQ(dims_tie.strides[1].back(), 1);
+
+    // transposed unary [M, N] with M > N: the longer input-contiguous M is not moved innermost
+    const auto dims_transposed = coalesce_elementwise_dimensions({64, 8}, {{1, 64}, {8, 1}});
+
+    EXPECT_EQ(dims_transposed.lengths, (std::vector<index_t>{64, 8}));
+    EXPECT_EQ(dims_transposed.strides[0], (std::vector<index_t>{1, 64}));
+    EXPECT_EQ(dims_transposed.strides[1], (std::vector<index_t>{8, 1}));
+    EXPECT_EQ(dims_transposed.vector_dim, 1);
+
+    // ties where the output is contiguous in no candidate keep the innermost dimension
+    const auto dims_broadcast = coalesce_elementwise_dimensions({64, 8}, {{1, 64}, {0, 1}, {8, 3}});
+
+    EXPECT_EQ(dims_broadcast.strides[1], (std::vector<index_t>{0, 1}));
+
+    // no tensor is contiguous in any dimension
+    EXPECT_EQ(coalesce_elementwise_dimensions({4, 16}, {{32, 2}}).vector_dim, -1);
+
+    EXPECT_EQ(get_max_scalar_per_vector(120, 8), 8);
+    EXPECT_EQ(get_max_scalar_per_vector(36, 8), 4);
+    EXPECT_EQ(get_max_scalar_per_vector(7, 8), 1);
+}
+
+TEST(DimensionCoalescing, Reduction)
+{
+    struct Problem
+    {
+        std::vector<index_t> inLengths;
+        std::vector<index_t> inStrides;
+        std::vector<index_t> outStrides;
+        std::vector<int> reduceDims;
+        std::vector<index_t> expected_lengths;
+        std::vector<int> expected_reduce_dims;
+        int expected_vector_dim;
+    };
+
+    // clang-format off
+    const std::vector<Problem> problems = {
+        // NHWC reduced over HWC
+        {{8, 4, 4, 16}, {256, 64, 16, 1}, {1},       {1, 2, 3}, {8, 256},       {1},    1},
+        // NHWC reduced over N
+        {{8, 4, 4, 16}, {256, 64, 16, 1}, {64, 16, 1}, {0},     {8, 256},       {0},    0},
+        // NHWC reduced over H and W
+        {{8, 4, 4, 16}, {256, 64, 16, 1}, {16, 1},   {1, 2},    {8, 16, 16},    {1},    0},
+        // reduced over all dimensions
+        {{2, 3, 5},     {15, 5, 1},       {1},       {0, 1, 2}, {30},           {0},    1},
+        // reduced over unit dimensions only
+        {{2, 1, 5},     {5, 5, 1},        {5, 1},    {1},       {10, 1},        {1},    0},
+        // interleaved reduce and invariant dimensions are not merged
+        {{2, 3, 4, 5},  {60, 20, 5, 1},   {4, 1},    {0, 2},    {2, 3, 4, 5},   {0, 2}, 0},
+        // non-contiguous input
+        {{8, 32},       {64, 2},          {1},       {1},       {8, 32},        {1},    -1},
+    };
+    // clang-format on
+
+    for(const auto& p : problems)
+    {
+        const auto dims =
+            coalesce_reduction_dimensions(p.inLengths, p.inStrides, p.outStrides, p.reduceDims);
+
+        EXPECT_EQ(dims.lengths, p.expected_lengths);
+        EXPECT_EQ(dims.reduce_dims, p.expected_reduce_dims);
+        EXPECT_EQ(dims.vector_dim, p.expected_vector_dim);
+
+        // every input element contributes to the same output element as before
+        EXPECT_EQ(
+            enumerate_reduction(p.inLengths, p.inStrides, p.outStrides, p.reduceDims),
+            enumerate_reduction(dims.lengths, dims.strides[0], dims.strides[1], dims.reduce_dims));
+
+        index_t in_size  = 1;
+        index_t out_size = 1;
+
+        for(auto l : dims.lengths)
+        {
+            in_size *= l;
+        }
+
+        for(auto l : dims.out_lengths)
+        {
+            out_size *= l;
+        }
+
+        for(int d : dims.reduce_dims)
+        {
+            out_size *= dims.lengths[d];
+        }
+
+        EXPECT_EQ(dims.strides[1].size(), dims.out_lengths.size());
+        EXPECT_EQ(in_size, out_size);
+    }
+}
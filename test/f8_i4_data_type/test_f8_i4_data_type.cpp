@@ -0,0 +1,290 @@
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "check_err.hpp"
+#include "data_type.hpp"
+#include "host_tensor.hpp"
+#include "host_tensor_generator.hpp"
+#include "host_type_convert.hpp"
+
+using ck::bf8_t;
+using ck::f8_t;
+using ck::pk_i4_t;
+using ck::type_convert;
+
+namespace {
+
+template <typename F8>
+float to_float(uint8_t code)
+{
+    return type_convert<float>(F8{code});
+}
+
+template <typename F8>
+uint8_t to_code(float x)
+{
+    return type_convert<F8>(x).data;
+}
+
+template <typename F8>
+uint8_t to_code_sat(float x)
+{
+    return ck::f8_convert_sat<F8>(x).data;
+}
+
+// every code which is not NaN converts to a float which converts back to the same code
+template <typename F8>
+void check_round_trip()
+{
+    for(int code = 0; code < 256; ++code)
+    {
+        const float x = to_float<F8>(code);
+
+        if(std::isnan(x))
+        {
+            EXPECT_TRUE(std::isnan(to_float<F8>(to_code<F8>(x)))) << "code " << code;
+        }
+        else
+        {
+            EXPECT_EQ(to_code<F8>(x), code) << "code " << code << " value " << x;
+            EXPECT_EQ(type_convert<float>(type_convert<F8>(type_convert<ck::half_t>(F8{
+                          static_cast<uint8_t>(code)}))),
+                      x)
+                << "code " << code;
+        }
+    }
+}
+
+// the midpoints of consecutive positive codes round to the even one, and anything off the
+// midpoint to the nearest one
+template <typename F8>
+void check_rounding()
+{
+    const uint8_t binary_max = ck::NumericLimits<F8>::binary_max;
+
+    for(uint8_t code = 0; code < binary_max; ++code)
+    {
+        const float lo  = to_float<F8>(code);
+        const float hi  = to_float<F8>(code + 1);
+        const float mid = (lo + hi) / 2;
+
+        EXPECT_EQ(to_code<F8>(mid), code % 2 == 0 ? code : code + 1) << "code " << int(code);
+        EXPECT_EQ(to_code<F8>(std::nextafter(mid, lo)), code) << "code " << int(code);
+        EXPECT_EQ(to_code<F8>(std::nextafter(mid, hi)), code + 1) << "code " << int(code);
+        EXPECT_EQ(to_code<F8>(-mid), (code % 2 == 0 ? code : code + 1) | 0x80)
+            << "code " << int(code);
+    }
+}
+
+} // namespace
+
+TEST(F8, Values)
+{
+    EXPECT_EQ(type_convert<float>(ck::NumericLimits<f8_t>::Max()), 448.f);
+    EXPECT_EQ(type_convert<float>(ck::NumericLimits<f8_t>::Lowest()), -448.f);
+    EXPECT_EQ(type_convert<float>(ck::NumericLimits<f8_t>::Min()), 0x1p-6f);
+    EXPECT_TRUE(std::isnan(type_convert<float>(ck::NumericLimits<f8_t>::QuietNaN())));
+    EXPECT_EQ(to_float<f8_t>(0x01), 0x1p-9f);
+    EXPECT_EQ(to_float<f8_t>(0x38), 1.f);
+    EXPECT_EQ(to_float<f8_t>(0xc4), -3.f);
+
+    EXPECT_EQ(type_convert<float>(ck::NumericLimits<bf8_t>::Max()), 57344.f);
+    EXPECT_EQ(type_convert<float>(ck::NumericLimits<bf8_t>::Lowest()), -57344.f);
+    EXPECT_EQ(type_convert<float>(ck::NumericLimits<bf8_t>::Min()), 0x1p-14f);
+    EXPECT_TRUE(std::isnan(type_convert<float>(ck::NumericLimits<bf8_t>::QuietNaN())));
+    EXPECT_EQ(to_float<bf8_t>(0x01), 0x1p-16f);
+    EXPECT_EQ(to_float<bf8_t>(0x3c), 1.f);
+    EXPECT_EQ(to_float<bf8_t>(0x7c), std::numeric_limits<float>::infinity());
+    EXPECT_EQ(to_float<bf8_t>(0xfc), -std::numeric_limits<float>::infinity());
+}
+
+TEST(F8, RoundTrip)
+{
+    check_round_trip<f8_t>();
+    check_round_trip<bf8_t>();
+}
+
+TEST(F8, RoundToNearestEven)
+{
+    check_rounding<f8_t>();
+    check_rounding<bf8_t>();
+
+    // half of the smallest subnormal rounds to 0, a bit more to it
+    EXPECT_EQ(to_code<f8_t>(0x1p-10f), 0x00);
+    EXPECT_EQ(to_code<f8_t>(0x1.01p-10f), 0x01);
+    EXPECT_EQ(to_code<f8_t>(1e-30f), 0x00);
+    EXPECT_EQ(to_code<f8_t>(-1e-30f), 0x80);
+    EXPECT_EQ(to_code<f8_t>(std::numeric_limits<float>::denorm_min()), 0x00);
+}
+
+TEST(F8, Overflow)
+{
+    const float inf = std::numeric_limits<float>::infinity();
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+
+    // the midpoint between the largest finite value and the next power of 2 rounds up
+    EXPECT_EQ(to_code<f8_t>(464.f), 0x7e);
+    EXPECT_EQ(to_code<f8_t>(480.f), 0x7f);
+    EXPECT_EQ(to_code<f8_t>(-inf), 0xff);
+    EXPECT_EQ(to_code<bf8_t>(61440.f), 0x7c);
+    EXPECT_EQ(to_code<bf8_t>(inf), 0x7c);
+    EXPECT_EQ(to_code<bf8_t>(-1e10f), 0xfc);
+
+    EXPECT_EQ(to_code_sat<f8_t>(480.f), 0x7e);
+    EXPECT_EQ(to_code_sat<f8_t>(-inf), 0xfe);
+    EXPECT_EQ(to_code_sat<bf8_t>(inf), 0x7b);
+    EXPECT_EQ(to_code_sat<bf8_t>(-1e10f), 0xfb);
+
+    // NaN stays NaN, also with saturation
+    EXPECT_TRUE(std::isnan(type_convert<float>(type_convert<f8_t>(nan))));
+    EXPECT_TRUE(std::isnan(type_convert<float>(type_convert<bf8_t>(-nan))));
+    EXPECT_TRUE(std::isnan(type_convert<float>(ck::f8_convert_sat<f8_t>(nan))));
+    EXPECT_TRUE(std::isnan(type_convert<float>(ck::f8_convert_sat<bf8_t>(nan))));
+}
+
+TEST(F8, BulkConvert)
+{
+    std::vector<float> src(200000);
+
+    for(std::size_t i = 0; i < src.size(); ++i)
+    {
+        src[i] = std::ldexp(static_cast<float>(i % 1000) - 500.f, static_cast<int>(i % 31) - 20);
+    }
+
+    std::vector<f8_t> f8(src.size());
+    std::vector<bf8_t> bf8(src.size());
+    std::vector<f8_t> f8_sat(src.size());
+    std::vector<float> dst(src.size());
+
+    bulk_type_convert(src.data(), f8.data(), src.size(), 3);
+    bulk_type_convert(src.data(), bf8.data(), src.size(), 3);
+    bulk_f8_convert_sat(src.data(), f8_sat.data(), src.size(), 3);
+
+    for(std::size_t i = 0; i < src.size(); ++i)
+    {
+        ASSERT_EQ(f8[i].data, to_code<f8_t>(src[i])) << "at " << i;
+        ASSERT_EQ(bf8[i].data, to_code<bf8_t>(src[i])) << "at " << i;
+        ASSERT_EQ(f8_sat[i].data, to_code_sat<f8_t>(src[i])) << "at " << i;
+    }
+
+    bulk_type_convert(f8.data(), dst.data(), src.size(), 3);
+
+    for(std::size_t i = 0; i < src.size(); ++i)
+    {
+        const float ref = type_convert<float>(f8[i]);
+
+        // the table holds the values of type_convert, NaN included
+        ASSERT_EQ(ck::bit_cast<uint32_t>(dst[i]), ck::bit_cast<uint32_t>(ref)) << "at " << i;
+    }
+}
+
+TEST(F8, CheckErr)
+{
+    Tensor<f8_t> ref(std::vector<std::size_t>{4, 5});
+    Tensor<bf8_t> ref_bf8(std::vector<std::size_t>{4, 5});
+
+    ref.GenerateTensorValue(GeneratorTensor_3<f8_t>{-10.f, 10.f});
+    ref_bf8.GenerateTensorValue(GeneratorTensor_2<bf8_t>{-5, 5});
+
+    Tensor<f8_t> out(ref);
+    Tensor<bf8_t> out_bf8(ref_bf8);
+
+    EXPECT_TRUE(ck::utils::check_err(out.mData, ref.mData));
+    EXPECT_TRUE(ck::utils::check_err(out_bf8.mData, ref_bf8.mData));
+
+    // one unit in the last place is within the default tolerance, two are not
+    out.mData[3] = type_convert<f8_t>(3.25f);
+    ref.mData[3] = type_convert<f8_t>(3.f);
+
+    EXPECT_TRUE(ck::utils::check_err(out.mData, ref.mData));
+
+    out.mData[3] = type_convert<f8_t>(3.5f);
+
+    EXPECT_FALSE(ck::utils::check_err(out.mData, ref.mData));
+    EXPECT_TRUE(ck::utils::check_err(out.mData, ref.mData, "", 0, 0.5));
+}
+
+TEST(I4, PackUnpack)
+{
+    for(int lo = -8; lo < 8; ++lo)
+    {
+        for(int hi = -8; hi < 8; ++hi)
+        {
+            const pk_i4_t x = ck::pack_i4(lo, hi);
+
+            EXPECT_EQ(x.data & 0xf, lo & 0xf);
+            EXPECT_EQ(ck::unpack_i4(x, 0), lo);
+            EXPECT_EQ(ck::unpack_i4(x, 1), hi);
+        }
+    }
+
+    EXPECT_EQ(ck::unpack_i4(ck::NumericLimits<pk_i4_t>::Max(), 1), 7);
+    EXPECT_EQ(ck::unpack_i4(ck::NumericLimits<pk_i4_t>::Lowest(), 0), -8);
+
+    EXPECT_EQ(ck::i4_convert_sat(2.5f), 2);
+    EXPECT_EQ(ck::i4_convert_sat(-3.5f), -4);
+    EXPECT_EQ(ck::i4_convert_sat(7.4f), 7);
+    EXPECT_EQ(ck::i4_convert_sat(100.f), 7);
+    EXPECT_EQ(ck::i4_convert_sat(-1e20f), -8);
+    EXPECT_EQ(ck::i4_convert_sat(std::numeric_limits<float>::quiet_NaN()), 0);
+}
+
+TEST(I4, PackTensor)
+{
+    Tensor<int8_t> values(std::vector<std::size_t>{3, 2, 6});
+
+    for(std::size_t i = 0; i < values.mData.size(); ++i)
+    {
+        values.mData[i] = static_cast<int8_t>(i % 16) - 8;
+    }
+
+    const Tensor<pk_i4_t> packed = pack_i4_tensor(values);
+
+    EXPECT_EQ(packed.mDesc.GetLengths(), (std::vector<std::size_t>{3, 2, 3}));
+    EXPECT_EQ(ck::unpack_i4(packed(1, 0, 2), 0), values(1, 0, 4));
+    EXPECT_EQ(ck::unpack_i4(packed(1, 0, 2), 1), values(1, 0, 5));
+    EXPECT_EQ(unpack_i4_tensor(packed).mData, values.mData);
+
+    // transposed source, packed along its last dimension
+    Tensor<int8_t> transposed(std::vector<std::size_t>{4, 2}, std::vector<std::size_t>{1, 4});
+
+    for(std::size_t i = 0; i < transposed.mData.size(); ++i)
+    {
+        transposed.mData[i] = static_cast<int8_t>(i) - 4;
+    }
+
+    const Tensor<pk_i4_t> packed_transposed = pack_i4_tensor(transposed);
+
+    for(std::size_t i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(ck::unpack_i4(packed_transposed(i, 0), 0), transposed(i, 0));
+        EXPECT_EQ(ck::unpack_i4(packed_transposed(i, 0), 1), transposed(i, 1));
+    }
+
+    EXPECT_THROW(pack_i4_tensor(Tensor<int8_t>(std::vector<std::size_t>{2, 3})),
+                 std::runtime_error);
+
+    values.mData[5] = 8;
+
+    EXPECT_THROW(pack_i4_tensor(values), std::runtime_error);
+}
+
+TEST(I4, CheckErr)
+{
+    Tensor<pk_i4_t> ref(std::vector<std::size_t>{7});
+
+    ref.GenerateTensorValue(GeneratorTensor_2<pk_i4_t>{-8, 8});
+
+    Tensor<pk_i4_t> out(ref);
+
+    EXPECT_TRUE(ck::utils::check_err(out.mData, ref.mData));
+
+    out.mData[2] = ck::pack_i4(ck::unpack_i4(ref.mData[2], 0),
+                               static_cast<int8_t>(ck::unpack_i4(ref.mData[2], 1) ^ 1));
+
+    EXPECT_FALSE(ck::utils::check_err(out.mData, ref.mData));
+}
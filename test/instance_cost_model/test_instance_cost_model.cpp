@@ -0,0 +1,140 @@
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "instance_cost_model.hpp"
+
+using namespace ck;
+using ck::tensor_operation::device::InstanceTraits;
+
+namespace {
+
+InstanceTraits make_gemm_traits(index_t block_size,
+                                index_t m_per_block,
+                                index_t n_per_block,
+                                index_t k_per_block,
+                                index_t lds_bytes,
+                                bool is_split_k = false)
+{
+    InstanceTraits traits;
+
+    traits.op_name     = "DeviceGemmTest";
+    traits.block_size  = block_size;
+    traits.m_per_block = m_per_block;
+    traits.n_per_block = n_per_block;
+    traits.k_per_block = k_per_block;
+    traits.lds_bytes   = lds_bytes;
+    traits.is_split_k  = is_split_k;
+
+    return traits;
+}
+
+struct FakeDeviceOp
+{
+    InstanceTraits traits;
+
+    InstanceTraits GetInstanceTraits() const { return traits; }
+};
+
+const utils::GpuModel gpu{120, 65536, 2560, 64.};
+
+} // namespace
+
+TEST(InstanceCostModel, TileQuantization)
+{
+    const auto traits = make_gemm_traits(256, 256, 128, 32, 32768);
+
+    const auto aligned =
+        utils::estimate_gemm_instance_cost(traits, {1024, 1024, 1024, 2, 2}, gpu);
+    const auto unaligned =
+        utils::estimate_gemm_instance_cost(traits, {1025, 1024, 1000, 2, 2}, gpu);
+
+    EXPECT_DOUBLE_EQ(aligned.tile_efficiency, 1.);
+    EXPECT_DOUBLE_EQ(aligned.k_efficiency, 1.);
+    EXPECT_DOUBLE_EQ(unaligned.tile_efficiency, 1025. / (5 * 256));
+    EXPECT_DOUBLE_EQ(unaligned.k_efficiency, 1000. / 1024);
+    EXPECT_GT(unaligned.relative_time, aligned.relative_time);
+}
+
+TEST(InstanceCostModel, WavesAndOccupancy)
+{
+    // 48 KB of LDS allows one block per CU, 16 KB allows 4, 2560 threads allow 10 blocks of 256
+    EXPECT_EQ(utils::estimate_gemm_instance_cost(
+                  make_gemm_traits(256, 128, 128, 32, 49152), {128, 128, 128, 2, 2}, gpu)
+                  .occupancy,
+              1);
+    EXPECT_EQ(utils::estimate_gemm_instance_cost(
+                  make_gemm_traits(256, 128, 128, 32, 16384), {128, 128, 128, 2, 2}, gpu)
+                  .occupancy,
+              4);
+    EXPECT_EQ(utils::estimate_gemm_instance_cost(
+                  make_gemm_traits(256, 128, 128, 32, 0), {128, 128, 128, 2, 2}, gpu)
+                  .occupancy,
+              10);
+
+    // too much LDS to run at all
+    EXPECT_FALSE(utils::estimate_gemm_instance_cost(
+                     make_gemm_traits(256, 128, 128, 32, 65537), {128, 128, 128, 2, 2}, gpu)
+                     .IsValid());
+
+    // 121 tiles on 120 CUs at occupancy 1 need 2 waves, the second one is almost empty
+    const auto cost = utils::estimate_gemm_instance_cost(
+        make_gemm_traits(256, 128, 128, 32, 49152), {11 * 128, 11 * 128, 128, 2, 2}, gpu);
+
+    EXPECT_EQ(cost.num_tiles, 121);
+    EXPECT_EQ(cost.num_waves, 2);
+    EXPECT_DOUBLE_EQ(cost.wave_efficiency, 121. / 240);
+}
+
+TEST(InstanceCostModel, ArithmeticIntensity)
+{
+    const auto small = utils::estimate_gemm_instance_cost(
+        make_gemm_traits(64, 32, 32, 32, 8192), {4096, 4096, 4096, 2, 2}, gpu);
+    const auto large = utils::estimate_gemm_instance_cost(
+        make_gemm_traits(256, 256, 128, 32, 32768), {4096, 4096, 4096, 2, 2}, gpu);
+
+    EXPECT_DOUBLE_EQ(small.arithmetic_intensity, 2. * 32 * 32 / (32 * 2 + 32 * 2));
+    EXPECT_DOUBLE_EQ(small.compute_efficiency, 16. / 64);
+    EXPECT_DOUBLE_EQ(large.compute_efficiency, 1.);
+    EXPECT_LT(large.relative_time, small.relative_time);
+}
+
+TEST(InstanceCostModel, SplitK)
+{
+    const utils::GemmProblemShape problem{256, 256, 8192, 4, 4, 8};
+
+    const auto no_split = utils::estimate_gemm_instance_cost(
+        make_gemm_traits(256, 128, 128, 32, 16384), problem, gpu);
+    const auto split = utils::estimate_gemm_instance_cost(
+        make_gemm_traits(256, 128, 128, 32, 16384, true), problem, gpu);
+
+    EXPECT_EQ(no_split.num_tiles, 4);
+    EXPECT_EQ(split.num_tiles, 32);
+    EXPECT_LT(split.relative_time, no_split.relative_time);
+}
+
+TEST(InstanceCostModel, RankAndPrune)
+{
+    std::vector<std::unique_ptr<FakeDeviceOp>> op_ptrs;
+
+    op_ptrs.push_back(std::make_unique<FakeDeviceOp>(FakeDeviceOp{InstanceTraits{}}));
+    op_ptrs.push_back(
+        std::make_unique<FakeDeviceOp>(FakeDeviceOp{make_gemm_traits(64, 32, 32, 32, 8192)}));
+    op_ptrs.push_back(
+        std::make_unique<FakeDeviceOp>(FakeDeviceOp{make_gemm_traits(256, 256, 128, 32, 32768)}));
+    op_ptrs.push_back(
+        std::make_unique<FakeDeviceOp>(FakeDeviceOp{make_gemm_traits(256, 128, 128, 32, 16384)}));
+
+    const utils::GemmProblemShape problem{3840, 4096, 4096, 2, 2};
+
+    const auto order = utils::rank_gemm_instances(op_ptrs, problem, gpu);
+
+    // instances without traits come last
+    EXPECT_EQ(order, (std::vector<std::size_t>{2, 3, 1, 0}));
+
+    utils::prune_gemm_instances(op_ptrs, problem, 2, gpu);
+
+    ASSERT_EQ(op_ptrs.size(), 2);
+    EXPECT_EQ(op_ptrs[0]->traits.m_per_block, 256);
+    EXPECT_EQ(op_ptrs[1]->traits.m_per_block, 128);
+}
@@ -0,0 +1,158 @@
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "device_base.hpp"
+
+using namespace ck::tensor_operation::device;
+
+namespace {
+
+struct FakeArgument : public BaseArgument
+{
+    std::size_t workspace_bytes;
+};
+
+struct FakeInvoker : public BaseInvoker
+{
+    float Run(const BaseArgument*, const StreamConfig& stream_config = StreamConfig{}) override
+    {
+        return stream_config.time_kernel_ ? 1.5f : 0.f;
+    }
+};
+
+struct FakeOperator : public BaseOperator
+{
+    std::string GetTypeString() const override { return "DeviceFake<256, 128, 128>"; }
+
+    size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+    {
+        return static_cast<const FakeArgument*>(p_arg)->workspace_bytes;
+    }
+};
+
+std::vector<InvocationRecord> collect_records(const std::string& problem)
+{
+    std::vector<InvocationRecord> records;
+
+    for(const auto& record : InvocationTrace::GetInstance().Collect())
+    {
+        if(problem == record.problem)
+        {
+            records.push_back(record);
+        }
+    }
+
+    return records;
+}
+
+} // namespace
+
+TEST(InvocationTrace, DisabledDoesNotRecord)
+{
+    FakeOperator op;
+    FakeInvoker invoker;
+    FakeArgument arg;
+
+    arg.workspace_bytes = 64;
+
+    InvocationTrace::GetInstance().Enable(false);
+
+    EXPECT_EQ(invoker.TracedRun(op, &arg, "fake disabled", StreamConfig{nullptr, true}), 1.5f);
+    EXPECT_TRUE(collect_records("fake disabled").empty());
+}
+
+TEST(InvocationTrace, RecordsInvocations)
+{
+    FakeOperator op;
+    FakeInvoker invoker;
+    FakeArgument arg;
+
+    arg.workspace_bytes = 1024;
+
+    InvocationTrace::GetInstance().Enable();
+
+    invoker.TracedRun(op, &arg, "fake 1 2 3", StreamConfig{nullptr, true});
+    invoker.TracedRun(op, &arg, "fake 1 2 3");
+
+    InvocationTrace::GetInstance().Enable(false);
+
+    const auto records = collect_records("fake 1 2 3");
+
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(std::string(records[0].op_name), op.GetTypeString());
+    EXPECT_EQ(records[0].workspace_bytes, 1024u);
+    EXPECT_EQ(records[0].kernel_time_ms, 1.5f);
+    EXPECT_EQ(records[1].kernel_time_ms, 0.f);
+    EXPECT_GE(records[1].host_time_ms, 0.f);
+}
+
+TEST(InvocationTrace, KeepsLastRecordsOfEachThread)
+{
+    FakeOperator op;
+    FakeArgument arg;
+
+    arg.workspace_bytes = 0;
+
+    InvocationTrace::GetInstance().Enable();
+
+    std::vector<std::thread> threads;
+
+    for(int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&]() {
+            FakeInvoker invoker;
+
+            for(std::size_t i = 0; i < InvocationTrace::RingSize + 10; ++i)
+            {
+                invoker.TracedRun(op, &arg, "fake threads");
+            }
+        });
+    }
+
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    InvocationTrace::GetInstance().Enable(false);
+
+    EXPECT_EQ(collect_records("fake threads").size(), 4 * InvocationTrace::RingSize);
+}
+
+TEST(InvocationTrace, DumpsReplayFormat)
+{
+    FakeOperator op;
+    FakeInvoker invoker;
+    FakeArgument arg;
+
+    arg.workspace_bytes = 8;
+
+    InvocationTrace::GetInstance().Enable();
+
+    invoker.TracedRun(op, &arg, "fake\tdump\n4");
+
+    InvocationTrace::GetInstance().Enable(false);
+
+    std::ostringstream os;
+
+    InvocationTrace::GetInstance().Dump(os);
+
+    EXPECT_NE(os.str().find("DeviceFake<256, 128, 128>\t8\t0\t"), std::string::npos);
+    EXPECT_NE(os.str().find("\tfake dump 4\n"), std::string::npos);
+}
+
+TEST(InvocationTrace, RecordedOpNameMatchesRecord)
+{
+    const std::string type_string =
+        "DeviceFake\n<" + std::string(InvocationRecord::MaxOpNameLength, '1') + ">";
+
+    const std::string recorded = InvocationTrace::GetRecordedOpName(type_string);
+
+    EXPECT_EQ(recorded.size(), InvocationRecord::MaxOpNameLength);
+    EXPECT_EQ(recorded.substr(0, 12), "DeviceFake <");
+    EXPECT_EQ(InvocationTrace::GetRecordedOpName("DeviceFake<256, 128, 128>"),
+              "DeviceFake<256, 128, 128>");
+}
@@ -0,0 +1,236 @@
+#include <iostream>
+#include <numeric>
+#include <initializer_list>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <stdlib.h>
+#include <half.hpp>
+
+#include "check_err.hpp"
+#include "config.hpp"
+#include "magic_division.hpp"
+#include "device.hpp"
+#include "host_tensor.hpp"
+#include "device_tensor.hpp"
+
+template <typename MagicDivisionType, typename DividendType, typename MultiplierType>
+__global__ void gpu_magic_number_division(MultiplierType magic_multiplier,
+                                          uint32_t magic_shift,
+                                          const DividendType* p_dividend,
+                                          DividendType* p_result,
+                                          uint64_t num)
+{
+    uint64_t global_thread_num = blockDim.x * gridDim.x;
+
+    uint64_t global_thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+
+    for(uint64_t data_id = global_thread_id; data_id < num; data_id += global_thread_num)
+    {
+        p_result[data_id] =
+            MagicDivisionType::DoMagicDivision(p_dividend[data_id], magic_multiplier, magic_shift);
+    }
+}
+
+// check every dividend in [begin, end] on host
+template <typename MagicDivisionType, typename DividendType, typename DivisorType>
+bool check_host_range(DivisorType divisor, DividendType begin, DividendType end)
+{
+    const auto magic_numbers    = MagicDivisionType::CalculateMagicNumbers(divisor);
+    const auto magic_multiplier = magic_numbers[ck::Number<0>{}];
+    const auto magic_shift      = magic_numbers[ck::Number<1>{}];
+
+    for(DividendType dividend = begin;; ++dividend)
+    {
+        const DividendType result =
+            MagicDivisionType::DoMagicDivision(dividend, magic_multiplier, magic_shift);
+
+        if(result != dividend / static_cast<DividendType>(divisor))
+        {
+            std::cout << "magic division failed: " << dividend << " / " << divisor << " = "
+                      << dividend / static_cast<DividendType>(divisor) << ", got " << result
+                      << std::endl;
+            return false;
+        }
+
+        if(dividend == end)
+        {
+            break;
+        }
+    }
+
+    return true;
+}
+
+// check random dividends on host and device
+template <typename MagicDivisionType, typename DividendType, typename DivisorType>
+bool check_random(DivisorType divisor, const std::vector<DividendType>& dividends_host)
+{
+    const uint64_t num = dividends_host.size();
+
+    const auto magic_numbers    = MagicDivisionType::CalculateMagicNumbers(divisor);
+    const auto magic_multiplier = magic_numbers[ck::Number<0>{}];
+    const auto magic_shift      = magic_numbers[ck::Number<1>{}];
+
+    std::vector<DividendType> naive_result_host(num);
+    std::vector<DividendType> magic_result_host(num);
+    std::vector<DividendType> magic_result_dev(num);
+
+    for(uint64_t i = 0; i < num; ++i)
+    {
+        naive_result_host[i] = dividends_host[i] / static_cast<DividendType>(divisor);
+        magic_result_host[i] =
+            MagicDivisionType::DoMagicDivision(dividends_host[i], magic_multiplier, magic_shift);
+    }
+
+    DeviceMem dividends_dev_buf(sizeof(DividendType) * num);
+    DeviceMem magic_result_dev_buf(sizeof(DividendType) * num);
+
+    dividends_dev_buf.ToDevice(dividends_host.data());
+
+    gpu_magic_number_division<MagicDivisionType><<<1024, 256>>>(
+        magic_multiplier,
+        magic_shift,
+        static_cast<const DividendType*>(dividends_dev_buf.GetDeviceBuffer()),
+        static_cast<DividendType*>(magic_result_dev_buf.GetDeviceBuffer()),
+        num);
+
+    magic_result_dev_buf.FromDevice(magic_result_dev.data());
+
+    return ck::utils::check_err(magic_result_host, naive_result_host) &&
+           ck::utils::check_err(magic_result_dev, naive_result_host);
+}
+
+int main(int, char*[])
+{
+    constexpr uint64_t num_dividend = 1L << 16;
+
+    constexpr uint32_t u32_max = std::numeric_limits<uint32_t>::max();
+    constexpr int32_t i32_min  = std::numeric_limits<int32_t>::min();
+    constexpr int32_t i32_max  = std::numeric_limits<int32_t>::max();
+    // MagicDivision64Bit supports uint64_t dividend and divisor up to 2^63
+    constexpr uint64_t u64_max = uint64_t(1) << 63;
+    constexpr int64_t i64_min  = std::numeric_limits<int64_t>::min();
+    constexpr int64_t i64_max  = std::numeric_limits<int64_t>::max();
+
+    constexpr int32_t n32 = num_dividend;
+    constexpr int64_t n64 = num_dividend;
+
+    using MD32 = ck::MagicDivision32BitFullRange;
+    using MD64 = ck::MagicDivision64Bit;
+
+    std::mt19937_64 gen(11939);
+
+    bool pass = true;
+
+    // divisors around powers of 2 and at the ends of the value range, plus random ones
+    std::vector<uint32_t> divisors_u32;
+
+    for(uint32_t shift = 0; shift < 32; ++shift)
+    {
+        for(int64_t offset : {-1, 0, 1})
+        {
+            const int64_t divisor = (int64_t(1) << shift) + offset;
+
+            if(divisor >= 1 && divisor <= u32_max)
+            {
+                divisors_u32.push_back(divisor);
+            }
+        }
+    }
+
+    for(int i = 0; i < 64; ++i)
+    {
+        divisors_u32.push_back(std::max<uint32_t>(gen() >> (32 + gen() % 32), 1));
+    }
+
+    divisors_u32.push_back(u32_max);
+
+    std::vector<uint32_t> dividends_u32(num_dividend);
+    std::vector<int32_t> dividends_i32(num_dividend);
+    std::vector<uint64_t> dividends_u64(num_dividend);
+    std::vector<int64_t> dividends_i64(num_dividend);
+
+    for(uint64_t i = 0; i < num_dividend; ++i)
+    {
+        dividends_u32[i] = gen();
+        dividends_i32[i] = gen();
+        dividends_u64[i] = gen() >> 1;
+        dividends_i64[i] = gen();
+    }
+
+    dividends_u32[0] = u32_max;
+    dividends_i32[0] = i32_min;
+    dividends_i32[1] = i32_max;
+    dividends_u64[0] = u64_max;
+    dividends_i64[0] = i64_min;
+    dividends_i64[1] = i64_max;
+
+    // uint32_t and int32_t dividend
+    for(uint32_t divisor : divisors_u32)
+    {
+        // exhaustive at both ends of the value range, where MagicDivision would overflow
+        pass = pass && check_host_range<MD32, uint32_t>(divisor, 0, n32);
+        pass = pass && check_host_range<MD32, uint32_t>(divisor, u32_max - n32, u32_max);
+        pass = pass && check_random<MD32>(divisor, dividends_u32);
+
+        if(divisor <= uint32_t(i32_max))
+        {
+            pass = pass && check_host_range<MD32, int32_t>(divisor, i32_min, i32_min + n32);
+            pass = pass && check_host_range<MD32, int32_t>(divisor, -n32, n32);
+            pass = pass && check_random<MD32>(divisor, dividends_i32);
+        }
+    }
+
+    // exhaustive over all uint32_t dividends for a few divisors
+    for(uint32_t divisor : {7U, 0x80000001U})
+    {
+        pass = pass && check_host_range<MD32, uint32_t>(divisor, 0, u32_max);
+    }
+
+    // uint64_t and int64_t dividend
+    std::vector<uint64_t> divisors_u64;
+
+    for(uint32_t shift = 0; shift < 64; ++shift)
+    {
+        for(int offset : {-1, 0, 1})
+        {
+            const uint64_t divisor = (uint64_t(1) << shift) + offset;
+
+            if(divisor >= 1 && divisor <= u64_max)
+            {
+                divisors_u64.push_back(divisor);
+            }
+        }
+    }
+
+    for(int i = 0; i < 64; ++i)
+    {
+        divisors_u64.push_back(std::max<uint64_t>(gen() >> (1 + gen() % 63), 1));
+    }
+
+    for(uint64_t divisor : divisors_u64)
+    {
+        pass = pass && check_host_range<MD64, uint64_t>(divisor, 0, n64);
+        pass = pass && check_host_range<MD64, uint64_t>(divisor, u64_max - n64, u64_max);
+        pass = pass && check_random<MD64>(divisor, dividends_u64);
+
+        if(divisor <= uint64_t(i64_max))
+        {
+            pass = pass && check_host_range<MD64, int64_t>(divisor, i64_min, i64_min + n64);
+            pass = pass && check_host_range<MD64, int64_t>(divisor, -n64, n64);
+            pass = pass && check_random<MD64>(divisor, dividends_i64);
+        }
+    }
+
+    if(pass)
+    {
+        std::cout << "test magic number division full range: Pass" << std::endl;
+        return 0;
+    }
+    else
+    {
+        std::cout << "test magic number division full range: Fail" << std::endl;
+        return -1;
+    }
+}
@@ -0,0 +1,203 @@
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "perf_regression.hpp"
+
+using namespace ck::utils;
+
+namespace {
+
+// data type, layout, M, N, K and strides
+const std::string gemm_problem = "1 1 3840 4096 4096 4096 4096 4096";
+
+// repeats of one instance with the given times
+void add_repeats(std::vector<PerfRecord>& records,
+                 const std::string& instance,
+                 const std::vector<double>& times)
+{
+    for(double t : times)
+    {
+        records.push_back({"gemm", gemm_problem, instance, t});
+    }
+}
+
+void write_results(const std::string& file_name, const std::vector<PerfRecord>& records)
+{
+    std::ofstream file(file_name);
+
+    file << "# synthetic results\n";
+
+    for(const auto& record : records)
+    {
+        WritePerfRecord(file, record);
+    }
+}
+
+} // namespace
+
+TEST(PerfRegression, ReadWriteRoundTrip)
+{
+    std::vector<PerfRecord> records;
+
+    add_repeats(records, "DeviceGemmXdl<256, 128, 128, 4, 8>", {1.5, 1.25});
+
+    std::stringstream ss;
+
+    for(const auto& record : records)
+    {
+        WritePerfRecord(ss, record);
+    }
+
+    ss << "\n# comment\n";
+
+    const auto read = ReadPerfRecords(ss);
+
+    ASSERT_EQ(read.size(), 2u);
+    EXPECT_EQ(read[0].op, "gemm");
+    EXPECT_EQ(read[0].problem, gemm_problem);
+    EXPECT_EQ(read[0].instance, "DeviceGemmXdl<256, 128, 128, 4, 8>");
+    EXPECT_EQ(read[0].time_ms, 1.5);
+    EXPECT_EQ(read[1].time_ms, 1.25);
+
+    std::stringstream malformed("gemm\t1 2 3\t1.0\n");
+
+    EXPECT_THROW(ReadPerfRecords(malformed), std::runtime_error);
+}
+
+TEST(PerfRegression, Stats)
+{
+    const auto stats = GetPerfStats({1, 2, 3, 4});
+
+    EXPECT_EQ(stats.num_samples, 4u);
+    EXPECT_DOUBLE_EQ(stats.mean, 2.5);
+    EXPECT_NEAR(stats.stddev, 1.2909944, 1e-6);
+
+    EXPECT_EQ(GetPerfStats({2}).stddev, 0);
+}
+
+TEST(PerfRegression, FlagsSlowdownsBeyondNoise)
+{
+    std::vector<PerfRecord> baseline;
+    std::vector<PerfRecord> current;
+
+    // quiet instance, 20% slower
+    add_repeats(baseline, "slower", {1.00, 1.01, 0.99, 1.00, 1.00});
+    add_repeats(current, "slower", {1.20, 1.21, 1.19, 1.20, 1.20});
+
+    // quiet instance, 50% slower
+    add_repeats(baseline, "much_slower", {2.00, 2.01, 1.99});
+    add_repeats(current, "much_slower", {3.00, 3.01, 2.99});
+
+    // 10% slower, but within the noise of the repeats
+    add_repeats(baseline, "noisy", {1.0, 1.4, 0.7, 1.2, 0.7});
+    add_repeats(current, "noisy", {1.1, 1.5, 0.8, 1.3, 0.8});
+
+    // 2% slower, below the relative threshold
+    add_repeats(baseline, "unchanged", {1.00, 1.00, 1.00});
+    add_repeats(current, "unchanged", {1.02, 1.02, 1.02});
+
+    // faster
+    add_repeats(baseline, "faster", {1.0});
+    add_repeats(current, "faster", {0.5});
+
+    add_repeats(baseline, "removed", {1.0});
+    add_repeats(current, "added", {1.0});
+
+    const auto report = ComparePerfResults(baseline, current);
+
+    ASSERT_EQ(report.comparisons.size(), 5u);
+    EXPECT_EQ(report.GetNumRegressions(), 2u);
+
+    // ranked by slowdown
+    EXPECT_EQ(report.comparisons[0].instance, "much_slower");
+    EXPECT_TRUE(report.comparisons[0].is_regression);
+    EXPECT_NEAR(report.comparisons[0].slowdown, 0.5, 1e-9);
+    EXPECT_EQ(report.comparisons[0].baseline.num_samples, 3u);
+
+    EXPECT_EQ(report.comparisons[1].instance, "slower");
+    EXPECT_TRUE(report.comparisons[1].is_regression);
+
+    EXPECT_EQ(report.comparisons[2].instance, "noisy");
+    EXPECT_FALSE(report.comparisons[2].is_regression);
+
+    EXPECT_EQ(report.comparisons[3].instance, "unchanged");
+    EXPECT_FALSE(report.comparisons[3].is_regression);
+
+    EXPECT_EQ(report.comparisons[4].instance, "faster");
+    EXPECT_FALSE(report.comparisons[4].is_regression);
+
+    ASSERT_EQ(report.missing_in_current.size(), 1u);
+    EXPECT_EQ(report.missing_in_current[0], "gemm | " + gemm_problem + " | removed");
+    ASSERT_EQ(report.missing_in_baseline.size(), 1u);
+    EXPECT_EQ(report.missing_in_baseline[0], "gemm | " + gemm_problem + " | added");
+
+    // without repeats only the relative threshold applies
+    const auto single = ComparePerfResults({baseline[0]}, {current[0]}, PerfThresholds{0.1, 3});
+
+    EXPECT_EQ(single.GetNumRegressions(), 1u);
+
+    EXPECT_EQ(ComparePerfResults(baseline, current, PerfThresholds{0.6, 3}).GetNumRegressions(),
+              0u);
+}
+
+TEST(PerfRegression, ResultsFiles)
+{
+    std::vector<PerfRecord> baseline;
+    std::vector<PerfRecord> current;
+
+    add_repeats(baseline, "a", {1.0, 1.0});
+    add_repeats(current, "a", {1.5, 1.5});
+
+    write_results("test_perf_regression_baseline.txt", baseline);
+    write_results("test_perf_regression_current.txt", current);
+
+    const auto report = ComparePerfResults(ReadPerfRecords("test_perf_regression_baseline.txt"),
+                                           ReadPerfRecords("test_perf_regression_current.txt"));
+
+    std::remove("test_perf_regression_baseline.txt");
+    std::remove("test_perf_regression_current.txt");
+
+    EXPECT_EQ(report.GetNumRegressions(), 1u);
+
+    EXPECT_THROW(ReadPerfRecords("test_perf_regression_does_not_exist.txt"), std::runtime_error);
+}
+
+TEST(PerfRegression, ProblemExcludesRunOptions)
+{
+    auto split = [](const std::string& command) {
+        std::vector<std::string> args;
+        std::istringstream is(command);
+        std::string arg;
+
+        while(is >> arg)
+        {
+            args.push_back(arg);
+        }
+
+        return args;
+    };
+
+    // verification, initialization, printing and timing differ, the problem does not
+    EXPECT_EQ(GetPerfProblem("gemm", split("1 1 0 0 0 1 3840 4096 4096 4096 4096 4096")),
+              gemm_problem);
+    EXPECT_EQ(GetPerfProblem("gemm", split("1 1 1 2 1 1 3840 4096 4096 4096 4096 4096")),
+              gemm_problem);
+
+    EXPECT_EQ(GetPerfProblem("conv_fwd_bias_relu",
+                             split("1 1 1 1 1 2 0 1 128 256 192 3 3 71 71 2 2 1 1 1 1 1 1")),
+              GetPerfProblem("conv_fwd_bias_relu",
+                             split("1 1 1 1 0 1 1 0 128 256 192 3 3 71 71 2 2 1 1 1 1 1 1")));
+    EXPECT_EQ(GetPerfProblem("conv_fwd_bias_relu", split("0 1 1 1 1 2 0 1 128")), "0 1 1 1 128");
+
+    EXPECT_EQ(GetPerfProblem("reduce", split("-D 64,4,280,82 -R 0,1,2,3 -O 0 -v 1 --half 1 1")),
+              "-D 64,4,280,82 -R 0,1,2,3 -O 0 --half");
+    EXPECT_EQ(GetPerfProblem("reduce", split("-D 64,4,280,82 --verify=0 -o1 -R 0 2 0")),
+              "-D 64,4,280,82 -R 0");
+
+    EXPECT_EQ(GetPerfProblem("compare", split("a.txt b.txt 0.1")), "a.txt b.txt 0.1");
+}
@@ -0,0 +1,260 @@
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "host_tensor.hpp"
+#include "reference_pool_fwd.hpp"
+
+using ck::index_t;
+using ck::ReduceTensorOp;
+
+namespace {
+
+struct PoolProblem
+{
+    std::vector<std::size_t> in_lengths; // N, C, spatial dims...
+    std::vector<index_t> window_spatial_lengths;
+    std::vector<index_t> window_strides;
+    std::vector<index_t> in_left_pads;
+    std::vector<index_t> in_right_pads;
+
+    std::vector<std::size_t> GetOutLengths() const
+    {
+        std::vector<std::size_t> out_lengths{in_lengths[0], in_lengths[1]};
+
+        for(std::size_t d = 0; d < window_spatial_lengths.size(); ++d)
+        {
+            const index_t padded_length =
+                static_cast<index_t>(in_lengths[d + 2]) + in_left_pads[d] + in_right_pads[d];
+
+            out_lengths.push_back((padded_length - window_spatial_lengths[d]) / window_strides[d] +
+                                  1);
+        }
+
+        return out_lengths;
+    }
+};
+
+// strides of the lengths (N, C, spatial dims...) laid out as NCHW, or as NHWC if channels_last
+std::vector<std::size_t> get_strides(const std::vector<std::size_t>& lengths, bool channels_last)
+{
+    std::vector<std::size_t> order(lengths.size());
+
+    for(std::size_t d = 0; d < lengths.size(); ++d)
+    {
+        order[d] = d;
+    }
+
+    if(channels_last)
+    {
+        order.erase(order.begin() + 1);
+        order.push_back(1);
+    }
+
+    std::vector<std::size_t> strides(lengths.size());
+
+    std::size_t stride = 1;
+
+    for(std::size_t i = lengths.size(); i-- > 0;)
+    {
+        strides[order[i]] = stride;
+        stride *= lengths[order[i]];
+    }
+
+    return strides;
+}
+
+// small integers, so that windows have ties, with some NaNs and infinities if non_finite
+template <typename T>
+void fill(Tensor<T>& tensor, bool non_finite)
+{
+    for(std::size_t i = 0; i < tensor.mData.size(); ++i)
+    {
+        tensor.mData[i] = static_cast<T>(static_cast<int>((i * 7 + i / 5) % 9) - 4);
+
+        if(non_finite && i % 23 == 5)
+        {
+            tensor.mData[i] = std::numeric_limits<T>::quiet_NaN();
+        }
+        else if(non_finite && i % 29 == 7)
+        {
+            tensor.mData[i] = (i / 29) % 2 == 0 ? std::numeric_limits<T>::infinity()
+                                                : -std::numeric_limits<T>::infinity();
+        }
+    }
+}
+
+template <typename T>
+void expect_same_value(T x, T y)
+{
+    if(std::isnan(x) || std::isnan(y))
+    {
+        EXPECT_TRUE(std::isnan(x) && std::isnan(y)) << x << " vs " << y;
+    }
+    else if(std::isinf(x) || std::isinf(y))
+    {
+        EXPECT_EQ(x, y);
+    }
+    else
+    {
+        EXPECT_NEAR(x, y, 1e-5 * (1 + std::abs(y)));
+    }
+}
+
+// Checks Run() against the scan of the window of every output, done by ComputeAt()
+template <index_t NumDimSpatial, ReduceTensorOp ReduceOpId, bool PropagateNan, bool OutputIndex>
+void check_pool_fwd(const PoolProblem& problem, bool channels_last, bool non_finite)
+{
+    using ReferencePoolFwd = ck::tensor_operation::host::ReferencePoolFwd<NumDimSpatial,
+                                                                          float,
+                                                                          float,
+                                                                          float,
+                                                                          int,
+                                                                          ReduceOpId,
+                                                                          PropagateNan,
+                                                                          OutputIndex>;
+
+    const auto out_lengths = problem.GetOutLengths();
+
+    Tensor<float> in(problem.in_lengths, get_strides(problem.in_lengths, channels_last));
+    Tensor<float> out(out_lengths, get_strides(out_lengths, channels_last));
+    Tensor<int> out_indices(out_lengths, get_strides(out_lengths, channels_last));
+
+    fill(in, non_finite);
+
+    auto argument = ReferencePoolFwd::MakeArgument(in,
+                                                   out,
+                                                   out_indices,
+                                                   problem.window_spatial_lengths,
+                                                   problem.window_strides,
+                                                   problem.in_left_pads,
+                                                   problem.in_right_pads);
+
+    ReferencePoolFwd::MakeInvoker().Run(argument);
+
+    out.ForEach([&](auto& self, const auto& idx) {
+        using Invoker = typename ReferencePoolFwd::Invoker;
+
+        expect_same_value(self(idx), Invoker::ComputeAt(argument, idx));
+
+        if constexpr(OutputIndex)
+        {
+            EXPECT_EQ(out_indices(idx), Invoker::ComputeIndexAt(argument, idx));
+        }
+    });
+}
+
+template <index_t NumDimSpatial>
+std::vector<PoolProblem> get_problems();
+
+template <>
+std::vector<PoolProblem> get_problems<1>()
+{
+    return {{{2, 3, 17}, {3}, {1}, {1}, {1}},
+            {{1, 2, 20}, {4}, {3}, {2}, {3}},
+            {{2, 1, 9}, {9}, {1}, {0}, {0}}};
+}
+
+template <>
+std::vector<PoolProblem> get_problems<2>()
+{
+    return {{{2, 3, 9, 8}, {3, 3}, {2, 2}, {1, 1}, {1, 1}},
+            {{1, 4, 12, 11}, {2, 5}, {2, 3}, {0, 2}, {1, 2}},
+            {{2, 2, 7, 7}, {7, 7}, {1, 1}, {0, 0}, {0, 0}}};
+}
+
+template <>
+std::vector<PoolProblem> get_problems<3>()
+{
+    return {{{1, 3, 6, 7, 5}, {3, 3, 3}, {2, 2, 1}, {1, 1, 1}, {1, 1, 1}},
+            {{2, 2, 5, 4, 6}, {2, 4, 2}, {1, 2, 3}, {0, 1, 0}, {1, 1, 0}}};
+}
+
+template <index_t NumDimSpatial, ReduceTensorOp ReduceOpId, bool PropagateNan, bool OutputIndex>
+void check_pool_fwd_problems()
+{
+    for(const auto& problem : get_problems<NumDimSpatial>())
+    {
+        for(bool channels_last : {false, true})
+        {
+            for(bool non_finite : {false, true})
+            {
+                check_pool_fwd<NumDimSpatial, ReduceOpId, PropagateNan, OutputIndex>(
+                    problem, channels_last, non_finite);
+            }
+        }
+    }
+}
+
+template <index_t NumDimSpatial>
+void check_pool_fwd_ops()
+{
+    check_pool_fwd_problems<NumDimSpatial, ReduceTensorOp::MAX, false, true>();
+    check_pool_fwd_problems<NumDimSpatial, ReduceTensorOp::MAX, true, true>();
+    check_pool_fwd_problems<NumDimSpatial, ReduceTensorOp::MIN, false, true>();
+    check_pool_fwd_problems<NumDimSpatial, ReduceTensorOp::MIN, true, true>();
+    check_pool_fwd_problems<NumDimSpatial, ReduceTensorOp::AMAX, true, true>();
+    check_pool_fwd_problems<NumDimSpatial, ReduceTensorOp::MAX, false, false>();
+    check_pool_fwd_problems<NumDimSpatial, ReduceTensorOp::AVG, false, false>();
+    check_pool_fwd_problems<NumDimSpatial, ReduceTensorOp::ADD, true, false>();
+    check_pool_fwd_problems<NumDimSpatial, ReduceTensorOp::NORM2, false, false>();
+}
+
+} // namespace
+
+TEST(ReferencePoolFwd, Pool1dMatchesWindowScan) { check_pool_fwd_ops<1>(); }
+
+TEST(ReferencePoolFwd, Pool2dMatchesWindowScan) { check_pool_fwd_ops<2>(); }
+
+TEST(ReferencePoolFwd, Pool3dMatchesWindowScan) { check_pool_fwd_ops<3>(); }
+
+TEST(ReferencePoolFwd, MaxAndAvgValues)
+{
+    using MaxPool = ck::tensor_operation::host::
+        ReferencePoolFwd<2, float, float, float, int, ReduceTensorOp::MAX, false, true>;
+    using AvgPool = ck::tensor_operation::host::
+        ReferencePoolFwd<2, float, float, float, int, ReduceTensorOp::AVG, false, false>;
+
+    // 1 2 3
+    // 4 9 9
+    // 7 8 0
+    Tensor<float> in(std::vector<std::size_t>{1, 1, 3, 3});
+    Tensor<float> out(std::vector<std::size_t>{1, 1, 2, 2});
+    Tensor<int> out_indices(std::vector<std::size_t>{1, 1, 2, 2});
+
+    in.mData = {1, 2, 3, 4, 9, 9, 7, 8, 0};
+
+    auto max_argument = MaxPool::MakeArgument(in, out, out_indices, {2, 2}, {1, 1}, {0, 0}, {0, 0});
+
+    MaxPool::MakeInvoker().Run(max_argument);
+
+    EXPECT_EQ(out.mData, (std::vector<float>{9, 9, 9, 9}));
+
+    // offset of the first 9 in each 2x2 window
+    EXPECT_EQ(out_indices.mData, (std::vector<int>{3, 2, 1, 0}));
+
+    // the padding counts in the window size
+    auto avg_argument = AvgPool::MakeArgument(in, out, out_indices, {2, 2}, {2, 2}, {1, 1}, {1, 1});
+
+    AvgPool::MakeInvoker().Run(avg_argument);
+
+    EXPECT_EQ(out.mData, (std::vector<float>{0.25, 1.25, 2.75, 6.5}));
+}
+
+TEST(ReferencePoolFwd, InconsistentLengthsThrow)
+{
+    using MaxPool = ck::tensor_operation::host::
+        ReferencePoolFwd<2, float, float, float, int, ReduceTensorOp::MAX, false, true>;
+
+    Tensor<float> in(std::vector<std::size_t>{1, 2, 8, 8});
+    Tensor<float> out(std::vector<std::size_t>{1, 2, 4, 4});
+    Tensor<int> out_indices(std::vector<std::size_t>{1, 2, 4, 4});
+
+    EXPECT_NO_THROW(MaxPool::MakeArgument(in, out, out_indices, {2, 2}, {2, 2}, {0, 0}, {0, 0}));
+    EXPECT_THROW(MaxPool::MakeArgument(in, out, out_indices, {3, 3}, {2, 2}, {0, 0}, {0, 0}),
+                 std::runtime_error);
+    EXPECT_THROW(MaxPool::MakeArgument(in, out, out_indices, {2}, {2}, {0}, {0}),
+                 std::runtime_error);
+}
@@ -0,0 +1,284 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "device.hpp"
+#include "host_tensor.hpp"
+#include "host_reduction.hpp"
+#include "reduction_operator.hpp"
+#include "device_reduce_welford_threadwise.hpp"
+
+namespace {
+
+// two-pass mean and population variance in double precision
+template <typename InDataType>
+void reference_mean_variance(const Tensor<InDataType>& in,
+                             const std::vector<int>& invariantDims,
+                             const std::vector<int>& reduceDims,
+                             std::vector<double>& mean,
+                             std::vector<double>& variance)
+{
+    const auto& lengths = in.mDesc.GetLengths();
+
+    std::size_t invariant_size = 1;
+    std::size_t reduce_size    = 1;
+
+    for(int d : invariantDims)
+        invariant_size *= lengths[d];
+
+    for(int d : reduceDims)
+        reduce_size *= lengths[d];
+
+    mean.assign(invariant_size, 0);
+    variance.assign(invariant_size, 0);
+
+    // index of the output element of every input element
+    auto out_index = [&](const std::vector<std::size_t>& idx) {
+        std::size_t index = 0;
+
+        for(int d : invariantDims)
+            index = index * lengths[d] + idx[d];
+
+        return index;
+    };
+
+    std::vector<std::size_t> idx(lengths.size(), 0);
+
+    auto for_each_element = [&](auto f) {
+        std::fill(idx.begin(), idx.end(), 0);
+
+        for(std::size_t i = 0; i < in.mDesc.GetElementSize(); ++i)
+        {
+            f(out_index(idx), static_cast<double>(in(idx)));
+
+            for(int d = static_cast<int>(lengths.size()) - 1; d >= 0; --d)
+            {
+                if(++idx[d] < lengths[d])
+                    break;
+
+                idx[d] = 0;
+            }
+        }
+    };
+
+    for_each_element([&](std::size_t o, double x) { mean[o] += x / reduce_size; });
+    for_each_element([&](std::size_t o, double x) {
+        variance[o] += (x - mean[o]) * (x - mean[o]) / reduce_size;
+    });
+}
+
+// the dimensions not reduced and the lengths of the output, which is (1) if all are reduced
+void get_invariant_dims(const std::vector<std::size_t>& inLengths,
+                        const std::vector<int>& reduceDims,
+                        std::vector<int>& invariantDims,
+                        std::vector<std::size_t>& outLengths)
+{
+    for(int d = 0; d < static_cast<int>(inLengths.size()); ++d)
+    {
+        if(std::find(reduceDims.begin(), reduceDims.end(), d) == reduceDims.end())
+        {
+            invariantDims.push_back(d);
+            outLengths.push_back(inLengths[d]);
+        }
+    }
+
+    if(outLengths.empty())
+        outLengths.push_back(1);
+}
+
+// normally distributed values with a large offset, which makes E[x^2] - E[x]^2 lose all
+// significant digits in fp32
+void generate_welford_input(Tensor<float>& in)
+{
+    std::mt19937 gen(5489);
+    std::normal_distribution<float> dist(1.0e4f, 1.0f);
+
+    in.GenerateTensorValue([&](auto...) { return dist(gen); });
+}
+
+bool check_mean_variance(const Tensor<float>& in,
+                         const std::vector<int>& invariantDims,
+                         const std::vector<int>& reduceDims,
+                         const Tensor<float>& mean,
+                         const Tensor<float>& variance)
+{
+    std::vector<double> ref_mean;
+    std::vector<double> ref_variance;
+
+    reference_mean_variance(in, invariantDims, reduceDims, ref_mean, ref_variance);
+
+    for(std::size_t i = 0; i < ref_mean.size(); ++i)
+    {
+        const double mean_err     = std::abs(mean.mData[i] - ref_mean[i]);
+        const double variance_err = std::abs(variance.mData[i] - ref_variance[i]);
+
+        if(mean_err > 1e-3 * std::abs(ref_mean[i]) || variance_err > 1e-2 * ref_variance[i])
+        {
+            std::cout << "welford mismatch at " << i << ": mean " << mean.mData[i] << " vs "
+                      << ref_mean[i] << ", variance " << variance.mData[i] << " vs "
+                      << ref_variance[i] << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <int Rank, int NumReduceDim>
+bool test_reduce_welford(const std::vector<std::size_t>& inLengths,
+                         const std::vector<int>& reduceDims,
+                         std::size_t numPartitions)
+{
+    std::vector<int> invariantDims;
+    std::vector<std::size_t> outLengths;
+
+    get_invariant_dims(inLengths, reduceDims, invariantDims, outLengths);
+
+    Tensor<float> in(inLengths);
+    Tensor<float> mean(outLengths);
+    Tensor<float> variance(outLengths);
+
+    generate_welford_input(in);
+
+    ReductionHostWelford<float, float, float, float, Rank, NumReduceDim, true> hostReduce(
+        in.mDesc, mean.mDesc, invariantDims, reduceDims);
+
+    hostReduce.Run(in.mData.data(), mean.mData.data(), variance.mData.data(), numPartitions);
+
+    return check_mean_variance(in, invariantDims, reduceDims, mean, variance);
+}
+
+template <int Rank, int NumReduceDim, int InSrcVectorDim>
+using DeviceWelford = ck::tensor_operation::device::
+    DeviceReduceWelfordThreadWise<float, float, float, float, Rank, NumReduceDim, true, 256, 4, 4,
+                                  InSrcVectorDim, 1>;
+
+template <int Rank, int NumReduceDim>
+bool test_device_reduce_welford(const std::vector<std::size_t>& inLengths,
+                                const std::vector<int>& reduceDims)
+{
+    std::vector<int> invariantDims;
+    std::vector<std::size_t> outLengths;
+
+    get_invariant_dims(inLengths, reduceDims, invariantDims, outLengths);
+
+    Tensor<float> in(inLengths);
+    Tensor<float> mean(outLengths);
+    Tensor<float> variance(outLengths);
+
+    generate_welford_input(in);
+
+    DeviceMem in_dev(sizeof(float) * in.mDesc.GetElementSpace());
+    DeviceMem mean_dev(sizeof(float) * mean.mDesc.GetElementSpace());
+    DeviceMem variance_dev(sizeof(float) * variance.mDesc.GetElementSpace());
+
+    in_dev.ToDevice(in.mData.data());
+
+    auto to_index_t = [](const std::vector<std::size_t>& v) {
+        return std::vector<ck::index_t>(v.begin(), v.end());
+    };
+
+    // the input is vectorized along the reduced dimensions if they are innermost, else along the
+    // invariant dimensions
+    DeviceWelford<Rank, NumReduceDim, 1> welford_k;
+    DeviceWelford<Rank, NumReduceDim, 0> welford_m;
+
+    auto run = [&](auto& op) {
+        auto argument_ptr = op.MakeArgumentPointer(to_index_t(inLengths),
+                                                   to_index_t(in.mDesc.GetStrides()),
+                                                   to_index_t(outLengths),
+                                                   to_index_t(mean.mDesc.GetStrides()),
+                                                   reduceDims,
+                                                   in_dev.GetDeviceBuffer(),
+                                                   mean_dev.GetDeviceBuffer(),
+                                                   variance_dev.GetDeviceBuffer());
+
+        if(!op.IsSupportedArgument(argument_ptr.get()))
+            return false;
+
+        op.MakeInvokerPointer()->Run(argument_ptr.get());
+
+        return true;
+    };
+
+    if(!run(welford_k) && !run(welford_m))
+    {
+        std::cout << "welford device instances do not support the problem" << std::endl;
+        return false;
+    }
+
+    mean_dev.FromDevice(mean.mData.data());
+    variance_dev.FromDevice(variance.mData.data());
+
+    return check_mean_variance(in, invariantDims, reduceDims, mean, variance);
+}
+
+bool test_welford_merge()
+{
+    using State = ck::reduce::WelfordState<float>;
+
+    ck::reduce::Welford op;
+
+    // merging with the identity does not change a state
+    State a = State::FromValue(3.0f);
+    op(a, State::FromValue(5.0f));
+    op(a, ck::reduce::Welford::GetIdentityValue<State>());
+
+    State empty = ck::reduce::Welford::GetIdentityValue<State>();
+    op(empty, ck::reduce::Welford::GetIdentityValue<State>());
+
+    // accumulating single values agrees with merging single-value states
+    State b = ck::reduce::Welford::GetIdentityValue<State>();
+    op(b, 3.0f);
+    op(b, 5.0f);
+
+    // NaN propagation
+    State c = State::FromValue(1.0f);
+    ck::detail::AccumulateWithNanCheck<true, ck::reduce::Welford, State>::Calculate(
+        c, State::FromValue(std::nanf("")));
+
+    auto is_close = [](float x, float y) { return std::abs(x - y) <= 1e-6f * std::abs(y); };
+
+    return is_close(a.count, 2.0f) && is_close(a.GetMean(), 4.0f) &&
+           is_close(a.GetVariance(), 1.0f) && is_close(empty.count, 0.0f) &&
+           is_close(empty.GetVariance(), 0.0f) && is_close(b.count, a.count) &&
+           is_close(b.GetMean(), a.GetMean()) && is_close(b.GetVariance(), a.GetVariance()) &&
+           std::isnan(c.GetMean());
+}
+
+} // namespace
+
+int main()
+{
+    bool pass = test_welford_merge();
+
+    for(std::size_t numPartitions : {1, 3, 16})
+    {
+        pass = pass && test_reduce_welford<4, 3>({16, 8, 12, 20}, {1, 2, 3}, numPartitions);
+        pass = pass && test_reduce_welford<4, 1>({16, 8, 12, 20}, {0}, numPartitions);
+        pass = pass && test_reduce_welford<4, 2>({16, 8, 12, 20}, {1, 3}, numPartitions);
+        pass = pass && test_reduce_welford<2, 2>({64, 1000}, {0, 1}, numPartitions);
+    }
+
+    // a single reduced element and no partitioning
+    pass = pass && test_reduce_welford<2, 1>({8, 1}, {1}, 0);
+
+    // reduced lengths which are not multiples of KThreadSliceSize test the masking of the padding
+    pass = pass && test_device_reduce_welford<4, 3>({16, 8, 12, 20}, {1, 2, 3});
+    pass = pass && test_device_reduce_welford<4, 1>({16, 8, 12, 20}, {0});
+    pass = pass && test_device_reduce_welford<4, 2>({16, 7, 12, 21}, {1, 3});
+    pass = pass && test_device_reduce_welford<2, 2>({63, 1001}, {0, 1});
+
+    if(pass)
+    {
+        std::cout << "test reduce welford: Pass" << std::endl;
+        return 0;
+    }
+    else
+    {
+        std::cout << "test reduce welford: Fail" << std::endl;
+        return -1;
+    }
+}
@@ -0,0 +1,189 @@
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "element_wise_operation.hpp"
+#include "host_tensor.hpp"
+#include "reference_cgemm.hpp"
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using ck::tensor_operation::host::CGemmAlgorithm;
+
+using ReferenceCGemm = ck::tensor_operation::host::
+    ReferenceCGemm<float, float, float, PassThrough, PassThrough, PassThrough>;
+
+namespace {
+
+template <typename T>
+void fill(Tensor<T>& tensor, int seed)
+{
+    for(std::size_t i = 0; i < tensor.mData.size(); ++i)
+    {
+        tensor.mData[i] = static_cast<T>(static_cast<int>((i * 7 + seed) % 13) - 6) / 4;
+    }
+}
+
+struct CGemmProblem
+{
+    std::size_t M;
+    std::size_t N;
+    std::size_t K;
+};
+
+// C computed element by element, with the real and imaginary parts summed along k
+void cgemm_naive(const Tensor<float>& a_real,
+                 const Tensor<float>& a_imag,
+                 const Tensor<float>& b_real,
+                 const Tensor<float>& b_imag,
+                 Tensor<float>& c_real,
+                 Tensor<float>& c_imag)
+{
+    const std::size_t M = c_real.mDesc.GetLengths()[0];
+    const std::size_t N = c_real.mDesc.GetLengths()[1];
+    const std::size_t K = a_real.mDesc.GetLengths()[1];
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            float v_c_real = 0;
+            float v_c_imag = 0;
+
+            for(std::size_t k = 0; k < K; ++k)
+            {
+                v_c_real += a_real(m, k) * b_real(k, n) - a_imag(m, k) * b_imag(k, n);
+                v_c_imag += a_real(m, k) * b_imag(k, n) + a_imag(m, k) * b_real(k, n);
+            }
+
+            c_real(m, n) = v_c_real;
+            c_imag(m, n) = v_c_imag;
+        }
+    }
+}
+
+void check_cgemm(const CGemmProblem& problem, CGemmAlgorithm algorithm)
+{
+    const std::size_t M = problem.M;
+    const std::size_t N = problem.N;
+    const std::size_t K = problem.K;
+
+    // A row-major, B column-major
+    Tensor<float> a_real(std::vector<std::size_t>{M, K});
+    Tensor<float> a_imag(std::vector<std::size_t>{M, K});
+    Tensor<float> b_real(std::vector<std::size_t>{K, N}, std::vector<std::size_t>{1, K});
+    Tensor<float> b_imag(std::vector<std::size_t>{K, N}, std::vector<std::size_t>{1, K});
+    Tensor<float> c_real(std::vector<std::size_t>{M, N});
+    Tensor<float> c_imag(std::vector<std::size_t>{M, N});
+    Tensor<float> c_real_ref(std::vector<std::size_t>{M, N});
+    Tensor<float> c_imag_ref(std::vector<std::size_t>{M, N});
+
+    fill(a_real, 1);
+    fill(a_imag, 2);
+    fill(b_real, 3);
+    fill(b_imag, 4);
+
+    auto argument = ReferenceCGemm::MakeArgument(
+        a_real, a_imag, b_real, b_imag, c_real, c_imag, {}, {}, {}, algorithm);
+
+    ReferenceCGemm::MakeInvoker().Run(argument);
+
+    cgemm_naive(a_real, a_imag, b_real, b_imag, c_real_ref, c_imag_ref);
+
+    // the inputs are multiples of 1/4, so every algorithm is exact
+    EXPECT_EQ(c_real.mData, c_real_ref.mData);
+    EXPECT_EQ(c_imag.mData, c_imag_ref.mData);
+
+    // same problem, with the real and imaginary parts interleaved
+    Tensor<float> a_2(std::vector<std::size_t>{M, K, 2});
+    Tensor<float> b_2(std::vector<std::size_t>{K, N, 2});
+    Tensor<float> c_2(std::vector<std::size_t>{M, N, 2});
+
+    a_2.ForEach([&](auto& self, auto idx) {
+        self(idx) = idx[2] == 0 ? a_real(idx[0], idx[1]) : a_imag(idx[0], idx[1]);
+    });
+    b_2.ForEach([&](auto& self, auto idx) {
+        self(idx) = idx[2] == 0 ? b_real(idx[0], idx[1]) : b_imag(idx[0], idx[1]);
+    });
+
+    auto argument_2 = ReferenceCGemm::MakeArgument(a_2, b_2, c_2, {}, {}, {}, algorithm);
+
+    ReferenceCGemm::MakeInvoker().Run(argument_2);
+
+    c_2.ForEach([&](auto& self, auto idx) {
+        EXPECT_EQ(self(idx), idx[2] == 0 ? c_real(idx[0], idx[1]) : c_imag(idx[0], idx[1]));
+    });
+}
+
+} // namespace
+
+TEST(ReferenceCGemm, DirectMatchesNaive)
+{
+    for(const auto& problem : std::vector<CGemmProblem>{{1, 1, 1}, {17, 300, 9}, {64, 128, 33}})
+    {
+        check_cgemm(problem, CGemmAlgorithm::Direct);
+    }
+}
+
+TEST(ReferenceCGemm, GaussMatchesNaive)
+{
+    for(const auto& problem : std::vector<CGemmProblem>{{1, 1, 1}, {17, 300, 9}, {64, 128, 33}})
+    {
+        check_cgemm(problem, CGemmAlgorithm::Gauss);
+    }
+}
+
+TEST(ReferenceCGemm, GaussIsCloseForDecimalValues)
+{
+    const std::size_t M = 23;
+    const std::size_t N = 150;
+    const std::size_t K = 71;
+
+    Tensor<float> a_real(std::vector<std::size_t>{M, K});
+    Tensor<float> a_imag(std::vector<std::size_t>{M, K});
+    Tensor<float> b_real(std::vector<std::size_t>{K, N});
+    Tensor<float> b_imag(std::vector<std::size_t>{K, N});
+    Tensor<float> c_real(std::vector<std::size_t>{M, N});
+    Tensor<float> c_imag(std::vector<std::size_t>{M, N});
+    Tensor<float> c_real_ref(std::vector<std::size_t>{M, N});
+    Tensor<float> c_imag_ref(std::vector<std::size_t>{M, N});
+
+    for(auto* p_tensor : {&a_real, &a_imag, &b_real, &b_imag})
+    {
+        for(std::size_t i = 0; i < p_tensor->mData.size(); ++i)
+        {
+            p_tensor->mData[i] = std::sin(0.37f * i + p_tensor->mData.size());
+        }
+    }
+
+    auto argument = ReferenceCGemm::MakeArgument(
+        a_real, a_imag, b_real, b_imag, c_real, c_imag, {}, {}, {}, CGemmAlgorithm::Gauss);
+
+    ReferenceCGemm::MakeInvoker().Run(argument);
+
+    cgemm_naive(a_real, a_imag, b_real, b_imag, c_real_ref, c_imag_ref);
+
+    for(std::size_t i = 0; i < c_real.mData.size(); ++i)
+    {
+        EXPECT_NEAR(c_real.mData[i], c_real_ref.mData[i], 1e-4f * K);
+        EXPECT_NEAR(c_imag.mData[i], c_imag_ref.mData[i], 1e-4f * K);
+    }
+}
+
+TEST(ReferenceCGemm, InconsistentLengthsThrow)
+{
+    Tensor<float> a(std::vector<std::size_t>{4, 3});
+    Tensor<float> a_wrong(std::vector<std::size_t>{4, 2});
+    Tensor<float> b(std::vector<std::size_t>{3, 5});
+    Tensor<float> c(std::vector<std::size_t>{4, 5});
+    Tensor<float> c_2(std::vector<std::size_t>{4, 5, 2});
+    Tensor<float> a_3(std::vector<std::size_t>{4, 3, 3});
+
+    EXPECT_NO_THROW(ReferenceCGemm::MakeArgument(a, a, b, b, c, c, {}, {}, {}));
+    EXPECT_THROW(ReferenceCGemm::MakeArgument(a, a_wrong, b, b, c, c, {}, {}, {}),
+                 std::runtime_error);
+    EXPECT_THROW(ReferenceCGemm::MakeArgument(a_wrong, a_wrong, b, b, c, c, {}, {}, {}),
+                 std::runtime_error);
+    EXPECT_THROW(ReferenceCGemm::MakeArgument(a_3, a_3, c_2, {}, {}, {}), std::runtime_error);
+}
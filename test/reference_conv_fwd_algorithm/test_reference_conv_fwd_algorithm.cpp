@@ -0,0 +1,229 @@
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "element_wise_operation.hpp"
+#include "host_tensor.hpp"
+#include "reference_conv_fwd.hpp"
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using ck::tensor_operation::host::ConvFwdAlgorithm;
+
+template <ck::index_t NDim>
+using ReferenceConvFwd = ck::tensor_operation::host::
+    ReferenceConvFwd<float, float, float, PassThrough, PassThrough, PassThrough, NDim>;
+
+namespace {
+
+// y = 2 * x - 1, to check that the element-wise operations are applied around the transforms
+struct ScaleShift
+{
+    void operator()(float& y, const float& x) const { y = 2 * x - 1; }
+};
+
+struct ConvProblem
+{
+    std::size_t N;
+    std::size_t G;
+    std::size_t C_per_group;
+    std::size_t K_per_group;
+    std::vector<std::size_t> filter_lengths;
+    std::vector<std::size_t> in_spatial_lengths;
+    std::vector<ck::index_t> strides;
+    std::vector<ck::index_t> dilations;
+    std::vector<ck::index_t> left_pads;
+    std::vector<ck::index_t> right_pads;
+
+    std::vector<std::size_t> GetInputLengths() const
+    {
+        std::vector<std::size_t> lengths{N, G * C_per_group};
+
+        lengths.insert(lengths.end(), in_spatial_lengths.begin(), in_spatial_lengths.end());
+
+        return lengths;
+    }
+
+    std::vector<std::size_t> GetWeightLengths() const
+    {
+        std::vector<std::size_t> lengths{G * K_per_group, C_per_group};
+
+        lengths.insert(lengths.end(), filter_lengths.begin(), filter_lengths.end());
+
+        return lengths;
+    }
+
+    std::vector<std::size_t> GetOutputLengths() const
+    {
+        std::vector<std::size_t> lengths{N, G * K_per_group};
+
+        for(std::size_t d = 0; d < filter_lengths.size(); ++d)
+        {
+            const std::size_t x_eff = (filter_lengths[d] - 1) * dilations[d] + 1;
+
+            lengths.push_back((in_spatial_lengths[d] + left_pads[d] + right_pads[d] - x_eff) /
+                                  strides[d] +
+                              1);
+        }
+
+        return lengths;
+    }
+};
+
+// small integers, so that Direct is exact and the fast algorithms are within rounding of it
+void fill(Tensor<float>& tensor, int seed)
+{
+    for(std::size_t i = 0; i < tensor.mData.size(); ++i)
+    {
+        tensor.mData[i] = static_cast<float>(static_cast<int>((i * 7 + seed) % 9) - 4);
+    }
+}
+
+template <ck::index_t NDim,
+          typename InElementwiseOperation  = PassThrough,
+          typename WeiElementwiseOperation = PassThrough,
+          typename OutElementwiseOperation = PassThrough>
+void check_algorithm(ConvFwdAlgorithm algorithm, const ConvProblem& problem)
+{
+    using ReferenceConv = ck::tensor_operation::host::ReferenceConvFwd<float,
+                                                                       float,
+                                                                       float,
+                                                                       InElementwiseOperation,
+                                                                       WeiElementwiseOperation,
+                                                                       OutElementwiseOperation,
+                                                                       NDim>;
+
+    Tensor<float> input(problem.GetInputLengths());
+    Tensor<float> weight(problem.GetWeightLengths());
+    Tensor<float> output_direct(problem.GetOutputLengths());
+    Tensor<float> output(problem.GetOutputLengths());
+
+    fill(input, 1);
+    fill(weight, 2);
+
+    auto run = [&](Tensor<float>& out, ConvFwdAlgorithm algo) {
+        auto argument = ReferenceConv::MakeArgument(input,
+                                                    weight,
+                                                    out,
+                                                    problem.strides,
+                                                    problem.dilations,
+                                                    problem.left_pads,
+                                                    problem.right_pads,
+                                                    InElementwiseOperation{},
+                                                    WeiElementwiseOperation{},
+                                                    OutElementwiseOperation{},
+                                                    algo);
+
+        ReferenceConv::MakeInvoker().Run(argument);
+    };
+
+    run(output_direct, ConvFwdAlgorithm::Direct);
+    run(output, algorithm);
+
+    for(std::size_t i = 0; i < output.mData.size(); ++i)
+    {
+        EXPECT_NEAR(output.mData[i], output_direct.mData[i], 1e-3) << "at " << i;
+    }
+}
+
+} // namespace
+
+TEST(ReferenceConvFwdAlgorithm, WinogradF4x4_3x3)
+{
+    // output lengths which are not multiples of the tile, and padding
+    check_algorithm<2>(ConvFwdAlgorithm::Winograd,
+                       {2, 1, 5, 3, {3, 3}, {11, 9}, {1, 1}, {1, 1}, {1, 1}, {1, 1}});
+    check_algorithm<2>(ConvFwdAlgorithm::Winograd,
+                       {1, 2, 3, 4, {3, 3}, {8, 13}, {1, 1}, {1, 1}, {0, 2}, {1, 0}});
+    check_algorithm<2, ScaleShift, ScaleShift, ScaleShift>(
+        ConvFwdAlgorithm::Winograd, {1, 1, 4, 2, {3, 3}, {7, 7}, {1, 1}, {1, 1}, {1, 1}, {1, 1}});
+}
+
+TEST(ReferenceConvFwdAlgorithm, WinogradF2x2_5x5)
+{
+    check_algorithm<2>(ConvFwdAlgorithm::Winograd,
+                       {2, 1, 3, 2, {5, 5}, {12, 9}, {1, 1}, {1, 1}, {2, 2}, {2, 2}});
+    check_algorithm<2>(ConvFwdAlgorithm::Winograd,
+                       {1, 3, 2, 2, {5, 5}, {7, 10}, {1, 1}, {1, 1}, {0, 1}, {0, 0}});
+}
+
+TEST(ReferenceConvFwdAlgorithm, Fft)
+{
+    check_algorithm<1>(ConvFwdAlgorithm::Fft, {2, 2, 3, 2, {7}, {40}, {1}, {1}, {3}, {3}});
+    check_algorithm<1>(ConvFwdAlgorithm::Fft, {1, 1, 2, 3, {4}, {33}, {3}, {2}, {1}, {2}});
+    check_algorithm<2>(ConvFwdAlgorithm::Fft,
+                       {2, 1, 3, 4, {7, 5}, {17, 20}, {1, 1}, {1, 1}, {3, 2}, {3, 2}});
+    check_algorithm<2>(ConvFwdAlgorithm::Fft,
+                       {1, 2, 2, 2, {3, 3}, {15, 16}, {2, 1}, {2, 3}, {1, 0}, {0, 1}});
+    check_algorithm<2, ScaleShift, ScaleShift, ScaleShift>(
+        ConvFwdAlgorithm::Fft, {1, 1, 3, 2, {5, 5}, {9, 9}, {1, 1}, {1, 1}, {2, 2}, {2, 2}});
+    check_algorithm<3>(
+        ConvFwdAlgorithm::Fft,
+        {1, 2, 2, 3, {3, 2, 3}, {6, 7, 5}, {1, 2, 1}, {1, 1, 2}, {1, 0, 2}, {1, 1, 2}});
+}
+
+TEST(ReferenceConvFwdAlgorithm, SelectAlgorithm)
+{
+    auto select = [](const ConvProblem& problem) {
+        Tensor<float> input(problem.GetInputLengths());
+        Tensor<float> weight(problem.GetWeightLengths());
+        Tensor<float> output(problem.GetOutputLengths());
+
+        auto argument = ReferenceConvFwd<2>::MakeArgument(input,
+                                                          weight,
+                                                          output,
+                                                          problem.strides,
+                                                          problem.dilations,
+                                                          problem.left_pads,
+                                                          problem.right_pads,
+                                                          PassThrough{},
+                                                          PassThrough{},
+                                                          PassThrough{});
+
+        return ReferenceConvFwd<2>::Invoker::SelectAlgorithm(argument);
+    };
+
+    // small problem
+    EXPECT_EQ(select({2, 1, 8, 8, {3, 3}, {14, 14}, {1, 1}, {1, 1}, {1, 1}, {1, 1}}),
+              ConvFwdAlgorithm::Direct);
+    // large 3x3 and 5x5 of stride 1
+    EXPECT_EQ(select({8, 1, 64, 64, {3, 3}, {56, 56}, {1, 1}, {1, 1}, {1, 1}, {1, 1}}),
+              ConvFwdAlgorithm::Winograd);
+    EXPECT_EQ(select({8, 1, 32, 32, {5, 5}, {56, 56}, {1, 1}, {1, 1}, {2, 2}, {2, 2}}),
+              ConvFwdAlgorithm::Winograd);
+    // large filter
+    EXPECT_EQ(select({4, 1, 32, 32, {11, 11}, {64, 64}, {1, 1}, {1, 1}, {5, 5}, {5, 5}}),
+              ConvFwdAlgorithm::Fft);
+    // large 3x3 of stride 2, where FFT computes 4 times more outputs than needed
+    EXPECT_EQ(select({8, 1, 64, 64, {3, 3}, {112, 112}, {2, 2}, {1, 1}, {1, 1}, {1, 1}}),
+              ConvFwdAlgorithm::Direct);
+    // depthwise
+    EXPECT_EQ(select({8, 256, 1, 1, {3, 3}, {112, 112}, {1, 1}, {1, 1}, {1, 1}, {1, 1}}),
+              ConvFwdAlgorithm::Direct);
+}
+
+TEST(ReferenceConvFwdAlgorithm, WinogradNotApplicable)
+{
+    const ConvProblem problem{1, 1, 2, 2, {3, 3}, {9, 9}, {2, 2}, {1, 1}, {1, 1}, {1, 1}};
+
+    Tensor<float> input(problem.GetInputLengths());
+    Tensor<float> weight(problem.GetWeightLengths());
+    Tensor<float> output(problem.GetOutputLengths());
+
+    auto argument = ReferenceConvFwd<2>::MakeArgument(input,
+                                                      weight,
+                                                      output,
+                                                      problem.strides,
+                                                      problem.dilations,
+                                                      problem.left_pads,
+                                                      problem.right_pads,
+                                                      PassThrough{},
+                                                      PassThrough{},
+                                                      PassThrough{},
+                                                      ConvFwdAlgorithm::Winograd);
+
+    ReferenceConvFwd<2> ref_conv;
+
+    EXPECT_FALSE(ref_conv.IsSupportedArgument(&argument));
+    EXPECT_THROW(ReferenceConvFwd<2>::MakeInvoker().Run(argument), std::runtime_error);
+}
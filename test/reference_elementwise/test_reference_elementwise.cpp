@@ -0,0 +1,182 @@
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "binary_element_wise_operation.hpp"
+#include "host_tensor.hpp"
+#include "reference_elementwise.hpp"
+
+using Add = ck::tensor_operation::element_wise::Add;
+
+using ck::tensor_operation::host::ReferenceElementwise;
+
+namespace {
+
+struct Negate
+{
+    void operator()(float& y, const float& x) const { y = -x; }
+};
+
+// y = x0 * x1 + x2 * x3 - x4
+struct MultiplyAdd5
+{
+    void operator()(float& y,
+                    const float& x0,
+                    const float& x1,
+                    const float& x2,
+                    const float& x3,
+                    const float& x4) const
+    {
+        y = x0 * x1 + x2 * x3 - x4;
+    }
+};
+
+template <typename T>
+void fill(Tensor<T>& tensor, int seed)
+{
+    for(std::size_t i = 0; i < tensor.mData.size(); ++i)
+    {
+        tensor.mData[i] = static_cast<T>(static_cast<int>((i * 7 + seed) % 17) - 8);
+    }
+}
+
+} // namespace
+
+TEST(ReferenceElementwise, SameShape)
+{
+    // one contiguous dimension after merging, longer than a chunk of work
+    Tensor<float> a(std::vector<std::size_t>{3, 50, 70});
+    Tensor<float> b(std::vector<std::size_t>{3, 50, 70});
+    Tensor<float> c(std::vector<std::size_t>{3, 50, 70});
+
+    fill(a, 1);
+    fill(b, 2);
+
+    using ReferenceAdd = ReferenceElementwise<Add, float, float, float, float>;
+
+    auto argument = ReferenceAdd::MakeArgument({a, b}, c, Add{});
+
+    ReferenceAdd::MakeInvoker().Run(argument);
+
+    EXPECT_EQ(argument.lengths_, (std::vector<std::size_t>{3 * 50 * 70}));
+
+    for(std::size_t i = 0; i < c.mData.size(); ++i)
+    {
+        EXPECT_EQ(c.mData[i], a.mData[i] + b.mData[i]);
+    }
+}
+
+TEST(ReferenceElementwise, TrailingBroadcast)
+{
+    // b_n is broadcast along m, as in example/19_binary_elementwise/broadcast_add_2d_amn_bn
+    Tensor<float> a_m_n(std::vector<std::size_t>{37, 29});
+    Tensor<float> b_n(std::vector<std::size_t>{29});
+    Tensor<float> b_m_1(std::vector<std::size_t>{37, 1});
+    Tensor<float> c_m_n(std::vector<std::size_t>{37, 29});
+
+    fill(a_m_n, 3);
+    fill(b_n, 4);
+    fill(b_m_1, 5);
+
+    using ReferenceAdd = ReferenceElementwise<Add, float, float, float, float>;
+
+    ReferenceAdd::MakeInvoker().Run(ReferenceAdd::MakeArgument({a_m_n, b_n}, c_m_n, Add{}));
+
+    c_m_n.ForEach([&](auto& self, auto idx) {
+        EXPECT_EQ(self(idx), a_m_n(idx[0], idx[1]) + b_n(idx[1]));
+    });
+
+    ReferenceAdd::MakeInvoker().Run(ReferenceAdd::MakeArgument({a_m_n, b_m_1}, c_m_n, Add{}));
+
+    c_m_n.ForEach([&](auto& self, auto idx) {
+        EXPECT_EQ(self(idx), a_m_n(idx[0], idx[1]) + b_m_1(idx[0], 0));
+    });
+}
+
+TEST(ReferenceElementwise, ExplicitBroadcastStrides)
+{
+    // a_m is broadcast along n and k, as in example/19_binary_elementwise/broadcast_add_3d_am_bmnk
+    Tensor<float> a_m(std::vector<std::size_t>{4});
+    Tensor<float> b_m_n_k(std::vector<std::size_t>{4, 16, 32});
+    Tensor<float> c_m_n_k(std::vector<std::size_t>{4, 16, 32});
+
+    fill(a_m, 6);
+    fill(b_m_n_k, 7);
+
+    using ReferenceAdd = ReferenceElementwise<Add, float, float, float, float>;
+
+    auto argument = ReferenceAdd::MakeArgument({a_m, b_m_n_k}, c_m_n_k, Add{}, {{{1, 0, 0}, {}}});
+
+    ReferenceAdd::MakeInvoker().Run(argument);
+
+    // n and k are merged, and a is broadcast along them
+    EXPECT_EQ(argument.lengths_, (std::vector<std::size_t>{4, 16 * 32}));
+
+    c_m_n_k.ForEach([&](auto& self, auto idx) {
+        EXPECT_EQ(self(idx), a_m(idx[0]) + b_m_n_k(idx[0], idx[1], idx[2]));
+    });
+}
+
+TEST(ReferenceElementwise, StridedAndTypeConversion)
+{
+    // column-major output and half inputs, so the inner loop is strided and converts
+    Tensor<ck::half_t> a(std::vector<std::size_t>{9, 13});
+    Tensor<float> c(std::vector<std::size_t>{9, 13}, std::vector<std::size_t>{1, 9});
+
+    fill(a, 8);
+
+    using ReferenceNegate = ReferenceElementwise<Negate, float, float, ck::half_t>;
+
+    ReferenceNegate::MakeInvoker().Run(ReferenceNegate::MakeArgument({a}, c, Negate{}));
+
+    c.ForEach([&](auto& self, auto idx) {
+        EXPECT_EQ(self(idx), -ck::type_convert<float>(a(idx[0], idx[1])));
+    });
+}
+
+TEST(ReferenceElementwise, FiveInputs)
+{
+    // the inputs of a layernorm: x, mean and variance per row, and gamma and beta per column
+    Tensor<float> x_m_n(std::vector<std::size_t>{6, 10});
+    Tensor<float> mean_m(std::vector<std::size_t>{6});
+    Tensor<float> var_m(std::vector<std::size_t>{6});
+    Tensor<float> gamma_n(std::vector<std::size_t>{10});
+    Tensor<float> beta_n(std::vector<std::size_t>{10});
+    Tensor<float> y_m_n(std::vector<std::size_t>{6, 10});
+
+    fill(x_m_n, 9);
+    fill(mean_m, 10);
+    fill(var_m, 11);
+    fill(gamma_n, 12);
+    fill(beta_n, 13);
+
+    using Reference5Ary =
+        ReferenceElementwise<MultiplyAdd5, float, float, float, float, float, float, float>;
+
+    auto argument = Reference5Ary::MakeArgument({x_m_n, mean_m, var_m, gamma_n, beta_n},
+                                                y_m_n,
+                                                MultiplyAdd5{},
+                                                {{{}, {1, 0}, {1, 0}, {}, {}}});
+
+    Reference5Ary::MakeInvoker().Run(argument);
+
+    y_m_n.ForEach([&](auto& self, auto idx) {
+        const std::size_t m = idx[0];
+        const std::size_t n = idx[1];
+
+        EXPECT_EQ(self(idx), x_m_n(m, n) * mean_m(m) + var_m(m) * gamma_n(n) - beta_n(n));
+    });
+}
+
+TEST(ReferenceElementwise, InconsistentLengthsThrow)
+{
+    Tensor<float> a(std::vector<std::size_t>{4, 5});
+    Tensor<float> b(std::vector<std::size_t>{4});
+    Tensor<float> c(std::vector<std::size_t>{4, 5});
+
+    using ReferenceAdd = ReferenceElementwise<Add, float, float, float, float>;
+
+    EXPECT_NO_THROW(ReferenceAdd::MakeArgument({a, b}, c, Add{}, {{{}, {1, 0}}}));
+    EXPECT_THROW(ReferenceAdd::MakeArgument({a, b}, c, Add{}), std::runtime_error);
+    EXPECT_THROW(ReferenceAdd::MakeArgument({a, b}, c, Add{}, {{{}, {1}}}), std::runtime_error);
+}
@@ -0,0 +1,223 @@
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "element_wise_operation.hpp"
+#include "host_tensor.hpp"
+#include "reduction_operator.hpp"
+#include "reference_gemm.hpp"
+#include "reference_gemm_reduce.hpp"
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using UnarySquare = ck::tensor_operation::element_wise::UnarySquare;
+using UnaryDivide = ck::tensor_operation::element_wise::UnaryDivide;
+
+using DxsReduceOp      = ck::Tuple<ck::reduce::Add, ck::reduce::Add, ck::reduce::Max>;
+using DxsInElementOps  = ck::Tuple<PassThrough, UnarySquare, PassThrough>;
+using DxsOutElementOps = ck::Tuple<UnaryDivide, UnaryDivide, PassThrough>;
+
+using ReferenceGemmReduce = ck::tensor_operation::host::ReferenceGemmReduce<float,
+                                                                            float,
+                                                                            float,
+                                                                            float,
+                                                                            float,
+                                                                            float,
+                                                                            PassThrough,
+                                                                            PassThrough,
+                                                                            PassThrough,
+                                                                            DxsReduceOp,
+                                                                            DxsInElementOps,
+                                                                            DxsOutElementOps>;
+
+namespace {
+
+template <typename T>
+void fill(Tensor<T>& tensor, int seed)
+{
+    for(std::size_t i = 0; i < tensor.mData.size(); ++i)
+    {
+        tensor.mData[i] = static_cast<T>(static_cast<int>((i * 7 + seed) % 11) - 5);
+    }
+}
+
+// C by ReferenceGemm, and the mean, mean square and max of each row of C
+void gemm_then_reduce(const Tensor<float>& a_m_k,
+                      const Tensor<float>& b_k_n,
+                      Tensor<float>& c_m_n,
+                      std::vector<float>& d0_m,
+                      std::vector<float>& d1_m,
+                      std::vector<float>& d2_m)
+{
+    using ReferenceGemm = ck::tensor_operation::host::
+        ReferenceGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    auto argument =
+        ReferenceGemm::MakeArgument(a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, {});
+
+    ReferenceGemm::MakeInvoker().Run(argument);
+
+    const std::size_t M = c_m_n.mDesc.GetLengths()[0];
+    const std::size_t N = c_m_n.mDesc.GetLengths()[1];
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        float sum        = 0;
+        float square_sum = 0;
+        float max        = ck::NumericLimits<float>::Lowest();
+
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            sum += c_m_n(m, n);
+            square_sum += c_m_n(m, n) * c_m_n(m, n);
+            max = std::max(max, c_m_n(m, n));
+        }
+
+        d0_m.push_back(sum / N);
+        d1_m.push_back(square_sum / N);
+        d2_m.push_back(max);
+    }
+}
+
+} // namespace
+
+TEST(ReferenceGemmReduce, MatchesGemmThenReduce)
+{
+    const std::size_t M = 37;
+    const std::size_t N = 29;
+    const std::size_t K = 17;
+
+    // A row-major, B column-major
+    Tensor<float> a_m_k(std::vector<std::size_t>{M, K}, std::vector<std::size_t>{K, 1});
+    Tensor<float> b_k_n(std::vector<std::size_t>{K, N}, std::vector<std::size_t>{1, K});
+    Tensor<float> c_m_n(std::vector<std::size_t>{M, N});
+    Tensor<float> d0_m(std::vector<std::size_t>{M});
+    Tensor<float> d1_m(std::vector<std::size_t>{M});
+    Tensor<float> d2_m(std::vector<std::size_t>{M});
+
+    fill(a_m_k, 1);
+    fill(b_k_n, 2);
+
+    const auto dxs_out_element_ops = DxsOutElementOps{
+        UnaryDivide{static_cast<int>(N)}, UnaryDivide{static_cast<int>(N)}, PassThrough{}};
+
+    auto argument = ReferenceGemmReduce::MakeArgument(a_m_k,
+                                                      b_k_n,
+                                                      c_m_n,
+                                                      {&d0_m, &d1_m, &d2_m},
+                                                      PassThrough{},
+                                                      PassThrough{},
+                                                      PassThrough{},
+                                                      DxsInElementOps{},
+                                                      dxs_out_element_ops);
+
+    ReferenceGemmReduce::MakeInvoker().Run(argument);
+
+    Tensor<float> c_m_n_ref(std::vector<std::size_t>{M, N});
+    std::vector<float> d0_m_ref, d1_m_ref, d2_m_ref;
+
+    gemm_then_reduce(a_m_k, b_k_n, c_m_n_ref, d0_m_ref, d1_m_ref, d2_m_ref);
+
+    // same order of summation, so the results are identical
+    EXPECT_EQ(c_m_n.mData, c_m_n_ref.mData);
+    EXPECT_EQ(d0_m.mData, d0_m_ref);
+    EXPECT_EQ(d1_m.mData, d1_m_ref);
+    EXPECT_EQ(d2_m.mData, d2_m_ref);
+}
+
+TEST(ReferenceGemmReduce, BatchedWithEpilogue)
+{
+    const std::size_t G = 3;
+    const std::size_t M = 8;
+    const std::size_t N = 12;
+    const std::size_t K = 5;
+
+    Tensor<float> a_g_m_k(std::vector<std::size_t>{G, M, K});
+    Tensor<float> b_g_k_n(std::vector<std::size_t>{G, K, N});
+    Tensor<float> c_g_m_n(std::vector<std::size_t>{G, M, N});
+    Tensor<float> d0_g_m(std::vector<std::size_t>{G, M});
+    Tensor<float> d1_g_m(std::vector<std::size_t>{G, M});
+    Tensor<float> d2_g_m(std::vector<std::size_t>{G, M});
+    Tensor<float> bias_n(std::vector<std::size_t>{N});
+
+    fill(a_g_m_k, 3);
+    fill(b_g_k_n, 4);
+    fill(bias_n, 5);
+
+    const auto dxs_out_element_ops = DxsOutElementOps{
+        UnaryDivide{static_cast<int>(N)}, UnaryDivide{static_cast<int>(N)}, PassThrough{}};
+
+    auto argument = ReferenceGemmReduce::MakeArgument(
+        a_g_m_k,
+        b_g_k_n,
+        c_g_m_n,
+        {&d0_g_m, &d1_g_m, &d2_g_m},
+        PassThrough{},
+        PassThrough{},
+        PassThrough{},
+        DxsInElementOps{},
+        dxs_out_element_ops,
+        [&](float& c, float acc, std::size_t, std::size_t, std::size_t n) {
+            c = acc + bias_n(n);
+        });
+
+    ReferenceGemmReduce::MakeInvoker().Run(argument);
+
+    for(std::size_t g = 0; g < G; ++g)
+    {
+        Tensor<float> a_m_k(std::vector<std::size_t>{M, K});
+        Tensor<float> b_k_n(std::vector<std::size_t>{K, N});
+
+        a_m_k.ForEach([&](auto& self, auto idx) { self(idx) = a_g_m_k(g, idx[0], idx[1]); });
+        b_k_n.ForEach([&](auto& self, auto idx) { self(idx) = b_g_k_n(g, idx[0], idx[1]); });
+
+        Tensor<float> c_m_n(std::vector<std::size_t>{M, N});
+        std::vector<float> d0_m, d1_m, d2_m;
+
+        // the reductions are of C after the epilogue, so recompute them from C + bias
+        gemm_then_reduce(a_m_k, b_k_n, c_m_n, d0_m, d1_m, d2_m);
+
+        for(std::size_t m = 0; m < M; ++m)
+        {
+            float sum        = 0;
+            float square_sum = 0;
+            float max        = ck::NumericLimits<float>::Lowest();
+
+            for(std::size_t n = 0; n < N; ++n)
+            {
+                EXPECT_EQ(c_g_m_n(g, m, n), c_m_n(m, n) + bias_n(n));
+
+                sum += c_g_m_n(g, m, n);
+                square_sum += c_g_m_n(g, m, n) * c_g_m_n(g, m, n);
+                max = std::max(max, c_g_m_n(g, m, n));
+            }
+
+            EXPECT_EQ(d0_g_m(g, m), sum / N);
+            EXPECT_EQ(d1_g_m(g, m), square_sum / N);
+            EXPECT_EQ(d2_g_m(g, m), max);
+        }
+    }
+}
+
+TEST(ReferenceGemmReduce, InconsistentLengthsThrow)
+{
+    Tensor<float> a_m_k(std::vector<std::size_t>{4, 3});
+    Tensor<float> b_k_n(std::vector<std::size_t>{3, 5});
+    Tensor<float> c_m_n(std::vector<std::size_t>{4, 5});
+    Tensor<float> d_m(std::vector<std::size_t>{4});
+    Tensor<float> d_wrong(std::vector<std::size_t>{5});
+
+    auto make_argument = [&](Tensor<float>& d2) {
+        return ReferenceGemmReduce::MakeArgument(a_m_k,
+                                                 b_k_n,
+                                                 c_m_n,
+                                                 {&d_m, &d_m, &d2},
+                                                 PassThrough{},
+                                                 PassThrough{},
+                                                 PassThrough{},
+                                                 DxsInElementOps{},
+                                                 DxsOutElementOps{});
+    };
+
+    EXPECT_NO_THROW(make_argument(d_m));
+    EXPECT_THROW(make_argument(d_wrong), std::runtime_error);
+}
@@ -0,0 +1,377 @@
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "element_wise_operation.hpp"
+#include "host_tensor.hpp"
+#include "reference_conv_backward_weight.hpp"
+#include "reference_conv_bwd_data.hpp"
+#include "reference_conv_fwd.hpp"
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+template <ck::index_t NDim>
+using ReferenceConvFwd = ck::tensor_operation::host::
+    ReferenceConvFwd<float, float, float, PassThrough, PassThrough, PassThrough, NDim>;
+
+template <ck::index_t NDim>
+using ReferenceConvBwdData = ck::tensor_operation::host::
+    ReferenceConvBwdData<float, float, float, float, PassThrough, PassThrough, PassThrough, NDim>;
+
+template <ck::index_t NDim>
+using ReferenceConvBwdWeight = ck::tensor_operation::host::
+    ReferenceConvBwdWeight<float, float, float, PassThrough, PassThrough, PassThrough, NDim>;
+
+namespace {
+
+struct ConvShape
+{
+    std::vector<std::size_t> in_lengths;  // {N, C, Hi, Wi}
+    std::vector<std::size_t> wei_lengths; // {K, C / G, Y, X}
+    std::vector<std::size_t> out_lengths; // {N, K, Ho, Wo}
+    std::vector<ck::index_t> strides;
+    std::vector<ck::index_t> dilations;
+    std::vector<ck::index_t> left_pads;
+    std::vector<ck::index_t> right_pads;
+};
+
+ConvShape make_conv_shape(std::size_t N,
+                          std::size_t G,
+                          std::size_t C_per_group,
+                          std::size_t K_per_group,
+                          const std::vector<std::size_t>& filter_lengths,
+                          const std::vector<std::size_t>& in_spatial_lengths,
+                          ck::index_t stride,
+                          ck::index_t dilation,
+                          ck::index_t pad)
+{
+    const std::size_t ndim = filter_lengths.size();
+
+    ConvShape shape{{N, G * C_per_group},
+                    {G * K_per_group, C_per_group},
+                    {N, G * K_per_group},
+                    std::vector<ck::index_t>(ndim, stride),
+                    std::vector<ck::index_t>(ndim, dilation),
+                    std::vector<ck::index_t>(ndim, pad),
+                    std::vector<ck::index_t>(ndim, pad)};
+
+    for(std::size_t d = 0; d < ndim; ++d)
+    {
+        const std::size_t x_eff = (filter_lengths[d] - 1) * dilation + 1;
+
+        shape.in_lengths.push_back(in_spatial_lengths[d]);
+        shape.wei_lengths.push_back(filter_lengths[d]);
+        shape.out_lengths.push_back((in_spatial_lengths[d] + 2 * pad - x_eff) / stride + 1);
+    }
+
+    return shape;
+}
+
+// channels innermost, i.e. NHWC for lengths {N, C, H, W}, which is NHWGC for grouped channels
+HostTensorDescriptor make_channels_last_descriptor(const std::vector<std::size_t>& lengths)
+{
+    const std::size_t rank = lengths.size();
+
+    std::vector<std::size_t> strides(rank);
+
+    strides[1] = 1;
+
+    std::size_t stride = lengths[1];
+
+    for(std::size_t d = rank; d-- > 2;)
+    {
+        strides[d] = stride;
+        stride *= lengths[d];
+    }
+
+    strides[0] = stride;
+
+    return HostTensorDescriptor(lengths, strides);
+}
+
+void fill(Tensor<float>& tensor, int seed)
+{
+    tensor.ForEach([&](auto& self, auto idx) {
+        std::size_t i = seed;
+
+        for(auto x : idx)
+        {
+            i = i * 31 + x;
+        }
+
+        self(idx) = static_cast<float>(static_cast<int>(i % 13) - 6);
+    });
+}
+
+// channels [begin, begin + count) of a tensor, i.e. along dimension 1
+Tensor<float> slice_channels(const Tensor<float>& tensor, std::size_t begin, std::size_t count)
+{
+    std::vector<std::size_t> lengths = tensor.mDesc.GetLengths();
+
+    lengths[1] = count;
+
+    Tensor<float> slice(lengths);
+
+    slice.ForEach([&](auto& self, auto idx) {
+        auto src_idx = idx;
+
+        src_idx[1] += begin;
+
+        self(idx) = tensor(src_idx);
+    });
+
+    return slice;
+}
+
+// expects tensor[begin, begin + count) along the channels to equal slice
+void expect_channels_eq(const Tensor<float>& tensor,
+                        std::size_t begin,
+                        const Tensor<float>& slice,
+                        std::size_t g)
+{
+    slice.ForEach([&](auto& self, auto idx) {
+        auto dst_idx = idx;
+
+        dst_idx[1] += begin;
+
+        EXPECT_EQ(tensor(dst_idx), self(idx)) << "group " << g;
+    });
+}
+
+template <ck::index_t NDim>
+void check_grouped_conv(std::size_t G, const ConvShape& shape)
+{
+    const std::size_t C = shape.in_lengths[1] / G;
+    const std::size_t K = shape.out_lengths[1] / G;
+
+    Tensor<float> input(make_channels_last_descriptor(shape.in_lengths));
+    Tensor<float> weight(make_channels_last_descriptor(shape.wei_lengths));
+    Tensor<float> output(make_channels_last_descriptor(shape.out_lengths));
+    Tensor<float> in_grad(make_channels_last_descriptor(shape.in_lengths));
+    Tensor<float> wei_grad(make_channels_last_descriptor(shape.wei_lengths));
+
+    fill(input, 1);
+    fill(weight, 2);
+
+    auto fwd_argument = ReferenceConvFwd<NDim>::MakeArgument(input,
+                                                             weight,
+                                                             output,
+                                                             shape.strides,
+                                                             shape.dilations,
+                                                             shape.left_pads,
+                                                             shape.right_pads,
+                                                             PassThrough{},
+                                                             PassThrough{},
+                                                             PassThrough{});
+
+    ReferenceConvFwd<NDim>::MakeInvoker().Run(fwd_argument);
+
+    // output gradient
+    fill(output, 3);
+
+    auto bwd_data_argument = ReferenceConvBwdData<NDim>::MakeArgument(in_grad,
+                                                                      weight,
+                                                                      output,
+                                                                      shape.strides,
+                                                                      shape.dilations,
+                                                                      shape.left_pads,
+                                                                      shape.right_pads,
+                                                                      PassThrough{},
+                                                                      PassThrough{},
+                                                                      PassThrough{});
+
+    ReferenceConvBwdData<NDim>::MakeInvoker().Run(bwd_data_argument);
+
+    auto bwd_weight_argument = ReferenceConvBwdWeight<NDim>::MakeArgument(input,
+                                                                          wei_grad,
+                                                                          output,
+                                                                          shape.strides,
+                                                                          shape.dilations,
+                                                                          shape.left_pads,
+                                                                          shape.right_pads,
+                                                                          PassThrough{},
+                                                                          PassThrough{},
+                                                                          PassThrough{});
+
+    ReferenceConvBwdWeight<NDim>::MakeInvoker().Run(bwd_weight_argument);
+
+    // each group is an ordinary convolution of its channels
+    Tensor<float> output_ref(shape.out_lengths);
+
+    fill(output_ref, 3);
+
+    for(std::size_t g = 0; g < G; ++g)
+    {
+        auto input_g    = slice_channels(input, g * C, C);
+        auto out_grad_g = slice_channels(output_ref, g * K, K);
+
+        // the weights of group g are those of its K output channels
+        std::vector<std::size_t> wei_lengths_g = shape.wei_lengths;
+
+        wei_lengths_g[0] = K;
+
+        Tensor<float> weight_g_k(wei_lengths_g);
+
+        weight_g_k.ForEach([&](auto& self, auto idx) {
+            auto src_idx = idx;
+
+            src_idx[0] += g * K;
+
+            self(idx) = weight(src_idx);
+        });
+
+        Tensor<float> output_g(out_grad_g.mDesc);
+        Tensor<float> in_grad_g(input_g.mDesc);
+        Tensor<float> wei_grad_g(weight_g_k.mDesc);
+
+        auto fwd_argument_g = ReferenceConvFwd<NDim>::MakeArgument(input_g,
+                                                                   weight_g_k,
+                                                                   output_g,
+                                                                   shape.strides,
+                                                                   shape.dilations,
+                                                                   shape.left_pads,
+                                                                   shape.right_pads,
+                                                                   PassThrough{},
+                                                                   PassThrough{},
+                                                                   PassThrough{});
+
+        ReferenceConvFwd<NDim>::MakeInvoker().Run(fwd_argument_g);
+
+        // the forward output was overwritten by the output gradient, so compare with ComputeAt
+        output_g.ForEach([&](auto& self, auto idx) {
+            auto dst_idx = idx;
+
+            dst_idx[1] += g * K;
+
+            EXPECT_EQ(ReferenceConvFwd<NDim>::Invoker::ComputeAt(fwd_argument, dst_idx),
+                      self(idx))
+                << "group " << g;
+        });
+
+        auto bwd_data_argument_g = ReferenceConvBwdData<NDim>::MakeArgument(in_grad_g,
+                                                                            weight_g_k,
+                                                                            out_grad_g,
+                                                                            shape.strides,
+                                                                            shape.dilations,
+                                                                            shape.left_pads,
+                                                                            shape.right_pads,
+                                                                            PassThrough{},
+                                                                            PassThrough{},
+                                                                            PassThrough{});
+
+        ReferenceConvBwdData<NDim>::MakeInvoker().Run(bwd_data_argument_g);
+
+        expect_channels_eq(in_grad, g * C, in_grad_g, g);
+
+        auto bwd_weight_argument_g = ReferenceConvBwdWeight<NDim>::MakeArgument(input_g,
+                                                                                wei_grad_g,
+                                                                                out_grad_g,
+                                                                                shape.strides,
+                                                                                shape.dilations,
+                                                                                shape.left_pads,
+                                                                                shape.right_pads,
+                                                                                PassThrough{},
+                                                                                PassThrough{},
+                                                                                PassThrough{});
+
+        ReferenceConvBwdWeight<NDim>::MakeInvoker().Run(bwd_weight_argument_g);
+
+        wei_grad_g.ForEach([&](auto& self, auto idx) {
+            auto dst_idx = idx;
+
+            dst_idx[0] += g * K;
+
+            EXPECT_EQ(wei_grad(dst_idx), self(idx)) << "group " << g;
+        });
+    }
+}
+
+template <ck::index_t NDim>
+void check_depthwise_conv_fwd(const ConvShape& shape)
+{
+    Tensor<float> input(make_channels_last_descriptor(shape.in_lengths));
+    Tensor<float> weight(make_channels_last_descriptor(shape.wei_lengths));
+    Tensor<float> output(make_channels_last_descriptor(shape.out_lengths));
+
+    fill(input, 4);
+    fill(weight, 5);
+
+    auto argument = ReferenceConvFwd<NDim>::MakeArgument(input,
+                                                         weight,
+                                                         output,
+                                                         shape.strides,
+                                                         shape.dilations,
+                                                         shape.left_pads,
+                                                         shape.right_pads,
+                                                         PassThrough{},
+                                                         PassThrough{},
+                                                         PassThrough{});
+
+    ReferenceConvFwd<NDim>::MakeInvoker().Run(argument);
+
+    // ComputeAt() is the general path, which sums in the same order
+    output.ForEach([&](auto& self, auto idx) {
+        EXPECT_EQ(self(idx), ReferenceConvFwd<NDim>::Invoker::ComputeAt(argument, idx));
+    });
+}
+
+} // namespace
+
+TEST(ReferenceGroupedConv, Grouped1D)
+{
+    check_grouped_conv<1>(3, make_conv_shape(2, 3, 2, 4, {3}, {17}, 2, 1, 1));
+}
+
+TEST(ReferenceGroupedConv, Grouped2D)
+{
+    check_grouped_conv<2>(4, make_conv_shape(2, 4, 3, 2, {3, 2}, {9, 8}, 1, 2, 1));
+}
+
+TEST(ReferenceGroupedConv, Grouped3D)
+{
+    check_grouped_conv<3>(2, make_conv_shape(1, 2, 2, 3, {2, 3, 2}, {5, 6, 7}, 2, 1, 1));
+}
+
+TEST(ReferenceGroupedConv, DepthwiseFwd)
+{
+    // C = K = G, e.g. the depthwise convolutions of MobileNet
+    check_depthwise_conv_fwd<1>(make_conv_shape(2, 19, 1, 1, {5}, {23}, 2, 2, 2));
+    check_depthwise_conv_fwd<2>(make_conv_shape(2, 32, 1, 1, {3, 3}, {14, 13}, 1, 1, 1));
+    check_depthwise_conv_fwd<2>(make_conv_shape(1, 24, 1, 1, {3, 3}, {15, 15}, 2, 1, 0));
+    check_depthwise_conv_fwd<3>(make_conv_shape(1, 8, 1, 1, {3, 3, 3}, {6, 7, 5}, 1, 2, 2));
+
+    // the dedicated path also matches the ordinary convolution of each channel
+    check_grouped_conv<2>(16, make_conv_shape(2, 16, 1, 1, {3, 3}, {10, 9}, 2, 1, 1));
+}
+
+TEST(ReferenceGroupedConv, InconsistentGroupsThrow)
+{
+    const ConvShape shape = make_conv_shape(1, 2, 3, 2, {3}, {8}, 1, 1, 0);
+
+    Tensor<float> input(shape.in_lengths);
+    Tensor<float> output(shape.out_lengths);
+
+    auto make_argument = [&](const Tensor<float>& weight) {
+        return ReferenceConvFwd<1>::MakeArgument(input,
+                                                 weight,
+                                                 output,
+                                                 shape.strides,
+                                                 shape.dilations,
+                                                 shape.left_pads,
+                                                 shape.right_pads,
+                                                 PassThrough{},
+                                                 PassThrough{},
+                                                 PassThrough{});
+    };
+
+    // C = 6 over channels of 3 is 2 groups, and K = 4 over 2 groups is 2 channels each
+    EXPECT_NO_THROW(make_argument(Tensor<float>(std::vector<std::size_t>{4, 3, 3})));
+
+    // C = 6 is not a multiple of 4
+    EXPECT_THROW(make_argument(Tensor<float>(std::vector<std::size_t>{4, 4, 3})),
+                 std::runtime_error);
+
+    // C = 6 over channels of 1 is 6 groups, but K = 4 is not a multiple of 6
+    EXPECT_THROW(make_argument(Tensor<float>(std::vector<std::size_t>{4, 1, 3})),
+                 std::runtime_error);
+}
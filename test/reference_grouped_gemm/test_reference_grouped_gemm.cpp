@@ -0,0 +1,151 @@
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "device_gemm.hpp"
+#include "element_wise_operation.hpp"
+#include "host_tensor.hpp"
+#include "reference_gemm.hpp"
+#include "reference_grouped_gemm.hpp"
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using GemmShape   = ck::tensor_operation::device::GemmShape;
+
+using ReferenceGemm = ck::tensor_operation::host::
+    ReferenceGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+using ReferenceGroupedGemm = ck::tensor_operation::host::
+    ReferenceGroupedGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+namespace {
+
+template <typename T>
+void fill(Tensor<T>& tensor, int seed)
+{
+    for(std::size_t i = 0; i < tensor.mData.size(); ++i)
+    {
+        tensor.mData[i] = static_cast<T>(static_cast<int>((i * 7 + seed) % 11) - 5);
+    }
+}
+
+// A row-major, B column-major and C row-major, as in example/15_grouped_gemm
+struct GroupedGemmTensors
+{
+    explicit GroupedGemmTensors(const std::vector<GemmShape>& gemm_shapes)
+    {
+        for(const auto& shape : gemm_shapes)
+        {
+            const std::size_t M = shape.M;
+            const std::size_t N = shape.N;
+            const std::size_t K = shape.K;
+
+            a_g_m_k.emplace_back(std::vector<std::size_t>{M, K},
+                                 std::vector<std::size_t>{std::size_t(shape.StrideA), 1});
+            b_g_k_n.emplace_back(std::vector<std::size_t>{K, N},
+                                 std::vector<std::size_t>{1, std::size_t(shape.StrideB)});
+            c_g_m_n.emplace_back(std::vector<std::size_t>{M, N},
+                                 std::vector<std::size_t>{std::size_t(shape.StrideC), 1});
+
+            fill(a_g_m_k.back(), a_g_m_k.size());
+            fill(b_g_k_n.back(), b_g_k_n.size() + 3);
+        }
+    }
+
+    std::vector<Tensor<float>> a_g_m_k;
+    std::vector<Tensor<float>> b_g_k_n;
+    std::vector<Tensor<float>> c_g_m_n;
+};
+
+void check_grouped_gemm(const std::vector<GemmShape>& gemm_shapes, std::size_t num_thread)
+{
+    GroupedGemmTensors tensors(gemm_shapes);
+
+    auto argument = ReferenceGroupedGemm::MakeArgument(gemm_shapes,
+                                                       tensors.a_g_m_k,
+                                                       tensors.b_g_k_n,
+                                                       tensors.c_g_m_n,
+                                                       PassThrough{},
+                                                       PassThrough{},
+                                                       PassThrough{});
+
+    ReferenceGroupedGemm::MakeInvoker().Run(argument, num_thread);
+
+    for(std::size_t g = 0; g < gemm_shapes.size(); ++g)
+    {
+        Tensor<float> c_m_n(tensors.c_g_m_n[g].mDesc);
+
+        auto ref_argument = ReferenceGemm::MakeArgument(tensors.a_g_m_k[g],
+                                                        tensors.b_g_k_n[g],
+                                                        c_m_n,
+                                                        PassThrough{},
+                                                        PassThrough{},
+                                                        PassThrough{});
+
+        ReferenceGemm::MakeInvoker().Run(ref_argument);
+
+        // same order of summation, so the results are identical
+        EXPECT_EQ(tensors.c_g_m_n[g].mData, c_m_n.mData) << "group " << g;
+    }
+}
+
+} // namespace
+
+TEST(ReferenceGroupedGemm, ManySmallGroups)
+{
+    std::vector<GemmShape> gemm_shapes;
+
+    for(int g = 0; g < 200; ++g)
+    {
+        const int M = 1 + g % 5;
+        const int N = 1 + g % 7;
+        const int K = 1 + g % 3;
+
+        gemm_shapes.push_back({M, N, K, K, K, N});
+    }
+
+    check_grouped_gemm(gemm_shapes, 4);
+}
+
+TEST(ReferenceGroupedGemm, OneLargeGroup)
+{
+    // the tiles of the large group are stolen by the threads done with the small ones
+    const std::vector<GemmShape> gemm_shapes{
+        {2, 3, 4, 4, 4, 3}, {130, 97, 33, 40, 33, 100}, {0, 5, 3, 3, 3, 5}, {1, 1, 1, 1, 1, 1}};
+
+    check_grouped_gemm(gemm_shapes, 1);
+    check_grouped_gemm(gemm_shapes, 3);
+    check_grouped_gemm(gemm_shapes, 64);
+}
+
+TEST(ReferenceGroupedGemm, InconsistentShapesThrow)
+{
+    const std::vector<GemmShape> gemm_shapes{{4, 5, 3, 3, 3, 5}, {6, 2, 7, 7, 7, 2}};
+
+    GroupedGemmTensors tensors(gemm_shapes);
+
+    auto make_argument = [&](const std::vector<GemmShape>& shapes) {
+        return ReferenceGroupedGemm::MakeArgument(shapes,
+                                                  tensors.a_g_m_k,
+                                                  tensors.b_g_k_n,
+                                                  tensors.c_g_m_n,
+                                                  PassThrough{},
+                                                  PassThrough{},
+                                                  PassThrough{});
+    };
+
+    EXPECT_NO_THROW(make_argument(gemm_shapes));
+    EXPECT_THROW(make_argument({gemm_shapes[0]}), std::runtime_error);
+    EXPECT_THROW(make_argument({gemm_shapes[0], {6, 2, 7, 8, 7, 2}}), std::runtime_error);
+    EXPECT_THROW(make_argument({gemm_shapes[0], {6, 3, 7, 7, 7, 3}}), std::runtime_error);
+
+    // without shapes, only the lengths are checked
+    tensors.c_g_m_n.pop_back();
+
+    EXPECT_THROW(ReferenceGroupedGemm::MakeArgument(tensors.a_g_m_k,
+                                                    tensors.b_g_k_n,
+                                                    tensors.c_g_m_n,
+                                                    PassThrough{},
+                                                    PassThrough{},
+                                                    PassThrough{}),
+                 std::runtime_error);
+}
@@ -0,0 +1,135 @@
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "host_tensor.hpp"
+#include "reference_integer_gemm.hpp"
+
+namespace {
+
+// same as the epilogue of example/14_gemm_xdl_requant_relu_requant
+struct RequantReluRequant
+{
+    void operator()(float& y, const float& x) const
+    {
+        float gemm_requant = scale_gemm_ * x;
+        float relu         = gemm_requant > 0 ? gemm_requant : 0;
+        float relu_requant = scale_relu_ * relu;
+        y                  = relu_requant > 127 ? 127 : relu_requant < -128 ? -128 : relu_requant;
+    }
+
+    float scale_gemm_;
+    float scale_relu_;
+};
+
+struct PassThroughFloat
+{
+    void operator()(float& y, const float& x) const { y = x; }
+};
+
+template <typename T>
+void fill(Tensor<T>& tensor, int seed)
+{
+    for(std::size_t i = 0; i < tensor.mData.size(); ++i)
+    {
+        tensor.mData[i] = static_cast<T>(static_cast<int>((i * 37 + seed * 11) % 256) - 128);
+    }
+}
+
+// A row-major, B column-major, as in the example
+template <typename CElementwiseOperation, typename CDataType>
+void check_integer_gemm(std::size_t M,
+                        std::size_t N,
+                        std::size_t K,
+                        CElementwiseOperation c_element_op,
+                        std::vector<float> scale_n = {})
+{
+    using ReferenceIntegerGemm = ck::tensor_operation::host::
+        ReferenceIntegerGemm<int8_t, int8_t, CDataType, int32_t, float, CElementwiseOperation>;
+
+    Tensor<int8_t> a_m_k(std::vector<std::size_t>{M, K});
+    Tensor<int8_t> b_k_n(std::vector<std::size_t>{K, N}, std::vector<std::size_t>{1, K});
+    Tensor<CDataType> c_m_n(std::vector<std::size_t>{M, N});
+
+    fill(a_m_k, 1);
+    fill(b_k_n, 2);
+
+    auto argument = ReferenceIntegerGemm::MakeArgument(a_m_k, b_k_n, c_m_n, c_element_op, scale_n);
+
+    ReferenceIntegerGemm::MakeInvoker().Run(argument);
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            int64_t v_acc = 0;
+
+            for(std::size_t k = 0; k < K; ++k)
+            {
+                v_acc += int64_t{a_m_k(m, k)} * int64_t{b_k_n(k, n)};
+            }
+
+            float v_c = static_cast<float>(v_acc);
+
+            if(!scale_n.empty())
+            {
+                v_c = scale_n[n] * v_c;
+            }
+
+            float v_out;
+
+            c_element_op(v_out, v_c);
+
+            ASSERT_EQ(c_m_n(m, n), static_cast<CDataType>(v_out)) << "m " << m << ", n " << n;
+            ASSERT_EQ(c_m_n(m, n), ReferenceIntegerGemm::Invoker::ComputeAt(argument, m, n));
+        }
+    }
+}
+
+} // namespace
+
+TEST(ReferenceIntegerGemm, ExactAccumulation)
+{
+    // K is not a multiple of 4 and N is not a multiple of the panel width, and the sums need
+    // more than the 24 bits of the mantissa of float
+    check_integer_gemm<PassThroughFloat, float>(5, 70, 1, PassThroughFloat{});
+    check_integer_gemm<PassThroughFloat, float>(7, 129, 1023, PassThroughFloat{});
+}
+
+TEST(ReferenceIntegerGemm, RequantReluRequant)
+{
+    check_integer_gemm<RequantReluRequant, int8_t>(33, 65, 67, RequantReluRequant{0.003f, 1});
+    check_integer_gemm<RequantReluRequant, int8_t>(16, 128, 256, RequantReluRequant{0.0001f, 2});
+}
+
+TEST(ReferenceIntegerGemm, PerChannelScale)
+{
+    std::vector<float> scale_n(65);
+
+    for(std::size_t n = 0; n < scale_n.size(); ++n)
+    {
+        scale_n[n] = 0.0005f * (n % 7 + 1);
+    }
+
+    check_integer_gemm<RequantReluRequant, int8_t>(9, 65, 130, RequantReluRequant{1, 1}, scale_n);
+}
+
+TEST(ReferenceIntegerGemm, InconsistentLengthsThrow)
+{
+    using ReferenceIntegerGemm = ck::tensor_operation::host::
+        ReferenceIntegerGemm<int8_t, int8_t, int8_t, int32_t, float, RequantReluRequant>;
+
+    Tensor<int8_t> a_m_k(std::vector<std::size_t>{4, 3});
+    Tensor<int8_t> b_k_n(std::vector<std::size_t>{3, 5});
+    Tensor<int8_t> b_wrong(std::vector<std::size_t>{2, 5});
+    Tensor<int8_t> c_m_n(std::vector<std::size_t>{4, 5});
+
+    const auto c_element_op = RequantReluRequant{1, 1};
+
+    EXPECT_NO_THROW(ReferenceIntegerGemm::MakeArgument(a_m_k, b_k_n, c_m_n, c_element_op));
+    EXPECT_THROW(ReferenceIntegerGemm::MakeArgument(a_m_k, b_wrong, c_m_n, c_element_op),
+                 std::runtime_error);
+    EXPECT_THROW(ReferenceIntegerGemm::MakeArgument(a_m_k, b_k_n, c_m_n, c_element_op, {1, 2}),
+                 std::runtime_error);
+}
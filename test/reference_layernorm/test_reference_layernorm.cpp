@@ -0,0 +1,347 @@
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "element_wise_operation.hpp"
+#include "host_tensor.hpp"
+#include "reference_gemm.hpp"
+#include "reference_gemm_layernorm.hpp"
+#include "reference_layernorm.hpp"
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using ReferenceLayernorm =
+    ck::tensor_operation::host::ReferenceLayernorm<float, float, float, float, float>;
+using ReferenceRmsnorm =
+    ck::tensor_operation::host::ReferenceRmsnorm<float, float, float, float, float>;
+
+namespace {
+
+void fill(Tensor<float>& tensor, int seed, float offset = 0)
+{
+    for(std::size_t i = 0; i < tensor.mData.size(); ++i)
+    {
+        tensor.mData[i] =
+            offset + static_cast<float>(static_cast<int>((i * 7 + seed) % 13) - 6) / 4;
+    }
+}
+
+// two-pass normalization in double precision, over the rows given by the dimensions not in
+// norm_dims
+Tensor<float> naive_norm(const Tensor<float>& x,
+                         const Tensor<float>* p_residual,
+                         const Tensor<float>* p_gamma,
+                         const Tensor<float>* p_beta,
+                         const std::vector<ck::index_t>& norm_dims,
+                         double epsilon,
+                         bool is_rms)
+{
+    const std::size_t rank = x.mDesc.GetNumOfDimension();
+
+    auto split = [&](const std::vector<std::size_t>& idx) {
+        std::vector<std::size_t> row_idx;
+        std::vector<std::size_t> norm_idx;
+
+        for(std::size_t d = 0; d < rank; ++d)
+        {
+            if(std::find(norm_dims.begin(), norm_dims.end(), d) == norm_dims.end())
+            {
+                row_idx.push_back(idx[d]);
+            }
+        }
+
+        for(auto d : norm_dims)
+        {
+            norm_idx.push_back(idx[d]);
+        }
+
+        return std::make_pair(row_idx, norm_idx);
+    };
+
+    auto h = [&](const std::vector<std::size_t>& idx) {
+        return static_cast<double>(x(idx)) + (p_residual ? (*p_residual)(idx) : 0.);
+    };
+
+    std::map<std::vector<std::size_t>, double> sums;
+    std::map<std::vector<std::size_t>, double> square_sums;
+    std::map<std::vector<std::size_t>, double> counts;
+
+    x.ForEach([&](auto&, auto idx) {
+        sums[split(idx).first] += h(idx);
+        counts[split(idx).first] += 1;
+    });
+
+    x.ForEach([&](auto&, auto idx) {
+        const auto row_idx = split(idx).first;
+        const double d     = h(idx) - (is_rms ? 0. : sums[row_idx] / counts[row_idx]);
+
+        square_sums[row_idx] += d * d;
+    });
+
+    Tensor<float> y(x.mDesc);
+
+    y.ForEach([&](auto& self, auto idx) {
+        const auto [row_idx, norm_idx] = split(idx);
+
+        const double center = is_rms ? 0. : sums[row_idx] / counts[row_idx];
+        const double gamma  = p_gamma ? (*p_gamma)(norm_idx) : 1.;
+        const double beta   = p_beta ? (*p_beta)(norm_idx) : 0.;
+
+        const double variance = square_sums[row_idx] / counts[row_idx];
+
+        self(idx) = (h(idx) - center) / std::sqrt(variance + epsilon) * gamma + beta;
+    });
+
+    return y;
+}
+
+// compares by index, so that out and ref may have different strides
+void expect_near(const Tensor<float>& out, const Tensor<float>& ref, double tol)
+{
+    ASSERT_EQ(out.mDesc.GetLengths(), ref.mDesc.GetLengths());
+
+    out.ForEach([&](auto& self, auto idx) {
+        EXPECT_NEAR(self(idx), ref(idx), tol) << "at " << out.mDesc.GetOffsetFromMultiIndex(idx);
+    });
+}
+
+} // namespace
+
+TEST(ReferenceLayernorm, LastDimension)
+{
+    Tensor<float> x(std::vector<std::size_t>{17, 33});
+    Tensor<float> gamma(std::vector<std::size_t>{33});
+    Tensor<float> beta(std::vector<std::size_t>{33});
+    Tensor<float> y(x.mDesc);
+
+    fill(x, 1);
+    fill(gamma, 2);
+    fill(beta, 3);
+
+    auto argument = ReferenceLayernorm::MakeArgument(x, &gamma, &beta, y, {1}, 1e-5f);
+
+    ReferenceLayernorm::MakeInvoker().Run(argument);
+
+    expect_near(y, naive_norm(x, nullptr, &gamma, &beta, {1}, 1e-5, false), 1e-5);
+}
+
+TEST(ReferenceLayernorm, ArbitraryDimensions)
+{
+    // NCHW normalized over CHW, as by a group norm of 1 group, and over N and H only, with
+    // transposed strides
+    Tensor<float> x(std::vector<std::size_t>{3, 4, 5, 6});
+    Tensor<float> y(x.mDesc);
+
+    fill(x, 4);
+
+    Tensor<float> gamma_chw(std::vector<std::size_t>{4, 5, 6});
+
+    fill(gamma_chw, 5);
+
+    auto argument = ReferenceLayernorm::MakeArgument(x, &gamma_chw, nullptr, y, {1, 2, 3}, 1e-5f);
+
+    ReferenceLayernorm::MakeInvoker().Run(argument);
+
+    expect_near(y, naive_norm(x, nullptr, &gamma_chw, nullptr, {1, 2, 3}, 1e-5, false), 1e-5);
+
+    Tensor<float> x_t(std::vector<std::size_t>{3, 4, 5, 6}, std::vector<std::size_t>{1, 3, 12, 60});
+    Tensor<float> y_t(std::vector<std::size_t>{3, 4, 5, 6});
+    Tensor<float> beta_nh(std::vector<std::size_t>{3, 5});
+
+    fill(x_t, 6);
+    fill(beta_nh, 7);
+
+    auto argument_t =
+        ReferenceLayernorm::MakeArgument(x_t, nullptr, &beta_nh, y_t, {0, 2}, 1e-5f);
+
+    ReferenceLayernorm::MakeInvoker().Run(argument_t);
+
+    expect_near(y_t, naive_norm(x_t, nullptr, nullptr, &beta_nh, {0, 2}, 1e-5, false), 1e-5);
+}
+
+TEST(ReferenceLayernorm, ResidualAdd)
+{
+    Tensor<float> x(std::vector<std::size_t>{9, 40});
+    Tensor<float> residual(x.mDesc);
+    Tensor<float> gamma(std::vector<std::size_t>{40});
+    Tensor<float> beta(std::vector<std::size_t>{40});
+    Tensor<float> sum(x.mDesc);
+    Tensor<float> y(x.mDesc);
+
+    fill(x, 1);
+    fill(residual, 8, 2.f);
+    fill(gamma, 2);
+    fill(beta, 3);
+
+    auto argument =
+        ReferenceLayernorm::MakeArgument(x, residual, &gamma, &beta, y, &sum, {1}, 1e-5f);
+
+    ReferenceLayernorm::MakeInvoker().Run(argument);
+
+    expect_near(y, naive_norm(x, &residual, &gamma, &beta, {1}, 1e-5, false), 1e-5);
+
+    for(std::size_t i = 0; i < x.mData.size(); ++i)
+    {
+        EXPECT_EQ(sum.mData[i], x.mData[i] + residual.mData[i]) << "at " << i;
+    }
+
+    // the sum is optional
+    auto argument_no_sum =
+        ReferenceLayernorm::MakeArgument(x, residual, &gamma, &beta, y, nullptr, {1}, 1e-5f);
+
+    ReferenceLayernorm::MakeInvoker().Run(argument_no_sum);
+
+    expect_near(y, naive_norm(x, &residual, &gamma, &beta, {1}, 1e-5, false), 1e-5);
+}
+
+TEST(ReferenceRmsnorm, Rmsnorm)
+{
+    Tensor<float> x(std::vector<std::size_t>{2, 6, 25});
+    Tensor<float> residual(x.mDesc);
+    Tensor<float> gamma(std::vector<std::size_t>{25});
+    Tensor<float> y(x.mDesc);
+
+    fill(x, 3, 1.f);
+    fill(residual, 9);
+    fill(gamma, 2);
+
+    auto argument = ReferenceRmsnorm::MakeArgument(x, &gamma, nullptr, y, {2}, 1e-6f);
+
+    ReferenceRmsnorm::MakeInvoker().Run(argument);
+
+    expect_near(y, naive_norm(x, nullptr, &gamma, nullptr, {2}, 1e-6, true), 1e-5);
+
+    auto argument_residual =
+        ReferenceRmsnorm::MakeArgument(x, residual, &gamma, nullptr, y, nullptr, {2}, 1e-6f);
+
+    ReferenceRmsnorm::MakeInvoker().Run(argument_residual);
+
+    expect_near(y, naive_norm(x, &residual, &gamma, nullptr, {2}, 1e-6, true), 1e-5);
+}
+
+TEST(ReferenceLayernorm, LargeMean)
+{
+    // E[x^2] - E[x]^2 in float loses all the digits of a variance of about 1 around a mean of
+    // 3000, Welford does not
+    Tensor<float> x(std::vector<std::size_t>{4, 4096});
+    Tensor<float> y(x.mDesc);
+
+    fill(x, 1, 3000.f);
+
+    auto argument = ReferenceLayernorm::MakeArgument(x, nullptr, nullptr, y, {1}, 0.f);
+
+    ReferenceLayernorm::MakeInvoker().Run(argument);
+
+    expect_near(y, naive_norm(x, nullptr, nullptr, nullptr, {1}, 0., false), 1e-3);
+}
+
+TEST(ReferenceLayernorm, InvalidArgumentsThrow)
+{
+    Tensor<float> x(std::vector<std::size_t>{4, 8});
+    Tensor<float> y(x.mDesc);
+    Tensor<float> y_wrong(std::vector<std::size_t>{8, 4});
+    Tensor<float> gamma_wrong(std::vector<std::size_t>{4});
+
+    EXPECT_THROW(ReferenceLayernorm::MakeArgument(x, nullptr, nullptr, y_wrong, {1}, 1e-5f),
+                 std::runtime_error);
+    EXPECT_THROW(ReferenceLayernorm::MakeArgument(x, &gamma_wrong, nullptr, y, {1}, 1e-5f),
+                 std::runtime_error);
+    EXPECT_THROW(ReferenceLayernorm::MakeArgument(x, nullptr, nullptr, y, {2}, 1e-5f),
+                 std::runtime_error);
+    EXPECT_THROW(ReferenceLayernorm::MakeArgument(x, nullptr, nullptr, y, {1, 1}, 1e-5f),
+                 std::runtime_error);
+    EXPECT_THROW(
+        ReferenceLayernorm::MakeArgument(x, y_wrong, nullptr, nullptr, y, nullptr, {1}, 1e-5f),
+        std::runtime_error);
+}
+
+TEST(ReferenceGemmLayernorm, MatchesGemmThenLayernorm)
+{
+    using ReferenceGemm = ck::tensor_operation::host::
+        ReferenceGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+    using ReferenceGemmLayernorm =
+        ck::tensor_operation::host::ReferenceGemmLayernorm<float,
+                                                           float,
+                                                           float,
+                                                           float,
+                                                           float,
+                                                           float,
+                                                           float,
+                                                           PassThrough,
+                                                           PassThrough,
+                                                           PassThrough>;
+
+    const std::size_t M = 37;
+    const std::size_t N = 29;
+    const std::size_t K = 19;
+
+    Tensor<float> a_m_k(std::vector<std::size_t>{M, K});
+    Tensor<float> b_k_n(std::vector<std::size_t>{K, N}, std::vector<std::size_t>{1, K});
+    Tensor<float> gamma_n(std::vector<std::size_t>{N});
+    Tensor<float> beta_n(std::vector<std::size_t>{N});
+    Tensor<float> bias_n(std::vector<std::size_t>{N});
+
+    fill(a_m_k, 1);
+    fill(b_k_n, 2);
+    fill(gamma_n, 3);
+    fill(beta_n, 4);
+    fill(bias_n, 5);
+
+    Tensor<float> c_m_n(std::vector<std::size_t>{M, N});
+    Tensor<float> y_m_n(std::vector<std::size_t>{M, N});
+
+    auto argument = ReferenceGemmLayernorm::MakeArgument(a_m_k,
+                                                         b_k_n,
+                                                         c_m_n,
+                                                         &gamma_n,
+                                                         &beta_n,
+                                                         y_m_n,
+                                                         PassThrough{},
+                                                         PassThrough{},
+                                                         PassThrough{},
+                                                         1e-4f);
+
+    ReferenceGemmLayernorm::MakeInvoker().Run(argument);
+
+    Tensor<float> ref_c_m_n(std::vector<std::size_t>{M, N});
+    Tensor<float> ref_y_m_n(std::vector<std::size_t>{M, N});
+
+    auto ref_gemm_argument = ReferenceGemm::MakeArgument(
+        a_m_k, b_k_n, ref_c_m_n, PassThrough{}, PassThrough{}, PassThrough{});
+
+    ReferenceGemm::MakeInvoker().Run(ref_gemm_argument);
+
+    auto ref_norm_argument =
+        ReferenceLayernorm::MakeArgument(ref_c_m_n, &gamma_n, &beta_n, ref_y_m_n, {1}, 1e-4f);
+
+    ReferenceLayernorm::MakeInvoker().Run(ref_norm_argument);
+
+    // same order of summation and of the statistics, so the results are identical
+    EXPECT_EQ(c_m_n.mData, ref_c_m_n.mData);
+    EXPECT_EQ(y_m_n.mData, ref_y_m_n.mData);
+
+    // with a bias in the epilogue, added to the input of the layernorm
+    auto argument_bias = ReferenceGemmLayernorm::MakeArgument(
+        a_m_k,
+        b_k_n,
+        c_m_n,
+        nullptr,
+        nullptr,
+        y_m_n,
+        PassThrough{},
+        PassThrough{},
+        PassThrough{},
+        1e-4f,
+        [&](float& c, float acc, std::size_t, std::size_t, std::size_t n) {
+            c = acc + bias_n(n);
+        });
+
+    ReferenceGemmLayernorm::MakeInvoker().Run(argument_bias);
+
+    ref_c_m_n.ForEach([&](auto& self, auto idx) { self(idx) += bias_n(idx[1]); });
+
+    expect_near(y_m_n, naive_norm(ref_c_m_n, nullptr, nullptr, nullptr, {1}, 1e-4, false), 1e-4);
+}
@@ -0,0 +1,208 @@
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "element_wise_operation.hpp"
+#include "host_tensor.hpp"
+#include "reference_batched_gemm.hpp"
+#include "reference_conv_backward_weight.hpp"
+#include "reference_conv_bwd_data.hpp"
+#include "reference_conv_fwd.hpp"
+#include "reference_gemm.hpp"
+#include "reference_softmax.hpp"
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using ck::tensor_operation::host::IndexRange;
+
+namespace {
+
+template <typename T>
+void fill(Tensor<T>& tensor, int seed)
+{
+    for(std::size_t i = 0; i < tensor.mData.size(); ++i)
+    {
+        tensor.mData[i] = static_cast<T>(static_cast<int>((i * 7 + seed) % 11) - 5);
+    }
+}
+
+template <typename T>
+std::vector<std::size_t> index_of(const Tensor<T>& tensor, std::size_t i)
+{
+    const auto& lengths = tensor.mDesc.GetLengths();
+
+    std::vector<std::size_t> idx(lengths.size());
+
+    for(std::size_t d = lengths.size(); d-- > 0;)
+    {
+        idx[d] = i % lengths[d];
+        i /= lengths[d];
+    }
+
+    return idx;
+}
+
+bool in_tile(const std::vector<std::size_t>& idx, const std::vector<IndexRange>& ranges)
+{
+    for(std::size_t d = 0; d < idx.size(); ++d)
+    {
+        if(idx[d] < ranges[d].first || idx[d] >= ranges[d].second)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Checks ComputeAt against Run at every output, and that ComputeTile writes the tile only
+template <typename Invoker, typename Argument, typename T>
+void check_point_evaluation(Argument& argument,
+                            Tensor<T>& out,
+                            const std::vector<IndexRange>& tile,
+                            bool is_output_read = false)
+{
+    const Tensor<T> initial_out(out);
+
+    Invoker{}.Run(argument);
+
+    const Tensor<T> full_out(out);
+
+    out.mData = initial_out.mData;
+
+    for(std::size_t i = 0; i < out.mData.size(); ++i)
+    {
+        const auto idx = index_of(out, i);
+
+        EXPECT_EQ(Invoker::ComputeAt(argument, idx), full_out(idx));
+    }
+
+    // outputs which are read by the op, e.g. for softmax with beta != 0, are left untouched
+    if(!is_output_read)
+    {
+        std::fill(out.mData.begin(), out.mData.end(), T{-100});
+    }
+
+    const Tensor<T> before_tile(out);
+
+    Invoker::ComputeTile(argument, tile);
+
+    for(std::size_t i = 0; i < out.mData.size(); ++i)
+    {
+        const auto idx = index_of(out, i);
+
+        EXPECT_EQ(out(idx), in_tile(idx, tile) ? full_out(idx) : before_tile(idx));
+    }
+}
+
+} // namespace
+
+TEST(ReferencePointEvaluation, Gemm)
+{
+    Tensor<float> a(std::vector<std::size_t>{13, 9});
+    Tensor<float> b(std::vector<std::size_t>{9, 11});
+    Tensor<float> c(std::vector<std::size_t>{13, 11});
+
+    fill(a, 1);
+    fill(b, 2);
+
+    using ReferenceGemm = ck::tensor_operation::host::
+        ReferenceGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    auto argument =
+        ReferenceGemm::MakeArgument(a, b, c, PassThrough{}, PassThrough{}, PassThrough{});
+
+    check_point_evaluation<ReferenceGemm::Invoker>(argument, c, {{4, 13}, {0, 3}});
+}
+
+TEST(ReferencePointEvaluation, BatchedGemm)
+{
+    Tensor<float> a(std::vector<std::size_t>{3, 5, 7});
+    Tensor<float> b(std::vector<std::size_t>{3, 7, 6});
+    Tensor<float> c(std::vector<std::size_t>{3, 5, 6});
+
+    fill(a, 3);
+    fill(b, 4);
+
+    using ReferenceBatchedGemm = ck::tensor_operation::host::
+        ReferenceBatchedGemm<float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    auto argument =
+        ReferenceBatchedGemm::MakeArgument(a, b, c, PassThrough{}, PassThrough{}, PassThrough{});
+
+    check_point_evaluation<ReferenceBatchedGemm::Invoker>(argument, c, {{1, 2}, {2, 5}, {0, 6}});
+}
+
+TEST(ReferencePointEvaluation, ConvFwd2D)
+{
+    // 7x8 input, 3x3 filter, strides 2x1, dilations 1x2, left pads 1x2, right pads 1x1
+    Tensor<float> in(std::vector<std::size_t>{2, 3, 7, 8});
+    Tensor<float> wei(std::vector<std::size_t>{4, 3, 3, 3});
+    Tensor<float> out(std::vector<std::size_t>{2, 4, 4, 7});
+
+    fill(in, 5);
+    fill(wei, 6);
+
+    using ReferenceConvFwd = ck::tensor_operation::host::
+        ReferenceConvFwd<float, float, float, PassThrough, PassThrough, PassThrough, 2>;
+
+    auto argument = ReferenceConvFwd::MakeArgument(
+        in, wei, out, {2, 1}, {1, 2}, {1, 2}, {1, 1}, PassThrough{}, PassThrough{}, PassThrough{});
+
+    check_point_evaluation<ReferenceConvFwd::Invoker>(
+        argument, out, {{1, 2}, {0, 4}, {0, 2}, {5, 7}});
+}
+
+TEST(ReferencePointEvaluation, ConvBwdData2D)
+{
+    Tensor<float> in(std::vector<std::size_t>{2, 3, 7, 8});
+    Tensor<float> wei(std::vector<std::size_t>{4, 3, 3, 3});
+    Tensor<float> out(std::vector<std::size_t>{2, 4, 4, 7});
+
+    fill(wei, 7);
+    fill(out, 8);
+
+    using ReferenceConvBwdData = ck::tensor_operation::host::
+        ReferenceConvBwdData<float, float, float, float, PassThrough, PassThrough, PassThrough, 2>;
+
+    auto argument = ReferenceConvBwdData::MakeArgument(
+        in, wei, out, {2, 1}, {1, 2}, {1, 2}, {1, 1}, PassThrough{}, PassThrough{}, PassThrough{});
+
+    check_point_evaluation<ReferenceConvBwdData::Invoker>(
+        argument, in, {{0, 2}, {1, 3}, {0, 1}, {6, 8}});
+}
+
+TEST(ReferencePointEvaluation, ConvBwdWeight1D)
+{
+    Tensor<float> in(std::vector<std::size_t>{2, 3, 9});
+    Tensor<float> wei(std::vector<std::size_t>{4, 3, 3});
+    Tensor<float> out(std::vector<std::size_t>{2, 4, 4});
+
+    fill(in, 9);
+    fill(out, 10);
+
+    using ReferenceConvBwdWeight = ck::tensor_operation::host::
+        ReferenceConvBwdWeight<float, float, float, PassThrough, PassThrough, PassThrough, 1>;
+
+    auto argument = ReferenceConvBwdWeight::MakeArgument(
+        in, wei, out, {2}, {1}, {1}, {0}, PassThrough{}, PassThrough{}, PassThrough{});
+
+    check_point_evaluation<ReferenceConvBwdWeight::Invoker>(
+        argument, wei, {{3, 4}, {0, 3}, {2, 3}});
+}
+
+TEST(ReferencePointEvaluation, Softmax)
+{
+    Tensor<float> in(std::vector<std::size_t>{3, 4, 5});
+    Tensor<float> out(std::vector<std::size_t>{3, 4, 5});
+
+    fill(in, 11);
+    fill(out, 12);
+
+    using ReferenceSoftmax = ck::tensor_operation::host::ReferenceSoftmax<float, float, float>;
+
+    // reduce over the first and last dimension, out = 2 * softmax(in) + 0.5 * out
+    auto argument = ReferenceSoftmax::MakeArgument(in, out, 2.f, 0.5f, 3, {0, 2});
+
+    check_point_evaluation<ReferenceSoftmax::Invoker>(
+        argument, out, {{0, 3}, {1, 2}, {2, 4}}, true);
+}
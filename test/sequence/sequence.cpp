@@ -0,0 +1,99 @@
+#include <iostream>
+
+#include "config.hpp"
+#include "sequence.hpp"
+#include "math.hpp"
+
+// the sequence algorithms are checked at compile time, running the test only reports success
+
+using namespace ck;
+
+template <typename X, typename Y>
+constexpr bool is_same_sequence = is_same<remove_cvref_t<X>, Y>::value;
+
+struct Greater
+{
+    __host__ __device__ constexpr bool operator()(index_t x, index_t y) const { return x > y; }
+};
+
+// sequence_sort, where values that compare equal are ordered by decreasing id
+using SortLess = sequence_sort<Sequence<2, 1, 2, 0>, math::less<index_t>>;
+
+static_assert(is_same_sequence<SortLess::type, Sequence<0, 1, 2, 2>>, "");
+static_assert(is_same_sequence<SortLess::sorted2unsorted_map, Sequence<3, 1, 2, 0>>, "");
+
+using SortGreater = sequence_sort<Sequence<1, 3, 2>, Greater>;
+
+static_assert(is_same_sequence<SortGreater::type, Sequence<3, 2, 1>>, "");
+static_assert(is_same_sequence<SortGreater::sorted2unsorted_map, Sequence<1, 2, 0>>, "");
+
+using SortGreaterTies = sequence_sort<Sequence<1, 3, 1>, Greater>;
+
+static_assert(is_same_sequence<SortGreaterTies::type, Sequence<3, 1, 1>>, "");
+static_assert(is_same_sequence<SortGreaterTies::sorted2unsorted_map, Sequence<1, 2, 0>>, "");
+
+static_assert(is_same_sequence<sequence_sort<Sequence<>, math::less<index_t>>::type, Sequence<>>,
+              "");
+
+// sequence_unique_sort keeps the first of the equal values in sorted order
+using UniqueSort =
+    sequence_unique_sort<Sequence<2, 1, 2, 0, 1>, math::less<index_t>, math::equal<index_t>>;
+
+static_assert(is_same_sequence<UniqueSort::type, Sequence<0, 1, 2>>, "");
+static_assert(is_same_sequence<UniqueSort::sorted2unsorted_map, Sequence<3, 4, 2>>, "");
+
+// is_valid_sequence_map
+static_assert(is_valid_sequence_map<Sequence<2, 0, 1>>::value, "");
+static_assert(is_valid_sequence_map<Sequence<0>>::value, "");
+static_assert(is_valid_sequence_map<Sequence<>>::value, "");
+static_assert(!is_valid_sequence_map<Sequence<0, 0, 1>>::value, "");
+static_assert(!is_valid_sequence_map<Sequence<0, 3, 1>>::value, "");
+static_assert(!is_valid_sequence_map<Sequence<-1, 0>>::value, "");
+
+// inverse of a map, and reordering by it
+static_assert(is_same_sequence<sequence_map_inverse<Sequence<2, 0, 1>>::type, Sequence<1, 2, 0>>,
+              "");
+static_assert(is_same_sequence<sequence_map_inverse<Sequence<>>::type, Sequence<>>, "");
+static_assert(is_same_sequence<decltype(Sequence<10, 20, 30>::ReorderGivenOld2New(
+                                   Sequence<2, 0, 1>{})),
+                               Sequence<20, 30, 10>>,
+              "");
+
+// reverse inclusive and exclusive scans
+static_assert(is_same_sequence<decltype(reverse_inclusive_scan_sequence(
+                                   Sequence<1, 2, 3>{}, math::plus<index_t>{}, Number<0>{})),
+                               Sequence<6, 5, 3>>,
+              "");
+static_assert(is_same_sequence<decltype(reverse_inclusive_scan_sequence(
+                                   Sequence<2, 3, 4>{}, math::multiplies{}, Number<1>{})),
+                               Sequence<24, 12, 4>>,
+              "");
+static_assert(is_same_sequence<decltype(reverse_inclusive_scan_sequence(
+                                   Sequence<>{}, math::plus<index_t>{}, Number<0>{})),
+                               Sequence<>>,
+              "");
+static_assert(is_same_sequence<decltype(reverse_exclusive_scan_sequence(
+                                   Sequence<1, 2, 3>{}, math::plus<index_t>{}, Number<0>{})),
+                               Sequence<5, 3, 0>>,
+              "");
+
+// modify
+static_assert(is_same_sequence<decltype(Sequence<1, 2, 3>::Modify(Number<1>{}, Number<7>{})),
+                               Sequence<1, 7, 3>>,
+              "");
+static_assert(
+    is_same_sequence<decltype(Sequence<1>::Modify(Number<0>{}, Number<7>{})), Sequence<7>>, "");
+
+// pop_back and reverse, down to the empty sequence
+static_assert(is_same_sequence<decltype(Sequence<1, 2, 3>::PopBack()), Sequence<1, 2>>, "");
+static_assert(is_same_sequence<decltype(Sequence<7>::PopBack()), Sequence<>>, "");
+static_assert(is_same_sequence<decltype(Sequence<1, 2, 3>::Reverse()), Sequence<3, 2, 1>>, "");
+static_assert(is_same_sequence<decltype(Sequence<7>::Reverse()), Sequence<7>>, "");
+static_assert(is_same_sequence<decltype(Sequence<>::Reverse()), Sequence<>>, "");
+
+int main()
+{
+    std::cout << "test_sequence: Pass" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,131 @@
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "host_tensor.hpp"
+#include "verification_policy.hpp"
+
+using namespace ck::utils;
+
+namespace {
+
+// C = A * B, row-major, M x K times K x N
+double gemm_point_reference(const Tensor<float>& a,
+                            const Tensor<float>& b,
+                            const std::vector<std::size_t>& idx)
+{
+    double acc = 0;
+
+    for(std::size_t k = 0; k < a.mDesc.GetLengths()[1]; ++k)
+    {
+        acc += static_cast<double>(a(idx[0], k)) * b(k, idx[1]);
+    }
+
+    return acc;
+}
+
+struct GemmProblem
+{
+    GemmProblem(std::size_t M, std::size_t N, std::size_t K)
+        : a(std::vector<std::size_t>{M, K}),
+          b(std::vector<std::size_t>{K, N}),
+          c(std::vector<std::size_t>{M, N})
+    {
+        for(std::size_t i = 0; i < a.mData.size(); ++i)
+        {
+            a.mData[i] = float(i % 7) - 3;
+        }
+
+        for(std::size_t i = 0; i < b.mData.size(); ++i)
+        {
+            b.mData[i] = float(i % 5) - 2;
+        }
+
+        for(std::size_t m = 0; m < M; ++m)
+        {
+            for(std::size_t n = 0; n < N; ++n)
+            {
+                c(m, n) = gemm_point_reference(a, b, {m, n});
+            }
+        }
+    }
+
+    Tensor<float> a;
+    Tensor<float> b;
+    Tensor<float> c;
+};
+
+} // namespace
+
+TEST(VerificationPolicy, ToleranceScalesWithReduceLength)
+{
+    const ReductionToleranceVerification<float> policy(10000, 1e-5, 1e-6);
+
+    EXPECT_DOUBLE_EQ(policy.GetRtol(), 1e-3);
+    EXPECT_DOUBLE_EQ(policy.GetAtol(), 1e-4);
+
+    Tensor<float> ref(std::vector<std::size_t>{4});
+
+    ref.mData = {0, 1, 2, 3};
+
+    Tensor<float> out(ref);
+
+    out(3) += 1e-3;
+    EXPECT_TRUE(policy.Verify(out, &ref));
+
+    out(3) += 1e-2;
+    EXPECT_FALSE(policy.Verify(out, &ref));
+}
+
+TEST(VerificationPolicy, ExactRejectsAnyDifference)
+{
+    const ExactVerification<float> policy;
+
+    Tensor<float> ref(std::vector<std::size_t>{2, 3});
+
+    ref.mData = {0, 1, 2, 3, 4, 5};
+
+    Tensor<float> out(ref);
+
+    EXPECT_TRUE(policy.Verify(out, &ref));
+
+    out(1, 2) = std::nextafter(out(1, 2), 10.f);
+
+    EXPECT_FALSE(policy.Verify(out, &ref));
+}
+
+TEST(VerificationPolicy, SampledChecksWithoutFullReference)
+{
+    using Policy = SampledVerification<float, float, float>;
+
+    EXPECT_EQ(Policy::GetNumSamples(1e-3, 0.999), 6905u);
+    EXPECT_EQ(Policy::GetNumSamples(0.5, 0.75), 2u);
+    EXPECT_EQ(Policy::GetNumSamples(1.0, 0.999), 1u);
+    EXPECT_EQ(Policy::GetNumSamples(0.5, 0.0), 0u);
+
+    // the number of samples is infinite or undefined
+    EXPECT_THROW(Policy::GetNumSamples(0.0, 0.999), std::runtime_error);
+    EXPECT_THROW(Policy::GetNumSamples(-0.5, 0.999), std::runtime_error);
+    EXPECT_THROW(Policy::GetNumSamples(1e-3, 1.0), std::runtime_error);
+    EXPECT_THROW(Policy::GetNumSamples(1e-3, -0.5), std::runtime_error);
+
+    GemmProblem problem(64, 48, 32);
+
+    const Policy policy(gemm_point_reference, 1e-5, 1e-5, 0.05, 0.999);
+
+    EXPECT_FALSE(policy.NeedsFullReference());
+    EXPECT_TRUE(policy.Verify(problem.c, nullptr, problem.a, problem.b));
+
+    // a wrong corner is always found
+    problem.c(63, 47) += 1;
+    EXPECT_FALSE(policy.Verify(problem.c, nullptr, problem.a, problem.b));
+    problem.c(63, 47) -= 1;
+
+    // as is a wrong row, with high probability
+    for(std::size_t n = 0; n < 48; ++n)
+    {
+        problem.c(17, n) += 1;
+    }
+    EXPECT_FALSE(policy.Verify(problem.c, nullptr, problem.a, problem.b));
+}